@@ -122,6 +122,11 @@
 */
 #define OS_MAX_NUM_OPEN_FILES 50 
 
+/*
+** This is the maximum number of file mappings (OS_FileMap) allowed at a time
+*/
+#define OS_MAX_FILE_MAPS      16
+
 /* 
 ** This defines the filethe input command of OS_ShellOutputToFile
 ** is written to in the VxWorks6 port 
@@ -182,6 +187,38 @@
 */
 #define OS_MAX_TIMERS         5
 
+/*
+** This define sets the maximum number of timers that may be added to time bases with
+** OS_TimerAdd.  On POSIX these timers use no OS resources, they are serviced by the
+** thread of their time base, so they are counted separately from OS_MAX_TIMERS, which
+** limits the signal based OS_TimerCreate.  Arming, cancelling and expiring one of
+** them costs O(log n), so this may be raised into the tens of thousands.
+*/
+#define OS_MAX_TIMEBASE_TIMERS  4096
+
+/*
+** If OS_TIMER_SERVICE_THREAD is defined, timers created with OS_TimerCreate do not use
+** signals.  Each one is a timerfd, and a single timer service thread calls the callbacks
+** in thread context, so they may take OSAL mutexes or call OS_QueuePut, and other tasks
+** are not interrupted by timer signals.  OS_TIMER_SERVICE_PRIORITY is the default OSAL
+** priority of that thread and OS_TIMER_SERVICE_AFFINITY the default CPUs it may run on
+** (bit N = CPU N, 0 = any CPU); OS_TimerSetServiceAttr changes them at run time.
+** OS_TimerGetServiceStats reports its dispatch latency.  Off by default, timers use
+** signals as before.
+*/
+#undef OS_TIMER_SERVICE_THREAD
+#define OS_TIMER_SERVICE_PRIORITY   1
+#define OS_TIMER_SERVICE_AFFINITY   0
+
+/*
+** OS_TIMER_SERVICE_SLACK_NS is the timer slack of the timer service thread and of
+** the time base threads: the kernel may delay their timed waits by up to this many
+** nanoseconds to merge them with other wakeups.  50000 is the Linux default; it is
+** ignored while the threads run with a real-time policy.  OS_TimerSetSlack gives a
+** single timer its own slack.
+*/
+#define OS_TIMER_SERVICE_SLACK_NS   50000
+
 /*
 ** This define sets the maximum number of open directories
 */
@@ -194,6 +231,65 @@
 */
 #define OS_QUEUE_MAX_DEPTH    50
 
+/*
+** These defines size the work queue (thread pool) API.  Every worker is an OSAL task,
+** so OS_MAX_WORK_QUEUES * OS_MAX_WORK_QUEUE_WORKERS also counts against OS_MAX_TASKS.
+** OS_WORK_QUEUE_MAX_DEPTH is the number of items that may be outstanding on one work
+** queue and must be a power of two.
+*/
+#define OS_MAX_WORK_QUEUES          4
+#define OS_MAX_WORK_QUEUE_WORKERS   8
+#define OS_WORK_QUEUE_MAX_DEPTH     256
+#define OS_MAX_WORK_GROUPS          8
+
+/*
+** These defines size the asynchronous file I/O API.  OS_ASYNC_QUEUE_MAX_DEPTH is the
+** most requests one queue may have outstanding.  Queues that do not use io_uring share
+** one work queue of OS_ASYNC_IO_WORKERS tasks, which counts against OS_MAX_WORK_QUEUES.
+*/
+#define OS_MAX_ASYNC_QUEUES         4
+#define OS_ASYNC_QUEUE_MAX_DEPTH    256
+#define OS_ASYNC_IO_WORKERS         4
+#define OS_ASYNC_IO_PRIORITY        50
+
+/*
+** These defines size the buffered stream API.  Each stream allocates its own buffer,
+** of at most OS_STREAM_MAX_BUFFER_SIZE bytes.
+*/
+#define OS_MAX_STREAMS              16
+#define OS_STREAM_MAX_BUFFER_SIZE   (1024 * 1024)
+
+/*
+** These defines size the fiber API.  Each scheduler worker is an OSAL task and counts
+** against OS_MAX_TASKS, fibers do not.  A fiber costs one table entry plus its stack,
+** so OS_MAX_FIBERS may be raised into the tens of thousands.
+*/
+#define OS_MAX_FIBERS               1024
+#define OS_MAX_FIBER_SCHEDS         4
+#define OS_MAX_FIBER_SCHED_WORKERS  8
+#define OS_MAX_FIBER_SEMS           256
+#define OS_MAX_FIBER_QUEUES         256
+#define OS_FIBER_DEFAULT_STACK_SIZE 0x4000
+
+/*
+ * If OSAL_DETERMINISTIC_MODE is defined, OS_API_Init calls OS_DeterministicModeEnable.
+ * All memory of the process is locked, OS_DETERMINISTIC_HEAP_SIZE bytes of heap are
+ * faulted in and kept, and every task prefaults its whole stack when it starts.  This
+ * needs permission to lock memory (CAP_IPC_LOCK or a large enough RLIMIT_MEMLOCK).
+ */
+#undef OSAL_DETERMINISTIC_MODE
+#define OS_DETERMINISTIC_HEAP_SIZE  (4 * 1024 * 1024)
+
+/*
+ * If OS_MONOTONIC_TSC is defined, OS_GetMonotonicNs and OS_GetMonotonicTime read the x86 time
+ * stamp counter instead of calling clock_gettime(CLOCK_MONOTONIC).  OS_API_Init calibrates it
+ * against CLOCK_MONOTONIC for OS_MONOTONIC_TSC_CALIBRATE_MSEC and uses it only if the CPU has an
+ * invariant TSC.  It then runs at the calibrated rate, which may differ from CLOCK_MONOTONIC by
+ * a few ppm, so leave it undefined if these timestamps are compared with timer deadlines.
+ */
+#undef OS_MONOTONIC_TSC
+#define OS_MONOTONIC_TSC_CALIBRATE_MSEC  20
+
 /*
  * If OS_DEBUG_PRINTF is defined, this will enable the "OS_DEBUG" statements in the code
  * This should be left disabled in a normal build as it may affect real time performance as
@@ -210,6 +306,9 @@
  *  - If the user does not have permission to create elevated priority tasks, then the tasks will
  *    be created at the default priority (no error).  Note this behavior can also be forced by the
  *    OSAL_DEBUG_DISABLE_TASK_PRIORITIES macro below.
+ *    The posix implementation checks CAP_SYS_NICE and RLIMIT_RTPRIO at OS_API_Init, so a non-root
+ *    process with either one still gets real-time priorities.  Without them, tasks run SCHED_OTHER
+ *    with the OSAL priority mapped onto a nice value.
  *
  * Leaving this undefined will produce the default behavior, which is to return errors to the caller
  * for these conditions.
@@ -129,6 +129,80 @@ int32 OS_write (int32  filedes, void *buffer, uint32 nbytes)
     return (OS_FS_UNIMPLEMENTED);
 } /* end OS_write */
 
+/*--------------------------------------------------------------------------------------
+    Name: OS_pread
+    
+    Purpose: reads up to nbytes from a file starting at offset, and puts them into
+             buffer, leaving the file offset unchanged.
+
+    Notes: Not implemented. The file API is not available on this port.
+---------------------------------------------------------------------------------------*/
+int32 OS_pread  (int32  filedes, void *buffer, uint32 nbytes, uint64 offset)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_pread */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_pwrite
+
+    Purpose: writes up to nbytes of buffer to a file starting at offset, leaving the
+             file offset unchanged.
+
+    Notes: Not implemented. The file API is not available on this port.
+---------------------------------------------------------------------------------------*/
+int32 OS_pwrite (int32  filedes, void *buffer, uint32 nbytes, uint64 offset)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_pwrite */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_readv
+
+    Purpose: reads from a file into iovcnt buffers, filling each one in turn.
+
+    Notes: Not implemented. The file API is not available on this port.
+---------------------------------------------------------------------------------------*/
+int32 OS_readv (int32  filedes, const os_iovec_t *iov, uint32 iovcnt)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_readv */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_writev
+
+    Purpose: writes iovcnt buffers to a file, one after the other.
+
+    Notes: Not implemented. The file API is not available on this port.
+---------------------------------------------------------------------------------------*/
+int32 OS_writev (int32  filedes, const os_iovec_t *iov, uint32 iovcnt)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_writev */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_preadv
+
+    Purpose: as OS_readv, starting at offset and leaving the file offset unchanged.
+
+    Notes: Not implemented. The file API is not available on this port.
+---------------------------------------------------------------------------------------*/
+int32 OS_preadv (int32  filedes, const os_iovec_t *iov, uint32 iovcnt, uint64 offset)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_preadv */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_pwritev
+
+    Purpose: as OS_writev, starting at offset and leaving the file offset unchanged.
+
+    Notes: Not implemented. The file API is not available on this port.
+---------------------------------------------------------------------------------------*/
+int32 OS_pwritev (int32  filedes, const os_iovec_t *iov, uint32 iovcnt, uint64 offset)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_pwritev */
+
 /*--------------------------------------------------------------------------------------
     Name: OS_chmod
 
@@ -158,6 +232,30 @@ int32 OS_stat   (const char *path, os_fstat_t  *filestats)
     return (OS_FS_UNIMPLEMENTED);
 } /* end OS_stat */
 
+/*--------------------------------------------------------------------------------------
+    Name: OS_fstat
+
+    Purpose: returns information about an open file.
+
+    Notes: Not implemented. The file API is not available on this port.
+---------------------------------------------------------------------------------------*/
+int32 OS_fstat (int32 filedes, os_fstat_t *filestats)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_fstat */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FDGetSize
+
+    Purpose: returns the size of an open file.
+
+    Notes: Not implemented. The file API is not available on this port.
+---------------------------------------------------------------------------------------*/
+int32 OS_FDGetSize (int32 filedes, uint64 *size)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_FDGetSize */
+
 /*--------------------------------------------------------------------------------------
     Name: OS_lseek
 
@@ -173,6 +271,190 @@ int32 OS_lseek  (int32  filedes, int32 offset, uint32 whence)
     return (OS_FS_UNIMPLEMENTED);
 } /* end OS_lseek */
 
+/*--------------------------------------------------------------------------------------
+    Name: OS_lseek64
+
+    Purpose: sets the read/write pointer of a file, for files larger than 2 GB.
+
+    Notes: Not implemented. The file API is not available on this port.
+---------------------------------------------------------------------------------------*/
+int32 OS_lseek64 (int32 filedes, int64 offset, uint32 whence, uint64 *new_offset)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_lseek64 */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FileMap
+
+    Purpose: maps part of an open file into memory.
+
+    Notes: Not implemented. The file API is not available on this port.
+---------------------------------------------------------------------------------------*/
+int32 OS_FileMap (int32 filedes, uint64 offset, uint32 length, uint32 access, void **addr)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_FileMap */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FileUnmap
+
+    Purpose: removes a mapping made by OS_FileMap.
+
+    Notes: Not implemented. The file API is not available on this port.
+---------------------------------------------------------------------------------------*/
+int32 OS_FileUnmap (void *addr)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_FileUnmap */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FileSync
+
+    Purpose: writes changes made through a mapping back to the file.
+
+    Notes: Not implemented. The file API is not available on this port.
+---------------------------------------------------------------------------------------*/
+int32 OS_FileSync (void *addr)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_FileSync */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_AsyncQueueCreate
+
+    Purpose: creates an asynchronous file I/O queue.
+
+    Notes: Not implemented. The file API is not available on this port.
+---------------------------------------------------------------------------------------*/
+int32 OS_AsyncQueueCreate (uint32 *queue_id, uint32 depth, uint32 flags)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_AsyncQueueCreate */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_AsyncQueueDelete
+
+    Purpose: deletes an asynchronous file I/O queue.
+
+    Notes: Not implemented. The file API is not available on this port.
+---------------------------------------------------------------------------------------*/
+int32 OS_AsyncQueueDelete (uint32 queue_id)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_AsyncQueueDelete */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_AsyncRead
+
+    Purpose: queues a read from an open file.
+
+    Notes: Not implemented. The file API is not available on this port.
+---------------------------------------------------------------------------------------*/
+int32 OS_AsyncRead (uint32 queue_id, int32 filedes, void *buffer, uint32 nbytes,
+                    uint64 offset, void *user_arg)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_AsyncRead */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_AsyncWrite
+
+    Purpose: queues a write to an open file.
+
+    Notes: Not implemented. The file API is not available on this port.
+---------------------------------------------------------------------------------------*/
+int32 OS_AsyncWrite (uint32 queue_id, int32 filedes, void *buffer, uint32 nbytes,
+                     uint64 offset, void *user_arg)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_AsyncWrite */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_AsyncWait
+
+    Purpose: collects the requests of a queue that have completed.
+
+    Notes: Not implemented. The file API is not available on this port.
+---------------------------------------------------------------------------------------*/
+int32 OS_AsyncWait (uint32 queue_id, os_async_completion_t *completions, uint32 max_count,
+                    int32 msecs)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_AsyncWait */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_StreamOpen
+
+    Purpose: creates a buffered stream on an open file.
+
+    Notes: Not implemented. The file API is not available on this port.
+---------------------------------------------------------------------------------------*/
+int32 OS_StreamOpen (uint32 *stream_id, int32 filedes, uint32 buffer_size,
+                     uint32 flush_size, uint32 flush_msec)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_StreamOpen */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_StreamWrite
+
+    Purpose: adds data to a buffered stream.
+
+    Notes: Not implemented. The file API is not available on this port.
+---------------------------------------------------------------------------------------*/
+int32 OS_StreamWrite (uint32 stream_id, const void *buffer, uint32 nbytes)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_StreamWrite */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_StreamFlush
+
+    Purpose: writes out the data buffered by a stream.
+
+    Notes: Not implemented. The file API is not available on this port.
+---------------------------------------------------------------------------------------*/
+int32 OS_StreamFlush (uint32 stream_id)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_StreamFlush */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_StreamFlushAll
+
+    Purpose: writes out the data buffered by all the streams.
+
+    Notes: Not implemented. The file API is not available on this port.
+---------------------------------------------------------------------------------------*/
+int32 OS_StreamFlushAll (void)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_StreamFlushAll */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_StreamClose
+
+    Purpose: flushes and frees a buffered stream.
+
+    Notes: Not implemented. The file API is not available on this port.
+---------------------------------------------------------------------------------------*/
+int32 OS_StreamClose (uint32 stream_id)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_StreamClose */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_StreamGetInfo
+
+    Purpose: fills in the state of a buffered stream.
+
+    Notes: Not implemented. The file API is not available on this port.
+---------------------------------------------------------------------------------------*/
+int32 OS_StreamGetInfo (uint32 stream_id, os_stream_prop_t *stream_prop)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_StreamGetInfo */
+
 /*--------------------------------------------------------------------------------------
     Name: OS_remove
 
@@ -355,6 +637,31 @@ void  OS_rewinddir (os_dirp_t directory )
 {
 } /* end OS_rewinddir */
 
+/*--------------------------------------------------------------------------------------
+    Name: OS_DirReadBatch
+
+    Purpose: reads several directory entries with their status at once.
+
+    Notes: Not implemented. The file API is not available on this port.
+---------------------------------------------------------------------------------------*/
+int32 OS_DirReadBatch (os_dirp_t directory, os_dirent_stat_t *entries, uint32 max_entries)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_DirReadBatch */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_DirWalk
+
+    Purpose: reports every object below a directory.
+
+    Notes: Not implemented. The file API is not available on this port.
+---------------------------------------------------------------------------------------*/
+int32 OS_DirWalk (const char *path, OS_DirWalkCallback_t callback, void *callback_arg,
+                  uint32 flags)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_DirWalk */
+
 /*--------------------------------------------------------------------------------------
     Name: OS_readdir
 
@@ -374,6 +374,30 @@ int32 OS_TimerSet(uint32 timer_id, uint32 start_time, uint32 interval_time)
    return OS_SUCCESS;
 }
 
+/******************************************************************************
+**  Function:  OS_TimerSetNs
+**
+**  Purpose:  OS_TimerSet with nanosecond times.  The host timers of this port
+**            work in microseconds, so the times are rounded up to those and
+**            must fit in the 32 bit microseconds of OS_TimerSet.
+**
+**  Return:   OS_TIMER_ERR_INVALID_ARGS if a time is too long for OS_TimerSet,
+**            otherwise as OS_TimerSet
+*/
+int32 OS_TimerSetNs(uint32 timer_id, uint64 start_time_ns, uint64 interval_time_ns)
+{
+   uint64 start_time = (start_time_ns + 999) / 1000;
+   uint64 interval_time = (interval_time_ns + 999) / 1000;
+
+   if ( start_time > 0xFFFFFFFF || interval_time > 0xFFFFFFFF )
+   {
+      return OS_TIMER_ERR_INVALID_ARGS;
+   }
+
+   return OS_TimerSet(timer_id, (uint32)start_time, (uint32)interval_time);
+
+}/* end OS_TimerSetNs */
+
 /******************************************************************************
 **  Function:  OS_TimerDelete
 **
@@ -512,6 +536,10 @@ int32 OS_TimerGetInfo (uint32 timer_id, OS_timer_prop_t *timer_prop)
     timer_prop -> start_time    = OS_timer_table[timer_id].start_time;
     timer_prop -> interval_time = OS_timer_table[timer_id].interval_time;
     timer_prop -> accuracy      = OS_timer_table[timer_id].accuracy;
+    timer_prop -> start_time_ns    = (uint64)OS_timer_table[timer_id].start_time * 1000;
+    timer_prop -> interval_time_ns = (uint64)OS_timer_table[timer_id].interval_time * 1000;
+    timer_prop -> accuracy_ns      = (OS_timer_table[timer_id].accuracy > 0xFFFFFFFF / 1000) ?
+          0xFFFFFFFF : OS_timer_table[timer_id].accuracy * 1000;
 
     OS_TableUnlock( OS_timer_table_mut );
 
@@ -552,3 +580,18 @@ int32 OS_TimerAdd(uint32 *timer_id, const char *timer_name, uint32 timebase_id,
 {
     return OS_ERR_NOT_IMPLEMENTED;
 }
+
+int32 OS_TimerGetServiceStats (OS_timer_service_stats_t *stats)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_TimerSetServiceAttr (uint32 priority, uint32 affinity_mask)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_TimerSetSlack(uint32 timer_id, uint32 slack_usec)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
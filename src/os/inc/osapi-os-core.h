@@ -57,6 +57,8 @@ typedef struct
     uint32 stack_size;
     uint32 priority;
     uint32 OStask_id;
+    uint32 policy;           /* OS_SCHED_ policy the task really runs under */
+    int32  os_priority;      /* native priority, or nice value under OS_SCHED_OTHER */
 }OS_task_prop_t;
     
 /* queues */
@@ -90,7 +92,28 @@ typedef struct
 }OS_mut_sem_prop_t;
 
 
-/* struct for OS_GetLocalTime() */
+/* Work Queues */
+typedef struct
+{
+    char   name [OS_MAX_API_NAME];
+    uint32 creator;
+    uint32 num_workers;
+    uint32 pending;          /* items submitted but not yet completed */
+    uint32 completed;        /* items completed since creation */
+    uint32 steals;           /* items a worker took from another worker's deque */
+}OS_work_queue_prop_t;
+
+/* Fiber Schedulers */
+typedef struct
+{
+    char   name [OS_MAX_API_NAME];
+    uint32 creator;
+    uint32 num_workers;
+    uint32 fibers;           /* fibers created and not yet finished */
+    uint32 switches;         /* times a worker switched to a fiber since creation */
+}OS_fiber_sched_prop_t;
+
+/* struct for OS_GetLocalTime() and OS_GetMonotonicTime() */
 
 typedef struct 
 { 
@@ -98,6 +121,23 @@ typedef struct
     uint32 microsecs;
 }OS_time_t; 
 
+/* task runtime statistics, see OS_TaskGetStats() */
+typedef struct
+{
+    char      name [OS_MAX_API_NAME];
+    uint32    task_id;
+    OS_time_t cpu_time;               /* CPU time consumed by the task */
+    uint32    voluntary_switches;     /* the task blocked or yielded */
+    uint32    involuntary_switches;   /* the task was preempted */
+    int32     current_cpu;            /* CPU the task last ran on, -1 if not known */
+    uint32    stack_size;
+    uint32    stack_high_water;       /* deepest stack use seen in bytes, 0 if not measured */
+    uint32    period_overruns;        /* releases missed by a periodic task */
+    uint32    worst_lateness_usec;    /* worst wakeup delay of a periodic task after its release */
+    uint32    minor_faults;           /* page faults served without I/O */
+    uint32    major_faults;           /* page faults that needed I/O */
+}OS_task_stats_t;
+
 /* heap info */
 typedef struct
 {
@@ -126,6 +166,47 @@ typedef char os_err_name_t[OS_ERROR_NAME_LENGTH];
 typedef void osal_task;
 typedef osal_task ((*osal_task_entry)(void));
 
+/*
+** Task entry point that receives the argument given to OS_TaskCreateEx()
+*/
+typedef osal_task ((*osal_task_entry_arg)(void *arg));
+
+/*
+** Scheduling policies that may be requested through OS_task_attr_t
+** OS_SCHED_DEFAULT lets the implementation pick its usual policy
+*/
+#define OS_SCHED_DEFAULT   0
+#define OS_SCHED_FIFO      1
+#define OS_SCHED_RR        2
+#define OS_SCHED_OTHER     3
+
+/*
+** Optional attributes for OS_TaskCreateEx()
+** A zeroed structure requests the same behavior as OS_TaskCreate()
+*/
+typedef struct
+{
+    uint32 affinity_mask;    /* bit N set allows the task to run on CPU N, 0 = any CPU */
+    uint32 policy;           /* one of the OS_SCHED_ values */
+    void   *stack_pointer;   /* caller supplied stack of stack_size bytes, NULL = allocate */
+    uint32 guard_size;       /* size of the stack guard area in bytes, 0 = OS default */
+}OS_task_attr_t;
+
+/*
+** Work item function executed by a work queue
+*/
+typedef void (*OS_WorkFunc_t)(void *arg);
+
+/*
+** Entry point of a fiber
+*/
+typedef void (*OS_FiberFunc_t)(void *arg);
+
+/*
+** Receives each snapshot taken by the task statistics monitor
+*/
+typedef void (*OS_TaskStatsCallback_t)(const OS_task_stats_t *task_stats, uint32 count);
+
 /*
 ** Typedef for general purpose OSAL callback functions
 ** This may be used by multiple APIS
@@ -186,16 +267,69 @@ int32 OS_TaskCreate            (uint32 *task_id, const char *task_name,
                                 uint32 *stack_pointer,
                                 uint32 stack_size,
                                 uint32 priority, uint32 flags);
+int32 OS_TaskCreateEx          (uint32 *task_id, const char *task_name,
+                                osal_task_entry_arg function_pointer,
+                                void *entry_arg,
+                                uint32 stack_size,
+                                uint32 priority, uint32 flags,
+                                const OS_task_attr_t *attr);
 
 int32 OS_TaskDelete            (uint32 task_id); 
 void OS_TaskExit               (void);
 int32 OS_TaskInstallDeleteHandler(osal_task_entry function_pointer);
 int32 OS_TaskDelay             (uint32 millisecond);
+int32 OS_TaskPeriodicInit      (uint32 period_usec);
+int32 OS_TaskWaitNextPeriod    (void);
 int32 OS_TaskSetPriority       (uint32 task_id, uint32 new_priority);
 int32 OS_TaskRegister          (void);
 uint32 OS_TaskGetId            (void);
 int32 OS_TaskGetIdByName       (uint32 *task_id, const char *task_name);
 int32 OS_TaskGetInfo           (uint32 task_id, OS_task_prop_t *task_prop);          
+int32 OS_TaskGetStats          (uint32 task_id, OS_task_stats_t *task_stats);
+int32 OS_TaskGetStatsAll       (OS_task_stats_t *task_stats, uint32 max_count, uint32 *count);
+int32 OS_TaskStatsMonitorStart (uint32 period_msec, uint32 priority,
+                                OS_TaskStatsCallback_t callback);
+int32 OS_TaskStatsMonitorStop  (void);
+
+/*
+** Work Queue API
+*/
+
+int32 OS_WorkQueueCreate       (uint32 *queue_id, const char *queue_name, uint32 num_workers,
+                                uint32 priority, uint32 affinity_mask);
+int32 OS_WorkQueueDelete       (uint32 queue_id);
+int32 OS_WorkQueueGetIdByName  (uint32 *queue_id, const char *queue_name);
+int32 OS_WorkQueueGetInfo      (uint32 queue_id, OS_work_queue_prop_t *queue_prop);
+int32 OS_WorkSubmit            (uint32 queue_id, OS_WorkFunc_t function, void *arg, uint32 *work_id);
+int32 OS_WorkSubmitGroup       (uint32 queue_id, uint32 group, OS_WorkFunc_t function, void *arg);
+int32 OS_WorkWait              (uint32 queue_id, uint32 work_id);
+int32 OS_WorkGroupWait         (uint32 queue_id, uint32 group);
+
+/*
+** Fiber API
+** Fibers are cooperative user space tasks run by the worker tasks of a fiber scheduler.
+** Fiber semaphores and queues block a fiber without blocking its worker.
+*/
+
+int32 OS_FiberSchedCreate      (uint32 *sched_id, const char *sched_name, uint32 num_workers,
+                                uint32 priority, uint32 affinity_mask);
+int32 OS_FiberSchedDelete      (uint32 sched_id);
+int32 OS_FiberSchedGetInfo     (uint32 sched_id, OS_fiber_sched_prop_t *sched_prop);
+int32 OS_FiberCreate           (uint32 *fiber_id, uint32 sched_id, OS_FiberFunc_t function,
+                                void *arg, uint32 stack_size);
+void  OS_FiberExit             (void);
+int32 OS_FiberYield            (void);
+int32 OS_FiberDelay            (uint32 millisecond);
+int32 OS_FiberGetId            (uint32 *fiber_id);
+int32 OS_FiberSemCreate        (uint32 *sem_id, uint32 sem_initial_value);
+int32 OS_FiberSemDelete        (uint32 sem_id);
+int32 OS_FiberSemGive          (uint32 sem_id);
+int32 OS_FiberSemTake          (uint32 sem_id);
+int32 OS_FiberQueueCreate      (uint32 *queue_id, uint32 queue_depth, uint32 data_size);
+int32 OS_FiberQueueDelete      (uint32 queue_id);
+int32 OS_FiberQueuePut         (uint32 queue_id, const void *data, uint32 size);
+int32 OS_FiberQueueGet         (uint32 queue_id, void *data, uint32 size, uint32 *size_copied,
+                                int32 timeout);
 
 /*
 ** Message Queue API
@@ -256,6 +390,8 @@ int32 OS_Milli2Ticks           (uint32 milli_seconds);
 int32 OS_Tick2Micros           (void);
 int32  OS_GetLocalTime         (OS_time_t *time_struct);
 int32  OS_SetLocalTime         (OS_time_t *time_struct);  
+int32  OS_GetMonotonicTime     (OS_time_t *time_struct);
+int32  OS_GetMonotonicNs       (uint64 *nsecs);
 
 /*
 ** Exception API
@@ -307,6 +443,11 @@ int32 OS_ShMemGetIdByName   (uint32 *ShMemId, const char *SegName );
 */
 int32 OS_HeapGetInfo       (OS_heap_prop_t *heap_prop);
 
+/*
+** Deterministic latency mode: lock memory and prefault stacks and heap
+*/
+int32 OS_DeterministicModeEnable (uint32 heap_reserve_size);
+
 /*
 ** API for useful debugging function
 */
@@ -129,10 +129,25 @@
 #define OS_WRITE_ONLY       1
 #define OS_READ_WRITE       2
 
+/*
+** Hints that may be or'ed into the access argument of OS_FileMap
+** to say how the mapping will be used
+*/
+#define OS_FILEMAP_SEQUENTIAL   0x0100  /* read mostly front to back */
+#define OS_FILEMAP_RANDOM       0x0200  /* read in no useful order, do not read ahead */
+#define OS_FILEMAP_WILLNEED     0x0400  /* start reading the whole mapping in now */
+
 #define OS_SEEK_SET         0
 #define OS_SEEK_CUR         1
 #define OS_SEEK_END         2
 
+/*
+** Largest count moved by one OS_read, OS_write, OS_pread or OS_pwrite call.
+** Larger requests are cut short, as a host may do anyway, so the count of bytes
+** moved never overflows the int32 result.  This is the limit Linux applies.
+*/
+#define OS_MAX_IO_SIZE      0x7FFFF000
+
 #define OS_CHK_ONLY         0
 #define OS_REPAIR           1
 
@@ -154,6 +169,31 @@
 #define OS_FS_PHYS_NAME_LEN 64
 #define OS_FS_VOL_NAME_LEN  32
 
+/*
+** Most segments one OS_readv/OS_writev call may take
+*/
+#define OS_FS_MAX_IOVEC     16
+
+/*
+** Flags for OS_AsyncQueueCreate, to choose how the requests are carried out.
+** Without either flag io_uring is used where the host has it, and worker tasks otherwise.
+*/
+#define OS_ASYNC_IO_URING   0x0001
+#define OS_ASYNC_THREADS    0x0002
+
+/*
+** Types of the entries returned by OS_DirReadBatch.  Symbolic links are not
+** followed, and are OS_DIRENT_TYPE_OTHER like devices, pipes and sockets.
+*/
+#define OS_DIRENT_TYPE_FILE     1
+#define OS_DIRENT_TYPE_DIR      2
+#define OS_DIRENT_TYPE_OTHER    3
+
+/*
+** Flags for OS_DirWalk
+*/
+#define OS_DIRWALK_PARALLEL     0x0001  /* scan directories on several tasks at once */
+
 
 /*
 ** Defines for File System Calls
@@ -223,6 +263,38 @@ typedef struct
     uint8   IsValid;                /* Whether or not this entry is valid */
 }OS_FDTableEntry;
 
+/*
+** One segment of a scatter/gather transfer for OS_readv/OS_writev
+*/
+typedef struct
+{
+   void    *buffer;                /* Start of the segment */
+   uint32   length;                /* Bytes in the segment */
+} os_iovec_t;
+
+/*
+** One completed request, as returned by OS_AsyncWait
+*/
+typedef struct
+{
+   void    *user_arg;              /* As given to OS_AsyncRead/OS_AsyncWrite */
+   int32    result;                /* Bytes transferred, or OS_FS_ERROR */
+} os_async_completion_t;
+
+/*
+** The state of a buffered stream, as returned by OS_StreamGetInfo
+*/
+typedef struct
+{
+   int32    filedes;               /* File the stream writes to */
+   uint32   buffer_size;           /* Bytes the stream can hold */
+   uint32   flush_size;            /* Buffered bytes that trigger a write */
+   uint32   flush_msec;            /* Longest time data stays buffered, 0 for no limit */
+   uint32   buffered;              /* Bytes waiting to be written */
+   uint32   write_calls;           /* Writes made to the file so far */
+   uint64   bytes_written;         /* Bytes written to the file so far */
+} os_stream_prop_t;
+
 typedef struct
 {
    uint32   MaxFds;                /* Total number of file descriptors */
@@ -237,6 +309,22 @@ typedef struct
 typedef struct stat         os_fstat_t;
 typedef DIR*                os_dirp_t;
 typedef struct dirent       os_dirent_t;
+
+/* One directory entry with the status information a catalog usually needs */
+typedef struct
+{
+   char     Name[OS_MAX_PATH_LEN];  /* Name of the entry within its directory */
+   uint32   Type;                   /* OS_DIRENT_TYPE_FILE, _DIR or _OTHER */
+   uint64   Size;                   /* Size in bytes */
+   int64    MTime;                  /* Last modification, in seconds since the epoch */
+} os_dirent_stat_t;
+
+/*
+ * Called by OS_DirWalk for each entry found. dir_path is the path of the directory
+ * that holds the entry. Any return value but OS_SUCCESS stops the walk.
+ */
+typedef int32 (*OS_DirWalkCallback_t)(const char *dir_path, const os_dirent_stat_t *entry,
+                                      void *arg);
 /* still don't know what this should be*/
 typedef unsigned long int   os_fshealth_t; 
 
@@ -270,15 +358,45 @@ int32           OS_open   (const char *path,  int32 access,  uint32 mode);
 int32           OS_close  (int32  filedes);
 
 /*
- * Reads nbytes bytes from file into buffer
+ * Reads nbytes bytes from file into buffer.
+ * One call moves at most OS_MAX_IO_SIZE bytes, so the count always fits the int32 result.
 */
 int32           OS_read   (int32  filedes, void *buffer, uint32 nbytes);
 
 /*
- * Write nybytes bytes of buffer into the file
+ * Write nybytes bytes of buffer into the file.
+ * One call moves at most OS_MAX_IO_SIZE bytes, so the count always fits the int32 result.
 */
 int32           OS_write  (int32  filedes, void *buffer, uint32 nbytes);
 
+/*
+ * Reads nbytes bytes from file into buffer, starting at offset.
+ * The file offset used by OS_read/OS_write/OS_lseek is not changed.
+*/
+int32           OS_pread  (int32  filedes, void *buffer, uint32 nbytes, uint64 offset);
+
+/*
+ * Writes nbytes bytes of buffer into the file, starting at offset.
+ * The file offset used by OS_read/OS_write/OS_lseek is not changed.
+*/
+int32           OS_pwrite (int32  filedes, void *buffer, uint32 nbytes, uint64 offset);
+
+/*
+ * Reads from the file into iovcnt buffers in turn, filling each before the next
+*/
+int32           OS_readv  (int32  filedes, const os_iovec_t *iov, uint32 iovcnt);
+
+/*
+ * Writes iovcnt buffers in turn into the file as one transfer
+*/
+int32           OS_writev (int32  filedes, const os_iovec_t *iov, uint32 iovcnt);
+
+/*
+ * As OS_readv/OS_writev, starting at offset and leaving the file offset unchanged
+*/
+int32           OS_preadv (int32  filedes, const os_iovec_t *iov, uint32 iovcnt, uint64 offset);
+int32           OS_pwritev(int32  filedes, const os_iovec_t *iov, uint32 iovcnt, uint64 offset);
+
 /*
  * Changes the permissions of a file
 */
@@ -289,11 +407,110 @@ int32           OS_chmod  (const char *path, uint32 access);
 */
 int32           OS_stat   (const char *path, os_fstat_t  *filestats);
 
+/*
+ * Returns file status information for an open file in filestats
+*/
+int32           OS_fstat  (int32  filedes, os_fstat_t  *filestats);
+
+/*
+ * Returns the size in bytes of an open file
+*/
+int32           OS_FDGetSize (int32 filedes, uint64 *size);
+
 /*
  * Seeks to the specified position of an open file 
 */
 int32           OS_lseek  (int32  filedes, int32 offset, uint32 whence);
 
+/*
+ * Seeks to the specified position of an open file, for files larger than 2 GB.
+ * The new offset from the beginning of the file is returned in new_offset.
+*/
+int32           OS_lseek64(int32  filedes, int64 offset, uint32 whence, uint64 *new_offset);
+
+/*
+ * Maps length bytes of an open file, starting at offset, into memory.
+ * access is OS_READ_ONLY or OS_READ_WRITE; a mapping needs read access, so
+ * OS_WRITE_ONLY is refused.
+ * The mapping is shared with the file and with other processes mapping it.
+ * It is removed by OS_FileUnmap, or when the file is closed.
+*/
+int32           OS_FileMap   (int32 filedes, uint64 offset, uint32 length, uint32 access, void **addr);
+
+/*
+ * Removes a mapping made by OS_FileMap
+*/
+int32           OS_FileUnmap (void *addr);
+
+/*
+ * Writes changes made through a mapping back to the file
+*/
+int32           OS_FileSync  (void *addr);
+
+/*
+ * Creates a queue for asynchronous reads and writes, with room for depth requests
+*/
+int32           OS_AsyncQueueCreate (uint32 *queue_id, uint32 depth, uint32 flags);
+
+/*
+ * Deletes an asynchronous I/O queue, once the requests still on it have completed
+*/
+int32           OS_AsyncQueueDelete (uint32 queue_id);
+
+/*
+ * Queues a read of nbytes bytes from the file into buffer, starting at offset.
+ * The buffer must stay valid until the completion has been collected by OS_AsyncWait.
+ * The file may be closed meanwhile; its host file stays open until the request completes.
+*/
+int32           OS_AsyncRead  (uint32 queue_id, int32 filedes, void *buffer, uint32 nbytes,
+                               uint64 offset, void *user_arg);
+
+/*
+ * Queues a write of nbytes bytes of buffer into the file, starting at offset
+*/
+int32           OS_AsyncWrite (uint32 queue_id, int32 filedes, void *buffer, uint32 nbytes,
+                               uint64 offset, void *user_arg);
+
+/*
+ * Waits up to msecs (or OS_PEND/OS_CHECK) for requests to complete, and returns
+ * the number of completions stored in the array
+*/
+int32           OS_AsyncWait  (uint32 queue_id, os_async_completion_t *completions,
+                               uint32 max_count, int32 msecs);
+
+/*
+ * Creates a buffered stream on top of an open file.  Small writes are gathered in a
+ * buffer of buffer_size bytes, written out once flush_size bytes (0 for a full buffer)
+ * are waiting, or flush_msec after the first of them (0 for no limit).
+*/
+int32           OS_StreamOpen     (uint32 *stream_id, int32 filedes, uint32 buffer_size,
+                                   uint32 flush_size, uint32 flush_msec);
+
+/*
+ * Adds nbytes bytes of buffer to the stream, and returns nbytes
+*/
+int32           OS_StreamWrite    (uint32 stream_id, const void *buffer, uint32 nbytes);
+
+/*
+ * Writes out the data buffered by the stream
+*/
+int32           OS_StreamFlush    (uint32 stream_id);
+
+/*
+ * Writes out the data buffered by all the streams
+*/
+int32           OS_StreamFlushAll (void);
+
+/*
+ * Flushes and releases the stream.  The file stays open.
+*/
+int32           OS_StreamClose    (uint32 stream_id);
+
+/*
+ * Fills in the state of the stream
+*/
+int32           OS_StreamGetInfo  (uint32 stream_id, os_stream_prop_t *stream_prop);
+
 /*
  * Removes a file from the file system
 */
@@ -305,12 +522,12 @@ int32           OS_remove (const char *path);
 int32           OS_rename (const char *old_filename, const char *new_filename);
 
 /* 
- * copies a single file from src to dest
+ * copies a single file from src to dest, into dest if it is a directory
 */
 int32 OS_cp (const char *src, const char *dest);
 
 /* 
- * moves a single file from src to dest
+ * moves a single file from src to dest, into dest if it is a directory
 */
 int32 OS_mv (const char *src, const char *dest);
 
@@ -364,6 +581,20 @@ void           OS_rewinddir(os_dirp_t directory);
 */
 os_dirent_t *   OS_readdir (os_dirp_t directory);
 
+/*
+ * Reads up to max_entries objects from the directory, with their type, size and
+ * modification time. Returns the number read, 0 at the end of the directory.
+*/
+int32           OS_DirReadBatch (os_dirp_t directory, os_dirent_stat_t *entries, uint32 max_entries);
+
+/*
+ * Calls callback for every object below path, descending into subdirectories.
+ * With OS_DIRWALK_PARALLEL several directories are scanned at once, and callback
+ * may be called from several tasks at the same time.
+*/
+int32           OS_DirWalk (const char *path, OS_DirWalkCallback_t callback, void *callback_arg,
+                            uint32 flags);
+
 /*
  * Removes an empty directory from the file system.
 */
@@ -50,6 +50,9 @@ typedef struct
    uint32              start_time;
    uint32              interval_time;
    uint32              accuracy;
+   uint64              start_time_ns;     /* as given to OS_TimerSetNs */
+   uint64              interval_time_ns;
+   uint32              accuracy_ns;       /* resolution of the clock behind the timer */
 
 } OS_timer_prop_t;
 
@@ -61,6 +64,17 @@ typedef struct
     uint32              accuracy;
 } OS_timebase_prop_t;
 
+/* timer service statistics, see OS_TimerGetServiceStats() */
+typedef struct
+{
+    uint32              expirations;    /* timer expirations dispatched */
+    uint32              overruns;       /* expirations merged into a later callback */
+    uint32              latency_last;   /* usec from expiry to callback, last expiration */
+    uint32              latency_avg;
+    uint32              latency_max;
+    uint32              wakeups;        /* times the service thread woke up */
+} OS_timer_service_stats_t;
+
 /*
 ** Timer API
 */
@@ -74,9 +88,13 @@ int32 OS_TimeBaseGetIdByName    (uint32 *timer_id, const char *timebase_name);
 int32 OS_TimerCreate            (uint32 *timer_id, const char *timer_name, uint32 *clock_accuracy, OS_TimerCallback_t callback_ptr);
 int32 OS_TimerAdd               (uint32 *timer_id, const char *timer_name, uint32 timebase_id, OS_ArgCallback_t  callback_ptr, void *callback_arg);
 int32 OS_TimerSet               (uint32 timer_id, uint32 start_time, uint32 interval_time);
+int32 OS_TimerSetNs             (uint32 timer_id, uint64 start_time_ns, uint64 interval_time_ns);
+int32 OS_TimerSetSlack          (uint32 timer_id, uint32 slack_usec);
 int32 OS_TimerDelete            (uint32 timer_id);
 
 int32 OS_TimerGetIdByName       (uint32 *timer_id, const char *timer_name);
 int32 OS_TimerGetInfo           (uint32  timer_id, OS_timer_prop_t *timer_prop);
+int32 OS_TimerGetServiceStats   (OS_timer_service_stats_t *stats);
+int32 OS_TimerSetServiceAttr    (uint32 priority, uint32 affinity_mask);
 
 #endif
@@ -21,6 +21,11 @@
 #
 set(OSAL_C_FLAGS "${OSAL_C_FLAGS} -D_XOPEN_SOURCE=600")
 
+# "_FILE_OFFSET_BITS=64" makes off_t and struct stat 64 bits wide on 32 bit hosts too,
+# so the file API can reach past 2 GB (OS_lseek64, OS_fstat, OS_FDGetSize, OS_pread...).
+# It changes os_fstat_t, so applications must be built with the same flags as OSAL.
+set(OSAL_C_FLAGS "${OSAL_C_FLAGS} -D_FILE_OFFSET_BITS=64")
+
 # OSAL_LINK_LIBS determines which system-level libraries must be included in the
 # link command in order to produce the final binary.  These libs will be used for
 # ALL targets that utilize the POSIX OS layer.  Additional target-specific libraries 
@@ -100,7 +100,17 @@
 /****************************************************************************************
                                     INCLUDE FILES
 ****************************************************************************************/
+
+/*
+** _GNU_SOURCE is needed for the CPU affinity calls (pthread_attr_setaffinity_np)
+** and for pthread_getattr_np
+*/
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
 #include <stdio.h>
+#include <stdlib.h>
 #include <sys/types.h>
 #include <ctype.h>
 #include <unistd.h>
@@ -117,6 +127,11 @@
 #include <fcntl.h>
 #include <errno.h>
 #include <limits.h>
+#include <sys/syscall.h>
+#include <sys/resource.h>
+#include <sys/mman.h>
+#include <malloc.h>
+#include <ucontext.h>
 
 /*
 ** The __USE_UNIX98 is for advanced pthread features on linux
@@ -141,6 +156,14 @@
 #include <mqueue.h>
 #endif
 
+/*
+** The time stamp counter fast path of OS_GetMonotonicNs only exists on x86
+*/
+#if defined(OS_MONOTONIC_TSC) && (defined(__x86_64__) || defined(__i386__))
+#define OS_MONOTONIC_HAVE_TSC
+#include <cpuid.h>
+#endif
+
 /*
 ** Defines
 */
@@ -151,6 +174,18 @@
    #define PTHREAD_STACK_MIN 8092
 #endif
 
+#ifndef OS_MONOTONIC_TSC_CALIBRATE_MSEC
+#define OS_MONOTONIC_TSC_CALIBRATE_MSEC  20
+#endif
+
+/*
+** Scheduling capability detection
+** OS_CAP_SYS_NICE is the bit of CAP_SYS_NICE in the CapEff mask of /proc/self/status
+*/
+#define OS_CAP_SYS_NICE   23
+#define OS_NICE_MIN       (-20)
+#define OS_NICE_MAX       19
+
 #undef OS_DEBUG_PRINTF 
 
 #define OS_SHUTDOWN_MAGIC_NUMBER    0xABADC0DE
@@ -173,7 +208,39 @@ typedef struct
     uint32    stack_size;
     uint32    priority;
     osal_task_entry  delete_hook_pointer;
+    osal_task_entry  classic_entry_pointer;   /* entry of OS_TaskCreate, takes no argument */
+    osal_task_entry_arg entry_function_pointer;
+    void      *entry_arg;
+    pid_t     tid;            /* kernel thread id, used to find the task under /proc */
+    uint8     *stack_low;     /* start of the painted stack area */
+    uint8     *stack_top;     /* top of the stack, NULL until the task runs */
+    uint32    policy;         /* effective OS_SCHED_ policy */
+    int       os_priority;    /* native priority, or nice value under OS_SCHED_OTHER */
+    struct timespec period_next;  /* next release of a periodic task, CLOCK_MONOTONIC */
+    uint32    period_usec;        /* 0 if the task is not periodic */
+    uint32    period_overruns;    /* releases missed because the task ran too long */
+    uint32    period_worst_lateness; /* worst wakeup after a release, in microseconds */
 }OS_task_internal_record_t;
+
+/*
+** Task statistics
+** When a task starts, the part of its stack that lies within the requested
+** stack size is painted with OS_STACK_PAINT_BYTE. The high-water mark is the
+** distance from the top of the stack to the deepest overwritten word.
+*/
+#define OS_STACK_PAINT_BYTE               0xA5
+#define OS_STACK_PAINT_WORD               0xA5A5A5A5
+#define OS_STACK_PAINT_MARGIN             1024    /* left unpainted below the entry frame */
+#define OS_TASK_STATS_MONITOR_STACK_SIZE  0x8000
+
+typedef struct
+{
+    int                    active;
+    uint32                 task_id;
+    uint32                 period_msec;
+    OS_TaskStatsCallback_t callback;
+    OS_task_stats_t        snapshot[OS_MAX_TASKS];
+}OS_task_stats_monitor_record_t;
     
 #ifdef OSAL_SOCKET_QUEUE
 /* queues */
@@ -230,6 +297,225 @@ typedef struct
     int             creator;
 }OS_mut_sem_internal_record_t;
 
+/*
+** Work queues
+** These defaults apply when osconfig.h does not size the work queue tables
+*/
+#ifndef OS_MAX_WORK_QUEUES
+#define OS_MAX_WORK_QUEUES          4
+#endif
+#ifndef OS_MAX_WORK_QUEUE_WORKERS
+#define OS_MAX_WORK_QUEUE_WORKERS   8
+#endif
+#ifndef OS_WORK_QUEUE_MAX_DEPTH
+#define OS_WORK_QUEUE_MAX_DEPTH     256     /* must be a power of two */
+#endif
+#ifndef OS_MAX_WORK_GROUPS
+#define OS_MAX_WORK_GROUPS          8
+#endif
+#ifndef OS_WORK_QUEUE_STACK_SIZE
+#define OS_WORK_QUEUE_STACK_SIZE    0x10000
+#endif
+
+#define OS_WORK_NONE                0xFFFFFFFF
+#define OS_WORK_HELP_INTERVAL_MSEC  10
+
+/* work item states */
+#define OS_WORK_FREE                0
+#define OS_WORK_QUEUED              1
+#define OS_WORK_RUNNING             2
+#define OS_WORK_DONE                3
+
+/*
+** The state word carries the low 16 bits of the item generation in its upper
+** half, so a compare-and-swap on it can not succeed on a reused item
+*/
+#define OS_WORK_STATE(gen, state)   ((((gen) & 0xFFFF) << 16) | (state))
+#define OS_WORK_STATE_OF(word)      ((word) & 0xFFFF)
+#define OS_WORK_GEN_OF(word)        ((word) >> 16)
+
+typedef struct
+{
+    OS_WorkFunc_t function;
+    void          *arg;
+    uint32        next;         /* free stack link */
+    uint32        state;        /* OS_WORK_STATE(generation, OS_WORK_xxx) */
+    uint32        generation;   /* distinguishes reuses of the same item in work ids */
+    uint32        group;
+    uint32        waitable;     /* TRUE if OS_WorkWait releases the item */
+}OS_work_item_t;
+
+/* Chase-Lev deque of item indices, owned by one worker */
+typedef struct
+{
+    int64         top;
+    int64         bottom;
+    uint32        slots[OS_WORK_QUEUE_MAX_DEPTH];
+}OS_work_deque_t;
+
+typedef struct
+{
+    int             free;
+    char            name [OS_MAX_API_NAME];
+    int             creator;
+    uint32          num_workers;
+    uint32          worker_task_ids[OS_MAX_WORK_QUEUE_WORKERS];
+    OS_work_deque_t deque[OS_MAX_WORK_QUEUE_WORKERS];
+    OS_work_item_t  items[OS_WORK_QUEUE_MAX_DEPTH];
+    uint64          free_head;      /* ABA tag in the upper 32 bits, item index in the lower */
+    uint32          injector[OS_WORK_QUEUE_MAX_DEPTH];
+    uint32          inject_head;
+    uint32          inject_count;
+    uint32          group_pending[OS_MAX_WORK_GROUPS];
+    uint32          queued;         /* items sitting in a deque or the injector */
+    uint32          pending;        /* items submitted but not completed */
+    uint32          completed;
+    uint32          steals;
+    uint32          sleepers;
+    uint32          waiters;
+    uint32          live_workers;
+    uint32          shutdown;
+    pthread_mutex_t mut;
+    pthread_cond_t  work_cv;
+    pthread_cond_t  done_cv;
+}OS_work_queue_internal_record_t;
+
+/*
+** Fibers
+** These defaults apply when osconfig.h does not size the fiber tables
+*/
+#ifndef OS_MAX_FIBERS
+#define OS_MAX_FIBERS               1024
+#endif
+#ifndef OS_MAX_FIBER_SCHEDS
+#define OS_MAX_FIBER_SCHEDS         4
+#endif
+#ifndef OS_MAX_FIBER_SCHED_WORKERS
+#define OS_MAX_FIBER_SCHED_WORKERS  8
+#endif
+#ifndef OS_MAX_FIBER_SEMS
+#define OS_MAX_FIBER_SEMS           256
+#endif
+#ifndef OS_MAX_FIBER_QUEUES
+#define OS_MAX_FIBER_QUEUES         256
+#endif
+#ifndef OS_FIBER_DEFAULT_STACK_SIZE
+#define OS_FIBER_DEFAULT_STACK_SIZE 0x4000
+#endif
+#ifndef OS_FIBER_SCHED_STACK_SIZE
+#define OS_FIBER_SCHED_STACK_SIZE   0x10000
+#endif
+
+#define OS_FIBER_MIN_STACK_SIZE     0x2000
+#define OS_FIBER_NONE               0xFFFFFFFF
+
+/* fiber states */
+#define OS_FIBER_FREE               0
+#define OS_FIBER_READY              1
+#define OS_FIBER_RUNNING            2
+#define OS_FIBER_BLOCKED            3
+#define OS_FIBER_DONE               4
+
+/*
+** Fiber context
+** On x86-64 a switch saves the callee-saved registers on the fiber stack and swaps
+** stack pointers, it never enters the kernel.  Other targets, or builds that define
+** OS_FIBER_UCONTEXT, use swapcontext, which also saves and restores the signal mask.
+*/
+#if defined(__x86_64__) && !defined(OS_FIBER_UCONTEXT)
+#define OS_FIBER_ASM_SWITCH
+typedef struct
+{
+    void            *sp;              /* saved stack pointer, the registers sit above it */
+}OS_fiber_context_t;
+#else
+typedef ucontext_t OS_fiber_context_t;
+#endif
+
+/* FIFO of fiber indices, linked through the fiber records */
+typedef struct
+{
+    uint32          head;
+    uint32          tail;
+}OS_fiber_list_t;
+
+typedef struct
+{
+    uint32          state;
+    uint32          sched_id;
+    uint32          worker;           /* worker the fiber runs or last ran on */
+    uint32          next;             /* ready list or wait list link */
+    uint32          sleep_next;       /* sleep list link */
+    int             sleeping;         /* TRUE while on the sleep list */
+    int             timed;            /* TRUE if the current wait has a timeout */
+    uint32          wait_word;        /* (wait sequence << 1) | 1 until a waker claims the wait */
+    uint32          switching;        /* TRUE until the worker has saved the fiber context */
+    struct timespec wake_time;        /* CLOCK_MONOTONIC */
+    OS_fiber_list_t *wait_list;       /* list the fiber is blocked on, NULL if none */
+    pthread_mutex_t *wait_mut;        /* lock of wait_list */
+    int32           wait_result;
+    int32           timeout_result;   /* wait_result if the sleep runs out first */
+    void            *wait_data;       /* receive buffer of a pending OS_FiberQueueGet */
+    uint32          *wait_size_copied;
+    OS_FiberFunc_t  function;
+    void            *arg;
+    void            *stack;
+    OS_fiber_context_t context;
+}OS_fiber_internal_record_t;
+
+typedef struct
+{
+    uint32             task_id;
+    uint32             current;       /* fiber running on this worker or OS_FIBER_NONE */
+    OS_fiber_list_t    ready;         /* fibers queued on this worker */
+    pthread_mutex_t    ready_mut;
+    OS_fiber_context_t context;       /* dispatcher context the fibers switch back to */
+}OS_fiber_worker_t;
+
+typedef struct
+{
+    int               free;
+    char              name [OS_MAX_API_NAME];
+    int               creator;
+    uint32            num_workers;
+    OS_fiber_worker_t workers[OS_MAX_FIBER_SCHED_WORKERS];
+    uint32            next_worker;    /* worker a new fiber is queued on */
+    uint32            sleep_head;     /* sleep list, sorted by wake time */
+    uint32            fibers;
+    uint32            switches;
+    uint32            idle_workers;
+    uint32            live_workers;
+    uint32            shutdown;
+    pthread_mutex_t   mut;            /* sleep list, idle and live workers */
+    pthread_cond_t    work_cv;
+    pthread_cond_t    done_cv;
+}OS_fiber_sched_internal_record_t;
+
+typedef struct
+{
+    int               free;
+    uint32            count;
+    uint32            task_waiters;
+    OS_fiber_list_t   waiters;
+    pthread_mutex_t   mut;
+    pthread_cond_t    task_cv;        /* tasks blocked in OS_FiberSemTake */
+}OS_fiber_sem_internal_record_t;
+
+typedef struct
+{
+    int               free;
+    uint32            depth;
+    uint32            data_size;
+    uint32            head;
+    uint32            count;
+    uint32            task_waiters;
+    uint8             *buffer;        /* depth slots of data_size bytes */
+    uint32            *sizes;
+    OS_fiber_list_t   waiters;
+    pthread_mutex_t   mut;
+    pthread_cond_t    task_cv;        /* tasks blocked in OS_FiberQueueGet */
+}OS_fiber_queue_internal_record_t;
+
 /* function pointer type */
 typedef void (*FuncPtr_t)(void);
 
@@ -239,25 +525,121 @@ OS_queue_internal_record_t   OS_queue_table         [OS_MAX_QUEUES];
 OS_bin_sem_internal_record_t OS_bin_sem_table       [OS_MAX_BIN_SEMAPHORES];
 OS_count_sem_internal_record_t OS_count_sem_table   [OS_MAX_COUNT_SEMAPHORES];
 OS_mut_sem_internal_record_t OS_mut_sem_table       [OS_MAX_MUTEXES];
+OS_work_queue_internal_record_t OS_work_queue_table [OS_MAX_WORK_QUEUES];
+OS_task_stats_monitor_record_t  OS_task_stats_monitor;
+OS_fiber_internal_record_t       OS_fiber_table       [OS_MAX_FIBERS];
+OS_fiber_sched_internal_record_t OS_fiber_sched_table [OS_MAX_FIBER_SCHEDS];
+OS_fiber_sem_internal_record_t   OS_fiber_sem_table   [OS_MAX_FIBER_SEMS];
+OS_fiber_queue_internal_record_t OS_fiber_queue_table [OS_MAX_FIBER_QUEUES];
 
 pthread_key_t    thread_key;
+pthread_key_t    OS_work_worker_key;
+pthread_key_t    OS_fiber_worker_key;
 
 pthread_mutex_t OS_task_table_mut;
 pthread_mutex_t OS_queue_table_mut;
 pthread_mutex_t OS_bin_sem_table_mut;
 pthread_mutex_t OS_mut_sem_table_mut;
 pthread_mutex_t OS_count_sem_table_mut;
+pthread_mutex_t OS_work_queue_table_mut;
+pthread_mutex_t OS_task_stats_monitor_mut;
+
+/*
+** Guards the allocation of fiber table entries.  Fiber switches do not take it.
+*/
+pthread_mutex_t OS_fiber_mut;
 
 uint32          OS_printf_enabled = TRUE;
 volatile uint32 OS_shutdown = FALSE;
 
+/*
+** Scheduling capabilities of this process, filled in by OS_API_Init
+*/
+int             OS_sched_rt_permitted = FALSE;     /* SCHED_FIFO and SCHED_RR may be used */
+int             OS_sched_rt_max_priority = 0;      /* highest real-time priority allowed */
+int             OS_sched_nice_min = 0;             /* most favorable nice value allowed */
+
+/*
+** Set by OS_DeterministicModeEnable, new tasks then prefault their whole stack
+*/
+int             OS_deterministic_mode = FALSE;
+
+#ifdef OS_MONOTONIC_HAVE_TSC
+/*
+** Calibration of the time stamp counter, filled in by OS_API_Init.  The time is
+** ns_base plus the ticks since tsc_base times tsc_mult, which is in nsec per
+** tick as a 32.32 fixed point number.
+*/
+int             OS_monotonic_tsc_enabled = FALSE;
+uint64          OS_monotonic_tsc_base = 0;
+uint64          OS_monotonic_ns_base = 0;
+uint64          OS_monotonic_tsc_mult = 0;
+#endif
+
 /*
 ** Local Function Prototypes
 */
 void    OS_CompAbsDelayTime( uint32 milli_second , struct timespec * tm);
+void    OS_TimespecAddUsec(struct timespec *ts, uint32 usec);
 void    OS_ThreadKillHandler(int sig );
 uint32  OS_FindCreator(void);
 int32   OS_PriorityRemap(uint32 InputPri);
+int32   OS_NiceRemap(uint32 InputPri);
+void    OS_SchedDetectCapabilities(void);
+void    OS_MonotonicInit(void);
+#ifdef OS_MONOTONIC_HAVE_TSC
+uint64  OS_MonotonicReadTsc(void);
+void    OS_MonotonicSample(uint64 *tsc, uint64 *nsecs);
+#endif
+void    OS_TaskApplyNice(uint32 task_id);
+void   *OS_PthreadTaskEntry(void *arg);
+int32   OS_TaskCreateCommon(uint32 *task_id, const char *task_name, osal_task_entry classic_entry,
+                            osal_task_entry_arg function_pointer, void *entry_arg, uint32 stack_size,
+                            uint32 priority, uint32 flags, const OS_task_attr_t *attr);
+void    OS_TaskReleaseEntry(uint32 task_id);
+int32   OS_TaskDeleteCommon(uint32 task_id);
+int     OS_TaskStatsMonitorIsTask(uint32 task_id);
+void    OS_TaskEntryCleanup(void *arg);
+void    OS_TaskPaintStack(uint32 task_id);
+int32   OS_TaskCollectStats(uint32 task_id, OS_task_stats_t *task_stats);
+void    OS_TaskReadProcStats(pid_t tid, OS_task_stats_t *task_stats);
+void    OS_TaskStatsMonitor(void *arg);
+uint32  OS_WorkItemAlloc(OS_work_queue_internal_record_t *wq);
+void    OS_WorkItemFree(OS_work_queue_internal_record_t *wq, uint32 idx);
+int     OS_WorkDequePush(OS_work_deque_t *dq, uint32 idx);
+uint32  OS_WorkDequePop(OS_work_deque_t *dq);
+uint32  OS_WorkDequeSteal(OS_work_deque_t *dq);
+uint32  OS_WorkCurrentWorker(uint32 queue_id);
+void    OS_WorkEnqueue(uint32 queue_id, uint32 idx);
+uint32  OS_WorkDequeue(uint32 queue_id, uint32 worker);
+void    OS_WorkExecute(uint32 queue_id, uint32 idx);
+void    OS_WorkQueueWorker(void *arg);
+int     OS_WorkQueueIsWorker(uint32 task_id);
+int     OS_FiberSchedIsWorker(uint32 task_id);
+void    OS_WorkQueueHelp(uint32 queue_id, volatile uint32 *done_flag, uint32 done_value);
+int32   OS_WorkSubmitInternal(uint32 queue_id, uint32 group, OS_WorkFunc_t function,
+                              void *arg, uint32 *work_id);
+void    OS_FiberListPush(OS_fiber_list_t *list, uint32 idx);
+uint32  OS_FiberListPop(OS_fiber_list_t *list);
+void    OS_FiberListRemove(OS_fiber_list_t *list, uint32 idx);
+void    OS_FiberSleepInsert(OS_fiber_sched_internal_record_t *sched, uint32 idx);
+void    OS_FiberSleepRemove(OS_fiber_sched_internal_record_t *sched, uint32 idx);
+void    OS_FiberWakeSleepers(OS_fiber_sched_internal_record_t *sched);
+void    OS_FiberMakeReady(uint32 idx);
+int     OS_FiberClaim(uint32 idx);
+void    OS_FiberWakeClaimed(uint32 idx, int32 result);
+uint32  OS_FiberPopWaiter(OS_fiber_list_t *wait_list);
+uint32  OS_FiberCurrent(void);
+void    OS_FiberContextInit(OS_fiber_internal_record_t *fiber, uint32 idx, void *stack,
+                            uint32 stack_size);
+void    OS_FiberSwitchOut(uint32 idx);
+int32   OS_FiberBlock(uint32 idx, OS_fiber_list_t *wait_list, pthread_mutex_t *wait_mut,
+                      int32 timeout, int32 timeout_result);
+uint32  OS_FiberNextReady(OS_fiber_sched_internal_record_t *sched, uint32 worker);
+int     OS_FiberAnyReady(OS_fiber_sched_internal_record_t *sched);
+void    OS_FiberTrampoline(int idx);
+void    OS_FiberSchedWorker(void *arg);
+void    OS_FiberCompAbsTime(uint32 milli_second, struct timespec *tm);
 int     OS_InterruptSafeLock(pthread_mutex_t *lock, sigset_t *set, sigset_t *previous);
 void    OS_InterruptSafeUnlock(pthread_mutex_t *lock, sigset_t *previous);
 
@@ -282,8 +664,10 @@ static void  OS_NoopSigHandler (int signal)
 int32 OS_API_Init(void)
 {
    int                 i;
+   int                 j;
    int                 ret;
    pthread_mutexattr_t mutex_attr ;    
+   pthread_condattr_t  cond_attr;
    int32               return_code = OS_SUCCESS;
    struct sched_param  param;
    int                 sched_policy;
@@ -337,9 +721,22 @@ int32 OS_API_Init(void)
         OS_task_table[i].free                = TRUE;
         OS_task_table[i].creator             = UNINITIALIZED;
         OS_task_table[i].delete_hook_pointer = NULL;
+        OS_task_table[i].classic_entry_pointer = NULL;
+        OS_task_table[i].entry_function_pointer = NULL;
+        OS_task_table[i].entry_arg           = NULL;
+        OS_task_table[i].tid                 = 0;
+        OS_task_table[i].stack_low           = NULL;
+        OS_task_table[i].stack_top           = NULL;
+        OS_task_table[i].policy              = OS_SCHED_DEFAULT;
+        OS_task_table[i].os_priority         = 0;
+        OS_task_table[i].period_usec         = 0;
         strcpy(OS_task_table[i].name,"");    
     }
 
+    OS_task_stats_monitor.active = FALSE;
+    OS_task_stats_monitor.task_id = UNINITIALIZED;
+    OS_task_stats_monitor.callback = NULL;
+
     /* Initialize Message Queue Table */
 
     for(i = 0; i < OS_MAX_QUEUES; i++)
@@ -375,6 +772,37 @@ int32 OS_API_Init(void)
         strcpy(OS_mut_sem_table[i].name,"");
     }
 
+    /* Initialize Work Queue Table */
+
+    for(i = 0; i < OS_MAX_WORK_QUEUES; i++)
+    {
+        OS_work_queue_table[i].free        = TRUE;
+        OS_work_queue_table[i].creator     = UNINITIALIZED;
+        strcpy(OS_work_queue_table[i].name,"");
+    }
+
+    /* Initialize Fiber Tables */
+
+    for(i = 0; i < OS_MAX_FIBER_SCHEDS; i++)
+    {
+        OS_fiber_sched_table[i].free        = TRUE;
+        OS_fiber_sched_table[i].creator     = UNINITIALIZED;
+        strcpy(OS_fiber_sched_table[i].name,"");
+    }
+    for(i = 0; i < OS_MAX_FIBERS; i++)
+    {
+        OS_fiber_table[i].state     = OS_FIBER_FREE;
+        OS_fiber_table[i].switching = FALSE;
+    }
+    for(i = 0; i < OS_MAX_FIBER_SEMS; i++)
+    {
+        OS_fiber_sem_table[i].free = TRUE;
+    }
+    for(i = 0; i < OS_MAX_FIBER_QUEUES; i++)
+    {
+        OS_fiber_queue_table[i].free = TRUE;
+    }
+
    /*
    ** Initialize the module loader
    */
@@ -405,6 +833,26 @@ int32 OS_API_Init(void)
       return(return_code);
    }
 
+   ret = pthread_key_create(&OS_work_worker_key, NULL );
+   if ( ret != 0 )
+   {
+      #ifdef OS_DEBUG_PRINTF
+        printf("Error creating work queue worker key\n");
+      #endif
+      return_code = OS_ERROR;
+      return(return_code);
+   }
+
+   ret = pthread_key_create(&OS_fiber_worker_key, NULL );
+   if ( ret != 0 )
+   {
+      #ifdef OS_DEBUG_PRINTF
+        printf("Error creating fiber worker key\n");
+      #endif
+      return_code = OS_ERROR;
+      return(return_code);
+   }
+
    /* 
    ** initialize the pthread mutex attribute structure with default values 
    */
@@ -479,6 +927,54 @@ int32 OS_API_Init(void)
       return_code = OS_ERROR;
       return(return_code);
    }
+   ret = pthread_mutex_init((pthread_mutex_t *) & OS_work_queue_table_mut,&mutex_attr); 
+   if ( ret != 0 )
+   {
+      return_code = OS_ERROR;
+      return(return_code);
+   }
+   ret = pthread_mutex_init((pthread_mutex_t *) & OS_task_stats_monitor_mut,&mutex_attr); 
+   if ( ret != 0 )
+   {
+      return_code = OS_ERROR;
+      return(return_code);
+   }
+
+   /*
+   ** The fiber locks are plain mutexes, the ready list locks are taken on
+   ** every fiber switch.  They live as long as the tables, so a fiber object
+   ** can be deleted while another task is still on its way into a call.
+   ** Fiber sleeps are measured on CLOCK_MONOTONIC.
+   */
+   ret = pthread_mutex_init(&OS_fiber_mut, NULL);
+   if ( ret != 0 )
+   {
+      return_code = OS_ERROR;
+      return(return_code);
+   }
+   pthread_condattr_init(&cond_attr);
+   pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC);
+   for (i = 0; i < OS_MAX_FIBER_SCHEDS; i++)
+   {
+      pthread_mutex_init(&OS_fiber_sched_table[i].mut, NULL);
+      pthread_cond_init(&OS_fiber_sched_table[i].work_cv, &cond_attr);
+      pthread_cond_init(&OS_fiber_sched_table[i].done_cv, NULL);
+      for (j = 0; j < OS_MAX_FIBER_SCHED_WORKERS; j++)
+      {
+         pthread_mutex_init(&OS_fiber_sched_table[i].workers[j].ready_mut, NULL);
+      }
+   }
+   for (i = 0; i < OS_MAX_FIBER_SEMS; i++)
+   {
+      pthread_mutex_init(&OS_fiber_sem_table[i].mut, NULL);
+      pthread_cond_init(&OS_fiber_sem_table[i].task_cv, NULL);
+   }
+   for (i = 0; i < OS_MAX_FIBER_QUEUES; i++)
+   {
+      pthread_mutex_init(&OS_fiber_queue_table[i].mut, NULL);
+      pthread_cond_init(&OS_fiber_queue_table[i].task_cv, &cond_attr);
+   }
+   pthread_condattr_destroy(&cond_attr);
 
    /*
    ** File system init
@@ -498,12 +994,28 @@ int32 OS_API_Init(void)
    ** trying this, however that assumes that only uid 0 will be able to do
    ** this, which is not necessarily true, some linuxes have fine-grained
    ** permissions which could allow a non-root user to do this too.
+   ** OS_SchedDetectCapabilities looks at CAP_SYS_NICE and RLIMIT_RTPRIO
+   ** to find out what is actually allowed.
    */
+   OS_SchedDetectCapabilities();
+
+   OS_MonotonicInit();
+
+#ifdef OSAL_DETERMINISTIC_MODE
+   if (OS_DeterministicModeEnable(OS_DETERMINISTIC_HEAP_SIZE) != OS_SUCCESS)
+   {
+#ifdef OS_DEBUG_PRINTF
+      printf("OS_API_Init: Could not enable deterministic mode, errno=%d\n",errno);
+#endif
+      return(OS_ERROR);
+   }
+#endif
+
    ret = pthread_getschedparam(pthread_self(), &sched_policy, &param);
-   if (ret == 0)
+   if (ret == 0 && OS_sched_rt_permitted == TRUE)
    {
       sched_policy = SCHED_FIFO;
-      param.sched_priority = sched_get_priority_max(sched_policy);
+      param.sched_priority = OS_sched_rt_max_priority;
       ret = pthread_setschedparam(pthread_self(), sched_policy, &param);
       if (ret != 0)
       {
@@ -512,7 +1024,7 @@ int32 OS_API_Init(void)
 #endif
       }
    }
-   else
+   else if (ret != 0)
    {
 #ifdef OS_DEBUG_PRINTF
       printf("OS_API_Init: Could not get scheduleparam in main thread, error=%d\n",ret);
@@ -537,6 +1049,9 @@ int32 OS_API_Init(void)
 ---------------------------------------------------------------------------------------*/
 void OS_ApplicationExit(int32 Status)
 {
+   /* data still buffered by file streams would be lost with the process */
+   OS_StreamFlushAll();
+
    if (Status == OS_SUCCESS)
    {
       exit(EXIT_SUCCESS);
@@ -559,6 +1074,27 @@ void OS_DeleteAllObjects       (void)
 {
     uint32 i;
 
+    /* file streams are written out while the tasks feeding them still exist */
+    OS_StreamFlushAll();
+
+    /* work queues first, their workers drain the queue and exit on their own */
+    for (i = 0; i < OS_MAX_WORK_QUEUES; ++i)
+    {
+        OS_WorkQueueDelete(i);
+    }
+    for (i = 0; i < OS_MAX_FIBER_SCHEDS; ++i)
+    {
+        OS_FiberSchedDelete(i);
+    }
+    for (i = 0; i < OS_MAX_FIBER_SEMS; ++i)
+    {
+        OS_FiberSemDelete(i);
+    }
+    for (i = 0; i < OS_MAX_FIBER_QUEUES; ++i)
+    {
+        OS_FiberQueueDelete(i);
+    }
+    OS_TaskStatsMonitorStop();
     for (i = 0; i < OS_MAX_TASKS; ++i)
     {
         OS_TaskDelete(i);
@@ -579,6 +1115,10 @@ void OS_DeleteAllObjects       (void)
     {
         OS_BinSemDelete(i);
     }
+    for (i = 0; i < OS_MAX_TIMEBASES; ++i)
+    {
+        OS_TimeBaseDelete(i);
+    }
     for (i = 0; i < OS_MAX_TIMERS; ++i)
     {
         OS_TimerDelete(i);
@@ -649,6 +1189,70 @@ void OS_ApplicationShutdown(uint8 flag)
 **********************************************************************************
 */
 
+/*---------------------------------------------------------------------------------------
+   Name: OS_PthreadTaskEntry
+
+   Purpose: Common pthread entry point for every task created through the OSAL.
+            Registers the new thread with its task table slot and then calls the
+            user entry point with the argument supplied at creation time.
+
+   returns: NULL
+---------------------------------------------------------------------------------------*/
+void *OS_PthreadTaskEntry(void *arg)
+{
+    uint32              task_id;
+    osal_task_entry     classic_entry;
+    osal_task_entry_arg entry;
+    void               *entry_arg;
+    sigset_t            previous;
+    sigset_t            mask;
+
+    task_id = (uint32)((cpuaddr)arg);
+
+    /*
+    ** Store the same key OS_TaskRegister would, so OS_TaskGetId works
+    ** from the first instruction of the task
+    */
+    pthread_setspecific(thread_key, (void *)((cpuaddr)task_id));
+
+    OS_InterruptSafeLock(&OS_task_table_mut, &mask, &previous);
+    classic_entry = OS_task_table[task_id].classic_entry_pointer;
+    entry         = OS_task_table[task_id].entry_function_pointer;
+    entry_arg     = OS_task_table[task_id].entry_arg;
+    OS_InterruptSafeUnlock(&OS_task_table_mut, &previous);
+
+    /*
+    ** The task may have been deleted before it ever ran, in which case
+    ** the cancel request is already pending and the slot may be reused.
+    */
+    pthread_testcancel();
+
+    /*
+    ** The cleanup handler withdraws the stack from OS_TaskGetStats before
+    ** the thread goes away, however it ends.
+    */
+    pthread_cleanup_push(OS_TaskEntryCleanup, arg);
+
+    OS_TaskPaintStack(task_id);
+    OS_TaskApplyNice(task_id);
+
+    /*
+    ** Each entry point is called through its own type
+    */
+    if (entry != NULL)
+    {
+       (*entry)(entry_arg);
+    }
+    else if (classic_entry != NULL)
+    {
+       (*classic_entry)();
+    }
+
+    pthread_cleanup_pop(1);
+
+    return NULL;
+}/* end OS_PthreadTaskEntry */
+
 /*---------------------------------------------------------------------------------------
    Name: OS_TaskCreate
 
@@ -669,6 +1273,58 @@ void OS_ApplicationShutdown(uint8 flag)
 int32 OS_TaskCreate (uint32 *task_id, const char *task_name, osal_task_entry function_pointer,
                       uint32 *stack_pointer, uint32 stack_size, uint32 priority,
                       uint32 flags)
+{
+    return OS_TaskCreateCommon(task_id, task_name, function_pointer, NULL, NULL,
+                               stack_size, priority, flags, NULL);
+}/* end OS_TaskCreate */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_TaskCreateEx
+
+   Purpose: Creates a task and starts running it, passing entry_arg to the entry
+            point. The optional attributes select CPU affinity, scheduling policy,
+            a caller supplied stack and the stack guard size.
+
+   returns: OS_INVALID_POINTER if any of the necessary pointers are NULL
+            OS_ERR_NAME_TOO_LONG if the name of the task is too long to be copied
+            OS_ERR_INVALID_PRIORITY if the priority is bad
+            OS_ERR_NO_FREE_IDS if there can be no more tasks created
+            OS_ERR_NAME_TAKEN if the name specified is already used by a task
+            OS_ERROR if the attributes are bad or the operating system calls fail
+            OS_SUCCESS if success
+
+    NOTES: attr may be NULL, which behaves the same as a zeroed OS_task_attr_t.
+           The stack size is always applied. SCHED_FIFO and SCHED_RR are only used
+           when OS_API_Init found the process may set them (CAP_SYS_NICE or an
+           RLIMIT_RTPRIO grant), otherwise the task runs SCHED_OTHER with the
+           priority mapped onto a nice value. A caller supplied stack must be at
+           least PTHREAD_STACK_MIN bytes and stays owned by the caller.
+---------------------------------------------------------------------------------------*/
+int32 OS_TaskCreateEx (uint32 *task_id, const char *task_name, osal_task_entry_arg function_pointer,
+                       void *entry_arg, uint32 stack_size, uint32 priority, uint32 flags,
+                       const OS_task_attr_t *attr)
+{
+    if (function_pointer == NULL)
+    {
+        return OS_INVALID_POINTER;
+    }
+
+    return OS_TaskCreateCommon(task_id, task_name, NULL, function_pointer, entry_arg,
+                               stack_size, priority, flags, attr);
+}/* end OS_TaskCreateEx */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_TaskCreateCommon
+
+   Purpose: Creates a task for OS_TaskCreate or OS_TaskCreateEx. Exactly one of
+            classic_entry and function_pointer is set, and the new task calls it
+            through its own type from OS_PthreadTaskEntry.
+
+   returns: the same as OS_TaskCreateEx
+---------------------------------------------------------------------------------------*/
+int32 OS_TaskCreateCommon(uint32 *task_id, const char *task_name, osal_task_entry classic_entry,
+                          osal_task_entry_arg function_pointer, void *entry_arg, uint32 stack_size,
+                          uint32 priority, uint32 flags, const OS_task_attr_t *attr)
 {
     int                return_code = 0;
     pthread_attr_t     custom_attr ;
@@ -676,14 +1332,17 @@ int32 OS_TaskCreate (uint32 *task_id, const char *task_name, osal_task_entry fun
     int                possible_taskid;
     int                i;
     uint32             local_stack_size;
-    int                ret;  
     int                os_priority;
-    int                inheritsched;
+    int                os_policy;
+    uint32             effective_policy;
+    OS_task_attr_t     local_attr;
+    cpu_set_t          cpuset;
     sigset_t           previous;
     sigset_t           mask;
     
     /* Check for NULL pointers */    
-    if( (task_name == NULL) || (function_pointer == NULL) || (task_id == NULL) )
+    if( (task_name == NULL) || (task_id == NULL) ||
+        (classic_entry == NULL && function_pointer == NULL) )
     {
         return OS_INVALID_POINTER;
     }
@@ -701,8 +1360,49 @@ int32 OS_TaskCreate (uint32 *task_id, const char *task_name, osal_task_entry fun
         return OS_ERR_INVALID_PRIORITY;
     }
 
+    if (attr != NULL)
+    {
+        local_attr = *attr;
+    }
+    else
+    {
+        memset(&local_attr, 0, sizeof(local_attr));
+    }
+
+    /* Check the optional attributes */
+    if (local_attr.policy > OS_SCHED_OTHER)
+    {
+        return OS_ERROR;
+    }
+
+    if (local_attr.stack_pointer != NULL && stack_size < PTHREAD_STACK_MIN)
+    {
+        return OS_ERROR;
+    }
+
+    /*
+    ** Work out the policy the task will really run under. The real-time
+    ** policies need the permission found by OS_API_Init, anything else
+    ** runs SCHED_OTHER with the OSAL priority mapped onto a nice value.
+    */
+    if (OS_sched_rt_permitted == TRUE && local_attr.policy != OS_SCHED_OTHER)
+    {
+        effective_policy = (local_attr.policy == OS_SCHED_RR) ? OS_SCHED_RR : OS_SCHED_FIFO;
+    }
+    else
+    {
+        effective_policy = OS_SCHED_OTHER;
+    }
+
     /* Change OSAL priority into a priority that will work for this OS */
-    os_priority = OS_PriorityRemap(priority);
+    if (effective_policy == OS_SCHED_OTHER)
+    {
+        os_priority = OS_NiceRemap(priority);
+    }
+    else
+    {
+        os_priority = OS_PriorityRemap(priority);
+    }
     
     /* Check Parameters */
     OS_InterruptSafeLock(&OS_task_table_mut, &mask, &previous); 
@@ -735,10 +1435,18 @@ int32 OS_TaskCreate (uint32 *task_id, const char *task_name, osal_task_entry fun
     
     /* 
     ** Set the possible task Id to not free so that
-    ** no other task can try to use it 
+    ** no other task can try to use it. The entry point and its
+    ** argument must be in place before the thread starts.
     */
     OS_task_table[possible_taskid].free = FALSE;
-    
+    OS_task_table[possible_taskid].classic_entry_pointer = classic_entry;
+    OS_task_table[possible_taskid].entry_function_pointer = function_pointer;
+    OS_task_table[possible_taskid].entry_arg = entry_arg;
+    OS_task_table[possible_taskid].stack_size = stack_size;
+    OS_task_table[possible_taskid].priority = priority;
+    OS_task_table[possible_taskid].policy = effective_policy;
+    OS_task_table[possible_taskid].os_priority = os_priority;
+    
     OS_InterruptSafeUnlock(&OS_task_table_mut, &previous);
 
     if ( stack_size < PTHREAD_STACK_MIN )
@@ -768,108 +1476,199 @@ int32 OS_TaskCreate (uint32 *task_id, const char *task_name, osal_task_entry fun
         return(OS_ERROR); 
     }
 
+    /*
+    ** Set the caller supplied stack, if any. This does not need
+    ** any privilege so it is done for every user.
+    */
+    if (local_attr.stack_pointer != NULL)
+    {
+       return_code = pthread_attr_setstack(&custom_attr, local_attr.stack_pointer, (size_t)stack_size);
+       #ifdef OS_DEBUG_PRINTF
+          if (return_code != 0)
+          {
+             printf("pthread_attr_setstack error in OS_TaskCreate, Task ID = %d\n",possible_taskid);
+          }
+       #endif
+    }
+
+    if (return_code == 0 && local_attr.guard_size != 0)
+    {
+       return_code = pthread_attr_setguardsize(&custom_attr, (size_t)local_attr.guard_size);
+       #ifdef OS_DEBUG_PRINTF
+          if (return_code != 0)
+          {
+             printf("pthread_attr_setguardsize error in OS_TaskCreate, Task ID = %d\n",possible_taskid);
+          }
+       #endif
+    }
+
+    if (return_code == 0 && local_attr.affinity_mask != 0)
+    {
+       CPU_ZERO(&cpuset);
+       for (i = 0; i < 32 && i < CPU_SETSIZE; i++)
+       {
+          if (local_attr.affinity_mask & (1UL << i))
+          {
+             CPU_SET(i, &cpuset);
+          }
+       }
+       return_code = pthread_attr_setaffinity_np(&custom_attr, sizeof(cpuset), &cpuset);
+       #ifdef OS_DEBUG_PRINTF
+          if (return_code != 0)
+          {
+             printf("pthread_attr_setaffinity_np error in OS_TaskCreate, Task ID = %d\n",possible_taskid);
+          }
+       #endif
+    }
+
+    /*
+    ** Set the Stack Size, unless the caller already gave us the stack.
+    ** This needs no privilege, so it is done whatever the policy.
+    */
+    if (return_code == 0 && local_attr.stack_pointer == NULL)
+    {
+       return_code = pthread_attr_setstacksize(&custom_attr, (size_t)local_stack_size );
+       #ifdef OS_DEBUG_PRINTF
+          if (return_code != 0)
+          {
+             printf("pthread_attr_setstacksize error in OS_TaskCreate, Task ID = %d\n",possible_taskid);
+          }
+       #endif
+    }
 
     /*
-    ** Test to see if the user is running as root.
-    ** root is required to set the scheduling policy, stack, and priority
+    ** Test to see if the process may use the real-time policies.
+    ** This used to require root, now any process with CAP_SYS_NICE
+    ** or an RLIMIT_RTPRIO grant qualifies.
     */
-    if (geteuid() == 0 )
+    if (return_code == 0 && OS_sched_rt_permitted == TRUE)
     {
        /*
        ** Set the scheduling inherit attribute to EXPLICIT
        */
-       inheritsched = PTHREAD_EXPLICIT_SCHED;
-       return_code = pthread_attr_setinheritsched(&custom_attr, inheritsched);
-       if ( return_code < 0 )
+       return_code = pthread_attr_setinheritsched(&custom_attr, PTHREAD_EXPLICIT_SCHED);
+       if ( return_code != 0 )
        {
            #ifdef OS_DEBUG_PRINTF
                printf("pthread_attr_setinheritsched error in OS_TaskCreate, Task ID = %d, errno = %s\n",
                       possible_taskid,strerror(errno));
            #endif
-           return(OS_ERROR);
        }
 
        /*
-       ** Set the Stack Size
+       ** Set the scheduling policy 
+       ** On Linux, the schedpolity must be SCHED_FIFO or SCHED_RR to set the priorty
        */
-       if (pthread_attr_setstacksize(&custom_attr, (size_t)local_stack_size ))
+       if (effective_policy == OS_SCHED_RR)
        {
-          #ifdef OS_DEBUG_PRINTF
-             printf("pthread_attr_setstacksize error in OS_TaskCreate, Task ID = %d\n",possible_taskid);
-          #endif
-          return(OS_ERROR);
+          os_policy = SCHED_RR;
+       }
+       else if (effective_policy == OS_SCHED_OTHER)
+       {
+          os_policy = SCHED_OTHER;
+       }
+       else
+       {
+          os_policy = SCHED_FIFO;
        }
 
-       /*
-       ** Set the scheduling policy 
-       ** On Linux, the schedpolity must be SCHED_FIFO or SCHED_RR to set the priorty
-       */
-       if (pthread_attr_setschedpolicy(&custom_attr, SCHED_FIFO))
+       if (return_code == 0)
        {
+          return_code = pthread_attr_setschedpolicy(&custom_attr, os_policy);
           #ifdef OS_DEBUG_PRINTF
-             printf("pthread_attr_setschedpolity error in OS_TaskCreate, Task ID = %d\n",possible_taskid);
+             if (return_code != 0)
+             {
+                printf("pthread_attr_setschedpolity error in OS_TaskCreate, Task ID = %d\n",possible_taskid);
+             }
           #endif
-          return(OS_ERROR);
        }
 
        /* 
        ** Set priority 
        */
-       memset(&priority_holder, 0, sizeof(priority_holder));
-       priority_holder.sched_priority = os_priority;
-       ret = pthread_attr_setschedparam(&custom_attr,&priority_holder);
-       if(ret !=0)
+       if (return_code == 0)
        {
+          /* SCHED_OTHER only takes 0, its nice value is set by the task itself */
+          memset(&priority_holder, 0, sizeof(priority_holder));
+          if (os_policy != SCHED_OTHER)
+          {
+             priority_holder.sched_priority = os_priority;
+          }
+          return_code = pthread_attr_setschedparam(&custom_attr,&priority_holder);
           #ifdef OS_DEBUG_PRINTF
-             printf("pthread_attr_setschedparam error in OS_TaskCreate, Task ID = %d\n",possible_taskid);
+             if (return_code != 0)
+             {
+                printf("pthread_attr_setschedparam error in OS_TaskCreate, Task ID = %d\n",possible_taskid);
+             }
           #endif
-          return(OS_ERROR);
        }
 
-    } /* End if user is root */
-
-    /*
-    ** Create thread
-    */
-    return_code = pthread_create(&(OS_task_table[possible_taskid].id),
-                                 &custom_attr,
-                                 (void*(*)(void*))function_pointer,
-                                 (void *)0);
-    if (return_code != 0)
+    } /* End if real-time policies are permitted */
+    else if (return_code == 0)
     {
-        OS_InterruptSafeLock(&OS_task_table_mut, &mask, &previous); 
-        OS_task_table[possible_taskid].free = TRUE;
-        OS_InterruptSafeUnlock(&OS_task_table_mut, &previous); 
-        #ifdef OS_DEBUG_PRINTF
-           printf("pthread_create error in OS_TaskCreate, Task ID = %d\n",possible_taskid);
-        #endif
-        return(OS_ERROR);
+       /*
+       ** Do not let the task inherit a real-time policy the process
+       ** may have been started with, it would not match its reported policy
+       */
+       return_code = pthread_attr_setinheritsched(&custom_attr, PTHREAD_EXPLICIT_SCHED);
+       if (return_code == 0)
+       {
+          return_code = pthread_attr_setschedpolicy(&custom_attr, SCHED_OTHER);
+       }
+       if (return_code == 0)
+       {
+          memset(&priority_holder, 0, sizeof(priority_holder));
+          return_code = pthread_attr_setschedparam(&custom_attr, &priority_holder);
+       }
+       #ifdef OS_DEBUG_PRINTF
+          if (return_code != 0)
+          {
+             printf("SCHED_OTHER attribute error in OS_TaskCreate, Task ID = %d\n",possible_taskid);
+          }
+       #endif
     }
 
     /*
-    ** Free the resources that are no longer needed
+    ** Create thread
     */
-    return_code = pthread_detach(OS_task_table[possible_taskid].id);
-    if (return_code !=0)
+    if (return_code == 0)
     {
-       OS_InterruptSafeLock(&OS_task_table_mut, &mask, &previous); 
-       OS_task_table[possible_taskid].free = TRUE;
-       OS_InterruptSafeUnlock(&OS_task_table_mut, &previous); 
+       return_code = pthread_create(&(OS_task_table[possible_taskid].id),
+                                    &custom_attr,
+                                    OS_PthreadTaskEntry,
+                                    (void *)((cpuaddr)possible_taskid));
        #ifdef OS_DEBUG_PRINTF
-         printf("pthread_detach error in OS_TaskCreate, Task ID = %d\n",possible_taskid);
+          if (return_code != 0)
+          {
+             printf("pthread_create error in OS_TaskCreate, Task ID = %d\n",possible_taskid);
+          }
        #endif
-       return(OS_ERROR);
+
+       /*
+       ** Free the resources that are no longer needed
+       */
+       if (return_code == 0)
+       {
+          return_code = pthread_detach(OS_task_table[possible_taskid].id);
+          #ifdef OS_DEBUG_PRINTF
+             if (return_code != 0)
+             {
+                printf("pthread_detach error in OS_TaskCreate, Task ID = %d\n",possible_taskid);
+             }
+          #endif
+       }
     }
 
-    return_code = pthread_attr_destroy(&custom_attr);
-    if (return_code !=0)
+    pthread_attr_destroy(&custom_attr);
+
+    if (return_code != 0)
     {
        OS_InterruptSafeLock(&OS_task_table_mut, &mask, &previous); 
        OS_task_table[possible_taskid].free = TRUE;
+       OS_task_table[possible_taskid].classic_entry_pointer = NULL;
+       OS_task_table[possible_taskid].entry_function_pointer = NULL;
+       OS_task_table[possible_taskid].entry_arg = NULL;
        OS_InterruptSafeUnlock(&OS_task_table_mut, &previous); 
-       #ifdef OS_DEBUG_PRINTF
-          printf("pthread_attr_destroy error in OS_TaskCreate, Task ID = %d\n",possible_taskid);
-       #endif
        return(OS_ERROR);
     }
 
@@ -893,7 +1692,7 @@ int32 OS_TaskCreate (uint32 *task_id, const char *task_name, osal_task_entry fun
     OS_InterruptSafeUnlock(&OS_task_table_mut, &previous); 
 
     return OS_SUCCESS;
-}/* end OS_TaskCreate */
+}/* end OS_TaskCreateCommon */
 
 
 /*--------------------------------------------------------------------------------------
@@ -901,17 +1700,14 @@ int32 OS_TaskCreate (uint32 *task_id, const char *task_name, osal_task_entry fun
 
     Purpose: Deletes the specified Task and removes it from the OS_task_table.
 
-    returns: OS_ERR_INVALID_ID if the ID given to it is invalid
-             OS_ERROR if the OS delete call fails
+    returns: OS_ERR_INVALID_ID if the ID given to it is invalid, or the task is a
+             fiber scheduler worker
+             OS_ERROR if the task is a work queue worker or the task statistics
+             monitor, or the OS delete call fails
              OS_SUCCESS if success
 ---------------------------------------------------------------------------------------*/
 int32 OS_TaskDelete (uint32 task_id)
 {    
-    int       ret;
-    FuncPtr_t FunctionPointer;
-    sigset_t  previous;
-    sigset_t  mask;
-    
     /* 
     ** Check to see if the task_id given is valid 
     */
@@ -920,6 +1716,51 @@ int32 OS_TaskDelete (uint32 task_id)
         return OS_ERR_INVALID_ID;
     }
 
+    /*
+    ** Work queue workers are stopped by OS_WorkQueueDelete, which waits
+    ** for each of them to exit
+    */
+    if (OS_WorkQueueIsWorker(task_id))
+    {
+        return OS_ERROR;
+    }
+
+    /*
+    ** Fiber scheduler workers are stopped by OS_FiberSchedDelete, which
+    ** waits for each of them to exit
+    */
+    if (OS_FiberSchedIsWorker(task_id))
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    /*
+    ** The task statistics monitor is stopped by OS_TaskStatsMonitorStop
+    */
+    if (OS_TaskStatsMonitorIsTask(task_id))
+    {
+        return OS_ERROR;
+    }
+
+    return OS_TaskDeleteCommon(task_id);
+
+}/* end OS_TaskDelete */
+
+/*--------------------------------------------------------------------------------------
+     Name: OS_TaskDeleteCommon
+
+    Purpose: Cancels a task and removes it from the OS_task_table, once
+             OS_TaskDelete or an OSAL service owning the task has checked
+             that it may go.
+
+    returns: OS_ERROR if the OS delete call fails
+             OS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_TaskDeleteCommon (uint32 task_id)
+{
+    int       ret;
+    FuncPtr_t FunctionPointer;
+
     /*
     ** Call the thread Delete hook if there is one.
     */
@@ -945,21 +1786,11 @@ int32 OS_TaskDelete (uint32 task_id)
     ** Now that the task is deleted, remove its 
     ** "presence" in OS_task_table
     */
-    OS_InterruptSafeLock(&OS_task_table_mut, &mask, &previous); 
-
-    OS_task_table[task_id].free = TRUE;
-    strcpy(OS_task_table[task_id].name, "");
-    OS_task_table[task_id].creator = UNINITIALIZED;
-    OS_task_table[task_id].stack_size = UNINITIALIZED;
-    OS_task_table[task_id].priority = UNINITIALIZED;    
-    OS_task_table[task_id].id = UNINITIALIZED;
-    OS_task_table[task_id].delete_hook_pointer = NULL;
-    
-    OS_InterruptSafeUnlock(&OS_task_table_mut, &previous); 
+    OS_TaskReleaseEntry(task_id);
 
     return OS_SUCCESS;
     
-}/* end OS_TaskDelete */
+}/* end OS_TaskDeleteCommon */
 
 /*--------------------------------------------------------------------------------------
      Name: OS_TaskExit
@@ -971,12 +1802,24 @@ int32 OS_TaskDelete (uint32 task_id)
 
 void OS_TaskExit()
 {
-    uint32    task_id;
+    OS_TaskReleaseEntry(OS_TaskGetId());
+
+    pthread_exit(NULL);
+
+}/*end OS_TaskExit */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_TaskReleaseEntry
+
+   Purpose: Marks the task table entry of an exiting task as free
+
+   returns: nothing
+---------------------------------------------------------------------------------------*/
+void OS_TaskReleaseEntry(uint32 task_id)
+{
     sigset_t  previous;
     sigset_t  mask;
 
-    task_id = OS_TaskGetId();
-
     OS_InterruptSafeLock(&OS_task_table_mut, &mask, &previous); 
 
     OS_task_table[task_id].free = TRUE;
@@ -986,12 +1829,21 @@ void OS_TaskExit()
     OS_task_table[task_id].priority = UNINITIALIZED;
     OS_task_table[task_id].id = UNINITIALIZED;
     OS_task_table[task_id].delete_hook_pointer = NULL;
+    OS_task_table[task_id].classic_entry_pointer = NULL;
+    OS_task_table[task_id].entry_function_pointer = NULL;
+    OS_task_table[task_id].entry_arg = NULL;
+    OS_task_table[task_id].tid = 0;
+    OS_task_table[task_id].stack_low = NULL;
+    OS_task_table[task_id].stack_top = NULL;
+    OS_task_table[task_id].policy = OS_SCHED_DEFAULT;
+    OS_task_table[task_id].os_priority = 0;
+    OS_task_table[task_id].period_usec = 0;
+    OS_task_table[task_id].period_overruns = 0;
+    OS_task_table[task_id].period_worst_lateness = 0;
     
     OS_InterruptSafeUnlock(&OS_task_table_mut, &previous); 
 
-    pthread_exit(NULL);
-
-}/*end OS_TaskExit */
+}/* end OS_TaskReleaseEntry */
 /*---------------------------------------------------------------------------------------
    Name: OS_TaskDelay
 
@@ -1029,6 +1881,150 @@ int32 OS_TaskDelay(uint32 millisecond )
     
 }/* end OS_TaskDelay */
 
+/*---------------------------------------------------------------------------------------
+   Name: OS_TaskPeriodicInit
+
+   Purpose: Makes the calling task periodic. The first release is one period
+            from now, later ones follow at exact multiples of the period no
+            matter how long the task runs in between.
+
+   returns: OS_ERROR if the period is 0
+            OS_ERR_INVALID_ID if the caller is not an OSAL task
+            OS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_TaskPeriodicInit(uint32 period_usec)
+{
+    uint32          task_id;
+    struct timespec now;
+    sigset_t        previous;
+    sigset_t        mask;
+
+    if (period_usec == 0)
+    {
+       return OS_ERROR;
+    }
+
+    task_id = OS_TaskGetId();
+    if (task_id >= OS_MAX_TASKS || OS_task_table[task_id].free == TRUE ||
+        !pthread_equal(OS_task_table[task_id].id, pthread_self()))
+    {
+       return OS_ERR_INVALID_ID;
+    }
+
+    if (clock_gettime(CLOCK_MONOTONIC, &now) != 0)
+    {
+       return OS_ERROR;
+    }
+
+    OS_InterruptSafeLock(&OS_task_table_mut, &mask, &previous);
+    OS_task_table[task_id].period_usec = period_usec;
+    OS_task_table[task_id].period_next = now;
+    OS_task_table[task_id].period_overruns = 0;
+    OS_task_table[task_id].period_worst_lateness = 0;
+    OS_TimespecAddUsec(&OS_task_table[task_id].period_next, period_usec);
+    OS_InterruptSafeUnlock(&OS_task_table_mut, &previous);
+
+    return OS_SUCCESS;
+
+}/* end OS_TaskPeriodicInit */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_TaskWaitNextPeriod
+
+   Purpose: Blocks the calling periodic task until its next release, using an
+            absolute CLOCK_MONOTONIC sleep so execution time and wakeup latency
+            do not accumulate. If the release has already passed, the missed
+            releases are counted as overruns and the task is lined up with the
+            next release still ahead, so it keeps its phase.
+
+   returns: OS_ERR_INVALID_ID if the caller is not an OSAL task
+            OS_ERROR if the task is not periodic or the clock calls fail
+            OS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_TaskWaitNextPeriod(void)
+{
+    uint32          task_id;
+    uint32          period_usec;
+    uint32          lateness;
+    uint64          late_nsec;
+    uint64          period_nsec;
+    uint64          release_nsec;
+    uint64          missed;
+    struct timespec release;
+    struct timespec now;
+    int             sleepstat;
+
+    task_id = OS_TaskGetId();
+    if (task_id >= OS_MAX_TASKS || OS_task_table[task_id].free == TRUE ||
+        !pthread_equal(OS_task_table[task_id].id, pthread_self()))
+    {
+       return OS_ERR_INVALID_ID;
+    }
+
+    /*
+    ** Only the task itself changes its periodic state, so it can
+    ** be worked on without holding the task table lock
+    */
+    period_usec = OS_task_table[task_id].period_usec;
+    if (period_usec == 0)
+    {
+       return OS_ERROR;
+    }
+
+    release = OS_task_table[task_id].period_next;
+    if (clock_gettime(CLOCK_MONOTONIC, &now) != 0)
+    {
+       return OS_ERROR;
+    }
+
+    if (now.tv_sec < release.tv_sec ||
+        (now.tv_sec == release.tv_sec && now.tv_nsec < release.tv_nsec))
+    {
+       do
+       {
+          sleepstat = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &release, NULL);
+       }
+       while (sleepstat == EINTR);
+
+       if (sleepstat != 0 || clock_gettime(CLOCK_MONOTONIC, &now) != 0)
+       {
+          return OS_ERROR;
+       }
+    }
+
+    /*
+    ** How late the task got going, and how many whole
+    ** releases went by while it was still busy
+    */
+    period_nsec  = (uint64)period_usec * 1000;
+    release_nsec = ((uint64)release.tv_sec * 1000000000) + (uint64)release.tv_nsec;
+    late_nsec    = ((uint64)now.tv_sec * 1000000000) + (uint64)now.tv_nsec - release_nsec;
+    missed = late_nsec / period_nsec;
+    if (missed > 0)
+    {
+       OS_task_table[task_id].period_overruns += (uint32)missed;
+       late_nsec -= missed * period_nsec;
+    }
+
+    lateness = (uint32)(late_nsec / 1000);
+    if (lateness > OS_task_table[task_id].period_worst_lateness)
+    {
+       OS_task_table[task_id].period_worst_lateness = lateness;
+    }
+
+    /*
+    ** The next release stays in 64 bit nanoseconds, so no number
+    ** of missed periods can push it back in time
+    */
+    release_nsec += (missed + 1) * period_nsec;
+    release.tv_sec  = (time_t)(release_nsec / 1000000000);
+    release.tv_nsec = (long)(release_nsec % 1000000000);
+    OS_task_table[task_id].period_next = release;
+
+    return OS_SUCCESS;
+
+}/* end OS_TaskWaitNextPeriod */
+
 /*---------------------------------------------------------------------------------------
    Name: OS_TaskSetPriority
 
@@ -1044,6 +2040,9 @@ int32 OS_TaskSetPriority (uint32 task_id, uint32 new_priority)
 {
     int                os_priority;
     int                ret;
+    pid_t              tid;
+    sigset_t           previous;
+    sigset_t           mask;
 
     if(task_id >= OS_MAX_TASKS || OS_task_table[task_id].free == TRUE)
     {
@@ -1055,11 +2054,33 @@ int32 OS_TaskSetPriority (uint32 task_id, uint32 new_priority)
         return OS_ERR_INVALID_PRIORITY;
     }
    
-    /* Change OSAL priority into a priority that will work for this OS */
-    os_priority = OS_PriorityRemap(new_priority);
+    if (OS_task_table[task_id].policy == OS_SCHED_OTHER)
+    {
+       /*
+       ** Update the table first, a task that has not started
+       ** yet picks its nice value up from there
+       */
+       os_priority = OS_NiceRemap(new_priority);
+
+       OS_InterruptSafeLock(&OS_task_table_mut, &mask, &previous);
+       OS_task_table[task_id].os_priority = os_priority;
+       tid = OS_task_table[task_id].tid;
+       OS_InterruptSafeUnlock(&OS_task_table_mut, &previous);
 
-    if (geteuid() == 0 )
+       if (tid != 0 && setpriority(PRIO_PROCESS, (id_t)tid, os_priority) != 0)
+       {
+          #ifdef OS_DEBUG_PRINTF
+             printf("setpriority err in OS_TaskSetPriority, Task ID = %lu, nice = %d, errno = %s\n",
+                        task_id,os_priority ,strerror(errno));
+          #endif
+          return(OS_ERROR);
+       }
+    }
+    else
     {
+       /* Change OSAL priority into a priority that will work for this OS */
+       os_priority = OS_PriorityRemap(new_priority);
+
        /* 
        ** Set priority
        */
@@ -1072,6 +2093,7 @@ int32 OS_TaskSetPriority (uint32 task_id, uint32 new_priority)
           #endif
           return(OS_ERROR);
        }
+       OS_task_table[task_id].os_priority = os_priority;
     }
 
     /* Use the abstracted priority, not the OS one */
@@ -1221,77 +2243,3139 @@ int32 OS_TaskGetInfo (uint32 task_id, OS_task_prop_t *task_prop)
     sigset_t  previous;
     sigset_t  mask;
 
-    /* 
-    ** Check to see that the id given is valid 
-    */
-    if (task_id >= OS_MAX_TASKS || OS_task_table[task_id].free == TRUE)
+    /* 
+    ** Check to see that the id given is valid 
+    */
+    if (task_id >= OS_MAX_TASKS || OS_task_table[task_id].free == TRUE)
+    {
+       return OS_ERR_INVALID_ID;
+    }
+
+    if( task_prop == NULL)
+    {
+       return OS_INVALID_POINTER;
+    }
+
+    /* put the info into the stucture */
+    OS_InterruptSafeLock(&OS_task_table_mut, &mask, &previous); 
+
+    task_prop -> creator =    OS_task_table[task_id].creator;
+    task_prop -> stack_size = OS_task_table[task_id].stack_size;
+    task_prop -> priority =   OS_task_table[task_id].priority;
+    task_prop -> OStask_id =  (uint32) OS_task_table[task_id].id;
+    task_prop -> policy =     OS_task_table[task_id].policy;
+    task_prop -> os_priority = OS_task_table[task_id].os_priority;
+    
+    strcpy(task_prop-> name, OS_task_table[task_id].name);
+
+    OS_InterruptSafeUnlock(&OS_task_table_mut, &previous); 
+    
+    return OS_SUCCESS;
+    
+} /* end OS_TaskGetInfo */
+
+/*---------------------------------------------------------------------------------------
+    Name: OS_TaskGetStats
+
+    Purpose: This function will pass back the runtime statistics of the specified
+             task: CPU time consumed, voluntary and involuntary context switches,
+             the CPU it last ran on and the stack high-water mark.
+
+    Returns: OS_ERR_INVALID_ID if the ID passed to it is invalid
+             OS_INVALID_POINTER if the task_stats pointer is NULL
+             OS_SUCCESS if it copied all of the statistics over
+ 
+---------------------------------------------------------------------------------------*/
+int32 OS_TaskGetStats (uint32 task_id, OS_task_stats_t *task_stats)
+{
+    /* 
+    ** Check to see that the id given is valid 
+    */
+    if (task_id >= OS_MAX_TASKS || OS_task_table[task_id].free == TRUE)
+    {
+       return OS_ERR_INVALID_ID;
+    }
+
+    if (task_stats == NULL)
+    {
+       return OS_INVALID_POINTER;
+    }
+
+    return OS_TaskCollectStats(task_id, task_stats);
+
+} /* end OS_TaskGetStats */
+
+/*---------------------------------------------------------------------------------------
+    Name: OS_TaskGetStatsAll
+
+    Purpose: Takes a snapshot of the runtime statistics of every task, filling
+             at most max_count entries of task_stats.
+
+    Returns: OS_INVALID_POINTER if task_stats or count is NULL
+             OS_SUCCESS and the number of entries filled in *count
+ 
+---------------------------------------------------------------------------------------*/
+int32 OS_TaskGetStatsAll (OS_task_stats_t *task_stats, uint32 max_count, uint32 *count)
+{
+    uint32 i;
+    uint32 filled;
+
+    if (task_stats == NULL || count == NULL)
+    {
+       return OS_INVALID_POINTER;
+    }
+
+    filled = 0;
+    for (i = 0; i < OS_MAX_TASKS && filled < max_count; i++)
+    {
+        if (OS_task_table[i].free == FALSE &&
+            OS_TaskCollectStats(i, &task_stats[filled]) == OS_SUCCESS)
+        {
+            filled++;
+        }
+    }
+
+    *count = filled;
+
+    return OS_SUCCESS;
+
+} /* end OS_TaskGetStatsAll */
+
+/*---------------------------------------------------------------------------------------
+    Name: OS_TaskStatsMonitorStart
+
+    Purpose: Starts a background task that takes an OS_TaskGetStatsAll snapshot
+             every period_msec milliseconds and hands it to the callback.
+             Only one monitor can run at a time.
+
+    Returns: OS_INVALID_POINTER if the callback is NULL
+             OS_ERROR if the period is 0 or a monitor is already running
+             any error code of OS_TaskCreate if the monitor task can not be created
+             OS_SUCCESS if the monitor was started
+ 
+---------------------------------------------------------------------------------------*/
+int32 OS_TaskStatsMonitorStart (uint32 period_msec, uint32 priority,
+                                OS_TaskStatsCallback_t callback)
+{
+    int32  status;
+    uint32 monitor_id;
+
+    if (callback == NULL)
+    {
+       return OS_INVALID_POINTER;
+    }
+
+    if (period_msec == 0)
+    {
+       return OS_ERROR;
+    }
+
+    pthread_mutex_lock(&OS_task_stats_monitor_mut);
+
+    if (OS_task_stats_monitor.active == TRUE)
+    {
+       pthread_mutex_unlock(&OS_task_stats_monitor_mut);
+       return OS_ERROR;
+    }
+
+    OS_task_stats_monitor.period_msec = period_msec;
+    OS_task_stats_monitor.callback = callback;
+
+    status = OS_TaskCreateEx(&monitor_id, "OS_TaskStatsMon", OS_TaskStatsMonitor, NULL,
+                             OS_TASK_STATS_MONITOR_STACK_SIZE, priority, 0, NULL);
+    if (status == OS_SUCCESS)
+    {
+       OS_task_stats_monitor.task_id = monitor_id;
+       OS_task_stats_monitor.active = TRUE;
+    }
+
+    pthread_mutex_unlock(&OS_task_stats_monitor_mut);
+
+    return status;
+
+} /* end OS_TaskStatsMonitorStart */
+
+/*---------------------------------------------------------------------------------------
+    Name: OS_TaskStatsMonitorStop
+
+    Purpose: Stops the task statistics monitor. No callback is started after
+             this returns, though one already running is allowed to finish.
+
+    Returns: OS_ERROR if no monitor is running, or if called from the callback
+             OS_SUCCESS if the monitor was stopped
+ 
+---------------------------------------------------------------------------------------*/
+int32 OS_TaskStatsMonitorStop (void)
+{
+    int32 status;
+
+    pthread_mutex_lock(&OS_task_stats_monitor_mut);
+
+    if (OS_task_stats_monitor.active != TRUE ||
+        pthread_equal(pthread_self(), OS_task_table[OS_task_stats_monitor.task_id].id))
+    {
+       pthread_mutex_unlock(&OS_task_stats_monitor_mut);
+       return OS_ERROR;
+    }
+
+    status = OS_TaskDeleteCommon(OS_task_stats_monitor.task_id);
+    if (status == OS_SUCCESS)
+    {
+       OS_task_stats_monitor.active = FALSE;
+       OS_task_stats_monitor.task_id = UNINITIALIZED;
+       OS_task_stats_monitor.callback = NULL;
+    }
+
+    pthread_mutex_unlock(&OS_task_stats_monitor_mut);
+
+    return status;
+
+} /* end OS_TaskStatsMonitorStop */
+
+/*---------------------------------------------------------------------------------------
+    Name: OS_TaskStatsMonitorIsTask
+
+    Purpose: Finds out if a task is the running task statistics monitor
+
+    Returns: TRUE if it is, FALSE otherwise
+---------------------------------------------------------------------------------------*/
+int OS_TaskStatsMonitorIsTask(uint32 task_id)
+{
+    int found;
+
+    pthread_mutex_lock(&OS_task_stats_monitor_mut);
+    found = (OS_task_stats_monitor.active == TRUE &&
+             OS_task_stats_monitor.task_id == task_id);
+    pthread_mutex_unlock(&OS_task_stats_monitor_mut);
+
+    return found;
+
+} /* end OS_TaskStatsMonitorIsTask */
+
+/*---------------------------------------------------------------------------------------
+    Name: OS_TaskStatsMonitor
+
+    Purpose: Entry point of the task statistics monitor task. Cancellation is
+             only allowed while it sleeps, so a stop never leaves a /proc file
+             open or a callback half done.
+
+    Returns: nothing
+---------------------------------------------------------------------------------------*/
+void OS_TaskStatsMonitor(void *arg)
+{
+    OS_TaskStatsCallback_t callback;
+    uint32                 period_msec;
+    uint32                 count;
+    int                    cancel_state;
+
+    while (1)
+    {
+        pthread_mutex_lock(&OS_task_stats_monitor_mut);
+        period_msec = OS_task_stats_monitor.period_msec;
+        pthread_mutex_unlock(&OS_task_stats_monitor_mut);
+
+        OS_TaskDelay(period_msec);
+
+        pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &cancel_state);
+
+        /*
+        ** A stop may have come in while this task was waiting for the lock
+        */
+        pthread_mutex_lock(&OS_task_stats_monitor_mut);
+        callback = NULL;
+        if (OS_task_stats_monitor.active == TRUE &&
+            OS_task_stats_monitor.task_id == OS_TaskGetId())
+        {
+            callback = OS_task_stats_monitor.callback;
+        }
+        pthread_mutex_unlock(&OS_task_stats_monitor_mut);
+
+        if (callback != NULL)
+        {
+            OS_TaskGetStatsAll(OS_task_stats_monitor.snapshot, OS_MAX_TASKS, &count);
+            (*callback)(OS_task_stats_monitor.snapshot, count);
+        }
+
+        pthread_setcancelstate(cancel_state, NULL);
+        pthread_testcancel();
+    }
+
+}/* end OS_TaskStatsMonitor */
+
+/*---------------------------------------------------------------------------------------
+    Name: OS_TaskPaintStack
+
+    Purpose: Called by a new task before it runs its entry point. Records the
+             stack bounds and kernel thread id and paints the unused part of the
+             stack, down to the requested stack size, for high-water tracking.
+
+    Returns: nothing
+---------------------------------------------------------------------------------------*/
+void OS_TaskPaintStack(uint32 task_id)
+{
+    pthread_attr_t attr;
+    void          *stack_addr;
+    size_t         stack_len;
+    uint8         *stack_top;
+    uint8         *paint_low;
+    uint8         *paint_high;
+    uint32         stack_size;
+    sigset_t       previous;
+    sigset_t       mask;
+
+    if (pthread_getattr_np(pthread_self(), &attr) != 0)
+    {
+       return;
+    }
+
+    if (pthread_attr_getstack(&attr, &stack_addr, &stack_len) != 0)
+    {
+       pthread_attr_destroy(&attr);
+       return;
+    }
+    pthread_attr_destroy(&attr);
+
+    OS_InterruptSafeLock(&OS_task_table_mut, &mask, &previous);
+    stack_size = OS_task_table[task_id].stack_size;
+    OS_InterruptSafeUnlock(&OS_task_table_mut, &previous);
+
+    /*
+    ** Only the requested size is painted, the OS may hand out a much larger
+    ** stack and touching all of it would commit memory the task never uses.
+    ** In deterministic mode the whole stack is painted, which also takes
+    ** every page fault of the stack now rather than in the middle of a cycle.
+    */
+    stack_top = (uint8 *)stack_addr + stack_len;
+    paint_low = (uint8 *)stack_addr;
+    if (stack_size < stack_len && OS_deterministic_mode == FALSE)
+    {
+       paint_low = stack_top - stack_size;
+    }
+    paint_low = (uint8 *)(((cpuaddr)paint_low + sizeof(uint32) - 1) & ~((cpuaddr)sizeof(uint32) - 1));
+
+    paint_high = (uint8 *)&attr - OS_STACK_PAINT_MARGIN;
+    if (paint_high > paint_low)
+    {
+       memset(paint_low, OS_STACK_PAINT_BYTE, paint_high - paint_low);
+    }
+    else
+    {
+       paint_low = stack_top;
+    }
+
+    /*
+    ** Only publish the stack if the slot still belongs to this thread
+    */
+    OS_InterruptSafeLock(&OS_task_table_mut, &mask, &previous);
+    if (OS_task_table[task_id].free == FALSE &&
+        pthread_equal(OS_task_table[task_id].id, pthread_self()))
+    {
+       OS_task_table[task_id].tid = (pid_t)syscall(SYS_gettid);
+       OS_task_table[task_id].stack_low = paint_low;
+       OS_task_table[task_id].stack_top = stack_top;
+    }
+    OS_InterruptSafeUnlock(&OS_task_table_mut, &previous);
+
+}/* end OS_TaskPaintStack */
+
+/*---------------------------------------------------------------------------------------
+    Name: OS_TaskApplyNice
+
+    Purpose: Called by a new task before it runs its entry point. A task running
+             SCHED_OTHER sets its own nice value, which Linux keeps per thread.
+
+    Returns: nothing
+---------------------------------------------------------------------------------------*/
+void OS_TaskApplyNice(uint32 task_id)
+{
+    uint32    policy;
+    int       nice_value;
+    sigset_t  previous;
+    sigset_t  mask;
+
+    OS_InterruptSafeLock(&OS_task_table_mut, &mask, &previous);
+    policy = OS_task_table[task_id].policy;
+    nice_value = OS_task_table[task_id].os_priority;
+    OS_InterruptSafeUnlock(&OS_task_table_mut, &previous);
+
+    if (policy == OS_SCHED_OTHER &&
+        setpriority(PRIO_PROCESS, (id_t)syscall(SYS_gettid), nice_value) != 0)
+    {
+       #ifdef OS_DEBUG_PRINTF
+          printf("setpriority error in OS_TaskApplyNice, Task ID = %lu, nice = %d\n",
+                 task_id, nice_value);
+       #endif
+    }
+
+}/* end OS_TaskApplyNice */
+
+/*---------------------------------------------------------------------------------------
+    Name: OS_TaskEntryCleanup
+
+    Purpose: Cancellation and exit handler of every task created by OS_TaskCreate.
+             Withdraws the stack bounds so no statistics call can look at the
+             stack once it has been released.
+
+    Returns: nothing
+---------------------------------------------------------------------------------------*/
+void OS_TaskEntryCleanup(void *arg)
+{
+    uint32    task_id = (uint32)((cpuaddr)arg);
+    sigset_t  previous;
+    sigset_t  mask;
+
+    OS_InterruptSafeLock(&OS_task_table_mut, &mask, &previous);
+    if (OS_task_table[task_id].free == FALSE &&
+        pthread_equal(OS_task_table[task_id].id, pthread_self()))
+    {
+       OS_task_table[task_id].tid = 0;
+       OS_task_table[task_id].stack_low = NULL;
+       OS_task_table[task_id].stack_top = NULL;
+    }
+    OS_InterruptSafeUnlock(&OS_task_table_mut, &previous);
+
+}/* end OS_TaskEntryCleanup */
+
+/*---------------------------------------------------------------------------------------
+    Name: OS_TaskCollectStats
+
+    Purpose: Fills in the statistics of one task. The CPU clock and the stack are
+             only looked at while the task table says the thread is alive.
+
+    Returns: OS_ERR_INVALID_ID if the task went away
+             OS_SUCCESS otherwise
+---------------------------------------------------------------------------------------*/
+int32 OS_TaskCollectStats(uint32 task_id, OS_task_stats_t *task_stats)
+{
+    clockid_t       cpu_clock;
+    struct timespec cpu_time;
+    const uint32   *scan;
+    pid_t           tid;
+    sigset_t        previous;
+    sigset_t        mask;
+
+    memset(task_stats, 0, sizeof(OS_task_stats_t));
+    task_stats->current_cpu = -1;
+
+    OS_InterruptSafeLock(&OS_task_table_mut, &mask, &previous);
+
+    if (OS_task_table[task_id].free == TRUE)
+    {
+       OS_InterruptSafeUnlock(&OS_task_table_mut, &previous);
+       return OS_ERR_INVALID_ID;
+    }
+
+    strcpy(task_stats->name, OS_task_table[task_id].name);
+    task_stats->task_id = task_id;
+    task_stats->stack_size = OS_task_table[task_id].stack_size;
+    task_stats->period_overruns = OS_task_table[task_id].period_overruns;
+    task_stats->worst_lateness_usec = OS_task_table[task_id].period_worst_lateness;
+
+    tid = OS_task_table[task_id].tid;
+    if (OS_task_table[task_id].stack_top != NULL)
+    {
+       if (pthread_getcpuclockid(OS_task_table[task_id].id, &cpu_clock) == 0 &&
+           clock_gettime(cpu_clock, &cpu_time) == 0)
+       {
+          task_stats->cpu_time.seconds = cpu_time.tv_sec;
+          task_stats->cpu_time.microsecs = cpu_time.tv_nsec / 1000;
+       }
+
+       /*
+       ** The stack grows down, so the first word that lost its paint
+       ** marks the deepest point the task has reached
+       */
+       scan = (const uint32 *)OS_task_table[task_id].stack_low;
+       while ((const uint8 *)scan < OS_task_table[task_id].stack_top && *scan == OS_STACK_PAINT_WORD)
+       {
+          scan++;
+       }
+       task_stats->stack_high_water = OS_task_table[task_id].stack_top - (const uint8 *)scan;
+    }
+
+    OS_InterruptSafeUnlock(&OS_task_table_mut, &previous);
+
+    if (tid != 0)
+    {
+       OS_TaskReadProcStats(tid, task_stats);
+    }
+
+    return OS_SUCCESS;
+
+}/* end OS_TaskCollectStats */
+
+/*---------------------------------------------------------------------------------------
+    Name: OS_TaskReadProcStats
+
+    Purpose: Reads the context switch counts and the last CPU of a thread from
+             /proc/self/task/<tid>. Fields that can not be read are left alone.
+
+    Returns: nothing
+---------------------------------------------------------------------------------------*/
+void OS_TaskReadProcStats(pid_t tid, OS_task_stats_t *task_stats)
+{
+    char        path[64];
+    char        buffer[2048];
+    const char *field;
+    int         fd;
+    ssize_t     len;
+    uint32      i;
+
+    snprintf(path, sizeof(path), "/proc/self/task/%d/status", (int)tid);
+    fd = open(path, O_RDONLY);
+    if (fd >= 0)
+    {
+       len = read(fd, buffer, sizeof(buffer) - 1);
+       close(fd);
+       if (len > 0)
+       {
+          buffer[len] = '\0';
+          field = strstr(buffer, "\nvoluntary_ctxt_switches:");
+          if (field != NULL)
+          {
+             task_stats->voluntary_switches = strtoul(field + 25, NULL, 10);
+          }
+          field = strstr(buffer, "\nnonvoluntary_ctxt_switches:");
+          if (field != NULL)
+          {
+             task_stats->involuntary_switches = strtoul(field + 28, NULL, 10);
+          }
+       }
+    }
+
+    /*
+    ** Minor and major faults are fields 10 and 12 of the stat line, the
+    ** CPU is field 39. The command name in field 2 may contain blanks,
+    ** so count fields from its closing parenthesis.
+    */
+    snprintf(path, sizeof(path), "/proc/self/task/%d/stat", (int)tid);
+    fd = open(path, O_RDONLY);
+    if (fd >= 0)
+    {
+       len = read(fd, buffer, sizeof(buffer) - 1);
+       close(fd);
+       if (len > 0)
+       {
+          buffer[len] = '\0';
+          field = strrchr(buffer, ')');
+          for (i = 3; field != NULL && i <= 39; i++)
+          {
+             field = strchr(field + 1, ' ');
+             if (field == NULL)
+             {
+                break;
+             }
+             if (i == 10)
+             {
+                task_stats->minor_faults = strtoul(field + 1, NULL, 10);
+             }
+             else if (i == 12)
+             {
+                task_stats->major_faults = strtoul(field + 1, NULL, 10);
+             }
+             else if (i == 39)
+             {
+                task_stats->current_cpu = (int32)strtol(field + 1, NULL, 10);
+             }
+          }
+       }
+    }
+
+}/* end OS_TaskReadProcStats */
+
+/*--------------------------------------------------------------------------------------
+     Name: OS_TaskInstallDeleteHandler
+
+    Purpose: Installs a handler for when the task is deleted.
+
+    returns: status
+---------------------------------------------------------------------------------------*/
+
+int32 OS_TaskInstallDeleteHandler(osal_task_entry function_pointer)
+{
+    uint32    task_id;
+    sigset_t  previous;
+    sigset_t  mask;
+
+    task_id = OS_TaskGetId();
+
+    if ( task_id >= OS_MAX_TASKS )
+    {
+       return(OS_ERR_INVALID_ID);
+    }
+
+    OS_InterruptSafeLock(&OS_task_table_mut, &mask, &previous); 
+
+    if ( OS_task_table[task_id].free != FALSE )
+    {
+       /* 
+       ** Somehow the calling task is not registered 
+       */
+       OS_InterruptSafeUnlock(&OS_task_table_mut, &previous); 
+       return(OS_ERR_INVALID_ID);
+    }
+
+    /*
+    ** Install the pointer
+    */
+    OS_task_table[task_id].delete_hook_pointer = function_pointer;    
+    
+    OS_InterruptSafeUnlock(&OS_task_table_mut, &previous); 
+
+    return(OS_SUCCESS);
+    
+}/*end OS_TaskInstallDeleteHandler */
+
+/****************************************************************************************
+                                  WORK QUEUE API
+****************************************************************************************/
+
+/*
+** A work queue is a pool of ordinary OSAL tasks that execute submitted work items.
+**
+** Each worker owns a fixed size Chase-Lev deque of item indices.  A worker pushes and
+** pops at the bottom of its own deque without locking, idle workers steal from the top
+** of the other deques.  Items submitted by a task that is not a worker of the queue go
+** to a small mutex protected injector ring.  Items come from a per-queue pool that is
+** managed as a lock-free stack, so neither path allocates memory.
+*/
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_WorkItemAlloc
+
+   Purpose: Takes an item off the free stack of a work queue
+
+   returns: The item index or OS_WORK_NONE if the pool is empty
+---------------------------------------------------------------------------------------*/
+uint32 OS_WorkItemAlloc(OS_work_queue_internal_record_t *wq)
+{
+    uint64 head;
+    uint64 new_head;
+    uint32 idx;
+
+    head = __atomic_load_n(&wq->free_head, __ATOMIC_ACQUIRE);
+    do
+    {
+        idx = (uint32)(head & 0xFFFFFFFF);
+        if (idx == OS_WORK_NONE)
+        {
+            return OS_WORK_NONE;
+        }
+        new_head = (((head >> 32) + 1) << 32) |
+                   __atomic_load_n(&wq->items[idx].next, __ATOMIC_RELAXED);
+    }
+    while (!__atomic_compare_exchange_n(&wq->free_head, &head, new_head, FALSE,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+
+    return idx;
+}/* end OS_WorkItemAlloc */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_WorkItemFree
+
+   Purpose: Returns an item to the free stack of a work queue.  The tag in the upper
+            half of the head prevents the ABA problem on concurrent alloc/free.
+
+   returns: nothing
+---------------------------------------------------------------------------------------*/
+void OS_WorkItemFree(OS_work_queue_internal_record_t *wq, uint32 idx)
+{
+    uint64 head;
+    uint64 new_head;
+
+    __atomic_store_n(&wq->items[idx].state,
+                     OS_WORK_STATE(wq->items[idx].generation, OS_WORK_FREE), __ATOMIC_RELAXED);
+
+    head = __atomic_load_n(&wq->free_head, __ATOMIC_RELAXED);
+    do
+    {
+        __atomic_store_n(&wq->items[idx].next, (uint32)(head & 0xFFFFFFFF), __ATOMIC_RELAXED);
+        new_head = (((head >> 32) + 1) << 32) | idx;
+    }
+    while (!__atomic_compare_exchange_n(&wq->free_head, &head, new_head, FALSE,
+                                        __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}/* end OS_WorkItemFree */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_WorkDequePush
+
+   Purpose: Pushes an item on the bottom of a deque.  Only the owning worker may call this.
+
+   returns: TRUE if the item was pushed, FALSE if the deque is full
+---------------------------------------------------------------------------------------*/
+int OS_WorkDequePush(OS_work_deque_t *dq, uint32 idx)
+{
+    int64 bottom;
+    int64 top;
+
+    bottom = __atomic_load_n(&dq->bottom, __ATOMIC_RELAXED);
+    top    = __atomic_load_n(&dq->top, __ATOMIC_ACQUIRE);
+    if ((bottom - top) >= OS_WORK_QUEUE_MAX_DEPTH)
+    {
+        return FALSE;
+    }
+
+    __atomic_store_n(&dq->slots[bottom & (OS_WORK_QUEUE_MAX_DEPTH - 1)], idx, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&dq->bottom, bottom + 1, __ATOMIC_RELAXED);
+
+    return TRUE;
+}/* end OS_WorkDequePush */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_WorkDequePop
+
+   Purpose: Pops the most recently pushed item from the bottom of a deque.  Only the
+            owning worker may call this.
+
+   returns: The item index or OS_WORK_NONE if the deque is empty
+---------------------------------------------------------------------------------------*/
+uint32 OS_WorkDequePop(OS_work_deque_t *dq)
+{
+    int64  bottom;
+    int64  top;
+    uint32 idx;
+
+    bottom = __atomic_load_n(&dq->bottom, __ATOMIC_RELAXED) - 1;
+    __atomic_store_n(&dq->bottom, bottom, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    top = __atomic_load_n(&dq->top, __ATOMIC_RELAXED);
+
+    if (top > bottom)
+    {
+        /* empty */
+        __atomic_store_n(&dq->bottom, bottom + 1, __ATOMIC_RELAXED);
+        return OS_WORK_NONE;
+    }
+
+    idx = __atomic_load_n(&dq->slots[bottom & (OS_WORK_QUEUE_MAX_DEPTH - 1)], __ATOMIC_RELAXED);
+    if (top == bottom)
+    {
+        /* last item, race any thief for it */
+        if (!__atomic_compare_exchange_n(&dq->top, &top, top + 1, FALSE,
+                                         __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+        {
+            idx = OS_WORK_NONE;
+        }
+        __atomic_store_n(&dq->bottom, bottom + 1, __ATOMIC_RELAXED);
+    }
+
+    return idx;
+}/* end OS_WorkDequePop */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_WorkDequeSteal
+
+   Purpose: Takes the oldest item from the top of another worker's deque
+
+   returns: The item index or OS_WORK_NONE if the deque is empty or the race was lost
+---------------------------------------------------------------------------------------*/
+uint32 OS_WorkDequeSteal(OS_work_deque_t *dq)
+{
+    int64  bottom;
+    int64  top;
+    uint32 idx;
+
+    top = __atomic_load_n(&dq->top, __ATOMIC_ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    bottom = __atomic_load_n(&dq->bottom, __ATOMIC_ACQUIRE);
+
+    if (top >= bottom)
+    {
+        return OS_WORK_NONE;
+    }
+
+    idx = __atomic_load_n(&dq->slots[top & (OS_WORK_QUEUE_MAX_DEPTH - 1)], __ATOMIC_RELAXED);
+    if (!__atomic_compare_exchange_n(&dq->top, &top, top + 1, FALSE,
+                                     __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+    {
+        return OS_WORK_NONE;
+    }
+
+    return idx;
+}/* end OS_WorkDequeSteal */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_WorkCurrentWorker
+
+   Purpose: Finds out if the calling task is a worker of the given work queue
+
+   returns: The worker index or OS_WORK_NONE if the caller is not one of its workers
+---------------------------------------------------------------------------------------*/
+uint32 OS_WorkCurrentWorker(uint32 queue_id)
+{
+    cpuaddr key;
+
+    key = (cpuaddr)pthread_getspecific(OS_work_worker_key);
+    if (key == 0 || ((key - 1) / OS_MAX_WORK_QUEUE_WORKERS) != queue_id)
+    {
+        return OS_WORK_NONE;
+    }
+
+    return (uint32)((key - 1) % OS_MAX_WORK_QUEUE_WORKERS);
+}/* end OS_WorkCurrentWorker */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_WorkEnqueue
+
+   Purpose: Makes an item available to the workers and wakes one up if needed
+
+   returns: nothing
+---------------------------------------------------------------------------------------*/
+void OS_WorkEnqueue(uint32 queue_id, uint32 idx)
+{
+    OS_work_queue_internal_record_t *wq = &OS_work_queue_table[queue_id];
+    uint32 worker;
+    int    pushed = FALSE;
+
+    /*
+    ** Count the item before publishing it, so a worker that takes it right
+    ** away can never bring the count below zero. This also pairs with the
+    ** sleepers/queued check in OS_WorkQueueWorker, one side or the other
+    ** always sees the update.
+    */
+    __atomic_add_fetch(&wq->queued, 1, __ATOMIC_SEQ_CST);
+
+    worker = OS_WorkCurrentWorker(queue_id);
+    if (worker != OS_WORK_NONE)
+    {
+        pushed = OS_WorkDequePush(&wq->deque[worker], idx);
+    }
+
+    if (!pushed)
+    {
+        /*
+        ** The pool holds at most OS_WORK_QUEUE_MAX_DEPTH items,
+        ** so the injector ring cannot overflow
+        */
+        pthread_mutex_lock(&wq->mut);
+        wq->injector[(wq->inject_head + wq->inject_count) & (OS_WORK_QUEUE_MAX_DEPTH - 1)] = idx;
+        __atomic_store_n(&wq->inject_count, wq->inject_count + 1, __ATOMIC_RELEASE);
+        pthread_mutex_unlock(&wq->mut);
+    }
+
+    if (__atomic_load_n(&wq->sleepers, __ATOMIC_SEQ_CST) != 0)
+    {
+        pthread_mutex_lock(&wq->mut);
+        pthread_cond_signal(&wq->work_cv);
+        pthread_mutex_unlock(&wq->mut);
+    }
+}/* end OS_WorkEnqueue */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_WorkDequeue
+
+   Purpose: Finds the next item for a worker (or a helping waiter): its own deque first,
+            then the injector, then the other workers' deques.
+
+   returns: The item index or OS_WORK_NONE if nothing is queued
+---------------------------------------------------------------------------------------*/
+uint32 OS_WorkDequeue(uint32 queue_id, uint32 worker)
+{
+    OS_work_queue_internal_record_t *wq = &OS_work_queue_table[queue_id];
+    uint32 idx = OS_WORK_NONE;
+    uint32 i;
+    uint32 victim;
+
+    if (worker != OS_WORK_NONE)
+    {
+        idx = OS_WorkDequePop(&wq->deque[worker]);
+    }
+
+    if (idx == OS_WORK_NONE && __atomic_load_n(&wq->inject_count, __ATOMIC_ACQUIRE) != 0)
+    {
+        pthread_mutex_lock(&wq->mut);
+        if (wq->inject_count != 0)
+        {
+            idx = wq->injector[wq->inject_head];
+            wq->inject_head = (wq->inject_head + 1) & (OS_WORK_QUEUE_MAX_DEPTH - 1);
+            __atomic_store_n(&wq->inject_count, wq->inject_count - 1, __ATOMIC_RELEASE);
+        }
+        pthread_mutex_unlock(&wq->mut);
+    }
+
+    for (i = 1; idx == OS_WORK_NONE && i <= wq->num_workers; i++)
+    {
+        victim = (worker == OS_WORK_NONE ? i - 1 : (worker + i) % wq->num_workers);
+        if (victim != worker)
+        {
+            idx = OS_WorkDequeSteal(&wq->deque[victim]);
+            if (idx != OS_WORK_NONE)
+            {
+                __atomic_add_fetch(&wq->steals, 1, __ATOMIC_RELAXED);
+            }
+        }
+    }
+
+    if (idx != OS_WORK_NONE)
+    {
+        __atomic_sub_fetch(&wq->queued, 1, __ATOMIC_SEQ_CST);
+    }
+
+    return idx;
+}/* end OS_WorkDequeue */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_WorkExecute
+
+   Purpose: Runs one work item and publishes its completion
+
+   returns: nothing
+---------------------------------------------------------------------------------------*/
+void OS_WorkExecute(uint32 queue_id, uint32 idx)
+{
+    OS_work_queue_internal_record_t *wq = &OS_work_queue_table[queue_id];
+    OS_work_item_t *item = &wq->items[idx];
+    uint32 group;
+    int    notify = FALSE;
+
+    __atomic_store_n(&item->state, OS_WORK_STATE(item->generation, OS_WORK_RUNNING),
+                     __ATOMIC_RELAXED);
+    (*item->function)(item->arg);
+
+    group = item->group;
+    if (group != OS_WORK_NONE &&
+        __atomic_sub_fetch(&wq->group_pending[group], 1, __ATOMIC_ACQ_REL) == 0)
+    {
+        notify = TRUE;
+    }
+
+    __atomic_add_fetch(&wq->completed, 1, __ATOMIC_RELAXED);
+    __atomic_sub_fetch(&wq->pending, 1, __ATOMIC_RELEASE);
+
+    if (item->waitable)
+    {
+        /* The waiter returns the item to the pool */
+        __atomic_store_n(&item->state, OS_WORK_STATE(item->generation, OS_WORK_DONE),
+                         __ATOMIC_SEQ_CST);
+        notify = TRUE;
+    }
+    else
+    {
+        OS_WorkItemFree(wq, idx);
+    }
+
+    if (notify && __atomic_load_n(&wq->waiters, __ATOMIC_SEQ_CST) != 0)
+    {
+        pthread_mutex_lock(&wq->mut);
+        pthread_cond_broadcast(&wq->done_cv);
+        pthread_mutex_unlock(&wq->mut);
+    }
+}/* end OS_WorkExecute */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_WorkQueueWorker
+
+   Purpose: Entry point of every work queue worker task
+
+   returns: nothing, the task exits once the queue is shut down and drained
+---------------------------------------------------------------------------------------*/
+void OS_WorkQueueWorker(void *arg)
+{
+    cpuaddr key = (cpuaddr)arg;
+    uint32  queue_id = (uint32)((key - 1) / OS_MAX_WORK_QUEUE_WORKERS);
+    uint32  worker   = (uint32)((key - 1) % OS_MAX_WORK_QUEUE_WORKERS);
+    OS_work_queue_internal_record_t *wq = &OS_work_queue_table[queue_id];
+    uint32  idx;
+
+    pthread_setspecific(OS_work_worker_key, arg);
+
+    while (1)
+    {
+        idx = OS_WorkDequeue(queue_id, worker);
+        if (idx != OS_WORK_NONE)
+        {
+            OS_WorkExecute(queue_id, idx);
+            continue;
+        }
+
+        pthread_mutex_lock(&wq->mut);
+        __atomic_add_fetch(&wq->sleepers, 1, __ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&wq->queued, __ATOMIC_SEQ_CST) == 0)
+        {
+            if (wq->shutdown)
+            {
+                __atomic_sub_fetch(&wq->sleepers, 1, __ATOMIC_SEQ_CST);
+                break;
+            }
+            pthread_cond_wait(&wq->work_cv, &wq->mut);
+        }
+        __atomic_sub_fetch(&wq->sleepers, 1, __ATOMIC_SEQ_CST);
+        pthread_mutex_unlock(&wq->mut);
+    }
+
+    pthread_mutex_unlock(&wq->mut);
+    pthread_setspecific(OS_work_worker_key, NULL);
+
+    /*
+    ** Give back the task table entry before reporting in, so that the
+    ** worker names are free again as soon as OS_WorkQueueDelete returns.
+    ** OS_TaskDelete stops refusing the task id once it is withdrawn here.
+    */
+    __atomic_store_n(&wq->worker_task_ids[worker], OS_WORK_NONE, __ATOMIC_RELEASE);
+    OS_TaskReleaseEntry(OS_TaskGetId());
+
+    pthread_mutex_lock(&wq->mut);
+    wq->live_workers--;
+    pthread_cond_broadcast(&wq->done_cv);
+    pthread_mutex_unlock(&wq->mut);
+
+    pthread_exit(NULL);
+}/* end OS_WorkQueueWorker */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_WorkQueueIsWorker
+
+   Purpose: Finds out if a task is a worker of any work queue
+
+   returns: TRUE if it is, FALSE otherwise
+---------------------------------------------------------------------------------------*/
+int OS_WorkQueueIsWorker(uint32 task_id)
+{
+    uint32   i;
+    uint32   j;
+    int      found = FALSE;
+    sigset_t previous;
+    sigset_t mask;
+
+    OS_InterruptSafeLock(&OS_work_queue_table_mut, &mask, &previous);
+    for (i = 0; i < OS_MAX_WORK_QUEUES && !found; i++)
+    {
+        if (OS_work_queue_table[i].free == TRUE)
+        {
+            continue;
+        }
+        for (j = 0; j < OS_work_queue_table[i].num_workers; j++)
+        {
+            if (__atomic_load_n(&OS_work_queue_table[i].worker_task_ids[j], __ATOMIC_ACQUIRE) == task_id)
+            {
+                found = TRUE;
+                break;
+            }
+        }
+    }
+    OS_InterruptSafeUnlock(&OS_work_queue_table_mut, &previous);
+
+    return found;
+}/* end OS_WorkQueueIsWorker */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_WorkQueueHelp
+
+   Purpose: Used while waiting: runs one queued item if there is one, otherwise
+            blocks briefly until some item completes.
+
+   returns: nothing
+---------------------------------------------------------------------------------------*/
+void OS_WorkQueueHelp(uint32 queue_id, volatile uint32 *done_flag, uint32 done_value)
+{
+    OS_work_queue_internal_record_t *wq = &OS_work_queue_table[queue_id];
+    struct timespec timeout;
+    uint32 idx;
+
+    idx = OS_WorkDequeue(queue_id, OS_WorkCurrentWorker(queue_id));
+    if (idx != OS_WORK_NONE)
+    {
+        OS_WorkExecute(queue_id, idx);
+        return;
+    }
+
+    pthread_mutex_lock(&wq->mut);
+    __atomic_add_fetch(&wq->waiters, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(done_flag, __ATOMIC_SEQ_CST) != done_value)
+    {
+        /*
+        ** Wake up now and then to help with items queued in the meantime
+        */
+        OS_CompAbsDelayTime(OS_WORK_HELP_INTERVAL_MSEC, &timeout);
+        pthread_cond_timedwait(&wq->done_cv, &wq->mut, &timeout);
+    }
+    __atomic_sub_fetch(&wq->waiters, 1, __ATOMIC_SEQ_CST);
+    pthread_mutex_unlock(&wq->mut);
+}/* end OS_WorkQueueHelp */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_WorkQueueCreate
+
+   Purpose: Creates a work queue and starts its worker tasks
+
+   returns: OS_INVALID_POINTER if any of the necessary pointers are NULL
+            OS_ERR_NAME_TOO_LONG if the name leaves no room for the worker task suffix
+            OS_ERR_INVALID_PRIORITY if the priority is bad
+            OS_ERR_NO_FREE_IDS if there can be no more work queues created
+            OS_ERR_NAME_TAKEN if the name specified is already used by a work queue
+            OS_ERROR if num_workers is out of range or the worker tasks cannot be created
+            OS_SUCCESS if success
+
+   NOTES: The workers are OSAL tasks named "<queue_name>.<n>".  When affinity_mask is
+          non zero the workers are spread round-robin over the CPUs it selects.
+---------------------------------------------------------------------------------------*/
+int32 OS_WorkQueueCreate (uint32 *queue_id, const char *queue_name, uint32 num_workers,
+                          uint32 priority, uint32 affinity_mask)
+{
+    OS_work_queue_internal_record_t *wq;
+    OS_task_attr_t      task_attr;
+    char                task_name[OS_MAX_API_NAME];
+    uint32              possible_qid;
+    uint32              i;
+    uint32              cpu;
+    int32               return_code;
+    sigset_t            previous;
+    sigset_t            mask;
+
+    if ( queue_id == NULL || queue_name == NULL )
+    {
+        return OS_INVALID_POINTER;
+    }
+
+    /* leave room for the ".<n>" suffix of the worker names */
+    if (strlen(queue_name) >= (OS_MAX_API_NAME - 3))
+    {
+        return OS_ERR_NAME_TOO_LONG;
+    }
+
+    if (priority > MAX_PRIORITY)
+    {
+        return OS_ERR_INVALID_PRIORITY;
+    }
+
+    if (num_workers == 0 || num_workers > OS_MAX_WORK_QUEUE_WORKERS)
+    {
+        return OS_ERROR;
+    }
+
+    OS_InterruptSafeLock(&OS_work_queue_table_mut, &mask, &previous);
+
+    for (possible_qid = 0; possible_qid < OS_MAX_WORK_QUEUES; possible_qid++)
+    {
+        if (OS_work_queue_table[possible_qid].free == TRUE)
+        {
+            break;
+        }
+    }
+
+    if (possible_qid >= OS_MAX_WORK_QUEUES)
+    {
+        OS_InterruptSafeUnlock(&OS_work_queue_table_mut, &previous);
+        return OS_ERR_NO_FREE_IDS;
+    }
+
+    for (i = 0; i < OS_MAX_WORK_QUEUES; i++)
+    {
+        if ((OS_work_queue_table[i].free == FALSE) &&
+            strcmp(queue_name, OS_work_queue_table[i].name) == 0)
+        {
+            OS_InterruptSafeUnlock(&OS_work_queue_table_mut, &previous);
+            return OS_ERR_NAME_TAKEN;
+        }
+    }
+
+    wq = &OS_work_queue_table[possible_qid];
+    wq->free = FALSE;
+    strcpy(wq->name, queue_name);
+
+    OS_InterruptSafeUnlock(&OS_work_queue_table_mut, &previous);
+
+    /*
+    ** Reset the queue state and thread the whole item pool on the free stack
+    */
+    wq->creator      = OS_FindCreator();
+    wq->num_workers  = num_workers;
+    wq->inject_head  = 0;
+    wq->inject_count = 0;
+    wq->queued       = 0;
+    wq->pending      = 0;
+    wq->completed    = 0;
+    wq->steals       = 0;
+    wq->sleepers     = 0;
+    wq->waiters      = 0;
+    wq->live_workers = 0;
+    wq->shutdown     = FALSE;
+    memset(wq->deque, 0, sizeof(wq->deque));
+    memset(wq->group_pending, 0, sizeof(wq->group_pending));
+    memset(wq->worker_task_ids, 0xFF, sizeof(wq->worker_task_ids));
+    for (i = 0; i < OS_WORK_QUEUE_MAX_DEPTH; i++)
+    {
+        wq->items[i].state      = OS_WORK_STATE(0, OS_WORK_FREE);
+        wq->items[i].generation = 0;
+        wq->items[i].next       = (i + 1 < OS_WORK_QUEUE_MAX_DEPTH) ? (i + 1) : OS_WORK_NONE;
+    }
+    wq->free_head = 0;
+
+    pthread_mutex_init(&wq->mut, NULL);
+    pthread_cond_init(&wq->work_cv, NULL);
+    pthread_cond_init(&wq->done_cv, NULL);
+
+    /*
+    ** Start the workers
+    */
+    return_code = OS_SUCCESS;
+    cpu = 0;
+    for (i = 0; i < num_workers && return_code == OS_SUCCESS; i++)
+    {
+        memset(&task_attr, 0, sizeof(task_attr));
+        if (affinity_mask != 0)
+        {
+            /* next CPU in the mask, wrapping around */
+            while ((affinity_mask & (1UL << cpu)) == 0)
+            {
+                cpu = (cpu + 1) % 32;
+            }
+            task_attr.affinity_mask = (1UL << cpu);
+            cpu = (cpu + 1) % 32;
+        }
+
+        sprintf(task_name, "%s.%u", queue_name, (unsigned int)i);
+        wq->live_workers++;
+        return_code = OS_TaskCreateEx(&wq->worker_task_ids[i], task_name, OS_WorkQueueWorker,
+                         (void *)((cpuaddr)(possible_qid * OS_MAX_WORK_QUEUE_WORKERS + i + 1)),
+                         OS_WORK_QUEUE_STACK_SIZE, priority, 0, &task_attr);
+        if (return_code != OS_SUCCESS)
+        {
+            wq->live_workers--;
+        }
+    }
+
+    if (return_code != OS_SUCCESS)
+    {
+        /*
+        ** Stop the workers that did start, then give the slot back
+        */
+        OS_WorkQueueDelete(possible_qid);
+        return return_code;
+    }
+
+    *queue_id = possible_qid;
+
+    return OS_SUCCESS;
+}/* end OS_WorkQueueCreate */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_WorkQueueDelete
+
+   Purpose: Stops the workers of a work queue once all submitted items have run and
+            frees the work queue
+
+   returns: OS_ERR_INVALID_ID if the id passed in is not a valid work queue
+            OS_ERROR if called from one of the queue's own workers
+            OS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_WorkQueueDelete (uint32 queue_id)
+{
+    OS_work_queue_internal_record_t *wq;
+    sigset_t previous;
+    sigset_t mask;
+
+    if (queue_id >= OS_MAX_WORK_QUEUES || OS_work_queue_table[queue_id].free == TRUE)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    if (OS_WorkCurrentWorker(queue_id) != OS_WORK_NONE)
+    {
+        return OS_ERROR;
+    }
+
+    wq = &OS_work_queue_table[queue_id];
+
+    pthread_mutex_lock(&wq->mut);
+    wq->shutdown = TRUE;
+    pthread_cond_broadcast(&wq->work_cv);
+    while (wq->live_workers > 0)
+    {
+        pthread_cond_wait(&wq->done_cv, &wq->mut);
+    }
+    pthread_mutex_unlock(&wq->mut);
+
+    pthread_cond_destroy(&wq->work_cv);
+    pthread_cond_destroy(&wq->done_cv);
+    pthread_mutex_destroy(&wq->mut);
+
+    OS_InterruptSafeLock(&OS_work_queue_table_mut, &mask, &previous);
+    wq->free = TRUE;
+    strcpy(wq->name, "");
+    wq->creator = UNINITIALIZED;
+    wq->num_workers = 0;
+    OS_InterruptSafeUnlock(&OS_work_queue_table_mut, &previous);
+
+    return OS_SUCCESS;
+}/* end OS_WorkQueueDelete */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_WorkSubmitInternal
+
+   Purpose: Common code of OS_WorkSubmit and OS_WorkSubmitGroup
+
+   returns: see OS_WorkSubmit
+---------------------------------------------------------------------------------------*/
+int32 OS_WorkSubmitInternal (uint32 queue_id, uint32 group, OS_WorkFunc_t function,
+                             void *arg, uint32 *work_id)
+{
+    OS_work_queue_internal_record_t *wq;
+    OS_work_item_t *item;
+    uint32 idx;
+
+    if (function == NULL)
+    {
+        return OS_INVALID_POINTER;
+    }
+
+    if (queue_id >= OS_MAX_WORK_QUEUES || OS_work_queue_table[queue_id].free == TRUE)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    wq = &OS_work_queue_table[queue_id];
+    if (wq->shutdown)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    idx = OS_WorkItemAlloc(wq);
+    if (idx == OS_WORK_NONE)
+    {
+        return OS_QUEUE_FULL;
+    }
+
+    item = &wq->items[idx];
+    item->function = function;
+    item->arg      = arg;
+    item->group    = group;
+    item->waitable = (work_id != NULL);
+    item->generation++;
+    __atomic_store_n(&item->state, OS_WORK_STATE(item->generation, OS_WORK_QUEUED),
+                     __ATOMIC_RELAXED);
+
+    if (group != OS_WORK_NONE)
+    {
+        __atomic_add_fetch(&wq->group_pending[group], 1, __ATOMIC_ACQ_REL);
+    }
+    __atomic_add_fetch(&wq->pending, 1, __ATOMIC_RELAXED);
+
+    if (work_id != NULL)
+    {
+        *work_id = ((item->generation & 0xFFFF) << 16) | idx;
+    }
+
+    OS_WorkEnqueue(queue_id, idx);
+
+    return OS_SUCCESS;
+}/* end OS_WorkSubmitInternal */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_WorkSubmit
+
+   Purpose: Queues function(arg) for execution by a work queue.  When called from one of
+            the queue's workers the item goes on that worker's own deque.
+
+   returns: OS_INVALID_POINTER if function is NULL
+            OS_ERR_INVALID_ID if the id passed in is not a valid work queue
+            OS_QUEUE_FULL if OS_WORK_QUEUE_MAX_DEPTH items are already outstanding
+            OS_SUCCESS if success
+
+   NOTES: If work_id is not NULL it receives an id that must later be passed to
+          OS_WorkWait, which also releases the item.  Pass NULL for fire and forget.
+---------------------------------------------------------------------------------------*/
+int32 OS_WorkSubmit (uint32 queue_id, OS_WorkFunc_t function, void *arg, uint32 *work_id)
+{
+    return OS_WorkSubmitInternal(queue_id, OS_WORK_NONE, function, arg, work_id);
+}/* end OS_WorkSubmit */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_WorkSubmitGroup
+
+   Purpose: Queues function(arg) as a member of a group of items that can be waited for
+            together with OS_WorkGroupWait
+
+   returns: OS_ERROR if the group number is out of range, otherwise as OS_WorkSubmit
+---------------------------------------------------------------------------------------*/
+int32 OS_WorkSubmitGroup (uint32 queue_id, uint32 group, OS_WorkFunc_t function, void *arg)
+{
+    if (group >= OS_MAX_WORK_GROUPS)
+    {
+        return OS_ERROR;
+    }
+
+    return OS_WorkSubmitInternal(queue_id, group, function, arg, NULL);
+}/* end OS_WorkSubmitGroup */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_WorkWait
+
+   Purpose: Waits until a submitted item has run.  The caller runs queued items of the
+            same work queue while it waits, so workers may wait on items they submitted.
+
+   returns: OS_ERR_INVALID_ID if the queue or work id is not valid, or if another
+            call already waited for the item
+            OS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_WorkWait (uint32 queue_id, uint32 work_id)
+{
+    OS_work_queue_internal_record_t *wq;
+    OS_work_item_t *item;
+    uint32 idx;
+    uint32 state;
+    uint32 done_state;
+
+    if (queue_id >= OS_MAX_WORK_QUEUES || OS_work_queue_table[queue_id].free == TRUE)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    wq  = &OS_work_queue_table[queue_id];
+    idx = work_id & 0xFFFF;
+    if (idx >= OS_WORK_QUEUE_MAX_DEPTH)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    item       = &wq->items[idx];
+    done_state = OS_WORK_STATE(work_id >> 16, OS_WORK_DONE);
+    while ((state = __atomic_load_n(&item->state, __ATOMIC_ACQUIRE)) != done_state)
+    {
+        /* Released by another waiter, and possibly reused since */
+        if (!item->waitable || OS_WORK_GEN_OF(state) != (work_id >> 16) ||
+            OS_WORK_STATE_OF(state) == OS_WORK_FREE)
+        {
+            return OS_ERR_INVALID_ID;
+        }
+        OS_WorkQueueHelp(queue_id, &item->state, done_state);
+    }
+
+    /*
+    ** Only the waiter that moves the item from DONE to FREE gives it back
+    */
+    if (!__atomic_compare_exchange_n(&item->state, &state, OS_WORK_STATE(work_id >> 16, OS_WORK_FREE),
+                                     FALSE, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    OS_WorkItemFree(wq, idx);
+
+    return OS_SUCCESS;
+}/* end OS_WorkWait */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_WorkGroupWait
+
+   Purpose: Waits until every item submitted to a group has run, helping like OS_WorkWait
+
+   returns: OS_ERR_INVALID_ID if the id passed in is not a valid work queue
+            OS_ERROR if the group number is out of range
+            OS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_WorkGroupWait (uint32 queue_id, uint32 group)
+{
+    OS_work_queue_internal_record_t *wq;
+
+    if (queue_id >= OS_MAX_WORK_QUEUES || OS_work_queue_table[queue_id].free == TRUE)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    if (group >= OS_MAX_WORK_GROUPS)
+    {
+        return OS_ERROR;
+    }
+
+    wq = &OS_work_queue_table[queue_id];
+    while (__atomic_load_n(&wq->group_pending[group], __ATOMIC_ACQUIRE) != 0)
+    {
+        OS_WorkQueueHelp(queue_id, &wq->group_pending[group], 0);
+    }
+
+    return OS_SUCCESS;
+}/* end OS_WorkGroupWait */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_WorkQueueGetIdByName
+
+   Purpose: This function tries to find a work queue Id given the name of the queue
+
+   returns: OS_INVALID_POINTER if the pointers passed in are NULL
+            OS_ERR_NAME_TOO_LONG if the name to found is too long to begin with
+            OS_ERR_NAME_NOT_FOUND if the name wasn't found in the table
+            OS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_WorkQueueGetIdByName (uint32 *queue_id, const char *queue_name)
+{
+    uint32 i;
+
+    if (queue_id == NULL || queue_name == NULL)
+    {
+        return OS_INVALID_POINTER;
+    }
+
+    if (strlen(queue_name) >= OS_MAX_API_NAME)
+    {
+        return OS_ERR_NAME_TOO_LONG;
+    }
+
+    for (i = 0; i < OS_MAX_WORK_QUEUES; i++)
+    {
+        if (OS_work_queue_table[i].free != TRUE &&
+            strcmp(OS_work_queue_table[i].name, queue_name) == 0)
+        {
+            *queue_id = i;
+            return OS_SUCCESS;
+        }
+    }
+
+    return OS_ERR_NAME_NOT_FOUND;
+}/* end OS_WorkQueueGetIdByName */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_WorkQueueGetInfo
+
+   Purpose: This function will pass back a pointer to structure that contains
+            all of the relevant info (name, workers, counters) about a work queue
+
+   returns: OS_INVALID_POINTER if queue_prop is NULL
+            OS_ERR_INVALID_ID if the id passed in is not a valid work queue
+            OS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_WorkQueueGetInfo (uint32 queue_id, OS_work_queue_prop_t *queue_prop)
+{
+    OS_work_queue_internal_record_t *wq;
+    sigset_t previous;
+    sigset_t mask;
+
+    if (queue_prop == NULL)
+    {
+        return OS_INVALID_POINTER;
+    }
+
+    if (queue_id >= OS_MAX_WORK_QUEUES || OS_work_queue_table[queue_id].free == TRUE)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    wq = &OS_work_queue_table[queue_id];
+
+    OS_InterruptSafeLock(&OS_work_queue_table_mut, &mask, &previous);
+
+    strcpy(queue_prop->name, wq->name);
+    queue_prop->creator     = wq->creator;
+    queue_prop->num_workers = wq->num_workers;
+    queue_prop->pending     = __atomic_load_n(&wq->pending, __ATOMIC_RELAXED);
+    queue_prop->completed   = __atomic_load_n(&wq->completed, __ATOMIC_RELAXED);
+    queue_prop->steals      = __atomic_load_n(&wq->steals, __ATOMIC_RELAXED);
+
+    OS_InterruptSafeUnlock(&OS_work_queue_table_mut, &previous);
+
+    return OS_SUCCESS;
+}/* end OS_WorkQueueGetInfo */
+
+/****************************************************************************************
+                                     FIBER API
+****************************************************************************************/
+
+/*
+** Fibers are user space coroutines multiplexed onto the worker tasks of a fiber
+** scheduler, so an application can run far more concurrent activities than
+** OS_MAX_TASKS allows.  Fibers are scheduled cooperatively: a fiber runs until it
+** yields, delays, blocks on a fiber semaphore or fiber queue, or finishes.  Blocking
+** switches to another fiber in user space instead of entering the kernel.  A fiber
+** that calls a blocking OSAL task function holds up its worker for that long.
+**
+** Each worker has its own ready list and an idle worker steals from the others.  The
+** sleep list of a scheduler, and the waiters of each fiber semaphore and queue, have
+** their own locks.  No lock is held across a switch: a fiber sets its switching flag,
+** puts itself on the list it waits on, drops the lock and switches to its worker,
+** which clears the flag once the fiber context is saved.  A worker that picks the
+** fiber up in the meantime waits for the flag before switching to it.
+**
+** A blocked fiber may be woken by its wait list or by its timeout.  Each wait has a
+** sequence number in wait_word, and only the waker that clears the low bit with a
+** compare-and-swap wakes the fiber; the other one leaves it alone.
+*/
+
+#ifdef OS_FIBER_ASM_SWITCH
+/*
+** OS_FiberContextSwitch(save_sp, load_sp) pushes the callee-saved registers and the
+** SSE and x87 control words, stores the stack pointer in *save_sp, loads load_sp and
+** pops the same frame from there.  OS_FiberStart is where a new fiber first returns
+** to, with its index in r12.
+*/
+void OS_FiberContextSwitch(void **save_sp, void *load_sp);
+void OS_FiberStart(void);
+
+__asm__ (
+    ".pushsection .text\n"
+    ".globl OS_FiberContextSwitch\n"
+    ".type OS_FiberContextSwitch, @function\n"
+    "OS_FiberContextSwitch:\n"
+    "    pushq %rbp\n"
+    "    pushq %rbx\n"
+    "    pushq %r12\n"
+    "    pushq %r13\n"
+    "    pushq %r14\n"
+    "    pushq %r15\n"
+    "    subq $8, %rsp\n"
+    "    stmxcsr (%rsp)\n"
+    "    fnstcw 4(%rsp)\n"
+    "    movq %rsp, (%rdi)\n"
+    "    movq %rsi, %rsp\n"
+    "    ldmxcsr (%rsp)\n"
+    "    fldcw 4(%rsp)\n"
+    "    addq $8, %rsp\n"
+    "    popq %r15\n"
+    "    popq %r14\n"
+    "    popq %r13\n"
+    "    popq %r12\n"
+    "    popq %rbx\n"
+    "    popq %rbp\n"
+    "    ret\n"
+    ".size OS_FiberContextSwitch, .-OS_FiberContextSwitch\n"
+    ".globl OS_FiberStart\n"
+    ".type OS_FiberStart, @function\n"
+    "OS_FiberStart:\n"
+    "    movq %r12, %rdi\n"
+    "    call OS_FiberTrampoline@PLT\n"
+    "    ud2\n"
+    ".size OS_FiberStart, .-OS_FiberStart\n"
+    ".popsection\n"
+);
+
+#define OS_FIBER_SWITCH(from, to)   OS_FiberContextSwitch(&(from)->sp, (to)->sp)
+#else
+#define OS_FIBER_SWITCH(from, to)   swapcontext((from), (to))
+#endif
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberContextInit
+
+   Purpose: Sets up the context of a new fiber so that the first switch to it calls
+            OS_FiberTrampoline(idx) on its own stack
+---------------------------------------------------------------------------------------*/
+void OS_FiberContextInit(OS_fiber_internal_record_t *fiber, uint32 idx, void *stack,
+                         uint32 stack_size)
+{
+#ifdef OS_FIBER_ASM_SWITCH
+    uint64 *sp;
+
+    /*
+    ** The frame OS_FiberContextSwitch pops, arranged so that the stack
+    ** is 16 byte aligned when OS_FiberStart calls OS_FiberTrampoline
+    */
+    sp = (uint64 *)(((cpuaddr)stack + stack_size) & ~((cpuaddr)15));
+    sp -= 2;
+    *--sp = (uint64)(cpuaddr)OS_FiberStart;   /* return address */
+    *--sp = 0;                                /* rbp */
+    *--sp = 0;                                /* rbx */
+    *--sp = idx;                              /* r12 */
+    *--sp = 0;                                /* r13 */
+    *--sp = 0;                                /* r14 */
+    *--sp = 0;                                /* r15 */
+    *--sp = ((uint64)0x037F << 32) | 0x1F80;  /* default x87 control word and MXCSR */
+    fiber->context.sp = sp;
+#else
+    getcontext(&fiber->context);
+    fiber->context.uc_stack.ss_sp   = stack;
+    fiber->context.uc_stack.ss_size = stack_size;
+    fiber->context.uc_link          = NULL;
+    makecontext(&fiber->context, (void (*)(void))OS_FiberTrampoline, 1, (int)idx);
+#endif
+}/* end OS_FiberContextInit */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberListPush
+
+   Purpose: Appends a fiber to a FIFO list
+---------------------------------------------------------------------------------------*/
+void OS_FiberListPush(OS_fiber_list_t *list, uint32 idx)
+{
+    OS_fiber_table[idx].next = OS_FIBER_NONE;
+    if (list->head == OS_FIBER_NONE)
+    {
+        list->head = idx;
+    }
+    else
+    {
+        OS_fiber_table[list->tail].next = idx;
+    }
+    list->tail = idx;
+}/* end OS_FiberListPush */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberListPop
+
+   Purpose: Takes the first fiber off a FIFO list
+
+   returns: The fiber index or OS_FIBER_NONE if the list is empty
+---------------------------------------------------------------------------------------*/
+uint32 OS_FiberListPop(OS_fiber_list_t *list)
+{
+    uint32 idx = list->head;
+
+    if (idx != OS_FIBER_NONE)
+    {
+        list->head = OS_fiber_table[idx].next;
+    }
+    return idx;
+}/* end OS_FiberListPop */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberListRemove
+
+   Purpose: Unlinks a fiber from anywhere in a FIFO list
+---------------------------------------------------------------------------------------*/
+void OS_FiberListRemove(OS_fiber_list_t *list, uint32 idx)
+{
+    uint32 prev = OS_FIBER_NONE;
+    uint32 cur  = list->head;
+
+    while (cur != OS_FIBER_NONE && cur != idx)
+    {
+        prev = cur;
+        cur  = OS_fiber_table[cur].next;
+    }
+
+    if (cur == OS_FIBER_NONE)
+    {
+        return;
+    }
+
+    if (prev == OS_FIBER_NONE)
+    {
+        list->head = OS_fiber_table[idx].next;
+    }
+    else
+    {
+        OS_fiber_table[prev].next = OS_fiber_table[idx].next;
+    }
+    if (list->tail == idx)
+    {
+        list->tail = prev;
+    }
+}/* end OS_FiberListRemove */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberSleepInsert
+
+   Purpose: Puts a fiber on the sleep list of its scheduler, which is kept sorted
+            by wake time.  Called with the scheduler lock held.
+---------------------------------------------------------------------------------------*/
+void OS_FiberSleepInsert(OS_fiber_sched_internal_record_t *sched, uint32 idx)
+{
+    OS_fiber_internal_record_t *fiber = &OS_fiber_table[idx];
+    uint32 *link = &sched->sleep_head;
+
+    while (*link != OS_FIBER_NONE)
+    {
+        struct timespec *other = &OS_fiber_table[*link].wake_time;
+
+        if (other->tv_sec > fiber->wake_time.tv_sec ||
+            (other->tv_sec == fiber->wake_time.tv_sec &&
+             other->tv_nsec > fiber->wake_time.tv_nsec))
+        {
+            break;
+        }
+        link = &OS_fiber_table[*link].sleep_next;
+    }
+
+    fiber->sleep_next = *link;
+    fiber->sleeping   = TRUE;
+    *link = idx;
+}/* end OS_FiberSleepInsert */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberSleepRemove
+
+   Purpose: Takes a fiber off the sleep list of its scheduler.  Called with the
+            scheduler lock held.
+---------------------------------------------------------------------------------------*/
+void OS_FiberSleepRemove(OS_fiber_sched_internal_record_t *sched, uint32 idx)
+{
+    uint32 *link = &sched->sleep_head;
+
+    while (*link != OS_FIBER_NONE && *link != idx)
+    {
+        link = &OS_fiber_table[*link].sleep_next;
+    }
+
+    if (*link == idx)
+    {
+        *link = OS_fiber_table[idx].sleep_next;
+    }
+    OS_fiber_table[idx].sleeping = FALSE;
+}/* end OS_FiberSleepRemove */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberClaim
+
+   Purpose: Claims the wake up of a blocked fiber.  Called with the lock of a list the
+            fiber is on held, so wait_word still belongs to that wait.
+
+   returns: TRUE if the caller now owns the wake up, FALSE if another waker got it
+---------------------------------------------------------------------------------------*/
+int OS_FiberClaim(uint32 idx)
+{
+    uint32 word = __atomic_load_n(&OS_fiber_table[idx].wait_word, __ATOMIC_ACQUIRE);
+
+    return ((word & 1) != 0 &&
+            __atomic_compare_exchange_n(&OS_fiber_table[idx].wait_word, &word, word & ~1U,
+                                        FALSE, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+}/* end OS_FiberClaim */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberPopWaiter
+
+   Purpose: Takes the first fiber whose wake up can be claimed off a wait list.  Called
+            with the lock of the list held.
+
+   returns: The fiber index, now owned by the caller, or OS_FIBER_NONE
+---------------------------------------------------------------------------------------*/
+uint32 OS_FiberPopWaiter(OS_fiber_list_t *wait_list)
+{
+    uint32 idx;
+
+    while ((idx = OS_FiberListPop(wait_list)) != OS_FIBER_NONE)
+    {
+        if (OS_FiberClaim(idx))
+        {
+            /* already off the list, OS_FiberWakeClaimed need not look for it */
+            OS_fiber_table[idx].wait_list = NULL;
+            break;
+        }
+    }
+
+    return idx;
+}/* end OS_FiberPopWaiter */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberWakeClaimed
+
+   Purpose: Ends the wait of a fiber whose wake up the caller claimed: takes it off the
+            lists it may still be on and makes it ready.  Called without any fiber lock.
+---------------------------------------------------------------------------------------*/
+void OS_FiberWakeClaimed(uint32 idx, int32 result)
+{
+    OS_fiber_internal_record_t *fiber = &OS_fiber_table[idx];
+    OS_fiber_sched_internal_record_t *sched = &OS_fiber_sched_table[fiber->sched_id];
+
+    if (fiber->wait_list != NULL)
+    {
+        pthread_mutex_lock(fiber->wait_mut);
+        OS_FiberListRemove(fiber->wait_list, idx);
+        pthread_mutex_unlock(fiber->wait_mut);
+        fiber->wait_list = NULL;
+    }
+    if (fiber->timed)
+    {
+        pthread_mutex_lock(&sched->mut);
+        if (fiber->sleeping)
+        {
+            OS_FiberSleepRemove(sched, idx);
+        }
+        pthread_mutex_unlock(&sched->mut);
+    }
+    fiber->wait_result = result;
+    OS_FiberMakeReady(idx);
+}/* end OS_FiberWakeClaimed */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberWakeSleepers
+
+   Purpose: Wakes every fiber whose wake time has passed with its timeout result
+---------------------------------------------------------------------------------------*/
+void OS_FiberWakeSleepers(OS_fiber_sched_internal_record_t *sched)
+{
+    OS_fiber_internal_record_t *fiber;
+    struct timespec now;
+    uint32 idx;
+    int    claimed;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    pthread_mutex_lock(&sched->mut);
+    while (sched->sleep_head != OS_FIBER_NONE)
+    {
+        idx   = sched->sleep_head;
+        fiber = &OS_fiber_table[idx];
+        if (fiber->wake_time.tv_sec > now.tv_sec ||
+            (fiber->wake_time.tv_sec == now.tv_sec && fiber->wake_time.tv_nsec > now.tv_nsec))
+        {
+            break;
+        }
+
+        sched->sleep_head = fiber->sleep_next;
+        fiber->sleeping = FALSE;
+        claimed = OS_FiberClaim(idx);
+        pthread_mutex_unlock(&sched->mut);
+
+        if (claimed)
+        {
+            OS_FiberWakeClaimed(idx, fiber->timeout_result);
+        }
+
+        pthread_mutex_lock(&sched->mut);
+    }
+    pthread_mutex_unlock(&sched->mut);
+}/* end OS_FiberWakeSleepers */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberMakeReady
+
+   Purpose: Queues a fiber on the worker it last ran on and wakes an idle worker of
+            its scheduler
+---------------------------------------------------------------------------------------*/
+void OS_FiberMakeReady(uint32 idx)
+{
+    OS_fiber_internal_record_t *fiber = &OS_fiber_table[idx];
+    OS_fiber_sched_internal_record_t *sched = &OS_fiber_sched_table[fiber->sched_id];
+    OS_fiber_worker_t *worker = &sched->workers[fiber->worker];
+
+    pthread_mutex_lock(&worker->ready_mut);
+    __atomic_store_n(&fiber->state, OS_FIBER_READY, __ATOMIC_RELAXED);
+    OS_FiberListPush(&worker->ready, idx);
+    pthread_mutex_unlock(&worker->ready_mut);
+
+    /*
+    ** Pairs with the idle_workers/ready check in OS_FiberSchedWorker,
+    ** one side or the other always sees the update
+    */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&sched->idle_workers, __ATOMIC_RELAXED) != 0)
+    {
+        pthread_mutex_lock(&sched->mut);
+        pthread_cond_signal(&sched->work_cv);
+        pthread_mutex_unlock(&sched->mut);
+    }
+}/* end OS_FiberMakeReady */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberNextReady
+
+   Purpose: Finds the next fiber for a worker: its own ready list first, then the
+            ready lists of the other workers
+
+   returns: The fiber index or OS_FIBER_NONE if no fiber is ready
+---------------------------------------------------------------------------------------*/
+uint32 OS_FiberNextReady(OS_fiber_sched_internal_record_t *sched, uint32 worker)
+{
+    OS_fiber_worker_t *victim;
+    uint32 idx = OS_FIBER_NONE;
+    uint32 i;
+
+    for (i = 0; idx == OS_FIBER_NONE && i < sched->num_workers; i++)
+    {
+        victim = &sched->workers[(worker + i) % sched->num_workers];
+        if (__atomic_load_n(&victim->ready.head, __ATOMIC_RELAXED) != OS_FIBER_NONE)
+        {
+            pthread_mutex_lock(&victim->ready_mut);
+            idx = OS_FiberListPop(&victim->ready);
+            pthread_mutex_unlock(&victim->ready_mut);
+        }
+    }
+
+    return idx;
+}/* end OS_FiberNextReady */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberAnyReady
+
+   returns: TRUE if any worker of the scheduler has a fiber queued
+---------------------------------------------------------------------------------------*/
+int OS_FiberAnyReady(OS_fiber_sched_internal_record_t *sched)
+{
+    uint32 i;
+    int    ready = FALSE;
+
+    for (i = 0; !ready && i < sched->num_workers; i++)
+    {
+        pthread_mutex_lock(&sched->workers[i].ready_mut);
+        ready = (sched->workers[i].ready.head != OS_FIBER_NONE);
+        pthread_mutex_unlock(&sched->workers[i].ready_mut);
+    }
+
+    return ready;
+}/* end OS_FiberAnyReady */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberCurrent
+
+   returns: The fiber running on the calling thread or OS_FIBER_NONE
+---------------------------------------------------------------------------------------*/
+uint32 OS_FiberCurrent(void)
+{
+    OS_fiber_worker_t *worker;
+
+    worker = (OS_fiber_worker_t *)pthread_getspecific(OS_fiber_worker_key);
+    if (worker == NULL)
+    {
+        return OS_FIBER_NONE;
+    }
+    return worker->current;
+}/* end OS_FiberCurrent */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberSwitchOut
+
+   Purpose: Switches from the calling fiber back to its worker.  The fiber must have
+            set its switching flag before making itself visible to other workers.
+            Returns once a worker resumes the fiber.
+---------------------------------------------------------------------------------------*/
+void OS_FiberSwitchOut(uint32 idx)
+{
+    OS_fiber_internal_record_t *fiber = &OS_fiber_table[idx];
+    OS_fiber_worker_t *worker = &OS_fiber_sched_table[fiber->sched_id].workers[fiber->worker];
+
+    OS_FIBER_SWITCH(&fiber->context, &worker->context);
+}/* end OS_FiberSwitchOut */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberBlock
+
+   Purpose: Blocks the calling fiber on wait_list, if not NULL, and for at most
+            timeout milliseconds unless timeout is OS_PEND.  Must be called with
+            wait_mut, the lock of wait_list, held; returns without it.
+
+   returns: The result passed to OS_FiberWakeClaimed, timeout_result if the time ran out
+---------------------------------------------------------------------------------------*/
+int32 OS_FiberBlock(uint32 idx, OS_fiber_list_t *wait_list, pthread_mutex_t *wait_mut,
+                    int32 timeout, int32 timeout_result)
+{
+    OS_fiber_internal_record_t *fiber = &OS_fiber_table[idx];
+    OS_fiber_sched_internal_record_t *sched = &OS_fiber_sched_table[fiber->sched_id];
+    uint32 word;
+
+    fiber->state          = OS_FIBER_BLOCKED;
+    fiber->wait_list      = wait_list;
+    fiber->wait_mut       = wait_mut;
+    fiber->timeout_result = timeout_result;
+    fiber->timed          = (timeout != OS_PEND);
+    __atomic_store_n(&fiber->switching, TRUE, __ATOMIC_RELAXED);
+
+    /* open a new wait, the previous one has been claimed */
+    word = __atomic_load_n(&fiber->wait_word, __ATOMIC_RELAXED);
+    __atomic_store_n(&fiber->wait_word, (((word >> 1) + 1) << 1) | 1, __ATOMIC_RELEASE);
+
+    if (wait_list != NULL)
+    {
+        OS_FiberListPush(wait_list, idx);
+    }
+    if (fiber->timed)
+    {
+        OS_FiberCompAbsTime((uint32)timeout, &fiber->wake_time);
+        pthread_mutex_lock(&sched->mut);
+        OS_FiberSleepInsert(sched, idx);
+        pthread_mutex_unlock(&sched->mut);
+    }
+    if (wait_mut != NULL)
+    {
+        pthread_mutex_unlock(wait_mut);
+    }
+
+    OS_FiberSwitchOut(idx);
+
+    return fiber->wait_result;
+}/* end OS_FiberBlock */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberCompAbsTime
+
+   Purpose: Computes the CLOCK_MONOTONIC time milli_second from now
+---------------------------------------------------------------------------------------*/
+void OS_FiberCompAbsTime(uint32 milli_second, struct timespec *tm)
+{
+    clock_gettime(CLOCK_MONOTONIC, tm);
+    tm->tv_sec += milli_second / 1000;
+    OS_TimespecAddUsec(tm, (milli_second % 1000) * 1000);
+}/* end OS_FiberCompAbsTime */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberTrampoline
+
+   Purpose: First function of every fiber, runs the entry point and ends the fiber
+---------------------------------------------------------------------------------------*/
+void OS_FiberTrampoline(int idx)
+{
+    OS_fiber_internal_record_t *fiber = &OS_fiber_table[idx];
+
+    fiber->function(fiber->arg);
+
+    OS_FiberExit();
+}/* end OS_FiberTrampoline */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberSchedWorker
+
+   Purpose: Entry point of every fiber scheduler worker task, runs ready fibers
+            until the scheduler is deleted
+
+   returns: nothing
+---------------------------------------------------------------------------------------*/
+void OS_FiberSchedWorker(void *arg)
+{
+    cpuaddr key = (cpuaddr)arg;
+    uint32  sched_id = (uint32)((key - 1) / OS_MAX_FIBER_SCHED_WORKERS);
+    uint32  worker_idx = (uint32)((key - 1) % OS_MAX_FIBER_SCHED_WORKERS);
+    OS_fiber_sched_internal_record_t *sched = &OS_fiber_sched_table[sched_id];
+    OS_fiber_worker_t *worker = &sched->workers[worker_idx];
+    OS_fiber_internal_record_t *fiber;
+    struct timespec wake_time;
+    uint32  idx;
+
+    pthread_setspecific(OS_fiber_worker_key, worker);
+
+    while (__atomic_load_n(&sched->shutdown, __ATOMIC_ACQUIRE) == FALSE)
+    {
+        if (__atomic_load_n(&sched->sleep_head, __ATOMIC_RELAXED) != OS_FIBER_NONE)
+        {
+            OS_FiberWakeSleepers(sched);
+        }
+
+        idx = OS_FiberNextReady(sched, worker_idx);
+        if (idx != OS_FIBER_NONE)
+        {
+            fiber = &OS_fiber_table[idx];
+
+            /* the worker the fiber last left may still be saving its context */
+            while (__atomic_load_n(&fiber->switching, __ATOMIC_ACQUIRE))
+            {
+                sched_yield();
+            }
+
+            fiber->state  = OS_FIBER_RUNNING;
+            fiber->worker = worker_idx;
+            worker->current = idx;
+            __atomic_add_fetch(&sched->switches, 1, __ATOMIC_RELAXED);
+
+            OS_FIBER_SWITCH(&worker->context, &fiber->context);
+
+            /* back on the worker stack, the fiber context is saved */
+            worker->current = OS_FIBER_NONE;
+            if (fiber->state == OS_FIBER_DONE)
+            {
+                free(fiber->stack);
+                fiber->stack = NULL;
+                __atomic_sub_fetch(&sched->fibers, 1, __ATOMIC_RELAXED);
+                __atomic_store_n(&fiber->state, OS_FIBER_FREE, __ATOMIC_RELEASE);
+            }
+            else
+            {
+                __atomic_store_n(&fiber->switching, FALSE, __ATOMIC_RELEASE);
+            }
+            continue;
+        }
+
+        pthread_mutex_lock(&sched->mut);
+        __atomic_add_fetch(&sched->idle_workers, 1, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        if (sched->shutdown == FALSE && !OS_FiberAnyReady(sched))
+        {
+            if (sched->sleep_head != OS_FIBER_NONE)
+            {
+                wake_time = OS_fiber_table[sched->sleep_head].wake_time;
+                pthread_cond_timedwait(&sched->work_cv, &sched->mut, &wake_time);
+            }
+            else
+            {
+                pthread_cond_wait(&sched->work_cv, &sched->mut);
+            }
+        }
+        __atomic_sub_fetch(&sched->idle_workers, 1, __ATOMIC_RELAXED);
+        pthread_mutex_unlock(&sched->mut);
+    }
+
+    pthread_setspecific(OS_fiber_worker_key, NULL);
+
+    /*
+    ** Give back the task table entry before reporting in, so that the
+    ** worker names are free again as soon as OS_FiberSchedDelete returns.
+    ** OS_TaskDelete stops refusing the task id once it is withdrawn here.
+    */
+    __atomic_store_n(&worker->task_id, OS_FIBER_NONE, __ATOMIC_RELEASE);
+    OS_TaskReleaseEntry(OS_TaskGetId());
+
+    pthread_mutex_lock(&sched->mut);
+    sched->live_workers--;
+    pthread_cond_broadcast(&sched->done_cv);
+    pthread_mutex_unlock(&sched->mut);
+
+    pthread_exit(NULL);
+}/* end OS_FiberSchedWorker */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberSchedIsWorker
+
+   Purpose: Finds out if a task is a worker of any fiber scheduler
+
+   returns: TRUE if it is, FALSE otherwise
+---------------------------------------------------------------------------------------*/
+int OS_FiberSchedIsWorker(uint32 task_id)
+{
+    uint32 i;
+    uint32 j;
+    int    found = FALSE;
+
+    pthread_mutex_lock(&OS_fiber_mut);
+    for (i = 0; i < OS_MAX_FIBER_SCHEDS && !found; i++)
+    {
+        if (OS_fiber_sched_table[i].free == TRUE)
+        {
+            continue;
+        }
+        for (j = 0; j < OS_fiber_sched_table[i].num_workers; j++)
+        {
+            if (__atomic_load_n(&OS_fiber_sched_table[i].workers[j].task_id, __ATOMIC_ACQUIRE) == task_id)
+            {
+                found = TRUE;
+                break;
+            }
+        }
+    }
+    pthread_mutex_unlock(&OS_fiber_mut);
+
+    return found;
+}/* end OS_FiberSchedIsWorker */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberSchedCreate
+
+   Purpose: Creates a fiber scheduler and starts the worker tasks that run its fibers
+
+   returns: OS_INVALID_POINTER if any of the necessary pointers are NULL
+            OS_ERR_NAME_TOO_LONG if the name leaves no room for the worker task suffix
+            OS_ERR_INVALID_PRIORITY if the priority is bad
+            OS_ERR_NO_FREE_IDS if there can be no more fiber schedulers created
+            OS_ERR_NAME_TAKEN if the name specified is already used by a fiber scheduler
+            OS_ERROR if num_workers is out of range or the worker tasks cannot be created
+            OS_SUCCESS if success
+
+   NOTES: The workers are OSAL tasks named "<sched_name>.<n>".  When affinity_mask is
+          non zero the workers are spread round-robin over the CPUs it selects.
+---------------------------------------------------------------------------------------*/
+int32 OS_FiberSchedCreate (uint32 *sched_id, const char *sched_name, uint32 num_workers,
+                           uint32 priority, uint32 affinity_mask)
+{
+    OS_fiber_sched_internal_record_t *sched;
+    OS_task_attr_t      task_attr;
+    char                task_name[OS_MAX_API_NAME];
+    uint32              possible_sid;
+    uint32              i;
+    uint32              cpu;
+    int32               return_code;
+
+    if ( sched_id == NULL || sched_name == NULL )
+    {
+        return OS_INVALID_POINTER;
+    }
+
+    /* leave room for the ".<n>" suffix of the worker names */
+    if (strlen(sched_name) >= (OS_MAX_API_NAME - 3))
+    {
+        return OS_ERR_NAME_TOO_LONG;
+    }
+
+    if (priority > MAX_PRIORITY)
+    {
+        return OS_ERR_INVALID_PRIORITY;
+    }
+
+    if (num_workers == 0 || num_workers > OS_MAX_FIBER_SCHED_WORKERS)
+    {
+        return OS_ERROR;
+    }
+
+    pthread_mutex_lock(&OS_fiber_mut);
+
+    for (possible_sid = 0; possible_sid < OS_MAX_FIBER_SCHEDS; possible_sid++)
+    {
+        if (OS_fiber_sched_table[possible_sid].free == TRUE)
+        {
+            break;
+        }
+    }
+
+    if (possible_sid >= OS_MAX_FIBER_SCHEDS)
+    {
+        pthread_mutex_unlock(&OS_fiber_mut);
+        return OS_ERR_NO_FREE_IDS;
+    }
+
+    for (i = 0; i < OS_MAX_FIBER_SCHEDS; i++)
+    {
+        if ((OS_fiber_sched_table[i].free == FALSE) &&
+            strcmp(sched_name, OS_fiber_sched_table[i].name) == 0)
+        {
+            pthread_mutex_unlock(&OS_fiber_mut);
+            return OS_ERR_NAME_TAKEN;
+        }
+    }
+
+    sched = &OS_fiber_sched_table[possible_sid];
+    sched->free         = FALSE;
+    strcpy(sched->name, sched_name);
+    sched->creator      = OS_FindCreator();
+    sched->num_workers  = num_workers;
+    sched->next_worker  = 0;
+    sched->sleep_head   = OS_FIBER_NONE;
+    sched->fibers       = 0;
+    sched->switches     = 0;
+    sched->idle_workers = 0;
+    sched->live_workers = 0;
+    sched->shutdown     = FALSE;
+    for (i = 0; i < OS_MAX_FIBER_SCHED_WORKERS; i++)
+    {
+        sched->workers[i].task_id    = OS_FIBER_NONE;
+        sched->workers[i].current    = OS_FIBER_NONE;
+        sched->workers[i].ready.head = OS_FIBER_NONE;
+        sched->workers[i].ready.tail = OS_FIBER_NONE;
+    }
+
+    pthread_mutex_unlock(&OS_fiber_mut);
+
+    /*
+    ** Start the workers
+    */
+    return_code = OS_SUCCESS;
+    cpu = 0;
+    for (i = 0; i < num_workers && return_code == OS_SUCCESS; i++)
+    {
+        memset(&task_attr, 0, sizeof(task_attr));
+        if (affinity_mask != 0)
+        {
+            /* next CPU in the mask, wrapping around */
+            while ((affinity_mask & (1UL << cpu)) == 0)
+            {
+                cpu = (cpu + 1) % 32;
+            }
+            task_attr.affinity_mask = (1UL << cpu);
+            cpu = (cpu + 1) % 32;
+        }
+
+        sprintf(task_name, "%s.%u", sched_name, (unsigned int)i);
+        pthread_mutex_lock(&sched->mut);
+        sched->live_workers++;
+        pthread_mutex_unlock(&sched->mut);
+        return_code = OS_TaskCreateEx(&sched->workers[i].task_id, task_name, OS_FiberSchedWorker,
+                         (void *)((cpuaddr)(possible_sid * OS_MAX_FIBER_SCHED_WORKERS + i + 1)),
+                         OS_FIBER_SCHED_STACK_SIZE, priority, 0, &task_attr);
+        if (return_code != OS_SUCCESS)
+        {
+            pthread_mutex_lock(&sched->mut);
+            sched->live_workers--;
+            pthread_mutex_unlock(&sched->mut);
+        }
+    }
+
+    if (return_code != OS_SUCCESS)
+    {
+        /*
+        ** Stop the workers that did start, then give the slot back
+        */
+        OS_FiberSchedDelete(possible_sid);
+        return return_code;
+    }
+
+    *sched_id = possible_sid;
+
+    return OS_SUCCESS;
+}/* end OS_FiberSchedCreate */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberSchedDelete
+
+   Purpose: Stops the workers of a fiber scheduler, discards the fibers that have not
+            finished and frees the scheduler.  A fiber that is running when this is
+            called is stopped the next time it yields or blocks.
+
+   returns: OS_ERR_INVALID_ID if the id passed in is not a valid fiber scheduler
+            OS_ERROR if called from one of the scheduler's own fibers
+            OS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_FiberSchedDelete (uint32 sched_id)
+{
+    OS_fiber_sched_internal_record_t *sched;
+    OS_fiber_internal_record_t       *fiber;
+    uint32 current;
+    uint32 i;
+
+    if (sched_id >= OS_MAX_FIBER_SCHEDS || OS_fiber_sched_table[sched_id].free == TRUE)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    current = OS_FiberCurrent();
+    if (current != OS_FIBER_NONE && OS_fiber_table[current].sched_id == sched_id)
+    {
+        return OS_ERROR;
+    }
+
+    sched = &OS_fiber_sched_table[sched_id];
+
+    /* from here on OS_FiberCreate turns the scheduler down */
+    pthread_mutex_lock(&OS_fiber_mut);
+    __atomic_store_n(&sched->shutdown, TRUE, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&OS_fiber_mut);
+
+    pthread_mutex_lock(&sched->mut);
+    pthread_cond_broadcast(&sched->work_cv);
+    while (sched->live_workers > 0)
+    {
+        pthread_cond_wait(&sched->done_cv, &sched->mut);
+    }
+    pthread_mutex_unlock(&sched->mut);
+
+    /*
+    ** No worker runs a fiber any more, drop the ones that are left
+    */
+    pthread_mutex_lock(&OS_fiber_mut);
+    for (i = 0; i < OS_MAX_FIBERS; i++)
+    {
+        fiber = &OS_fiber_table[i];
+        if (__atomic_load_n(&fiber->state, __ATOMIC_ACQUIRE) == OS_FIBER_FREE ||
+            fiber->sched_id != sched_id)
+        {
+            continue;
+        }
+
+        if (fiber->state == OS_FIBER_BLOCKED)
+        {
+            if (fiber->wait_list != NULL)
+            {
+                pthread_mutex_lock(fiber->wait_mut);
+            }
+            if (OS_FiberClaim(i))
+            {
+                if (fiber->wait_list != NULL)
+                {
+                    OS_FiberListRemove(fiber->wait_list, i);
+                }
+            }
+            else
+            {
+                /* a waker owns it, let it finish putting the fiber on a ready list */
+                while (__atomic_load_n(&fiber->state, __ATOMIC_ACQUIRE) == OS_FIBER_BLOCKED)
+                {
+                    sched_yield();
+                }
+            }
+            if (fiber->wait_list != NULL)
+            {
+                pthread_mutex_unlock(fiber->wait_mut);
+            }
+            fiber->wait_list = NULL;
+        }
+
+        free(fiber->stack);
+        fiber->stack     = NULL;
+        fiber->sleeping  = FALSE;
+        fiber->switching = FALSE;
+        __atomic_store_n(&fiber->state, OS_FIBER_FREE, __ATOMIC_RELEASE);
+    }
+
+    /* a fiber woken during the sweep may have been queued again */
+    for (i = 0; i < OS_MAX_FIBER_SCHED_WORKERS; i++)
+    {
+        pthread_mutex_lock(&sched->workers[i].ready_mut);
+        sched->workers[i].ready.head = OS_FIBER_NONE;
+        sched->workers[i].ready.tail = OS_FIBER_NONE;
+        pthread_mutex_unlock(&sched->workers[i].ready_mut);
+    }
+
+    sched->free = TRUE;
+    strcpy(sched->name, "");
+    sched->creator = UNINITIALIZED;
+    sched->num_workers = 0;
+    sched->fibers = 0;
+    sched->sleep_head = OS_FIBER_NONE;
+    pthread_mutex_unlock(&OS_fiber_mut);
+
+    return OS_SUCCESS;
+}/* end OS_FiberSchedDelete */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberSchedGetInfo
+
+   Purpose: This function will pass back a pointer to structure that contains
+            all of the relevant info (name, workers, counters) about a fiber scheduler
+
+   returns: OS_INVALID_POINTER if sched_prop is NULL
+            OS_ERR_INVALID_ID if the id passed in is not a valid fiber scheduler
+            OS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_FiberSchedGetInfo (uint32 sched_id, OS_fiber_sched_prop_t *sched_prop)
+{
+    OS_fiber_sched_internal_record_t *sched;
+
+    if (sched_prop == NULL)
+    {
+        return OS_INVALID_POINTER;
+    }
+
+    if (sched_id >= OS_MAX_FIBER_SCHEDS || OS_fiber_sched_table[sched_id].free == TRUE)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    sched = &OS_fiber_sched_table[sched_id];
+
+    pthread_mutex_lock(&OS_fiber_mut);
+
+    strcpy(sched_prop->name, sched->name);
+    sched_prop->creator     = sched->creator;
+    sched_prop->num_workers = sched->num_workers;
+    sched_prop->fibers      = __atomic_load_n(&sched->fibers, __ATOMIC_RELAXED);
+    sched_prop->switches    = __atomic_load_n(&sched->switches, __ATOMIC_RELAXED);
+
+    pthread_mutex_unlock(&OS_fiber_mut);
+
+    return OS_SUCCESS;
+}/* end OS_FiberSchedGetInfo */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberCreate
+
+   Purpose: Creates a fiber that runs function(arg) on the given fiber scheduler.
+            The fiber ends when function returns or calls OS_FiberExit.
+
+   returns: OS_INVALID_POINTER if any of the necessary pointers are NULL
+            OS_ERR_INVALID_ID if the scheduler id is not valid
+            OS_ERR_NO_FREE_IDS if there can be no more fibers created
+            OS_ERROR if the stack could not be allocated
+            OS_SUCCESS if success
+
+   NOTES: A stack_size of 0 selects OS_FIBER_DEFAULT_STACK_SIZE
+---------------------------------------------------------------------------------------*/
+int32 OS_FiberCreate (uint32 *fiber_id, uint32 sched_id, OS_FiberFunc_t function,
+                      void *arg, uint32 stack_size)
+{
+    OS_fiber_sched_internal_record_t *sched;
+    OS_fiber_internal_record_t *fiber;
+    void   *stack;
+    uint32  possible_fid;
+
+    if (fiber_id == NULL || function == NULL)
+    {
+        return OS_INVALID_POINTER;
+    }
+
+    if (sched_id >= OS_MAX_FIBER_SCHEDS || OS_fiber_sched_table[sched_id].free == TRUE)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    if (stack_size == 0)
+    {
+        stack_size = OS_FIBER_DEFAULT_STACK_SIZE;
+    }
+    else if (stack_size < OS_FIBER_MIN_STACK_SIZE)
+    {
+        stack_size = OS_FIBER_MIN_STACK_SIZE;
+    }
+
+    stack = malloc(stack_size);
+    if (stack == NULL)
+    {
+        return OS_ERROR;
+    }
+
+    sched = &OS_fiber_sched_table[sched_id];
+
+    pthread_mutex_lock(&OS_fiber_mut);
+
+    if (sched->free == TRUE || sched->shutdown == TRUE)
+    {
+        pthread_mutex_unlock(&OS_fiber_mut);
+        free(stack);
+        return OS_ERR_INVALID_ID;
+    }
+
+    for (possible_fid = 0; possible_fid < OS_MAX_FIBERS; possible_fid++)
+    {
+        if (__atomic_load_n(&OS_fiber_table[possible_fid].state, __ATOMIC_ACQUIRE) == OS_FIBER_FREE)
+        {
+            break;
+        }
+    }
+
+    if (possible_fid >= OS_MAX_FIBERS)
+    {
+        pthread_mutex_unlock(&OS_fiber_mut);
+        free(stack);
+        return OS_ERR_NO_FREE_IDS;
+    }
+
+    fiber = &OS_fiber_table[possible_fid];
+    fiber->state      = OS_FIBER_READY;
+    fiber->sched_id   = sched_id;
+    fiber->worker     = sched->next_worker;
+    fiber->sleeping   = FALSE;
+    fiber->timed      = FALSE;
+    fiber->switching  = FALSE;
+    fiber->wait_list  = NULL;
+    fiber->function   = function;
+    fiber->arg        = arg;
+    fiber->stack      = stack;
+    sched->next_worker = (sched->next_worker + 1) % sched->num_workers;
+
+    OS_FiberContextInit(fiber, possible_fid, stack, stack_size);
+
+    __atomic_add_fetch(&sched->fibers, 1, __ATOMIC_RELAXED);
+
+    /* still under the table lock, so OS_FiberSchedDelete can not miss it */
+    OS_FiberMakeReady(possible_fid);
+
+    pthread_mutex_unlock(&OS_fiber_mut);
+
+    *fiber_id = possible_fid;
+
+    return OS_SUCCESS;
+}/* end OS_FiberCreate */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberExit
+
+   Purpose: Ends the calling fiber.  Does nothing when called from a task.
+---------------------------------------------------------------------------------------*/
+void OS_FiberExit (void)
+{
+    uint32 idx = OS_FiberCurrent();
+
+    if (idx == OS_FIBER_NONE)
+    {
+        return;
+    }
+
+    /* the worker frees the stack once it is off it */
+    OS_fiber_table[idx].state = OS_FIBER_DONE;
+    OS_FiberSwitchOut(idx);
+}/* end OS_FiberExit */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberYield
+
+   Purpose: Lets the other ready fibers of the scheduler run before the calling fiber
+            continues
+
+   returns: OS_ERROR if not called from a fiber
+            OS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_FiberYield (void)
+{
+    uint32 idx = OS_FiberCurrent();
+
+    if (idx == OS_FIBER_NONE)
+    {
+        return OS_ERROR;
+    }
+
+    __atomic_store_n(&OS_fiber_table[idx].switching, TRUE, __ATOMIC_RELAXED);
+    OS_FiberMakeReady(idx);
+    OS_FiberSwitchOut(idx);
+
+    return OS_SUCCESS;
+}/* end OS_FiberYield */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberDelay
+
+   Purpose: Suspends the calling fiber for at least millisecond milliseconds while
+            the other fibers keep running.  Called from a task it is OS_TaskDelay.
+
+   returns: OS_SUCCESS if success, see OS_TaskDelay when called from a task
+---------------------------------------------------------------------------------------*/
+int32 OS_FiberDelay (uint32 millisecond)
+{
+    uint32 idx = OS_FiberCurrent();
+
+    if (idx == OS_FIBER_NONE)
+    {
+        return OS_TaskDelay(millisecond);
+    }
+
+    return OS_FiberBlock(idx, NULL, NULL, (int32)millisecond, OS_SUCCESS);
+}/* end OS_FiberDelay */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberGetId
+
+   Purpose: Passes back the id of the calling fiber
+
+   returns: OS_INVALID_POINTER if fiber_id is NULL
+            OS_ERROR if not called from a fiber
+            OS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_FiberGetId (uint32 *fiber_id)
+{
+    uint32 idx;
+
+    if (fiber_id == NULL)
+    {
+        return OS_INVALID_POINTER;
+    }
+
+    idx = OS_FiberCurrent();
+    if (idx == OS_FIBER_NONE)
+    {
+        return OS_ERROR;
+    }
+
+    *fiber_id = idx;
+
+    return OS_SUCCESS;
+}/* end OS_FiberGetId */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberSemCreate
+
+   Purpose: Creates a counting semaphore that fibers wait on without blocking their
+            worker.  Tasks may give and take it as well.
+
+   returns: OS_INVALID_POINTER if sem_id is NULL
+            OS_ERR_NO_FREE_IDS if there can be no more fiber semaphores created
+            OS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_FiberSemCreate (uint32 *sem_id, uint32 sem_initial_value)
+{
+    OS_fiber_sem_internal_record_t *sem;
+    uint32 possible_semid;
+
+    if (sem_id == NULL)
+    {
+        return OS_INVALID_POINTER;
+    }
+
+    pthread_mutex_lock(&OS_fiber_mut);
+
+    for (possible_semid = 0; possible_semid < OS_MAX_FIBER_SEMS; possible_semid++)
+    {
+        if (OS_fiber_sem_table[possible_semid].free == TRUE)
+        {
+            break;
+        }
+    }
+
+    if (possible_semid >= OS_MAX_FIBER_SEMS)
+    {
+        pthread_mutex_unlock(&OS_fiber_mut);
+        return OS_ERR_NO_FREE_IDS;
+    }
+
+    sem = &OS_fiber_sem_table[possible_semid];
+    pthread_mutex_lock(&sem->mut);
+    sem->free         = FALSE;
+    sem->count        = sem_initial_value;
+    sem->task_waiters = 0;
+    sem->waiters.head = OS_FIBER_NONE;
+    sem->waiters.tail = OS_FIBER_NONE;
+    pthread_mutex_unlock(&sem->mut);
+
+    pthread_mutex_unlock(&OS_fiber_mut);
+
+    *sem_id = possible_semid;
+
+    return OS_SUCCESS;
+}/* end OS_FiberSemCreate */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberSemDelete
+
+   Purpose: Frees a fiber semaphore
+
+   returns: OS_ERR_INVALID_ID if the id passed in is not a valid fiber semaphore
+            OS_ERROR if a fiber or task is waiting on the semaphore
+            OS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_FiberSemDelete (uint32 sem_id)
+{
+    OS_fiber_sem_internal_record_t *sem;
+
+    if (sem_id >= OS_MAX_FIBER_SEMS || OS_fiber_sem_table[sem_id].free == TRUE)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    sem = &OS_fiber_sem_table[sem_id];
+
+    pthread_mutex_lock(&OS_fiber_mut);
+    pthread_mutex_lock(&sem->mut);
+    if (sem->waiters.head != OS_FIBER_NONE || sem->task_waiters > 0)
+    {
+        pthread_mutex_unlock(&sem->mut);
+        pthread_mutex_unlock(&OS_fiber_mut);
+        return OS_ERROR;
+    }
+    sem->free = TRUE;
+    pthread_mutex_unlock(&sem->mut);
+    pthread_mutex_unlock(&OS_fiber_mut);
+
+    return OS_SUCCESS;
+}/* end OS_FiberSemDelete */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberSemGive
+
+   Purpose: Hands the semaphore to the fiber that has waited longest, otherwise
+            increments its count
+
+   returns: OS_ERR_INVALID_ID if the id passed in is not a valid fiber semaphore
+            OS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_FiberSemGive (uint32 sem_id)
+{
+    OS_fiber_sem_internal_record_t *sem;
+    uint32 idx;
+
+    if (sem_id >= OS_MAX_FIBER_SEMS || OS_fiber_sem_table[sem_id].free == TRUE)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    sem = &OS_fiber_sem_table[sem_id];
+
+    pthread_mutex_lock(&sem->mut);
+    idx = OS_FiberPopWaiter(&sem->waiters);
+    if (idx == OS_FIBER_NONE)
+    {
+        sem->count++;
+        if (sem->task_waiters > 0)
+        {
+            pthread_cond_signal(&sem->task_cv);
+        }
+    }
+    pthread_mutex_unlock(&sem->mut);
+
+    if (idx != OS_FIBER_NONE)
+    {
+        OS_FiberWakeClaimed(idx, OS_SUCCESS);
+    }
+
+    return OS_SUCCESS;
+}/* end OS_FiberSemGive */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberSemTake
+
+   Purpose: Decrements the semaphore, waiting until it is given if the count is zero.
+            A fiber waits by switching to other fibers, a task blocks.
+
+   returns: OS_ERR_INVALID_ID if the id passed in is not a valid fiber semaphore
+            OS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_FiberSemTake (uint32 sem_id)
+{
+    OS_fiber_sem_internal_record_t *sem;
+    uint32 idx;
+
+    if (sem_id >= OS_MAX_FIBER_SEMS || OS_fiber_sem_table[sem_id].free == TRUE)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    sem = &OS_fiber_sem_table[sem_id];
+    idx = OS_FiberCurrent();
+
+    pthread_mutex_lock(&sem->mut);
+    if (sem->count > 0)
+    {
+        sem->count--;
+        pthread_mutex_unlock(&sem->mut);
+        return OS_SUCCESS;
+    }
+
+    if (idx != OS_FIBER_NONE)
+    {
+        /* the giver hands the count over directly */
+        return OS_FiberBlock(idx, &sem->waiters, &sem->mut, OS_PEND, OS_SUCCESS);
+    }
+
+    sem->task_waiters++;
+    while (sem->count == 0)
+    {
+        pthread_cond_wait(&sem->task_cv, &sem->mut);
+    }
+    sem->task_waiters--;
+    sem->count--;
+    pthread_mutex_unlock(&sem->mut);
+
+    return OS_SUCCESS;
+}/* end OS_FiberSemTake */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberQueueCreate
+
+   Purpose: Creates a message queue that fibers wait on without blocking their worker.
+            Tasks may put and get messages as well.
+
+   returns: OS_INVALID_POINTER if queue_id is NULL
+            OS_QUEUE_INVALID_SIZE if data_size is 0
+            OS_ERR_NO_FREE_IDS if there can be no more fiber queues created
+            OS_ERROR if queue_depth is 0 or the buffer could not be allocated
+            OS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_FiberQueueCreate (uint32 *queue_id, uint32 queue_depth, uint32 data_size)
+{
+    OS_fiber_queue_internal_record_t *queue;
+    uint8  *buffer;
+    uint32 possible_qid;
+
+    if (queue_id == NULL)
+    {
+        return OS_INVALID_POINTER;
+    }
+
+    if (data_size == 0)
+    {
+        return OS_QUEUE_INVALID_SIZE;
+    }
+
+    if (queue_depth == 0)
+    {
+        return OS_ERROR;
+    }
+
+    /* the message sizes are kept behind the message slots */
+    buffer = malloc(queue_depth * (data_size + sizeof(uint32)));
+    if (buffer == NULL)
+    {
+        return OS_ERROR;
+    }
+
+    pthread_mutex_lock(&OS_fiber_mut);
+
+    for (possible_qid = 0; possible_qid < OS_MAX_FIBER_QUEUES; possible_qid++)
+    {
+        if (OS_fiber_queue_table[possible_qid].free == TRUE)
+        {
+            break;
+        }
+    }
+
+    if (possible_qid >= OS_MAX_FIBER_QUEUES)
+    {
+        pthread_mutex_unlock(&OS_fiber_mut);
+        free(buffer);
+        return OS_ERR_NO_FREE_IDS;
+    }
+
+    queue = &OS_fiber_queue_table[possible_qid];
+    pthread_mutex_lock(&queue->mut);
+    queue->free         = FALSE;
+    queue->depth        = queue_depth;
+    queue->data_size    = data_size;
+    queue->head         = 0;
+    queue->count        = 0;
+    queue->task_waiters = 0;
+    queue->buffer       = buffer;
+    queue->sizes        = (uint32 *)(buffer + (queue_depth * data_size));
+    queue->waiters.head = OS_FIBER_NONE;
+    queue->waiters.tail = OS_FIBER_NONE;
+    pthread_mutex_unlock(&queue->mut);
+
+    pthread_mutex_unlock(&OS_fiber_mut);
+
+    *queue_id = possible_qid;
+
+    return OS_SUCCESS;
+}/* end OS_FiberQueueCreate */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberQueueDelete
+
+   Purpose: Frees a fiber queue and the messages still in it
+
+   returns: OS_ERR_INVALID_ID if the id passed in is not a valid fiber queue
+            OS_ERROR if a fiber or task is waiting on the queue
+            OS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_FiberQueueDelete (uint32 queue_id)
+{
+    OS_fiber_queue_internal_record_t *queue;
+
+    if (queue_id >= OS_MAX_FIBER_QUEUES || OS_fiber_queue_table[queue_id].free == TRUE)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    queue = &OS_fiber_queue_table[queue_id];
+
+    pthread_mutex_lock(&OS_fiber_mut);
+    pthread_mutex_lock(&queue->mut);
+    if (queue->waiters.head != OS_FIBER_NONE || queue->task_waiters > 0)
+    {
+        pthread_mutex_unlock(&queue->mut);
+        pthread_mutex_unlock(&OS_fiber_mut);
+        return OS_ERROR;
+    }
+    free(queue->buffer);
+    queue->buffer = NULL;
+    queue->sizes  = NULL;
+    queue->free   = TRUE;
+    pthread_mutex_unlock(&queue->mut);
+    pthread_mutex_unlock(&OS_fiber_mut);
+
+    return OS_SUCCESS;
+}/* end OS_FiberQueueDelete */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberQueuePut
+
+   Purpose: Hands a message to the fiber that has waited longest for one, otherwise
+            appends it to the queue.  Never blocks.
+
+   returns: OS_INVALID_POINTER if data is NULL
+            OS_ERR_INVALID_ID if the id passed in is not a valid fiber queue
+            OS_QUEUE_INVALID_SIZE if size is larger than the queue's data size
+            OS_QUEUE_FULL if the queue is full
+            OS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_FiberQueuePut (uint32 queue_id, const void *data, uint32 size)
+{
+    OS_fiber_queue_internal_record_t *queue;
+    OS_fiber_internal_record_t       *fiber;
+    uint32 slot;
+    uint32 idx;
+
+    if (data == NULL)
+    {
+        return OS_INVALID_POINTER;
+    }
+
+    if (queue_id >= OS_MAX_FIBER_QUEUES || OS_fiber_queue_table[queue_id].free == TRUE)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    queue = &OS_fiber_queue_table[queue_id];
+    if (size > queue->data_size)
+    {
+        return OS_QUEUE_INVALID_SIZE;
+    }
+
+    pthread_mutex_lock(&queue->mut);
+
+    idx = OS_FiberPopWaiter(&queue->waiters);
+    if (idx != OS_FIBER_NONE)
     {
-       return OS_ERR_INVALID_ID;
+        pthread_mutex_unlock(&queue->mut);
+
+        /* a waiting fiber is never given a buffer smaller than the data size */
+        fiber = &OS_fiber_table[idx];
+        memcpy(fiber->wait_data, data, size);
+        *fiber->wait_size_copied = size;
+        OS_FiberWakeClaimed(idx, OS_SUCCESS);
+        return OS_SUCCESS;
     }
 
-    if( task_prop == NULL)
+    if (queue->count == queue->depth)
     {
-       return OS_INVALID_POINTER;
+        pthread_mutex_unlock(&queue->mut);
+        return OS_QUEUE_FULL;
     }
 
-    /* put the info into the stucture */
-    OS_InterruptSafeLock(&OS_task_table_mut, &mask, &previous); 
+    slot = (queue->head + queue->count) % queue->depth;
+    memcpy(queue->buffer + (slot * queue->data_size), data, size);
+    queue->sizes[slot] = size;
+    queue->count++;
+    if (queue->task_waiters > 0)
+    {
+        pthread_cond_signal(&queue->task_cv);
+    }
 
-    task_prop -> creator =    OS_task_table[task_id].creator;
-    task_prop -> stack_size = OS_task_table[task_id].stack_size;
-    task_prop -> priority =   OS_task_table[task_id].priority;
-    task_prop -> OStask_id =  (uint32) OS_task_table[task_id].id;
-    
-    strcpy(task_prop-> name, OS_task_table[task_id].name);
+    pthread_mutex_unlock(&queue->mut);
 
-    OS_InterruptSafeUnlock(&OS_task_table_mut, &previous); 
-    
     return OS_SUCCESS;
-    
-} /* end OS_TaskGetInfo */
-
-/*--------------------------------------------------------------------------------------
-     Name: OS_TaskInstallDeleteHandler
-
-    Purpose: Installs a handler for when the task is deleted.
+}/* end OS_FiberQueuePut */
 
-    returns: status
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberQueueGet
+
+   Purpose: Takes the oldest message off the queue.  If the queue is empty the caller
+            waits as given by timeout: OS_PEND waits forever, OS_CHECK not at all and
+            any other value is a number of milliseconds.  A fiber waits by switching
+            to other fibers, a task blocks.
+
+   returns: OS_INVALID_POINTER if data or size_copied is NULL
+            OS_ERR_INVALID_ID if the id passed in is not a valid fiber queue
+            OS_QUEUE_INVALID_SIZE if size is smaller than the queue's data size
+            OS_QUEUE_EMPTY if the queue is empty and timeout is OS_CHECK
+            OS_QUEUE_TIMEOUT if no message arrived within the timeout
+            OS_SUCCESS if success
 ---------------------------------------------------------------------------------------*/
-
-int32 OS_TaskInstallDeleteHandler(osal_task_entry function_pointer)
+int32 OS_FiberQueueGet (uint32 queue_id, void *data, uint32 size, uint32 *size_copied,
+                        int32 timeout)
 {
-    uint32    task_id;
-    sigset_t  previous;
-    sigset_t  mask;
+    OS_fiber_queue_internal_record_t *queue;
+    struct timespec abs_timeout;
+    uint32 idx;
+    int    ret;
 
-    task_id = OS_TaskGetId();
+    if (data == NULL || size_copied == NULL)
+    {
+        return OS_INVALID_POINTER;
+    }
 
-    if ( task_id >= OS_MAX_TASKS )
+    if (queue_id >= OS_MAX_FIBER_QUEUES || OS_fiber_queue_table[queue_id].free == TRUE)
     {
-       return(OS_ERR_INVALID_ID);
+        return OS_ERR_INVALID_ID;
     }
 
-    OS_InterruptSafeLock(&OS_task_table_mut, &mask, &previous); 
+    queue = &OS_fiber_queue_table[queue_id];
+    if (size < queue->data_size)
+    {
+        return OS_QUEUE_INVALID_SIZE;
+    }
 
-    if ( OS_task_table[task_id].free != FALSE )
+    idx = OS_FiberCurrent();
+
+    pthread_mutex_lock(&queue->mut);
+
+    if (queue->count == 0)
     {
-       /* 
-       ** Somehow the calling task is not registered 
-       */
-       OS_InterruptSafeUnlock(&OS_task_table_mut, &previous); 
-       return(OS_ERR_INVALID_ID);
+        if (timeout == OS_CHECK)
+        {
+            pthread_mutex_unlock(&queue->mut);
+            return OS_QUEUE_EMPTY;
+        }
+
+        if (idx != OS_FIBER_NONE)
+        {
+            /* the putter copies the message straight into data */
+            OS_fiber_table[idx].wait_data        = data;
+            OS_fiber_table[idx].wait_size_copied = size_copied;
+            return OS_FiberBlock(idx, &queue->waiters, &queue->mut, timeout, OS_QUEUE_TIMEOUT);
+        }
+
+        if (timeout != OS_PEND)
+        {
+            OS_FiberCompAbsTime((uint32)timeout, &abs_timeout);
+        }
+        queue->task_waiters++;
+        ret = 0;
+        while (queue->count == 0 && ret != ETIMEDOUT)
+        {
+            if (timeout == OS_PEND)
+            {
+                ret = pthread_cond_wait(&queue->task_cv, &queue->mut);
+            }
+            else
+            {
+                ret = pthread_cond_timedwait(&queue->task_cv, &queue->mut, &abs_timeout);
+            }
+        }
+        queue->task_waiters--;
+
+        if (queue->count == 0)
+        {
+            pthread_mutex_unlock(&queue->mut);
+            return OS_QUEUE_TIMEOUT;
+        }
     }
 
-    /*
-    ** Install the pointer
-    */
-    OS_task_table[task_id].delete_hook_pointer = function_pointer;    
-    
-    OS_InterruptSafeUnlock(&OS_task_table_mut, &previous); 
+    *size_copied = queue->sizes[queue->head];
+    memcpy(data, queue->buffer + (queue->head * queue->data_size), *size_copied);
+    queue->head = (queue->head + 1) % queue->depth;
+    queue->count--;
 
-    return(OS_SUCCESS);
-    
-}/*end OS_TaskInstallDeleteHandler */
+    pthread_mutex_unlock(&queue->mut);
+
+    return OS_SUCCESS;
+}/* end OS_FiberQueueGet */
 
 /****************************************************************************************
                                 MESSAGE QUEUE API
@@ -3779,6 +7863,59 @@ int32 OS_HeapGetInfo       (OS_heap_prop_t *heap_prop)
     */
     return (OS_ERR_NOT_IMPLEMENTED);
 }
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_DeterministicModeEnable
+
+   Purpose: Takes the page faults up front so real-time loops do not see them.
+            Locks all current and future memory of the process, keeps the heap
+            from giving memory back to the OS, and touches heap_reserve_size bytes
+            of heap so that later allocations reuse pages that are already
+            resident. Tasks created afterwards prefault their whole stack.
+            OS_API_Init calls this when OSAL_DETERMINISTIC_MODE is defined.
+
+   Parameters: heap_reserve_size - bytes of heap to fault in, 0 for none
+
+   returns: OS_ERROR if the memory can not be locked or reserved
+            OS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_DeterministicModeEnable (uint32 heap_reserve_size)
+{
+    void *reserve;
+
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+    {
+        #ifdef OS_DEBUG_PRINTF
+           printf("mlockall failed in OS_DeterministicModeEnable, errno = %s\n", strerror(errno));
+        #endif
+        return OS_ERROR;
+    }
+
+    /*
+    ** Freed memory stays in the heap and large blocks do not get their
+    ** own mapping. A single arena makes every task reuse the reserve.
+    */
+    mallopt(M_TRIM_THRESHOLD, -1);
+    mallopt(M_MMAP_MAX, 0);
+#ifdef M_ARENA_MAX
+    mallopt(M_ARENA_MAX, 1);
+#endif
+
+    if (heap_reserve_size > 0)
+    {
+        reserve = malloc(heap_reserve_size);
+        if (reserve == NULL)
+        {
+            return OS_ERROR;
+        }
+        memset(reserve, 0, heap_reserve_size);
+        free(reserve);
+    }
+
+    OS_deterministic_mode = TRUE;
+
+    return OS_SUCCESS;
+}/* end OS_DeterministicModeEnable */
 /*---------------------------------------------------------------------------------------
 ** Name: OS_Tick2Micros
 **
@@ -3871,6 +8008,82 @@ int32 OS_GetLocalTime(OS_time_t *time_struct)
 
 }/* end OS_GetLocalTime */
 
+/*---------------------------------------------------------------------------------------
+ * Name: OS_GetMonotonicNs
+ * 
+ * Purpose: Returns the time in nanoseconds on a clock that only moves forward and
+ *          is not changed by OS_SetLocalTime, for timestamps and measurements.
+ *          This is CLOCK_MONOTONIC, or the calibrated time stamp counter when
+ *          OS_MONOTONIC_TSC is defined and the CPU has an invariant one.
+ *
+ * Returns: OS_INVALID_POINTER if nsecs is NULL
+ *          OS_ERROR if the clock could not be read
+ *          OS_SUCCESS if success
+ * ------------------------------------------------------------------------------------*/
+
+int32 OS_GetMonotonicNs(uint64 *nsecs)
+{
+    struct timespec time;
+#ifdef OS_MONOTONIC_HAVE_TSC
+    uint64          ticks;
+#endif
+
+    if (nsecs == NULL)
+    {
+       return OS_INVALID_POINTER;
+    }
+
+#ifdef OS_MONOTONIC_HAVE_TSC
+    if (OS_monotonic_tsc_enabled == TRUE)
+    {
+        /*
+        ** Split the ticks so the product with the 32.32 multiplier can not overflow
+        */
+        ticks = OS_MonotonicReadTsc() - OS_monotonic_tsc_base;
+        *nsecs = OS_monotonic_ns_base + ((ticks >> 32) * OS_monotonic_tsc_mult) +
+                 (((ticks & 0xFFFFFFFF) * OS_monotonic_tsc_mult) >> 32);
+        return OS_SUCCESS;
+    }
+#endif
+
+    if (clock_gettime(CLOCK_MONOTONIC, &time) != 0)
+    {
+        return OS_ERROR;
+    }
+
+    *nsecs = ((uint64)time.tv_sec * 1000000000) + (uint64)time.tv_nsec;
+
+    return OS_SUCCESS;
+
+}/* end OS_GetMonotonicNs */
+
+/*---------------------------------------------------------------------------------------
+ * Name: OS_GetMonotonicTime
+ * 
+ * Purpose: OS_GetMonotonicNs as seconds and microseconds
+ * ------------------------------------------------------------------------------------*/
+
+int32 OS_GetMonotonicTime(OS_time_t *time_struct)
+{
+    uint64 nsecs;
+    int32  ReturnCode;
+
+    if (time_struct == NULL)
+    {
+       return OS_INVALID_POINTER;
+    }
+
+    ReturnCode = OS_GetMonotonicNs(&nsecs);
+    if (ReturnCode == OS_SUCCESS)
+    {
+        time_struct -> seconds = (uint32)(nsecs / 1000000000);
+        time_struct -> microsecs = (uint32)((nsecs % 1000000000) / 1000);
+    }
+
+    return ReturnCode;
+
+}/* end OS_GetMonotonicTime */
+
 /*---------------------------------------------------------------------------------------
  * Name: OS_SetLocalTime
  * 
@@ -4010,6 +8223,24 @@ void  OS_CompAbsDelayTime( uint32 msecs, struct timespec * tm)
         tm->tv_sec ++ ;
     }
 }
+
+/*---------------------------------------------------------------------------------------
+** Name: OS_TimespecAddUsec
+**
+** Purpose: Advances a timespec by the given number of microseconds, keeping
+**          tv_nsec normalized
+---------------------------------------------------------------------------------------*/
+void OS_TimespecAddUsec(struct timespec *ts, uint32 usec)
+{
+    ts->tv_sec  += (time_t) (usec / 1000000);
+    ts->tv_nsec += (long) (usec % 1000000) * 1000L;
+
+    if (ts->tv_nsec >= 1000000000L)
+    {
+        ts->tv_nsec -= 1000000000L;
+        ts->tv_sec ++;
+    }
+}
 /* ---------------------------------------------------------------------------
  * Name: OS_printf 
  * 
@@ -4139,7 +8370,7 @@ int32 OS_GetErrorName(int32 error_num, os_err_name_t * err_name)
 int32 OS_PriorityRemap(uint32 InputPri)
 {
     int OutputPri;
-    int pmax = sched_get_priority_max( SCHED_FIFO );
+    int pmax = OS_sched_rt_max_priority;
     int pmin = sched_get_priority_min( SCHED_FIFO );
     int prange = abs((pmax - pmin)  +1);
     int numbins, offset;
@@ -4220,6 +8451,223 @@ int32 OS_PriorityRemap(uint32 InputPri)
     return OutputPri;
 }/*end OS_PriortyRemap*/
 
+/*----------------------------------------------------------------------------
+ * Name: OS_NiceRemap
+ *
+ * Purpose: Remaps the OSAL priority onto a nice value for tasks that run
+ *          SCHED_OTHER. OSAL priority 0 gets the most favorable nice value
+ *          this process may use, 255 gets the least favorable one.
+----------------------------------------------------------------------------*/
+int32 OS_NiceRemap(uint32 InputPri)
+{
+    if (InputPri > MAX_PRIORITY)
+    {
+        InputPri = MAX_PRIORITY;
+    }
+
+    return OS_sched_nice_min + (((int)InputPri * (OS_NICE_MAX - OS_sched_nice_min)) / MAX_PRIORITY);
+}/* end OS_NiceRemap */
+
+/*----------------------------------------------------------------------------
+ * Name: OS_SchedDetectCapabilities
+ *
+ * Purpose: Finds out which scheduling policies and priorities this process
+ *          may use. CAP_SYS_NICE (root usually has it) allows everything.
+ *          Without it, a non-zero RLIMIT_RTPRIO still allows the real-time
+ *          policies up to that priority, and RLIMIT_NICE sets how far the
+ *          nice value may be lowered.
+----------------------------------------------------------------------------*/
+void OS_SchedDetectCapabilities(void)
+{
+    struct rlimit      limit;
+    int                privileged;
+    char               buffer[4096];
+    const char        *field;
+    int                fd;
+    ssize_t            len;
+    unsigned long long cap_eff;
+    int                nice_floor;
+
+    /*
+    ** The effective capability set is authoritative, euid 0 is only
+    ** a guess for systems without /proc
+    */
+    privileged = (geteuid() == 0);
+    fd = open("/proc/self/status", O_RDONLY);
+    if (fd >= 0)
+    {
+       len = read(fd, buffer, sizeof(buffer) - 1);
+       close(fd);
+       if (len > 0)
+       {
+          buffer[len] = '\0';
+          field = strstr(buffer, "\nCapEff:");
+          if (field != NULL)
+          {
+             cap_eff = strtoull(field + 8, NULL, 16);
+             privileged = ((cap_eff >> OS_CAP_SYS_NICE) & 1) != 0;
+          }
+       }
+    }
+
+    OS_sched_rt_max_priority = sched_get_priority_max(SCHED_FIFO);
+    OS_sched_nice_min = OS_NICE_MIN;
+
+    if (privileged)
+    {
+       OS_sched_rt_permitted = TRUE;
+    }
+    else
+    {
+       OS_sched_rt_permitted = FALSE;
+       if (getrlimit(RLIMIT_RTPRIO, &limit) == 0 && limit.rlim_cur > 0)
+       {
+          OS_sched_rt_permitted = TRUE;
+          if (limit.rlim_cur != RLIM_INFINITY && (int)limit.rlim_cur < OS_sched_rt_max_priority)
+          {
+             OS_sched_rt_max_priority = (int)limit.rlim_cur;
+          }
+       }
+
+       /*
+       ** Raising the nice value is always allowed, lowering it below
+       ** the current one only as far as RLIMIT_NICE (20 - rlim) permits
+       */
+       errno = 0;
+       OS_sched_nice_min = getpriority(PRIO_PROCESS, 0);
+       if (errno != 0)
+       {
+          OS_sched_nice_min = 0;
+       }
+       if (getrlimit(RLIMIT_NICE, &limit) == 0)
+       {
+          if (limit.rlim_cur == RLIM_INFINITY)
+          {
+             nice_floor = OS_NICE_MIN;
+          }
+          else
+          {
+             nice_floor = 20 - (int)limit.rlim_cur;
+          }
+          if (nice_floor < OS_sched_nice_min)
+          {
+             OS_sched_nice_min = nice_floor;
+          }
+       }
+       if (OS_sched_nice_min < OS_NICE_MIN)
+       {
+          OS_sched_nice_min = OS_NICE_MIN;
+       }
+    }
+
+#ifdef OS_DEBUG_PRINTF
+    printf("OS_SchedDetectCapabilities: real-time %s, max priority %d, min nice %d\n",
+           OS_sched_rt_permitted ? "permitted" : "not permitted",
+           OS_sched_rt_max_priority, OS_sched_nice_min);
+#endif
+
+}/* end OS_SchedDetectCapabilities */
+
+/*---------------------------------------------------------------------------------------
+ * Name: OS_MonotonicInit
+ *
+ * Purpose: With OS_MONOTONIC_TSC, calibrates the time stamp counter against
+ *          CLOCK_MONOTONIC over OS_MONOTONIC_TSC_CALIBRATE_MSEC and turns on the
+ *          fast path of OS_GetMonotonicNs.  Only an invariant TSC ticks at the same
+ *          rate on every CPU and in every power state, so any other one is not used.
+ *---------------------------------------------------------------------------------------*/
+void OS_MonotonicInit(void)
+{
+#ifdef OS_MONOTONIC_HAVE_TSC
+    unsigned int    eax, ebx, ecx, edx;
+    uint64          tsc_start, tsc_end;
+    uint64          ns_start, ns_end;
+    struct timespec delay;
+
+    OS_monotonic_tsc_enabled = FALSE;
+
+    if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) == 0 || (edx & (1 << 8)) == 0)
+    {
+#ifdef OS_DEBUG_PRINTF
+        printf("OS_MonotonicInit: no invariant TSC, using CLOCK_MONOTONIC\n");
+#endif
+        return;
+    }
+
+    OS_MonotonicSample(&tsc_start, &ns_start);
+    delay.tv_sec = OS_MONOTONIC_TSC_CALIBRATE_MSEC / 1000;
+    delay.tv_nsec = (OS_MONOTONIC_TSC_CALIBRATE_MSEC % 1000) * 1000000;
+    while (nanosleep(&delay, &delay) != 0 && errno == EINTR)
+    {
+        ;
+    }
+    OS_MonotonicSample(&tsc_end, &ns_end);
+
+    if (tsc_end <= tsc_start || ns_end <= ns_start)
+    {
+        return;
+    }
+
+    OS_monotonic_tsc_mult = ((ns_end - ns_start) << 32) / (tsc_end - tsc_start);
+    OS_monotonic_tsc_base = tsc_end;
+    OS_monotonic_ns_base = ns_end;
+    OS_monotonic_tsc_enabled = TRUE;
+
+#ifdef OS_DEBUG_PRINTF
+    printf("OS_MonotonicInit: TSC at %u kHz\n",
+           (unsigned int)((tsc_end - tsc_start) * 1000000 / (ns_end - ns_start)));
+#endif
+#endif
+
+}/* end OS_MonotonicInit */
+
+#ifdef OS_MONOTONIC_HAVE_TSC
+/*---------------------------------------------------------------------------------------
+ * Name: OS_MonotonicReadTsc
+ *
+ * Purpose: Reads the time stamp counter of the CPU
+ *---------------------------------------------------------------------------------------*/
+uint64 OS_MonotonicReadTsc(void)
+{
+    uint32 lo, hi;
+
+    __asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+
+    return ((uint64)hi << 32) | lo;
+
+}/* end OS_MonotonicReadTsc */
+
+/*---------------------------------------------------------------------------------------
+ * Name: OS_MonotonicSample
+ *
+ * Purpose: Reads CLOCK_MONOTONIC and the TSC at the same moment, as far as that
+ *          goes: of a few tries, the read that the two TSC reads enclose most
+ *          tightly wins, and the TSC is taken half way between them.
+ *---------------------------------------------------------------------------------------*/
+void OS_MonotonicSample(uint64 *tsc, uint64 *nsecs)
+{
+    struct timespec time;
+    uint64          before, after;
+    uint64          best = 0;
+    int             i;
+
+    for (i = 0; i < 8; i++)
+    {
+        before = OS_MonotonicReadTsc();
+        clock_gettime(CLOCK_MONOTONIC, &time);
+        after = OS_MonotonicReadTsc();
+
+        if (i == 0 || (after - before) < best)
+        {
+            best = after - before;
+            *tsc = before + (best / 2);
+            *nsecs = ((uint64)time.tv_sec * 1000000000) + (uint64)time.tv_nsec;
+        }
+    }
+
+}/* end OS_MonotonicSample */
+#endif
+
 /* ---------------------------------------------------------------------------
  * Name: OS_ThreadKillHandler
  * 
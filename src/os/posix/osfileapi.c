@@ -75,6 +75,13 @@
                                     INCLUDE FILES
 ****************************************************************************************/
 
+/*
+** _GNU_SOURCE is needed for syscall(), used by OS_cp to reach copy_file_range,
+** and for preadv/pwritev
+*/
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
 
 #include "stdio.h"
 #include "stdlib.h"
@@ -88,8 +95,21 @@
 
 #include "dirent.h"
 #include "sys/stat.h"
+#include "sys/uio.h"
+#include "sys/mman.h"
 #include "signal.h"
 
+#ifdef __linux__
+#include "sys/syscall.h"
+#include "sys/sendfile.h"
+#if defined(__NR_io_uring_setup) && !defined(OS_ASYNC_NO_IO_URING)
+#define OS_ASYNC_HAVE_IO_URING
+#include "linux/io_uring.h"
+#include "sys/eventfd.h"
+#include "poll.h"
+#endif
+#endif
+
 #include "common_types.h"
 #include "osapi.h"
 
@@ -100,13 +120,263 @@
 #define ERROR -1
 #define OS_REDIRECTSTRSIZE 15
 
+/*
+** OS_cp moves at most this many bytes per copy_file_range/sendfile call,
+** and uses a buffer of OS_CP_BUFFER_SIZE bytes when it has to read and write
+*/
+#define OS_CP_CHUNK_SIZE   (1024 * 1024 * 1024)
+#define OS_CP_BUFFER_SIZE  (64 * 1024)
+
+#ifndef OS_MAX_FILE_MAPS
+#define OS_MAX_FILE_MAPS   16
+#endif
+
+#define OS_FILEMAP_ACCESS_MASK  0x00FF
+#define OS_FILEMAP_HINT_MASK    (OS_FILEMAP_SEQUENTIAL | OS_FILEMAP_RANDOM | OS_FILEMAP_WILLNEED)
+
+#ifndef OS_MAX_ASYNC_QUEUES
+#define OS_MAX_ASYNC_QUEUES       4
+#endif
+
+#ifndef OS_ASYNC_QUEUE_MAX_DEPTH
+#define OS_ASYNC_QUEUE_MAX_DEPTH  256
+#endif
+
+#ifndef OS_ASYNC_IO_WORKERS
+#define OS_ASYNC_IO_WORKERS       4
+#endif
+
+#ifndef OS_ASYNC_IO_PRIORITY
+#define OS_ASYNC_IO_PRIORITY      50
+#endif
+
+#define OS_ASYNC_NONE             0xFFFFFFFF
+#define OS_ASYNC_WORK_QUEUE_NAME  "OS_AsyncIO"
+
+#ifndef OS_MAX_STREAMS
+#define OS_MAX_STREAMS            16
+#endif
+
+#ifndef OS_STREAM_MAX_BUFFER_SIZE
+#define OS_STREAM_MAX_BUFFER_SIZE (1024 * 1024)
+#endif
+
+/*
+** Number of chains in the index from path to open file descriptors.  One
+** chain per descriptor keeps the average chain under one entry.
+*/
+#ifndef OS_FD_PATH_HASH_SIZE
+#define OS_FD_PATH_HASH_SIZE      OS_MAX_NUM_OPEN_FILES
+#endif
+
+#define OS_FD_NONE                (-1)
+
+/*
+** Entries read from a directory at a time by OS_DirWalk
+*/
+#ifndef OS_DIRWALK_BATCH
+#define OS_DIRWALK_BATCH          64
+#endif
+
+/*
+** A path reserved by a task that works on the file without holding OS_FDTableMutex.
+** OS_open and OS_creat reserve the path they open, shared, until it is in the path
+** index; OS_remove, OS_cp and OS_mv reserve the files they change, exclusive, so no
+** task opens them meanwhile.  The records live on the stack of the task.
+*/
+typedef struct OS_fd_reserve_s
+{
+    const char              *path;
+    uint8                    exclusive;
+    struct OS_fd_reserve_s  *next;
+} OS_fd_reserve_t;
+
+/*
+** One mapping made by OS_FileMap.  The host mapping described by base and
+** length starts on a page boundary, at or before the address given to the caller.
+** busy counts the OS_FileSync calls running msync on it without the table lock;
+** a mapping removed meanwhile is only unmapped, and its slot reused, once the
+** last of them is done.
+*/
+typedef struct
+{
+    void   *addr;
+    void   *base;
+    size_t  length;
+    int32   filedes;
+    uint32  busy;
+    uint8   IsValid;
+} OS_file_map_record_t;
+
+/*
+** One request of an asynchronous I/O queue.  Its index in the queue is the io_uring
+** user_data.  next links it on the free list, or on the done list once it completed.
+*/
+typedef struct
+{
+    void         *user_arg;
+    struct iovec  iov;
+    off_t         offset;
+    int32         filedes;
+    int           host_fd;
+    int32         result;
+    uint32        queue_id;
+    uint32        next;
+    uint8         is_write;
+} OS_async_request_t;
+
+#ifdef OS_ASYNC_HAVE_IO_URING
+/*
+** The io_uring of a queue, with pointers into its mapped rings
+*/
+typedef struct
+{
+    int                  ring_fd;
+    int                  event_fd;
+    void                *sq_ptr;
+    size_t               sq_size;
+    void                *cq_ptr;
+    size_t               cq_size;
+    struct io_uring_sqe *sqes;
+    size_t               sqes_size;
+    uint32              *sq_head;
+    uint32              *sq_tail;
+    uint32              *sq_mask;
+    uint32              *sq_array;
+    uint32              *cq_head;
+    uint32              *cq_tail;
+    uint32              *cq_mask;
+    struct io_uring_cqe *cqes;
+} OS_async_ring_t;
+#endif
+
+/*
+** An asynchronous I/O queue.  outstanding counts the requests taken off the free
+** list and not yet collected by OS_AsyncWait.
+*/
+typedef struct
+{
+    uint8               free;
+    uint8               uses_io_uring;
+    uint32              depth;
+    uint32              outstanding;
+    uint32              free_head;
+    uint32              done_head;
+    uint32              done_tail;
+    uint32              waiters;
+    pthread_mutex_t     mut;
+    pthread_cond_t      done_cv;
+    OS_async_request_t  requests[OS_ASYNC_QUEUE_MAX_DEPTH];
+#ifdef OS_ASYNC_HAVE_IO_URING
+    OS_async_ring_t     ring;
+#endif
+} OS_async_queue_record_t;
+
+/*
+** A buffered stream.  deadline is the CLOCK_MONOTONIC time, in nanoseconds, by which
+** the buffered data has to be written, or 0 when there is none.  A detached stream
+** belongs to a file being closed: it is no longer valid, but keeps its entry until the
+** closing task has flushed it.  Everything but the mutex, which lives as long as the
+** table, is guarded by mut.
+*/
+typedef struct
+{
+    uint8               IsValid;
+    uint8               detached;
+    int32               filedes;
+    int                 host_fd;
+    uint8              *buffer;
+    uint32              buffer_size;
+    uint32              flush_size;
+    uint32              flush_msec;
+    uint32              buffered;
+    uint32              write_calls;
+    uint64              bytes_written;
+    uint64              deadline;
+    pthread_mutex_t     mut;
+} OS_stream_record_t;
+
+/*
+** A directory waiting to be scanned by OS_DirWalk, with its OSAL and host paths
+*/
+typedef struct OS_dirwalk_node_s
+{
+    struct OS_dirwalk_node_s *next;
+    struct OS_dirwalk_s      *walk;
+    char                      path[OS_MAX_PATH_LEN];
+    char                      local_path[OS_MAX_LOCAL_PATH_LEN];
+} OS_dirwalk_node_t;
+
+/*
+** State shared by the tasks taking part in one OS_DirWalk
+*/
+typedef struct OS_dirwalk_s
+{
+    OS_DirWalkCallback_t  callback;
+    void                 *callback_arg;
+    uint8                 parallel;
+    uint8                 stop;       /* set when the callback ends the walk */
+    int32                 status;     /* first error met */
+    uint32                pending;    /* directories queued or being scanned */
+    OS_dirwalk_node_t    *list;       /* directories left to the calling task */
+    pthread_mutex_t       mut;
+    pthread_cond_t        cv;
+} OS_dirwalk_t;
+
 
 /***************************************************************************************
                                  FUNCTION PROTOTYPES
 ***************************************************************************************/
 
 int32         OS_check_name_length(const char *path);
+int32         OS_FDTableAlloc(void);
+void          OS_FDTableFree(int32 filedes);
+int           OS_FDHostDrop(int32 filedes);
+void          OS_FDHostRelease(int32 filedes);
+void          OS_FDCloseStart(int32 filedes);
+int32         OS_FDCloseFinish(int32 filedes);
+uint32        OS_FDPathHash(const char *path);
+void          OS_FDPathInsert(int32 filedes);
+void          OS_FDPathRemove(int32 filedes);
+int32         OS_FDPathFind(const char *path);
+int32         OS_FDPathReserve(OS_fd_reserve_t *reserve, const char *path, uint8 exclusive);
+void          OS_FDPathUnreserve(OS_fd_reserve_t *reserve);
+int32         OS_CopyTarget(const char *src, const char *dest, char *dest_name, char *dest_path);
+int32         OS_CopyLocalFile(const char *src_path, const char *dest_path, uint32 sync);
+int32         OS_CopyFileData(int src_fd, int dest_fd);
+int32         OS_SyncParentDir(const char *path);
+int32         OS_IovecToHost(int32 filedes, const os_iovec_t *iov, uint32 iovcnt, struct iovec *host_iov);
+void          OS_FileUnmapByFd(int32 filedes);
+int32         OS_AsyncSubmit(uint32 queue_id, int32 filedes, void *buffer, uint32 nbytes,
+                             uint64 offset, void *user_arg, uint8 is_write);
+void          OS_AsyncExecute(void *arg);
+void          OS_AsyncDone(OS_async_queue_record_t *aq, uint32 idx);
+uint32        OS_AsyncCollect(OS_async_queue_record_t *aq, os_async_completion_t *completions,
+                              uint32 max_count);
+int           OS_AsyncBlock(OS_async_queue_record_t *aq, const struct timespec *deadline);
+void          OS_AsyncReap(OS_async_queue_record_t *aq);
+int32         OS_AsyncWorkersAttach(void);
+void          OS_AsyncWorkersDetach(void);
+int32         OS_StreamWriteOut(OS_stream_record_t *stream, const uint8 *extra, uint32 extra_len);
+int32         OS_StreamRelease(OS_stream_record_t *stream);
+void          OS_StreamDetachByFd(int32 filedes);
+int32         OS_StreamCloseByFd(int32 filedes);
+int32         OS_StreamFlusherStart(void);
+void          OS_StreamFlusherKick(void);
+void         *OS_StreamFlusherThread(void *arg);
+int32         OS_DirWalkJoin(char *dest, size_t size, const char *dir, const char *name);
+void          OS_DirWalkError(OS_dirwalk_t *walk, int32 status, uint8 stop);
+void          OS_DirWalkQueue(OS_dirwalk_node_t *node);
+void          OS_DirWalkScan(OS_dirwalk_node_t *node);
+void          OS_DirWalkTask(void *arg);
+#ifdef OS_ASYNC_HAVE_IO_URING
+int32         OS_AsyncRingSetup(OS_async_ring_t *ring, uint32 entries);
+void          OS_AsyncRingTeardown(OS_async_ring_t *ring);
+void          OS_AsyncRingPush(OS_async_queue_record_t *aq, uint32 idx);
+void          OS_AsyncRingFlush(OS_async_ring_t *ring);
+#endif
 extern uint32 OS_FindCreator(void);
+extern int32  OS_FS_MountIndexInit(void);
 extern int    OS_InterruptSafeLock(pthread_mutex_t *lock, sigset_t *set, sigset_t *previous);
 extern void   OS_InterruptSafeUnlock(pthread_mutex_t *lock, sigset_t *previous);
 
@@ -116,6 +386,48 @@ extern void   OS_InterruptSafeUnlock(pthread_mutex_t *lock, sigset_t *previous);
 
 OS_FDTableEntry OS_FDTable[OS_MAX_NUM_OPEN_FILES];
 pthread_mutex_t OS_FDTableMutex;
+
+/*
+** Guarded by OS_FDTableMutex: the list of free OS_FDTable entries, linked through
+** OS_fd_free_next, the index of named entries, chained through OS_fd_path_next,
+** and the paths reserved by tasks working on them
+*/
+int32           OS_fd_free_head;
+int32           OS_fd_free_next[OS_MAX_NUM_OPEN_FILES];
+uint32          OS_fd_free_count;
+int32           OS_fd_path_head[OS_FD_PATH_HASH_SIZE];
+int32           OS_fd_path_next[OS_MAX_NUM_OPEN_FILES];
+uint32          OS_fd_path_hash[OS_MAX_NUM_OPEN_FILES];
+OS_fd_reserve_t *OS_fd_reserve_list;
+
+/*
+** Guarded by OS_FDTableMutex: the number of users of the host fd of each entry outside
+** the mutex, that is async requests in flight and a close flushing the streams, and
+** whether the entry was closed while it still had some
+*/
+uint32          OS_fd_host_refs[OS_MAX_NUM_OPEN_FILES];
+uint8           OS_fd_close_deferred[OS_MAX_NUM_OPEN_FILES];
+
+/* guarded by OS_FDTableMutex, since each mapping belongs to an OS_FDTable entry */
+OS_file_map_record_t OS_file_map_table[OS_MAX_FILE_MAPS];
+
+OS_async_queue_record_t OS_async_queue_table[OS_MAX_ASYNC_QUEUES];
+pthread_mutex_t         OS_async_queue_table_mut;
+
+/* the work queue shared by the queues that do not use io_uring, guarded by OS_async_work_mut */
+uint32                  OS_async_work_queue_id;
+uint32                  OS_async_work_users;
+pthread_mutex_t         OS_async_work_mut;
+
+/* allocation of the stream table is guarded by OS_stream_table_mut */
+OS_stream_record_t      OS_stream_table[OS_MAX_STREAMS];
+pthread_mutex_t         OS_stream_table_mut;
+
+/* the thread that writes out streams on time, woken through OS_stream_flusher_cv */
+pthread_mutex_t         OS_stream_flusher_mut;
+pthread_cond_t          OS_stream_flusher_cv;
+uint8                   OS_stream_flusher_started;
+uint8                   OS_stream_flusher_kicked;
 /****************************************************************************************
                                 INITIALIZATION FUNCTION
 ****************************************************************************************/
@@ -123,6 +435,7 @@ int32 OS_FS_Init(void)
 {
     int i;
     int ret;	
+    pthread_condattr_t cond_attr;
 
     /* Initialize the file system constructs */
     for (i =0; i < OS_MAX_NUM_OPEN_FILES; i++)
@@ -131,11 +444,52 @@ int32 OS_FS_Init(void)
         strcpy(OS_FDTable[i].Path, "\0");
         OS_FDTable[i].User =       0;
         OS_FDTable[i].IsValid =    FALSE;
+
+        /* the free list hands out the lowest entries first */
+        OS_fd_free_next[i] = (i + 1 < OS_MAX_NUM_OPEN_FILES) ? (i + 1) : OS_FD_NONE;
+        OS_fd_path_next[i] = OS_FD_NONE;
+        OS_fd_path_hash[i] = 0;
+        OS_fd_host_refs[i] = 0;
+        OS_fd_close_deferred[i] = FALSE;
+    }
+    OS_fd_free_head  = 0;
+    OS_fd_free_count = OS_MAX_NUM_OPEN_FILES;
+    OS_fd_reserve_list = NULL;
+
+    for (i = 0; i < OS_FD_PATH_HASH_SIZE; i++)
+    {
+        OS_fd_path_head[i] = OS_FD_NONE;
+    }
+
+    memset(OS_file_map_table, 0, sizeof(OS_file_map_table));
+
+    for (i = 0; i < OS_MAX_ASYNC_QUEUES; i++)
+    {
+        OS_async_queue_table[i].free = TRUE;
     }
+    OS_async_work_users = 0;
+    pthread_mutex_init(&OS_async_queue_table_mut, NULL);
+    pthread_mutex_init(&OS_async_work_mut, NULL);
+
+    for (i = 0; i < OS_MAX_STREAMS; i++)
+    {
+        OS_stream_table[i].IsValid  = FALSE;
+        OS_stream_table[i].detached = FALSE;
+        OS_stream_table[i].buffer   = NULL;
+        pthread_mutex_init(&OS_stream_table[i].mut, NULL);
+    }
+    pthread_mutex_init(&OS_stream_table_mut, NULL);
+    pthread_mutex_init(&OS_stream_flusher_mut, NULL);
+    pthread_condattr_init(&cond_attr);
+    pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&OS_stream_flusher_cv, &cond_attr);
+    pthread_condattr_destroy(&cond_attr);
+    OS_stream_flusher_started = FALSE;
+    OS_stream_flusher_kicked  = FALSE;
     
     ret = pthread_mutex_init((pthread_mutex_t *) & OS_FDTableMutex,NULL); 
 
-    if ( ret < 0 )
+    if ( ret < 0 || OS_FS_MountIndexInit() != OS_FS_SUCCESS )
     {
         return(OS_ERROR);
     }
@@ -145,6 +499,340 @@ int32 OS_FS_Init(void)
     }
 
 }
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FDTableAlloc
+
+    Purpose: Takes the first entry off the free list and marks it valid, so no
+             other task can take it. The caller must hold OS_FDTableMutex.
+
+    Returns: the file descriptor, or OS_FD_NONE if every entry is in use
+---------------------------------------------------------------------------------------*/
+int32 OS_FDTableAlloc(void)
+{
+    int32 filedes;
+
+    filedes = OS_fd_free_head;
+    if (filedes != OS_FD_NONE)
+    {
+        OS_fd_free_head = OS_fd_free_next[filedes];
+        OS_fd_free_next[filedes] = OS_FD_NONE;
+        --OS_fd_free_count;
+        OS_FDTable[filedes].IsValid = TRUE;
+    }
+
+    return filedes;
+
+}/* end OS_FDTableAlloc */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FDTableFree
+
+    Purpose: Resets an entry, takes it out of the path index and puts it back on
+             the free list. Entries that are already free are left alone, so two
+             tasks closing the same descriptor cannot free it twice.
+             The caller must hold OS_FDTableMutex.
+
+    Returns: none
+---------------------------------------------------------------------------------------*/
+void OS_FDTableFree(int32 filedes)
+{
+    if (OS_FDTable[filedes].IsValid == FALSE && OS_fd_close_deferred[filedes] == FALSE)
+    {
+        return;
+    }
+
+    OS_FDPathRemove(filedes);
+
+    OS_FDTable[filedes].OSfd =       -1;
+    strcpy(OS_FDTable[filedes].Path, "\0");
+    OS_FDTable[filedes].User =       0;
+    OS_FDTable[filedes].IsValid =    FALSE;
+    OS_fd_close_deferred[filedes] = FALSE;
+
+    OS_fd_free_next[filedes] = OS_fd_free_head;
+    OS_fd_free_head = filedes;
+    ++OS_fd_free_count;
+
+}/* end OS_FDTableFree */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FDHostDrop
+
+    Purpose: Drops a reference on the host fd of an entry. If the entry was closed
+             meanwhile and this was the last reference, the entry is freed.
+             The caller must hold OS_FDTableMutex.
+
+    Returns: the host fd the caller has to close, or -1 if there is none
+---------------------------------------------------------------------------------------*/
+int OS_FDHostDrop(int32 filedes)
+{
+    int host_fd = -1;
+
+    if (--OS_fd_host_refs[filedes] == 0 && OS_fd_close_deferred[filedes] == TRUE)
+    {
+        host_fd = OS_FDTable[filedes].OSfd;
+        OS_FDTableFree(filedes);
+    }
+
+    return host_fd;
+
+}/* end OS_FDHostDrop */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FDHostRelease
+
+    Purpose: Drops the reference an async request held on the host fd of an entry,
+             and closes the host fd if the entry was closed meanwhile and this was
+             the last reference.
+
+    Returns: none
+---------------------------------------------------------------------------------------*/
+void OS_FDHostRelease(int32 filedes)
+{
+    int       host_fd;
+    sigset_t  previous;
+    sigset_t  mask;
+
+    OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
+    host_fd = OS_FDHostDrop(filedes);
+    OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
+
+    if (host_fd >= 0)
+    {
+        close(host_fd);
+    }
+
+}/* end OS_FDHostRelease */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FDCloseStart
+
+    Purpose: First half of closing an open entry, done under OS_FDTableMutex: removes
+             the mappings of the file, detaches its streams, marks the entry invalid
+             and takes it out of the path index. The entry keeps its host fd and stays
+             off the free list until OS_FDCloseFinish has flushed the streams and the
+             async requests still using the host fd have completed.
+
+    Returns: none
+---------------------------------------------------------------------------------------*/
+void OS_FDCloseStart(int32 filedes)
+{
+    OS_FileUnmapByFd(filedes);
+    OS_StreamDetachByFd(filedes);
+
+    OS_fd_host_refs[filedes]++;
+    OS_FDPathRemove(filedes);
+    OS_FDTable[filedes].IsValid = FALSE;
+    OS_fd_close_deferred[filedes] = TRUE;
+
+}/* end OS_FDCloseStart */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FDCloseFinish
+
+    Purpose: Second half of closing an entry, done without OS_FDTableMutex: flushes
+             and frees the streams detached by OS_FDCloseStart, then closes the host
+             fd, unless async requests still use it, in which case the last of them
+             closes it.
+
+    Returns: OS_FS_ERROR if the host fd could not be closed, or the data buffered by
+             the streams could not be written
+             OS_FS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_FDCloseFinish(int32 filedes)
+{
+    int       status = 0;
+    int       host_fd;
+    int32     stream_status;
+    sigset_t  previous;
+    sigset_t  mask;
+
+    stream_status = OS_StreamCloseByFd(filedes);
+
+    OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
+    host_fd = OS_FDHostDrop(filedes);
+    OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
+
+    /*
+    ** call close, and check for an interrupted system call
+    */
+    if (host_fd >= 0)
+    {
+        do
+        {
+            status = close (host_fd);
+        } while ( status == -1 && errno == EINTR );
+    }
+
+    if (status == ERROR || stream_status != OS_FS_SUCCESS)
+    {
+        return OS_FS_ERROR;
+    }
+
+    return OS_FS_SUCCESS;
+
+}/* end OS_FDCloseFinish */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FDPathHash
+
+    Purpose: Hashes a path name for the path index (FNV-1a)
+
+    Returns: the hash of the path
+---------------------------------------------------------------------------------------*/
+uint32 OS_FDPathHash(const char *path)
+{
+    uint32 hash = 2166136261U;
+
+    while (*path != '\0')
+    {
+        hash ^= (uint8)*path;
+        hash *= 16777619U;
+        ++path;
+    }
+
+    return hash;
+
+}/* end OS_FDPathHash */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FDPathInsert
+
+    Purpose: Adds a valid entry to the path index under its current Path.
+             The caller must hold OS_FDTableMutex.
+
+    Returns: none
+---------------------------------------------------------------------------------------*/
+void OS_FDPathInsert(int32 filedes)
+{
+    uint32 hash;
+    uint32 chain;
+
+    hash  = OS_FDPathHash(OS_FDTable[filedes].Path);
+    chain = hash % OS_FD_PATH_HASH_SIZE;
+
+    OS_fd_path_hash[filedes] = hash;
+    OS_fd_path_next[filedes] = OS_fd_path_head[chain];
+    OS_fd_path_head[chain]   = filedes;
+
+}/* end OS_FDPathInsert */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FDPathRemove
+
+    Purpose: Takes an entry out of the path index. Entries that were never added,
+             such as one still being opened, are not found and nothing changes.
+             The caller must hold OS_FDTableMutex.
+
+    Returns: none
+---------------------------------------------------------------------------------------*/
+void OS_FDPathRemove(int32 filedes)
+{
+    int32 *link;
+
+    link = &OS_fd_path_head[OS_fd_path_hash[filedes] % OS_FD_PATH_HASH_SIZE];
+    while (*link != OS_FD_NONE)
+    {
+        if (*link == filedes)
+        {
+            *link = OS_fd_path_next[filedes];
+            break;
+        }
+        link = &OS_fd_path_next[*link];
+    }
+
+    OS_fd_path_next[filedes] = OS_FD_NONE;
+
+}/* end OS_FDPathRemove */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FDPathFind
+
+    Purpose: Looks up a file that is open through the OSAL under the given path.
+             The caller must hold OS_FDTableMutex.
+
+    Returns: the file descriptor, or OS_FD_NONE if no open file has that path
+---------------------------------------------------------------------------------------*/
+int32 OS_FDPathFind(const char *path)
+{
+    uint32 hash;
+    int32  filedes;
+
+    hash    = OS_FDPathHash(path);
+    filedes = OS_fd_path_head[hash % OS_FD_PATH_HASH_SIZE];
+    while (filedes != OS_FD_NONE)
+    {
+        if (OS_fd_path_hash[filedes] == hash && strcmp(OS_FDTable[filedes].Path, path) == 0)
+        {
+            break;
+        }
+        filedes = OS_fd_path_next[filedes];
+    }
+
+    return filedes;
+
+}/* end OS_FDPathFind */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FDPathReserve
+
+    Purpose: Reserves path for the calling task, which fills in reserve. A shared
+             reservation conflicts only with an exclusive one; an exclusive one
+             conflicts with any other, and with the path being open.
+             The caller must hold OS_FDTableMutex.
+
+    Returns: OS_FS_ERROR if the path is open or reserved in a conflicting way
+             OS_FS_SUCCESS if the path is now reserved
+---------------------------------------------------------------------------------------*/
+int32 OS_FDPathReserve(OS_fd_reserve_t *reserve, const char *path, uint8 exclusive)
+{
+    OS_fd_reserve_t *other;
+
+    for (other = OS_fd_reserve_list; other != NULL; other = other->next)
+    {
+        if ((exclusive == TRUE || other->exclusive == TRUE) && strcmp(other->path, path) == 0)
+        {
+            return OS_FS_ERROR;
+        }
+    }
+
+    if (exclusive == TRUE && OS_FDPathFind(path) != OS_FD_NONE)
+    {
+        return OS_FS_ERROR;
+    }
+
+    reserve->path      = path;
+    reserve->exclusive = exclusive;
+    reserve->next      = OS_fd_reserve_list;
+    OS_fd_reserve_list = reserve;
+
+    return OS_FS_SUCCESS;
+
+}/* end OS_FDPathReserve */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FDPathUnreserve
+
+    Purpose: Drops a reservation made by OS_FDPathReserve.
+             The caller must hold OS_FDTableMutex.
+
+    Returns: none
+---------------------------------------------------------------------------------------*/
+void OS_FDPathUnreserve(OS_fd_reserve_t *reserve)
+{
+    OS_fd_reserve_t **link;
+
+    for (link = &OS_fd_reserve_list; *link != NULL; link = &(*link)->next)
+    {
+        if (*link == reserve)
+        {
+            *link = reserve->next;
+            break;
+        }
+    }
+
+}/* end OS_FDPathUnreserve */
 /****************************************************************************************
                                     Filesys API
 ****************************************************************************************/
@@ -164,7 +852,8 @@ int32 OS_FS_Init(void)
              OS_FS_ERR_PATH_TOO_LONG if path exceeds the maximum number of chars
              OS_FS_ERR_PATH_INVALID if path cannot be parsed
              OS_FS_ERR_NAME_TOO_LONG if the name of the file is too long
-             OS_FS_ERROR if permissions are unknown or OS call fails
+             OS_FS_ERROR if permissions are unknown, the file is being removed,
+             copied to or moved, or OS call fails
              OS_FS_ERR_NO_FREE_FDS if there are no free file descripors left
              OS_FS_SUCCESS if success
     
@@ -176,7 +865,8 @@ int32 OS_creat  (const char *path, int32  access)
     char       local_path[OS_MAX_LOCAL_PATH_LEN];
     int        perm;
     mode_t     mode;
-    uint32     PossibleFD;
+    int32      PossibleFD;
+    OS_fd_reserve_t reserve;
     sigset_t   previous;
     sigset_t   mask;
 
@@ -228,34 +918,33 @@ int32 OS_creat  (const char *path, int32  access)
         return OS_FS_ERR_PATH_INVALID;
     }
 
+    /* Take a free table entry, marked valid so no other 
+     * task can take that ID, and reserve the path so it is
+     * not removed or replaced before it is in the index */
     OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
-
-    for ( PossibleFD = 0; PossibleFD < OS_MAX_NUM_OPEN_FILES; PossibleFD++)
+    if (OS_FDPathReserve(&reserve, path, FALSE) != OS_FS_SUCCESS)
     {
-        if( OS_FDTable[PossibleFD].IsValid == FALSE)
-        {
-            break;
-        }
+        OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
+        return OS_FS_ERROR;
+    }
+    PossibleFD = OS_FDTableAlloc();
+    if (PossibleFD == OS_FD_NONE)
+    {
+        OS_FDPathUnreserve(&reserve);
     }
+    OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
 
-    if (PossibleFD >= OS_MAX_NUM_OPEN_FILES)
+    if (PossibleFD == OS_FD_NONE)
     {
-        OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
         return OS_FS_ERR_NO_FREE_FDS;
     }
 
-
-    /* Mark the table entry as valid so no other 
-     * task can take that ID */
-    OS_FDTable[PossibleFD].IsValid =    TRUE;
-
-    OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
-
     mode = S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH;
    
     status =  open(local_path, perm | O_CREAT | O_TRUNC, mode);
 
     OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
+    OS_FDPathUnreserve(&reserve);
 
     if (status != ERROR)
     {
@@ -263,13 +952,14 @@ int32 OS_creat  (const char *path, int32  access)
         OS_FDTable[PossibleFD].OSfd =       status;
         strncpy(OS_FDTable[PossibleFD].Path, path, OS_MAX_PATH_LEN);
         OS_FDTable[PossibleFD].User =       OS_FindCreator();
+        OS_FDPathInsert(PossibleFD);
         OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
         return PossibleFD;
     }
     else
     {
-        /* Operation failed, so reset to false */
-        OS_FDTable[PossibleFD].IsValid = FALSE;
+        /* Operation failed, so give the entry back */
+        OS_FDTableFree(PossibleFD);
         OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
         return OS_FS_ERROR;
     }
@@ -286,7 +976,8 @@ int32 OS_creat  (const char *path, int32  access)
              OS_FS_ERR_PATH_TOO_LONG if path exceeds the maximum number of chars
              OS_FS_ERR_PATH_INVALID if path cannot be parsed
              OS_FS_ERR_NAME_TOO_LONG if the name of the file is too long
-             OS_FS_ERROR if permissions are unknown or OS call fails
+             OS_FS_ERROR if permissions are unknown, the file is being removed,
+             copied to or moved, or OS call fails
              OS_FS_ERR_NO_FREE_FDS if there are no free file descriptors left
              a file descriptor if success
 ---------------------------------------------------------------------------------------*/
@@ -296,7 +987,8 @@ int32 OS_open   (const char *path,  int32 access,  uint32  mode)
     int       status;
     char      local_path[OS_MAX_LOCAL_PATH_LEN];
     int       perm;
-    uint32    PossibleFD;
+    int32     PossibleFD;
+    OS_fd_reserve_t reserve;
     sigset_t  previous;
     sigset_t  mask;
     
@@ -350,33 +1042,32 @@ int32 OS_open   (const char *path,  int32 access,  uint32  mode)
         return OS_FS_ERR_PATH_INVALID;
     }
     
+    /* Take a free table entry, marked valid so no other 
+     * task can take that ID, and reserve the path so it is
+     * not removed or replaced before it is in the index */
     OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
-
-    for ( PossibleFD = 0; PossibleFD < OS_MAX_NUM_OPEN_FILES; PossibleFD++)
+    if (OS_FDPathReserve(&reserve, path, FALSE) != OS_FS_SUCCESS)
     {
-        if( OS_FDTable[PossibleFD].IsValid == FALSE)
-        {
-            break;
-        }
+        OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
+        return OS_FS_ERROR;
     }
-
-    if (PossibleFD >= OS_MAX_NUM_OPEN_FILES)
+    PossibleFD = OS_FDTableAlloc();
+    if (PossibleFD == OS_FD_NONE)
     {
-        OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
+        OS_FDPathUnreserve(&reserve);
+    }
+    OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
 
+    if (PossibleFD == OS_FD_NONE)
+    {
         return OS_FS_ERR_NO_FREE_FDS;
     }
 
-    /* Mark the table entry as valid so no other 
-     * task can take that ID */
-    OS_FDTable[PossibleFD].IsValid = TRUE;
-
-    OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
-
     /* open the file  */
     status =  open(local_path, perm, mode);
 
     OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
+    OS_FDPathUnreserve(&reserve);
 
     if (status != ERROR)
     {
@@ -384,14 +1075,15 @@ int32 OS_open   (const char *path,  int32 access,  uint32  mode)
         OS_FDTable[PossibleFD].OSfd =       status;
         strncpy(OS_FDTable[PossibleFD].Path, path, OS_MAX_PATH_LEN);
         OS_FDTable[PossibleFD].User =       OS_FindCreator();
+        OS_FDPathInsert(PossibleFD);
         OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
         
         return PossibleFD;
     }
     else
     {
-        /* Operation failed, so reset to false */
-        OS_FDTable[PossibleFD].IsValid = FALSE;
+        /* Operation failed, so give the entry back */
+        OS_FDTableFree(PossibleFD);
         OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
         return OS_FS_ERROR;
     }
@@ -402,16 +1094,19 @@ int32 OS_open   (const char *path,  int32 access,  uint32  mode)
 /*--------------------------------------------------------------------------------------
     Name: OS_close
     
-    Purpose: Closes a file. 
+    Purpose: Closes a file. The streams of the file are flushed and freed first.
+             The descriptor is invalid once this returns, but if async requests on
+             the file are still in flight, the host file stays open until the last
+             of them completes.
 
-    Returns: OS_FS_ERROR if file  descriptor could not be closed
+    Returns: OS_FS_ERROR if file  descriptor could not be closed, or the data
+             buffered by its streams could not be written
              OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
              OS_FS_SUCCESS if success
 ---------------------------------------------------------------------------------------*/
 
 int32 OS_close (int32  filedes)
 {
-    int       status;
     sigset_t  previous;
     sigset_t  mask;
 
@@ -422,44 +1117,25 @@ int32 OS_close (int32  filedes)
     }
     else
     {    
-
         /*
-        ** call close, and check for an interrupted system call 
+        ** Mappings and streams of the file go away with it
         */
-        do
+        OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
+        if (OS_FDTable[filedes].IsValid == FALSE)
         {
-            status = close ((int) OS_FDTable[filedes].OSfd);
-        } while ( status == -1 && errno == EINTR );
-
-        if (status == ERROR)
-        {
-            /*
-            ** Remove the file from the OSAL list
-            ** to free up that slot 
-            */
-            /* fill in the table before returning */
-            OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
-            OS_FDTable[filedes].OSfd =       -1;
-            strcpy(OS_FDTable[filedes].Path, "\0");
-            OS_FDTable[filedes].User =       0;
-            OS_FDTable[filedes].IsValid =    FALSE;
-            OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
-
-            return OS_FS_ERROR;
-        }
-        else
-        {
-            /* fill in the table before returning */
-            OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
-            OS_FDTable[filedes].OSfd =       -1;
-            strcpy(OS_FDTable[filedes].Path, "\0");
-            OS_FDTable[filedes].User =       0;
-            OS_FDTable[filedes].IsValid =    FALSE;
+            /* another task closed it first */
             OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
-            
-            return OS_FS_SUCCESS;
+            return OS_FS_ERR_INVALID_FD;
         }
 
+        /*
+        ** Remove the file from the OSAL list, so no other task can use it
+        ** once the lock is dropped, then flush its streams and close it
+        */
+        OS_FDCloseStart(filedes);
+        OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
+
+        return OS_FDCloseFinish(filedes);
     }
     
 }/* end OS_close */
@@ -467,7 +1143,8 @@ int32 OS_close (int32  filedes)
 /*--------------------------------------------------------------------------------------
     Name: OS_read
     
-    Purpose: reads up to nbytes from a file, and puts them into buffer. 
+    Purpose: reads up to nbytes from a file, and puts them into buffer. At most
+             OS_MAX_IO_SIZE bytes are read by one call.
     
     Returns: OS_FS_ERR_INVALID_POINTER if buffer is a null pointer
              OS_FS_ERROR if OS call failed
@@ -488,6 +1165,12 @@ int32 OS_read  (int32  filedes, void *buffer, uint32 nbytes)
     }
     else
     { 
+        if (nbytes > OS_MAX_IO_SIZE)
+        {
+            /* so the count returned always fits an int32 */
+            nbytes = OS_MAX_IO_SIZE;
+        }
+
         status = read (OS_FDTable[filedes].OSfd, buffer, nbytes);
  
         if (status == ERROR)
@@ -502,7 +1185,7 @@ int32 OS_read  (int32  filedes, void *buffer, uint32 nbytes)
     Name: OS_write
 
     Purpose: writes to a file. copies up to a maximum of nbtyes of buffer to the file
-             described in filedes
+             described in filedes. At most OS_MAX_IO_SIZE bytes are written by one call.
 
     Returns: OS_FS_ERR_INVALID_POINTER if buffer is NULL
              OS_FS_ERROR if OS call failed
@@ -524,6 +1207,12 @@ int32 OS_write (int32  filedes, void *buffer, uint32 nbytes)
     }
     else
     {
+        if (nbytes > OS_MAX_IO_SIZE)
+        {
+            /* so the count returned always fits an int32 */
+            nbytes = OS_MAX_IO_SIZE;
+        }
+
         status = write(OS_FDTable[filedes].OSfd, buffer, nbytes );
     
         if (status != ERROR)
@@ -534,6 +1223,278 @@ int32 OS_write (int32  filedes, void *buffer, uint32 nbytes)
     
 }/* end OS_write */
 
+/*--------------------------------------------------------------------------------------
+    Name: OS_pread
+    
+    Purpose: reads up to nbytes from a file starting at offset, and puts them into
+             buffer. The file offset is left unchanged, so several tasks may read
+             different parts of the same file at once without a seek.
+    
+    Returns: OS_FS_ERR_INVALID_POINTER if buffer is a null pointer
+             OS_FS_ERROR if offset is beyond what the host supports or OS call failed
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             number of bytes read if success
+---------------------------------------------------------------------------------------*/
+int32 OS_pread  (int32  filedes, void *buffer, uint32 nbytes, uint64 offset)
+{
+    int32 status;
+
+    if (buffer == NULL)
+        return OS_FS_ERR_INVALID_POINTER;
+
+    /* Make sure the file descriptor is legit before using it */
+    if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
+    {
+        return OS_FS_ERR_INVALID_FD;
+    }
+
+    /* off_t may be narrower than 64 bits, and it is signed */
+    if ((off_t)offset < 0 || (uint64)(off_t)offset != offset)
+    {
+        return OS_FS_ERROR;
+    }
+
+    if (nbytes > OS_MAX_IO_SIZE)
+    {
+        nbytes = OS_MAX_IO_SIZE;
+    }
+
+    status = pread (OS_FDTable[filedes].OSfd, buffer, nbytes, (off_t)offset);
+
+    if (status == ERROR)
+        return OS_FS_ERROR;
+
+    return status;
+    
+}/* end OS_pread */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_pwrite
+
+    Purpose: writes up to nbytes of buffer to the file described in filedes, starting
+             at offset. The file offset is left unchanged.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if buffer is NULL
+             OS_FS_ERROR if offset is beyond what the host supports or OS call failed
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             number of bytes written if success
+---------------------------------------------------------------------------------------*/
+
+int32 OS_pwrite (int32  filedes, void *buffer, uint32 nbytes, uint64 offset)
+{
+    int32 status;
+
+    if (buffer == NULL)
+        return OS_FS_ERR_INVALID_POINTER;
+
+    /* Make sure the file descriptor is legit before using it */
+    if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
+    {
+        return OS_FS_ERR_INVALID_FD;
+    }
+
+    /* off_t may be narrower than 64 bits, and it is signed */
+    if ((off_t)offset < 0 || (uint64)(off_t)offset != offset)
+    {
+        return OS_FS_ERROR;
+    }
+
+    if (nbytes > OS_MAX_IO_SIZE)
+    {
+        nbytes = OS_MAX_IO_SIZE;
+    }
+
+    status = pwrite(OS_FDTable[filedes].OSfd, buffer, nbytes, (off_t)offset);
+
+    if (status != ERROR)
+        return  status;
+    else
+        return OS_FS_ERROR;
+    
+}/* end OS_pwrite */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_IovecToHost
+
+    Purpose: Checks the arguments common to the scatter/gather calls and converts
+             the OSAL segments into the host iovec array, which must hold
+             OS_FS_MAX_IOVEC entries.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if iov or a segment buffer is NULL
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             OS_FS_ERROR if there are too many segments or they total over 2 GB
+             OS_FS_SUCCESS if the segments were converted
+---------------------------------------------------------------------------------------*/
+int32 OS_IovecToHost(int32 filedes, const os_iovec_t *iov, uint32 iovcnt, struct iovec *host_iov)
+{
+    uint32 i;
+    uint32 total;
+
+    if (iov == NULL)
+        return OS_FS_ERR_INVALID_POINTER;
+
+    /* Make sure the file descriptor is legit before using it */
+    if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
+    {
+        return OS_FS_ERR_INVALID_FD;
+    }
+
+    if (iovcnt > OS_FS_MAX_IOVEC)
+    {
+        return OS_FS_ERROR;
+    }
+
+    /* the byte count is returned as an int32, so the total must fit in one */
+    total = 0;
+    for (i = 0; i < iovcnt; ++i)
+    {
+        if (iov[i].buffer == NULL)
+        {
+            return OS_FS_ERR_INVALID_POINTER;
+        }
+        if (iov[i].length > (uint32)0x7FFFFFFF - total)
+        {
+            return OS_FS_ERROR;
+        }
+        total += iov[i].length;
+
+        host_iov[i].iov_base = iov[i].buffer;
+        host_iov[i].iov_len = iov[i].length;
+    }
+
+    return OS_FS_SUCCESS;
+
+}/* end OS_IovecToHost */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_readv
+    
+    Purpose: reads from a file into iovcnt buffers, filling each one before moving
+             to the next, with a single call to the host.
+    
+    Returns: OS_FS_ERR_INVALID_POINTER if iov or a segment buffer is NULL
+             OS_FS_ERROR if there are more than OS_FS_MAX_IOVEC segments or OS call failed
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             number of bytes read if success
+---------------------------------------------------------------------------------------*/
+int32 OS_readv  (int32  filedes, const os_iovec_t *iov, uint32 iovcnt)
+{
+    struct iovec host_iov[OS_FS_MAX_IOVEC];
+    int32        status;
+
+    status = OS_IovecToHost(filedes, iov, iovcnt, host_iov);
+    if (status != OS_FS_SUCCESS)
+        return status;
+
+    status = readv (OS_FDTable[filedes].OSfd, host_iov, (int)iovcnt);
+
+    if (status == ERROR)
+        return OS_FS_ERROR;
+
+    return status;
+    
+}/* end OS_readv */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_writev
+
+    Purpose: writes iovcnt buffers to a file, one after the other, with a single
+             call to the host. A record made of a header and a payload can be
+             written without copying them together first.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if iov or a segment buffer is NULL
+             OS_FS_ERROR if there are more than OS_FS_MAX_IOVEC segments or OS call failed
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             number of bytes written if success
+---------------------------------------------------------------------------------------*/
+int32 OS_writev (int32  filedes, const os_iovec_t *iov, uint32 iovcnt)
+{
+    struct iovec host_iov[OS_FS_MAX_IOVEC];
+    int32        status;
+
+    status = OS_IovecToHost(filedes, iov, iovcnt, host_iov);
+    if (status != OS_FS_SUCCESS)
+        return status;
+
+    status = writev(OS_FDTable[filedes].OSfd, host_iov, (int)iovcnt);
+
+    if (status == ERROR)
+        return OS_FS_ERROR;
+
+    return status;
+    
+}/* end OS_writev */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_preadv
+    
+    Purpose: as OS_readv, but reads starting at offset and leaves the file offset
+             unchanged.
+    
+    Returns: OS_FS_ERR_INVALID_POINTER if iov or a segment buffer is NULL
+             OS_FS_ERROR if there are too many segments, offset is beyond what the
+             host supports or OS call failed
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             number of bytes read if success
+---------------------------------------------------------------------------------------*/
+int32 OS_preadv (int32  filedes, const os_iovec_t *iov, uint32 iovcnt, uint64 offset)
+{
+    struct iovec host_iov[OS_FS_MAX_IOVEC];
+    int32        status;
+
+    status = OS_IovecToHost(filedes, iov, iovcnt, host_iov);
+    if (status != OS_FS_SUCCESS)
+        return status;
+
+    if ((off_t)offset < 0 || (uint64)(off_t)offset != offset)
+    {
+        return OS_FS_ERROR;
+    }
+
+    status = preadv (OS_FDTable[filedes].OSfd, host_iov, (int)iovcnt, (off_t)offset);
+
+    if (status == ERROR)
+        return OS_FS_ERROR;
+
+    return status;
+    
+}/* end OS_preadv */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_pwritev
+    
+    Purpose: as OS_writev, but writes starting at offset and leaves the file offset
+             unchanged.
+    
+    Returns: OS_FS_ERR_INVALID_POINTER if iov or a segment buffer is NULL
+             OS_FS_ERROR if there are too many segments, offset is beyond what the
+             host supports or OS call failed
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             number of bytes written if success
+---------------------------------------------------------------------------------------*/
+int32 OS_pwritev (int32  filedes, const os_iovec_t *iov, uint32 iovcnt, uint64 offset)
+{
+    struct iovec host_iov[OS_FS_MAX_IOVEC];
+    int32        status;
+
+    status = OS_IovecToHost(filedes, iov, iovcnt, host_iov);
+    if (status != OS_FS_SUCCESS)
+        return status;
+
+    if ((off_t)offset < 0 || (uint64)(off_t)offset != offset)
+    {
+        return OS_FS_ERROR;
+    }
+
+    status = pwritev(OS_FDTable[filedes].OSfd, host_iov, (int)iovcnt, (off_t)offset);
+
+    if (status == ERROR)
+        return OS_FS_ERROR;
+
+    return status;
+    
+}/* end OS_pwritev */
+
 
 /*--------------------------------------------------------------------------------------
     Name: OS_chmod
@@ -594,6 +1555,71 @@ int32 OS_stat   (const char *path, os_fstat_t  *filestats)
     
 } /* end OS_stat */
 
+/*--------------------------------------------------------------------------------------
+    Name: OS_fstat
+    
+    Purpose: returns information about an open file in filestats. With
+             _FILE_OFFSET_BITS=64 the size is right for files larger than 2 GB.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if filestats is NULL
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             OS_FS_ERROR if the OS call failed
+             OS_FS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+
+int32 OS_fstat (int32 filedes, os_fstat_t *filestats)
+{
+    if (filestats == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+
+    /* Make sure the file descriptor is legit before using it */
+    if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
+    {
+        return OS_FS_ERR_INVALID_FD;
+    }
+
+    if (fstat(OS_FDTable[filedes].OSfd, filestats) == ERROR)
+    {
+        return OS_FS_ERROR;
+    }
+
+    return OS_FS_SUCCESS;
+
+} /* end OS_fstat */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FDGetSize
+    
+    Purpose: returns the size in bytes of an open file in size
+
+    Returns: OS_FS_ERR_INVALID_POINTER if size is NULL
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             OS_FS_ERROR if the OS call failed
+             OS_FS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+
+int32 OS_FDGetSize (int32 filedes, uint64 *size)
+{
+    struct stat filestats;
+    int32       status;
+
+    if (size == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+
+    status = OS_fstat(filedes, &filestats);
+    if (status == OS_FS_SUCCESS)
+    {
+        *size = (uint64)filestats.st_size;
+    }
+
+    return status;
+
+} /* end OS_FDGetSize */
+
 /*--------------------------------------------------------------------------------------
     Name: OS_lseek
 
@@ -602,7 +1628,8 @@ int32 OS_stat   (const char *path, os_fstat_t  *filestats)
 
     Returns: the new offset from the beginning of the file
              OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
-             OS_FS_ERROR if OS call failed
+             OS_FS_ERROR if OS call failed, or the new offset does not fit an int32.
+             The seek has still been done in that case; OS_lseek64 returns it.
 ---------------------------------------------------------------------------------------*/
 
 int32 OS_lseek  (int32  filedes, int32 offset, uint32 whence)
@@ -635,7 +1662,7 @@ int32 OS_lseek  (int32  filedes, int32 offset, uint32 whence)
     
         status = lseek( OS_FDTable[filedes].OSfd, (off_t) offset, (int) where );
 
-        if ( (int) status != ERROR)
+        if ( status != ERROR && status <= (off_t) 0x7FFFFFFF )
             return (int32) status;
         else
             return OS_FS_ERROR;
@@ -644,13 +1671,1846 @@ int32 OS_lseek  (int32  filedes, int32 offset, uint32 whence)
 }/* end OS_lseek */
 
 /*--------------------------------------------------------------------------------------
-    Name: OS_remove
+    Name: OS_lseek64
 
-    Purpose: removes a given filename from the drive
- 
-    Returns: OS_FS_SUCCESS if the driver returns OK
-             OS_FS_ERROR if there is no device or the driver returns error
-             OS_FS_ERR_INVALID_POINTER if path is NULL
+    Purpose: sets the read/write pointer to a specific offset in a specific file,
+             for files larger than 2 GB. Whence is either OS_SEEK_SET, OS_SEEK_CUR,
+             or OS_SEEK_END. The new offset from the beginning of the file is
+             returned in new_offset, which may be NULL if it is not needed.
+
+    Returns: OS_FS_SUCCESS if success
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             OS_FS_ERROR if whence is unknown, offset is beyond what the host
+             supports or OS call failed
+---------------------------------------------------------------------------------------*/
+
+int32 OS_lseek64 (int32 filedes, int64 offset, uint32 whence, uint64 *new_offset)
+{
+    off_t status;
+    int   where;
+
+    /* Make sure the file descriptor is legit before using it */
+    if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
+    {
+        return OS_FS_ERR_INVALID_FD;
+    }
+
+    switch(whence)
+    {
+        case OS_SEEK_SET:
+            where = SEEK_SET;
+            break;
+        case OS_SEEK_CUR:
+            where = SEEK_CUR;
+            break;
+        case OS_SEEK_END:
+            where = SEEK_END;
+            break;
+        default:
+            return OS_FS_ERROR;
+    }
+
+    /* off_t is narrower than 64 bits unless the build sets _FILE_OFFSET_BITS=64 */
+    if ((int64)(off_t)offset != offset)
+    {
+        return OS_FS_ERROR;
+    }
+
+    status = lseek(OS_FDTable[filedes].OSfd, (off_t)offset, where);
+    if (status == ERROR)
+    {
+        return OS_FS_ERROR;
+    }
+
+    if (new_offset != NULL)
+    {
+        *new_offset = (uint64)status;
+    }
+
+    return OS_FS_SUCCESS;
+
+}/* end OS_lseek64 */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FileMap
+
+    Purpose: maps length bytes of an open file, starting at offset, into memory and
+             returns their address in addr.  The mapping is shared: changes made
+             through it reach the file, and processes that map the same file share
+             the same pages instead of each holding a copy.
+
+             access is OS_READ_ONLY or OS_READ_WRITE, and must be allowed by the
+             access the file was opened with.  A mapping always needs read access
+             to the file, so OS_WRITE_ONLY is refused.  OS_FILEMAP_SEQUENTIAL,
+             OS_FILEMAP_RANDOM or OS_FILEMAP_WILLNEED may be or'ed in to tell the
+             host how the mapping will be read.
+
+             offset does not need to be page aligned.  The mapping stays valid until
+             OS_FileUnmap is called or the file is closed.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if addr is NULL
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             OS_ERR_NO_FREE_IDS if OS_MAX_FILE_MAPS mappings already exist
+             OS_FS_ERROR if access, offset or length is not usable or OS call failed,
+             or access is OS_WRITE_ONLY
+             OS_FS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_FileMap (int32 filedes, uint64 offset, uint32 length, uint32 access, void **addr)
+{
+    int       prot;
+    int32     status;
+    uint32    i;
+    long      page_size;
+    uint64    delta;
+    void     *base;
+    sigset_t  previous;
+    sigset_t  mask;
+
+    if (addr == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+
+    switch (access & OS_FILEMAP_ACCESS_MASK)
+    {
+        case OS_READ_ONLY:
+            prot = PROT_READ;
+            break;
+        case OS_READ_WRITE:
+            prot = PROT_READ | PROT_WRITE;
+            break;
+        default:
+            return OS_FS_ERROR;
+    }
+
+    if ((access & ~(OS_FILEMAP_ACCESS_MASK | OS_FILEMAP_HINT_MASK)) != 0 || length == 0)
+    {
+        return OS_FS_ERROR;
+    }
+
+    /*
+    ** The host maps whole pages, so map from the page holding offset
+    */
+    page_size = sysconf(_SC_PAGESIZE);
+    if (page_size <= 0)
+    {
+        return OS_FS_ERROR;
+    }
+    delta = offset % (uint64)page_size;
+    offset -= delta;
+
+    if ((off_t)offset < 0 || (uint64)(off_t)offset != offset ||
+        (size_t)length > (size_t)-1 - (size_t)delta)
+    {
+        return OS_FS_ERROR;
+    }
+
+    OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
+
+    if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
+    {
+        status = OS_FS_ERR_INVALID_FD;
+    }
+    else
+    {
+        for (i = 0; i < OS_MAX_FILE_MAPS; i++)
+        {
+            if (OS_file_map_table[i].IsValid == FALSE && OS_file_map_table[i].busy == 0)
+            {
+                break;
+            }
+        }
+
+        if (i >= OS_MAX_FILE_MAPS)
+        {
+            status = OS_ERR_NO_FREE_IDS;
+        }
+        else
+        {
+            base = mmap(NULL, (size_t)length + (size_t)delta, prot, MAP_SHARED,
+                        OS_FDTable[filedes].OSfd, (off_t)offset);
+            if (base == MAP_FAILED)
+            {
+                status = OS_FS_ERROR;
+            }
+            else
+            {
+                OS_file_map_table[i].base = base;
+                OS_file_map_table[i].length = (size_t)length + (size_t)delta;
+                OS_file_map_table[i].addr = (char *)base + delta;
+                OS_file_map_table[i].filedes = filedes;
+                OS_file_map_table[i].IsValid = TRUE;
+                *addr = OS_file_map_table[i].addr;
+                status = OS_FS_SUCCESS;
+
+                /*
+                ** The hints are advice only, a host that ignores them is not an error
+                */
+                if (access & OS_FILEMAP_SEQUENTIAL)
+                {
+                    posix_madvise(base, OS_file_map_table[i].length, POSIX_MADV_SEQUENTIAL);
+                }
+                if (access & OS_FILEMAP_RANDOM)
+                {
+                    posix_madvise(base, OS_file_map_table[i].length, POSIX_MADV_RANDOM);
+                }
+                if (access & OS_FILEMAP_WILLNEED)
+                {
+                    posix_madvise(base, OS_file_map_table[i].length, POSIX_MADV_WILLNEED);
+                }
+            }
+        }
+    }
+
+    OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
+
+    return status;
+
+}/* end OS_FileMap */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FileUnmap
+
+    Purpose: removes a mapping made by OS_FileMap.  Changes made through it are
+             kept in the file, but may not be on storage yet; see OS_FileSync.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if addr is NULL
+             OS_FS_ERROR if addr was not returned by OS_FileMap or OS call failed
+             OS_FS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_FileUnmap (void *addr)
+{
+    int32     status;
+    uint32    i;
+    sigset_t  previous;
+    sigset_t  mask;
+
+    if (addr == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+
+    status = OS_FS_ERROR;
+
+    OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
+
+    for (i = 0; i < OS_MAX_FILE_MAPS; i++)
+    {
+        if (OS_file_map_table[i].IsValid == TRUE && OS_file_map_table[i].addr == addr)
+        {
+            if (OS_file_map_table[i].busy > 0)
+            {
+                /* the last OS_FileSync unmaps it */
+                status = OS_FS_SUCCESS;
+            }
+            else if (munmap(OS_file_map_table[i].base, OS_file_map_table[i].length) == 0)
+            {
+                status = OS_FS_SUCCESS;
+            }
+            OS_file_map_table[i].IsValid = FALSE;
+            break;
+        }
+    }
+
+    OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
+
+    return status;
+
+}/* end OS_FileUnmap */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FileSync
+
+    Purpose: writes changes made through a mapping from OS_FileMap back to the file
+             and waits for them to reach storage.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if addr is NULL
+             OS_FS_ERROR if addr was not returned by OS_FileMap or OS call failed
+             OS_FS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_FileSync (void *addr)
+{
+    int32     status;
+    uint32    i;
+    void     *base = NULL;
+    size_t    length = 0;
+    sigset_t  previous;
+    sigset_t  mask;
+
+    if (addr == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+
+    /*
+    ** Pin the mapping so it stays in place while msync runs without the lock
+    */
+    OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
+
+    for (i = 0; i < OS_MAX_FILE_MAPS; i++)
+    {
+        if (OS_file_map_table[i].IsValid == TRUE && OS_file_map_table[i].addr == addr)
+        {
+            OS_file_map_table[i].busy++;
+            base = OS_file_map_table[i].base;
+            length = OS_file_map_table[i].length;
+            break;
+        }
+    }
+
+    OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
+
+    if (i >= OS_MAX_FILE_MAPS)
+    {
+        return OS_FS_ERROR;
+    }
+
+    status = OS_FS_ERROR;
+    if (msync(base, length, MS_SYNC) == 0)
+    {
+        status = OS_FS_SUCCESS;
+    }
+
+    OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
+
+    OS_file_map_table[i].busy--;
+    if (OS_file_map_table[i].busy == 0 && OS_file_map_table[i].IsValid == FALSE)
+    {
+        /* removed while msync ran */
+        munmap(base, length);
+    }
+
+    OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
+
+    return status;
+
+}/* end OS_FileSync */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FileUnmapByFd
+
+    Purpose: removes every mapping of a file that is being closed.
+             The caller must hold OS_FDTableMutex.
+
+    Returns: nothing
+---------------------------------------------------------------------------------------*/
+void OS_FileUnmapByFd (int32 filedes)
+{
+    uint32 i;
+
+    for (i = 0; i < OS_MAX_FILE_MAPS; i++)
+    {
+        if (OS_file_map_table[i].IsValid == TRUE && OS_file_map_table[i].filedes == filedes)
+        {
+            /* a mapping pinned by OS_FileSync is unmapped by its last caller */
+            if (OS_file_map_table[i].busy == 0)
+            {
+                munmap(OS_file_map_table[i].base, OS_file_map_table[i].length);
+            }
+            OS_file_map_table[i].IsValid = FALSE;
+        }
+    }
+
+}/* end OS_FileUnmapByFd */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_AsyncQueueCreate
+
+    Purpose: creates a queue for asynchronous reads and writes with room for depth
+             outstanding requests. flags may be OS_ASYNC_IO_URING or OS_ASYNC_THREADS
+             to choose the engine; with neither, io_uring is used if the host allows
+             it and the worker tasks otherwise.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if queue_id is NULL
+             OS_FS_ERROR if depth or flags are out of range, or OS call failed
+             OS_FS_UNIMPLEMENTED if OS_ASYNC_IO_URING is asked for but not available
+             OS_ERR_NO_FREE_IDS if there are no free queues
+             OS_FS_SUCCESS if success
+
+    Notes: The worker tasks are one work queue of OS_ASYNC_IO_WORKERS tasks, shared by
+           every queue that does not use io_uring. It is created with the first such
+           queue and deleted with the last one.
+---------------------------------------------------------------------------------------*/
+int32 OS_AsyncQueueCreate (uint32 *queue_id, uint32 depth, uint32 flags)
+{
+    OS_async_queue_record_t *aq;
+    pthread_condattr_t       cond_attr;
+    uint32                   possible_qid;
+    uint32                   i;
+    int32                    status;
+    sigset_t                 previous;
+    sigset_t                 mask;
+
+    if (queue_id == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+
+    if (depth == 0 || depth > OS_ASYNC_QUEUE_MAX_DEPTH ||
+        (flags & ~(OS_ASYNC_IO_URING | OS_ASYNC_THREADS)) != 0 ||
+        flags == (OS_ASYNC_IO_URING | OS_ASYNC_THREADS))
+    {
+        return OS_FS_ERROR;
+    }
+
+#ifndef OS_ASYNC_HAVE_IO_URING
+    if (flags & OS_ASYNC_IO_URING)
+    {
+        return OS_FS_UNIMPLEMENTED;
+    }
+#endif
+
+    OS_InterruptSafeLock(&OS_async_queue_table_mut, &mask, &previous);
+
+    for (possible_qid = 0; possible_qid < OS_MAX_ASYNC_QUEUES; possible_qid++)
+    {
+        if (OS_async_queue_table[possible_qid].free == TRUE)
+        {
+            break;
+        }
+    }
+
+    if (possible_qid >= OS_MAX_ASYNC_QUEUES)
+    {
+        OS_InterruptSafeUnlock(&OS_async_queue_table_mut, &previous);
+        return OS_ERR_NO_FREE_IDS;
+    }
+
+    aq = &OS_async_queue_table[possible_qid];
+    aq->free = FALSE;
+
+    OS_InterruptSafeUnlock(&OS_async_queue_table_mut, &previous);
+
+    /*
+    ** Thread the first depth requests on the free list
+    */
+    aq->depth         = depth;
+    aq->outstanding   = 0;
+    aq->uses_io_uring = FALSE;
+    aq->done_head     = OS_ASYNC_NONE;
+    aq->done_tail     = OS_ASYNC_NONE;
+    aq->waiters       = 0;
+    for (i = 0; i < depth; i++)
+    {
+        aq->requests[i].queue_id = possible_qid;
+        aq->requests[i].next     = (i + 1 < depth) ? (i + 1) : OS_ASYNC_NONE;
+    }
+    aq->free_head = 0;
+
+    /* OS_AsyncWait takes its deadline from CLOCK_MONOTONIC */
+    pthread_mutex_init(&aq->mut, NULL);
+    pthread_condattr_init(&cond_attr);
+    pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&aq->done_cv, &cond_attr);
+    pthread_condattr_destroy(&cond_attr);
+
+    status = OS_FS_ERROR;
+
+#ifdef OS_ASYNC_HAVE_IO_URING
+    if ((flags & OS_ASYNC_THREADS) == 0)
+    {
+        status = OS_AsyncRingSetup(&aq->ring, depth);
+        if (status == OS_FS_SUCCESS)
+        {
+            aq->uses_io_uring = TRUE;
+        }
+    }
+#endif
+
+    if (aq->uses_io_uring == FALSE && (flags & OS_ASYNC_IO_URING) == 0)
+    {
+        status = OS_AsyncWorkersAttach();
+    }
+
+    if (status != OS_FS_SUCCESS)
+    {
+        pthread_cond_destroy(&aq->done_cv);
+        pthread_mutex_destroy(&aq->mut);
+
+        OS_InterruptSafeLock(&OS_async_queue_table_mut, &mask, &previous);
+        aq->free = TRUE;
+        OS_InterruptSafeUnlock(&OS_async_queue_table_mut, &previous);
+
+        return status;
+    }
+
+    *queue_id = possible_qid;
+
+    return OS_FS_SUCCESS;
+
+}/* end OS_AsyncQueueCreate */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_AsyncQueueDelete
+
+    Purpose: waits for the requests still in flight on a queue, drops their
+             completions and deletes the queue.
+
+    Returns: OS_ERR_INVALID_ID if the id passed in is not a valid queue
+             OS_FS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_AsyncQueueDelete (uint32 queue_id)
+{
+    OS_async_queue_record_t *aq;
+    sigset_t                 previous;
+    sigset_t                 mask;
+
+    if (queue_id >= OS_MAX_ASYNC_QUEUES || OS_async_queue_table[queue_id].free == TRUE)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    aq = &OS_async_queue_table[queue_id];
+
+    pthread_mutex_lock(&aq->mut);
+    while (1)
+    {
+        OS_AsyncReap(aq);
+        OS_AsyncCollect(aq, NULL, aq->depth);
+        if (aq->outstanding == 0)
+        {
+            break;
+        }
+        OS_AsyncBlock(aq, NULL);
+    }
+    pthread_mutex_unlock(&aq->mut);
+
+#ifdef OS_ASYNC_HAVE_IO_URING
+    if (aq->uses_io_uring)
+    {
+        OS_AsyncRingTeardown(&aq->ring);
+    }
+    else
+#endif
+    {
+        OS_AsyncWorkersDetach();
+    }
+
+    pthread_cond_destroy(&aq->done_cv);
+    pthread_mutex_destroy(&aq->mut);
+
+    OS_InterruptSafeLock(&OS_async_queue_table_mut, &mask, &previous);
+    aq->free = TRUE;
+    OS_InterruptSafeUnlock(&OS_async_queue_table_mut, &previous);
+
+    return OS_FS_SUCCESS;
+
+}/* end OS_AsyncQueueDelete */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_AsyncRead
+
+    Purpose: queues a read of up to nbytes from the file described in filedes into
+             buffer, starting at offset. The file offset is left unchanged.
+             At most OS_MAX_IO_SIZE bytes are transferred by one request.
+             The buffer must not be touched until OS_AsyncWait has returned the
+             completion, which carries user_arg.
+             Closing the file does not cancel the request: the host file stays
+             open until it completes.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if buffer is NULL
+             OS_ERR_INVALID_ID if the id passed in is not a valid queue
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             OS_FS_ERROR if offset is beyond what the host supports
+             OS_QUEUE_FULL if depth requests are already outstanding
+             OS_FS_SUCCESS if the request was queued
+---------------------------------------------------------------------------------------*/
+int32 OS_AsyncRead (uint32 queue_id, int32 filedes, void *buffer, uint32 nbytes,
+                    uint64 offset, void *user_arg)
+{
+    return OS_AsyncSubmit(queue_id, filedes, buffer, nbytes, offset, user_arg, FALSE);
+}/* end OS_AsyncRead */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_AsyncWrite
+
+    Purpose: queues a write of nbytes of buffer to the file described in filedes,
+             starting at offset. The file offset is left unchanged.
+
+    Returns: as OS_AsyncRead
+---------------------------------------------------------------------------------------*/
+int32 OS_AsyncWrite (uint32 queue_id, int32 filedes, void *buffer, uint32 nbytes,
+                     uint64 offset, void *user_arg)
+{
+    return OS_AsyncSubmit(queue_id, filedes, buffer, nbytes, offset, user_arg, TRUE);
+}/* end OS_AsyncWrite */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_AsyncWait
+
+    Purpose: stores up to max_count completed requests of a queue in completions,
+             oldest first. If none has completed it waits for msecs milliseconds,
+             forever with OS_PEND, or not at all with OS_CHECK.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if completions is NULL
+             OS_ERR_INVALID_ID if the id passed in is not a valid queue
+             OS_FS_ERROR if max_count is zero or msecs is negative but not OS_PEND
+             OS_ERROR_TIMEOUT if no request completed in time
+             the number of completions stored if success
+---------------------------------------------------------------------------------------*/
+int32 OS_AsyncWait (uint32 queue_id, os_async_completion_t *completions, uint32 max_count,
+                    int32 msecs)
+{
+    OS_async_queue_record_t *aq;
+    struct timespec          deadline;
+    uint32                   count;
+    int                      timed_out;
+
+    if (completions == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+
+    if (queue_id >= OS_MAX_ASYNC_QUEUES || OS_async_queue_table[queue_id].free == TRUE)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    if (max_count == 0 || (msecs < 0 && msecs != OS_PEND))
+    {
+        return OS_FS_ERROR;
+    }
+
+    if (msecs > 0)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+        deadline.tv_sec  += msecs / 1000;
+        deadline.tv_nsec += (msecs % 1000) * 1000000;
+        if (deadline.tv_nsec >= 1000000000)
+        {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000;
+        }
+    }
+
+    aq = &OS_async_queue_table[queue_id];
+    timed_out = FALSE;
+
+    pthread_mutex_lock(&aq->mut);
+    while (1)
+    {
+        OS_AsyncReap(aq);
+        count = OS_AsyncCollect(aq, completions, max_count);
+        if (count > 0 || timed_out || msecs == OS_CHECK)
+        {
+            break;
+        }
+        timed_out = OS_AsyncBlock(aq, (msecs == OS_PEND) ? NULL : &deadline);
+    }
+    pthread_mutex_unlock(&aq->mut);
+
+    if (count == 0)
+    {
+        return OS_ERROR_TIMEOUT;
+    }
+
+    return (int32)count;
+
+}/* end OS_AsyncWait */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_AsyncSubmit
+
+    Purpose: common code of OS_AsyncRead and OS_AsyncWrite
+
+    Returns: see OS_AsyncRead
+---------------------------------------------------------------------------------------*/
+int32 OS_AsyncSubmit (uint32 queue_id, int32 filedes, void *buffer, uint32 nbytes,
+                      uint64 offset, void *user_arg, uint8 is_write)
+{
+    OS_async_queue_record_t *aq;
+    OS_async_request_t      *req;
+    uint32                   idx;
+    int32                    status;
+    int                      host_fd;
+    sigset_t                 previous;
+    sigset_t                 mask;
+
+    if (buffer == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+
+    if (queue_id >= OS_MAX_ASYNC_QUEUES || OS_async_queue_table[queue_id].free == TRUE)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    /* Make sure the file descriptor is legit before using it */
+    if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
+    {
+        return OS_FS_ERR_INVALID_FD;
+    }
+
+    /* off_t may be narrower than 64 bits, and it is signed */
+    if ((off_t)offset < 0 || (uint64)(off_t)offset != offset)
+    {
+        return OS_FS_ERROR;
+    }
+
+    /* the completion result is an int32, so keep it clear of the sign bit */
+    if (nbytes > OS_MAX_IO_SIZE)
+    {
+        nbytes = OS_MAX_IO_SIZE;
+    }
+
+    /*
+    ** The request holds a reference on the entry, so a close while it is in
+    ** flight leaves the host fd open until it completes
+    */
+    OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
+    if (OS_FDTable[filedes].IsValid == FALSE)
+    {
+        OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
+        return OS_FS_ERR_INVALID_FD;
+    }
+    OS_fd_host_refs[filedes]++;
+    host_fd = OS_FDTable[filedes].OSfd;
+    OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
+
+    aq = &OS_async_queue_table[queue_id];
+
+    pthread_mutex_lock(&aq->mut);
+
+    idx = aq->free_head;
+    if (idx == OS_ASYNC_NONE)
+    {
+        pthread_mutex_unlock(&aq->mut);
+        OS_FDHostRelease(filedes);
+        return OS_QUEUE_FULL;
+    }
+
+    req = &aq->requests[idx];
+    aq->free_head = req->next;
+    aq->outstanding++;
+
+    req->user_arg     = user_arg;
+    req->iov.iov_base = buffer;
+    req->iov.iov_len  = nbytes;
+    req->offset       = (off_t)offset;
+    req->filedes      = filedes;
+    req->host_fd      = host_fd;
+    req->is_write     = is_write;
+
+#ifdef OS_ASYNC_HAVE_IO_URING
+    if (aq->uses_io_uring)
+    {
+        OS_AsyncRingPush(aq, idx);
+        status = OS_FS_SUCCESS;
+    }
+    else
+#endif
+    {
+        status = OS_WorkSubmit(OS_async_work_queue_id, OS_AsyncExecute, req, NULL);
+        if (status != OS_SUCCESS)
+        {
+            req->next = aq->free_head;
+            aq->free_head = idx;
+            aq->outstanding--;
+        }
+    }
+
+    pthread_mutex_unlock(&aq->mut);
+
+    if (status != OS_FS_SUCCESS)
+    {
+        OS_FDHostRelease(filedes);
+    }
+
+    return status;
+
+}/* end OS_AsyncSubmit */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_AsyncExecute
+
+    Purpose: work queue function that carries out one request of a queue that does
+             not use io_uring, and puts it on the done list of the queue
+
+    Returns: nothing
+---------------------------------------------------------------------------------------*/
+void OS_AsyncExecute (void *arg)
+{
+    OS_async_request_t      *req = (OS_async_request_t *)arg;
+    OS_async_queue_record_t *aq  = &OS_async_queue_table[req->queue_id];
+    ssize_t                  status;
+
+    if (req->is_write)
+    {
+        status = pwrite(req->host_fd, req->iov.iov_base, req->iov.iov_len, req->offset);
+    }
+    else
+    {
+        status = pread(req->host_fd, req->iov.iov_base, req->iov.iov_len, req->offset);
+    }
+
+    req->result = (status < 0) ? OS_FS_ERROR : (int32)status;
+
+    pthread_mutex_lock(&aq->mut);
+    OS_AsyncDone(aq, (uint32)(req - aq->requests));
+    if (aq->waiters != 0)
+    {
+        pthread_cond_broadcast(&aq->done_cv);
+    }
+    pthread_mutex_unlock(&aq->mut);
+
+}/* end OS_AsyncExecute */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_AsyncDone
+
+    Purpose: appends a completed request to the done list of its queue and drops
+             its reference on the file. The caller must hold the queue mutex.
+
+    Returns: nothing
+---------------------------------------------------------------------------------------*/
+void OS_AsyncDone (OS_async_queue_record_t *aq, uint32 idx)
+{
+    OS_FDHostRelease(aq->requests[idx].filedes);
+
+    aq->requests[idx].next = OS_ASYNC_NONE;
+    if (aq->done_tail == OS_ASYNC_NONE)
+    {
+        aq->done_head = idx;
+    }
+    else
+    {
+        aq->requests[aq->done_tail].next = idx;
+    }
+    aq->done_tail = idx;
+
+}/* end OS_AsyncDone */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_AsyncCollect
+
+    Purpose: takes up to max_count requests off the done list of a queue, copies them
+             to completions unless it is NULL, and frees them.
+             The caller must hold the queue mutex.
+
+    Returns: the number of requests taken
+---------------------------------------------------------------------------------------*/
+uint32 OS_AsyncCollect (OS_async_queue_record_t *aq, os_async_completion_t *completions,
+                        uint32 max_count)
+{
+    OS_async_request_t *req;
+    uint32              idx;
+    uint32              count;
+
+    count = 0;
+    while (count < max_count && aq->done_head != OS_ASYNC_NONE)
+    {
+        idx = aq->done_head;
+        req = &aq->requests[idx];
+
+        aq->done_head = req->next;
+        if (aq->done_head == OS_ASYNC_NONE)
+        {
+            aq->done_tail = OS_ASYNC_NONE;
+        }
+
+        if (completions != NULL)
+        {
+            completions[count].user_arg = req->user_arg;
+            completions[count].result   = req->result;
+        }
+
+        req->next = aq->free_head;
+        aq->free_head = idx;
+        aq->outstanding--;
+        count++;
+    }
+
+    return count;
+
+}/* end OS_AsyncCollect */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_AsyncBlock
+
+    Purpose: waits until a request of the queue may have completed, or until the
+             CLOCK_MONOTONIC deadline if it is not NULL. The caller must hold the
+             queue mutex, which is released while waiting.
+
+    Returns: TRUE if the deadline has passed, FALSE otherwise
+---------------------------------------------------------------------------------------*/
+int OS_AsyncBlock (OS_async_queue_record_t *aq, const struct timespec *deadline)
+{
+    int             status;
+#ifdef OS_ASYNC_HAVE_IO_URING
+    struct pollfd   event_poll;
+    struct timespec now;
+    struct timespec left;
+    uint64          events;
+
+    if (aq->uses_io_uring)
+    {
+        left.tv_sec  = 0;
+        left.tv_nsec = 0;
+        if (deadline != NULL)
+        {
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            left.tv_sec  = deadline->tv_sec - now.tv_sec;
+            left.tv_nsec = deadline->tv_nsec - now.tv_nsec;
+            if (left.tv_nsec < 0)
+            {
+                left.tv_sec--;
+                left.tv_nsec += 1000000000;
+            }
+            if (left.tv_sec < 0)
+            {
+                return TRUE;
+            }
+        }
+
+        /*
+        ** Entries the kernel could not take yet are retried every millisecond
+        */
+        if (*aq->ring.sq_tail != __atomic_load_n(aq->ring.sq_head, __ATOMIC_ACQUIRE) &&
+            (deadline == NULL || left.tv_sec > 0 || left.tv_nsec > 1000000))
+        {
+            left.tv_sec  = 0;
+            left.tv_nsec = 1000000;
+            deadline     = &left;
+        }
+
+        /*
+        ** Every completion bumps the eventfd, so one that lands after the last
+        ** look at the completion ring still ends the poll
+        */
+        event_poll.fd      = aq->ring.event_fd;
+        event_poll.events  = POLLIN;
+        event_poll.revents = 0;
+
+        pthread_mutex_unlock(&aq->mut);
+        ppoll(&event_poll, 1, (deadline == NULL) ? NULL : &left, NULL);
+        if (read(aq->ring.event_fd, &events, sizeof(events)) < 0)
+        {
+            /* nothing to clear */
+        }
+        pthread_mutex_lock(&aq->mut);
+
+        return FALSE;
+    }
+#endif
+
+    aq->waiters++;
+    if (deadline == NULL)
+    {
+        pthread_cond_wait(&aq->done_cv, &aq->mut);
+        status = 0;
+    }
+    else
+    {
+        status = pthread_cond_timedwait(&aq->done_cv, &aq->mut, deadline);
+    }
+    aq->waiters--;
+
+    return (status == ETIMEDOUT);
+
+}/* end OS_AsyncBlock */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_AsyncWorkersAttach
+
+    Purpose: registers one more user of the worker tasks, starting them if needed
+
+    Returns: OS_FS_SUCCESS or the error of OS_WorkQueueCreate
+---------------------------------------------------------------------------------------*/
+int32 OS_AsyncWorkersAttach (void)
+{
+    int32 status;
+
+    status = OS_SUCCESS;
+
+    pthread_mutex_lock(&OS_async_work_mut);
+    if (OS_async_work_users == 0)
+    {
+        status = OS_WorkQueueCreate(&OS_async_work_queue_id, OS_ASYNC_WORK_QUEUE_NAME,
+                                    OS_ASYNC_IO_WORKERS, OS_ASYNC_IO_PRIORITY, 0);
+    }
+    if (status == OS_SUCCESS)
+    {
+        OS_async_work_users++;
+    }
+    pthread_mutex_unlock(&OS_async_work_mut);
+
+    return status;
+
+}/* end OS_AsyncWorkersAttach */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_AsyncWorkersDetach
+
+    Purpose: drops one user of the worker tasks, stopping them after the last one
+
+    Returns: nothing
+---------------------------------------------------------------------------------------*/
+void OS_AsyncWorkersDetach (void)
+{
+    pthread_mutex_lock(&OS_async_work_mut);
+    OS_async_work_users--;
+    if (OS_async_work_users == 0)
+    {
+        OS_WorkQueueDelete(OS_async_work_queue_id);
+    }
+    pthread_mutex_unlock(&OS_async_work_mut);
+
+}/* end OS_AsyncWorkersDetach */
+
+#ifdef OS_ASYNC_HAVE_IO_URING
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_AsyncRingSetup
+
+    Purpose: creates an io_uring with room for entries requests, maps its rings and
+             attaches an eventfd for OS_AsyncBlock to wait on
+
+    Returns: OS_FS_UNIMPLEMENTED if the host does not allow io_uring
+             OS_FS_ERROR if the rings could not be mapped
+             OS_FS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_AsyncRingSetup (OS_async_ring_t *ring, uint32 entries)
+{
+    struct io_uring_params params;
+    int                    event_fd;
+
+    memset(ring, 0, sizeof(*ring));
+    ring->event_fd = -1;
+
+    memset(&params, 0, sizeof(params));
+    ring->ring_fd = syscall(__NR_io_uring_setup, entries, &params);
+    if (ring->ring_fd < 0)
+    {
+        return OS_FS_UNIMPLEMENTED;
+    }
+
+    ring->sq_size   = params.sq_off.array + params.sq_entries * sizeof(uint32);
+    ring->cq_size   = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    ring->sq_ptr = mmap(NULL, ring->sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                        ring->ring_fd, IORING_OFF_SQ_RING);
+    ring->cq_ptr = mmap(NULL, ring->cq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                        ring->ring_fd, IORING_OFF_CQ_RING);
+    ring->sqes   = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                        ring->ring_fd, IORING_OFF_SQES);
+    if (ring->sq_ptr == MAP_FAILED || ring->cq_ptr == MAP_FAILED || ring->sqes == MAP_FAILED)
+    {
+        OS_AsyncRingTeardown(ring);
+        return OS_FS_ERROR;
+    }
+
+    ring->sq_head  = (uint32 *)((char *)ring->sq_ptr + params.sq_off.head);
+    ring->sq_tail  = (uint32 *)((char *)ring->sq_ptr + params.sq_off.tail);
+    ring->sq_mask  = (uint32 *)((char *)ring->sq_ptr + params.sq_off.ring_mask);
+    ring->sq_array = (uint32 *)((char *)ring->sq_ptr + params.sq_off.array);
+    ring->cq_head  = (uint32 *)((char *)ring->cq_ptr + params.cq_off.head);
+    ring->cq_tail  = (uint32 *)((char *)ring->cq_ptr + params.cq_off.tail);
+    ring->cq_mask  = (uint32 *)((char *)ring->cq_ptr + params.cq_off.ring_mask);
+    ring->cqes     = (struct io_uring_cqe *)((char *)ring->cq_ptr + params.cq_off.cqes);
+
+    event_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    ring->event_fd = event_fd;
+    if (event_fd < 0 ||
+        syscall(__NR_io_uring_register, ring->ring_fd, IORING_REGISTER_EVENTFD, &event_fd, 1) < 0)
+    {
+        OS_AsyncRingTeardown(ring);
+        return OS_FS_UNIMPLEMENTED;
+    }
+
+    return OS_FS_SUCCESS;
+
+}/* end OS_AsyncRingSetup */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_AsyncRingTeardown
+
+    Purpose: unmaps the rings of an io_uring and closes it
+
+    Returns: nothing
+---------------------------------------------------------------------------------------*/
+void OS_AsyncRingTeardown (OS_async_ring_t *ring)
+{
+    if (ring->sqes != NULL && ring->sqes != MAP_FAILED)
+    {
+        munmap(ring->sqes, ring->sqes_size);
+    }
+    if (ring->cq_ptr != NULL && ring->cq_ptr != MAP_FAILED)
+    {
+        munmap(ring->cq_ptr, ring->cq_size);
+    }
+    if (ring->sq_ptr != NULL && ring->sq_ptr != MAP_FAILED)
+    {
+        munmap(ring->sq_ptr, ring->sq_size);
+    }
+    if (ring->event_fd >= 0)
+    {
+        close(ring->event_fd);
+    }
+    close(ring->ring_fd);
+
+}/* end OS_AsyncRingTeardown */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_AsyncRingPush
+
+    Purpose: places a request in the submission ring and hands it to the kernel.
+             The caller must hold the queue mutex.
+
+    Returns: nothing
+---------------------------------------------------------------------------------------*/
+void OS_AsyncRingPush (OS_async_queue_record_t *aq, uint32 idx)
+{
+    OS_async_ring_t     *ring = &aq->ring;
+    OS_async_request_t  *req  = &aq->requests[idx];
+    struct io_uring_sqe *sqe;
+    uint32               tail;
+    uint32               slot;
+
+    /*
+    ** The ring has at least depth entries, so there is always room
+    */
+    tail = *ring->sq_tail;
+    slot = tail & *ring->sq_mask;
+
+    sqe = &ring->sqes[slot];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode    = req->is_write ? IORING_OP_WRITEV : IORING_OP_READV;
+    sqe->fd        = req->host_fd;
+    sqe->addr      = (unsigned long)&req->iov;
+    sqe->len       = 1;
+    sqe->off       = (uint64)req->offset;
+    sqe->user_data = idx;
+
+    ring->sq_array[slot] = slot;
+    __atomic_store_n(ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+
+    OS_AsyncRingFlush(ring);
+
+}/* end OS_AsyncRingPush */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_AsyncRingFlush
+
+    Purpose: hands the entries of the submission ring the kernel has not taken yet
+             to io_uring_enter. Entries it cannot take now stay for the next call.
+
+    Returns: nothing
+---------------------------------------------------------------------------------------*/
+void OS_AsyncRingFlush (OS_async_ring_t *ring)
+{
+    uint32 to_submit;
+    long   status;
+
+    to_submit = *ring->sq_tail - __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+    if (to_submit == 0)
+    {
+        return;
+    }
+
+    do
+    {
+        status = syscall(__NR_io_uring_enter, ring->ring_fd, to_submit, 0, 0, NULL, 0);
+    } while (status < 0 && errno == EINTR);
+
+}/* end OS_AsyncRingFlush */
+
+#endif
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_AsyncReap
+
+    Purpose: moves the requests found in the completion ring of an io_uring queue to
+             its done list, after handing the kernel anything left to submit.
+             Does nothing for a queue run by the worker tasks.
+             The caller must hold the queue mutex.
+
+    Returns: nothing
+---------------------------------------------------------------------------------------*/
+void OS_AsyncReap (OS_async_queue_record_t *aq)
+{
+#ifdef OS_ASYNC_HAVE_IO_URING
+    OS_async_ring_t     *ring = &aq->ring;
+    struct io_uring_cqe *cqe;
+    uint32               head;
+    uint32               tail;
+    uint32               idx;
+
+    if (aq->uses_io_uring == FALSE)
+    {
+        return;
+    }
+
+    OS_AsyncRingFlush(ring);
+
+    head = *ring->cq_head;
+    tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+    while (head != tail)
+    {
+        cqe = &ring->cqes[head & *ring->cq_mask];
+        idx = (uint32)cqe->user_data;
+        aq->requests[idx].result = (cqe->res < 0) ? OS_FS_ERROR : cqe->res;
+        OS_AsyncDone(aq, idx);
+        head++;
+    }
+    __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+#endif
+
+}/* end OS_AsyncReap */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_StreamOpen
+
+    Purpose: creates a buffered stream on the open file filedes. OS_StreamWrite adds
+             data to a buffer of buffer_size bytes, which is written to the file with
+             one call once flush_size bytes are waiting (0 for buffer_size), flush_msec
+             after the first of them was added (0 for no time limit), on OS_StreamFlush,
+             and when the stream or the file is closed.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if stream_id is NULL
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             OS_FS_ERROR if the sizes are out of range, or OS call failed
+             OS_ERR_NO_FREE_IDS if there are no free streams
+             OS_FS_SUCCESS if success
+
+    Notes: Streams with a time limit are written out by a thread started with the first
+           of them. It runs until the application exits.
+---------------------------------------------------------------------------------------*/
+int32 OS_StreamOpen (uint32 *stream_id, int32 filedes, uint32 buffer_size,
+                     uint32 flush_size, uint32 flush_msec)
+{
+    OS_stream_record_t *stream;
+    uint8              *buffer;
+    uint32              possible_sid;
+    sigset_t            fd_previous;
+    sigset_t            previous;
+    sigset_t            mask;
+
+    if (stream_id == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+
+    if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
+    {
+        return OS_FS_ERR_INVALID_FD;
+    }
+
+    if (buffer_size == 0 || buffer_size > OS_STREAM_MAX_BUFFER_SIZE || flush_size > buffer_size)
+    {
+        return OS_FS_ERROR;
+    }
+
+    if (flush_size == 0)
+    {
+        flush_size = buffer_size;
+    }
+
+    if (flush_msec != 0 && OS_StreamFlusherStart() != OS_FS_SUCCESS)
+    {
+        return OS_FS_ERROR;
+    }
+
+    buffer = malloc(buffer_size);
+    if (buffer == NULL)
+    {
+        return OS_FS_ERROR;
+    }
+
+    /*
+    ** The file is checked and the stream registered under OS_FDTableMutex,
+    ** so a close either detaches the new stream or turns the open down
+    */
+    OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &fd_previous);
+    if (OS_FDTable[filedes].IsValid == FALSE)
+    {
+        OS_InterruptSafeUnlock(&OS_FDTableMutex, &fd_previous);
+        free(buffer);
+        return OS_FS_ERR_INVALID_FD;
+    }
+
+    OS_InterruptSafeLock(&OS_stream_table_mut, &mask, &previous);
+
+    for (possible_sid = 0; possible_sid < OS_MAX_STREAMS; possible_sid++)
+    {
+        if (OS_stream_table[possible_sid].IsValid == FALSE &&
+            OS_stream_table[possible_sid].detached == FALSE)
+        {
+            break;
+        }
+    }
+
+    if (possible_sid >= OS_MAX_STREAMS)
+    {
+        OS_InterruptSafeUnlock(&OS_stream_table_mut, &previous);
+        OS_InterruptSafeUnlock(&OS_FDTableMutex, &fd_previous);
+        free(buffer);
+        return OS_ERR_NO_FREE_IDS;
+    }
+
+    stream = &OS_stream_table[possible_sid];
+
+    pthread_mutex_lock(&stream->mut);
+    stream->filedes       = filedes;
+    stream->host_fd       = OS_FDTable[filedes].OSfd;
+    stream->buffer        = buffer;
+    stream->buffer_size   = buffer_size;
+    stream->flush_size    = flush_size;
+    stream->flush_msec    = flush_msec;
+    stream->buffered      = 0;
+    stream->write_calls   = 0;
+    stream->bytes_written = 0;
+    stream->deadline      = 0;
+    stream->IsValid       = TRUE;
+    pthread_mutex_unlock(&stream->mut);
+
+    OS_InterruptSafeUnlock(&OS_stream_table_mut, &previous);
+    OS_InterruptSafeUnlock(&OS_FDTableMutex, &fd_previous);
+
+    *stream_id = possible_sid;
+
+    return OS_FS_SUCCESS;
+
+}/* end OS_StreamOpen */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_StreamWrite
+
+    Purpose: adds nbytes bytes of buffer to the stream. Data that does not fit in the
+             buffer is written to the file together with what is buffered, in one call.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if buffer is NULL
+             OS_ERR_INVALID_ID if the stream id passed in is invalid
+             OS_FS_ERROR if the data could not be written
+             nbytes if success
+---------------------------------------------------------------------------------------*/
+int32 OS_StreamWrite (uint32 stream_id, const void *buffer, uint32 nbytes)
+{
+    OS_stream_record_t *stream;
+    struct timespec     now;
+    int32               status;
+    uint8               kick = FALSE;
+
+    if (buffer == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+
+    if (stream_id >= OS_MAX_STREAMS)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    stream = &OS_stream_table[stream_id];
+
+    pthread_mutex_lock(&stream->mut);
+
+    if (stream->IsValid == FALSE)
+    {
+        pthread_mutex_unlock(&stream->mut);
+        return OS_ERR_INVALID_ID;
+    }
+
+    status = nbytes;
+    if (nbytes <= stream->buffer_size - stream->buffered)
+    {
+        /*
+        ** The first bytes of an empty buffer start its time limit
+        */
+        if (stream->buffered == 0 && nbytes > 0 && stream->flush_msec != 0)
+        {
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            stream->deadline = ((uint64)now.tv_sec * 1000000000) + (uint64)now.tv_nsec +
+                               ((uint64)stream->flush_msec * 1000000);
+            kick = TRUE;
+        }
+
+        memcpy(stream->buffer + stream->buffered, buffer, nbytes);
+        stream->buffered += nbytes;
+
+        if (stream->buffered >= stream->flush_size &&
+            OS_StreamWriteOut(stream, NULL, 0) != OS_FS_SUCCESS)
+        {
+            status = OS_FS_ERROR;
+        }
+    }
+    else if (OS_StreamWriteOut(stream, buffer, nbytes) != OS_FS_SUCCESS)
+    {
+        status = OS_FS_ERROR;
+    }
+
+    pthread_mutex_unlock(&stream->mut);
+
+    if (kick)
+    {
+        OS_StreamFlusherKick();
+    }
+
+    return status;
+
+}/* end OS_StreamWrite */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_StreamFlush
+
+    Purpose: writes the data buffered by the stream to its file
+
+    Returns: OS_ERR_INVALID_ID if the stream id passed in is invalid
+             OS_FS_ERROR if the data could not be written
+             OS_FS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_StreamFlush (uint32 stream_id)
+{
+    OS_stream_record_t *stream;
+    int32               status;
+
+    if (stream_id >= OS_MAX_STREAMS)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    stream = &OS_stream_table[stream_id];
+
+    pthread_mutex_lock(&stream->mut);
+
+    if (stream->IsValid == FALSE)
+    {
+        status = OS_ERR_INVALID_ID;
+    }
+    else
+    {
+        status = OS_StreamWriteOut(stream, NULL, 0);
+    }
+
+    pthread_mutex_unlock(&stream->mut);
+
+    return status;
+
+}/* end OS_StreamFlush */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_StreamFlushAll
+
+    Purpose: writes the data buffered by every stream to its file. It is called by
+             OS_DeleteAllObjects and OS_ApplicationExit, so nothing is left behind
+             when the application stops.
+
+    Returns: OS_FS_ERROR if the data of one or more streams could not be written
+             OS_FS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_StreamFlushAll (void)
+{
+    OS_stream_record_t *stream;
+    int32               return_status = OS_FS_SUCCESS;
+    uint32              i;
+
+    for (i = 0; i < OS_MAX_STREAMS; i++)
+    {
+        stream = &OS_stream_table[i];
+
+        pthread_mutex_lock(&stream->mut);
+        if (stream->IsValid == TRUE && OS_StreamWriteOut(stream, NULL, 0) != OS_FS_SUCCESS)
+        {
+            return_status = OS_FS_ERROR;
+        }
+        pthread_mutex_unlock(&stream->mut);
+    }
+
+    return return_status;
+
+}/* end OS_StreamFlushAll */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_StreamClose
+
+    Purpose: flushes the stream and frees it. The file stays open.
+
+    Returns: OS_ERR_INVALID_ID if the stream id passed in is invalid
+             OS_FS_ERROR if the buffered data could not be written; the stream is
+             freed all the same
+             OS_FS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_StreamClose (uint32 stream_id)
+{
+    OS_stream_record_t *stream;
+
+    if (stream_id >= OS_MAX_STREAMS)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    stream = &OS_stream_table[stream_id];
+
+    pthread_mutex_lock(&stream->mut);
+
+    if (stream->IsValid == FALSE)
+    {
+        pthread_mutex_unlock(&stream->mut);
+        return OS_ERR_INVALID_ID;
+    }
+
+    return OS_StreamRelease(stream);
+
+}/* end OS_StreamClose */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_StreamGetInfo
+
+    Purpose: fills in the properties and counters of the stream
+
+    Returns: OS_FS_ERR_INVALID_POINTER if stream_prop is NULL
+             OS_ERR_INVALID_ID if the stream id passed in is invalid
+             OS_FS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_StreamGetInfo (uint32 stream_id, os_stream_prop_t *stream_prop)
+{
+    OS_stream_record_t *stream;
+
+    if (stream_prop == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+
+    if (stream_id >= OS_MAX_STREAMS)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    stream = &OS_stream_table[stream_id];
+
+    pthread_mutex_lock(&stream->mut);
+
+    if (stream->IsValid == FALSE)
+    {
+        pthread_mutex_unlock(&stream->mut);
+        return OS_ERR_INVALID_ID;
+    }
+
+    stream_prop->filedes       = stream->filedes;
+    stream_prop->buffer_size   = stream->buffer_size;
+    stream_prop->flush_size    = stream->flush_size;
+    stream_prop->flush_msec    = stream->flush_msec;
+    stream_prop->buffered      = stream->buffered;
+    stream_prop->write_calls   = stream->write_calls;
+    stream_prop->bytes_written = stream->bytes_written;
+
+    pthread_mutex_unlock(&stream->mut);
+
+    return OS_FS_SUCCESS;
+
+}/* end OS_StreamGetInfo */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_StreamWriteOut
+
+    Purpose: writes the buffered data of a stream, followed by extra_len bytes of
+             extra, with as few calls as the host allows. The caller holds the mutex
+             of the stream.
+
+    Returns: OS_FS_ERROR if the host write failed; what was not written stays buffered
+             OS_FS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_StreamWriteOut (OS_stream_record_t *stream, const uint8 *extra, uint32 extra_len)
+{
+    struct iovec  iov[2];
+    uint8        *data = stream->buffer;
+    uint32        left = stream->buffered;
+    int           iovcnt;
+    ssize_t       written;
+    int32         status = OS_FS_SUCCESS;
+
+    while (left > 0 || extra_len > 0)
+    {
+        iovcnt = 0;
+        if (left > 0)
+        {
+            iov[iovcnt].iov_base = data;
+            iov[iovcnt].iov_len  = left;
+            ++iovcnt;
+        }
+        if (extra_len > 0)
+        {
+            iov[iovcnt].iov_base = (void *)extra;
+            iov[iovcnt].iov_len  = extra_len;
+            ++iovcnt;
+        }
+
+        written = writev(stream->host_fd, iov, iovcnt);
+        if (written < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (written <= 0)
+        {
+            status = OS_FS_ERROR;
+            break;
+        }
+
+        ++stream->write_calls;
+        stream->bytes_written += written;
+
+        if ((size_t)written >= left)
+        {
+            written   -= left;
+            left       = 0;
+            extra     += written;
+            extra_len -= written;
+        }
+        else
+        {
+            data += written;
+            left -= written;
+        }
+    }
+
+    /*
+    ** Extra data that could not be written is dropped, as the caller reports
+    ** the whole write as failed
+    */
+    if (left > 0 && data != stream->buffer)
+    {
+        memmove(stream->buffer, data, left);
+    }
+    stream->buffered = left;
+    if (left == 0)
+    {
+        stream->deadline = 0;
+    }
+
+    return status;
+
+}/* end OS_StreamWriteOut */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_StreamRelease
+
+    Purpose: flushes a stream and marks it free. The caller holds the mutex of the
+             stream, which is released on return.
+
+    Returns: OS_FS_ERROR if the buffered data could not be written
+             OS_FS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_StreamRelease (OS_stream_record_t *stream)
+{
+    uint8  *buffer;
+    int32   status;
+
+    status = OS_StreamWriteOut(stream, NULL, 0);
+
+    buffer           = stream->buffer;
+    stream->buffer   = NULL;
+    stream->buffered = 0;
+    stream->deadline = 0;
+    stream->IsValid  = FALSE;
+    stream->detached = FALSE;
+
+    pthread_mutex_unlock(&stream->mut);
+
+    free(buffer);
+
+    return status;
+
+}/* end OS_StreamRelease */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_StreamDetachByFd
+
+    Purpose: detaches the streams of a file that is being closed, so no other task can
+             use them. Their data is written out later by OS_StreamCloseByFd.
+             The caller must hold OS_FDTableMutex.
+
+    Returns: nothing
+---------------------------------------------------------------------------------------*/
+void OS_StreamDetachByFd (int32 filedes)
+{
+    OS_stream_record_t *stream;
+    uint32              i;
+
+    for (i = 0; i < OS_MAX_STREAMS; i++)
+    {
+        stream = &OS_stream_table[i];
+
+        pthread_mutex_lock(&stream->mut);
+        if (stream->IsValid == TRUE && stream->filedes == filedes)
+        {
+            stream->IsValid  = FALSE;
+            stream->detached = TRUE;
+        }
+        pthread_mutex_unlock(&stream->mut);
+    }
+
+}/* end OS_StreamDetachByFd */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_StreamCloseByFd
+
+    Purpose: flushes and frees the streams detached from a file that is being closed.
+             The caller must not hold OS_FDTableMutex, as the writes may block.
+
+    Returns: OS_FS_ERROR if the buffered data of a stream could not be written
+             OS_FS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_StreamCloseByFd (int32 filedes)
+{
+    OS_stream_record_t *stream;
+    int32               return_status = OS_FS_SUCCESS;
+    uint32              i;
+
+    for (i = 0; i < OS_MAX_STREAMS; i++)
+    {
+        stream = &OS_stream_table[i];
+
+        pthread_mutex_lock(&stream->mut);
+        if (stream->detached == TRUE && stream->filedes == filedes)
+        {
+            if (OS_StreamRelease(stream) != OS_FS_SUCCESS)
+            {
+                return_status = OS_FS_ERROR;
+            }
+        }
+        else
+        {
+            pthread_mutex_unlock(&stream->mut);
+        }
+    }
+
+    return return_status;
+
+}/* end OS_StreamCloseByFd */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_StreamFlusherStart
+
+    Purpose: starts the thread that writes out streams on time, if it is not
+             running yet
+
+    Returns: OS_FS_ERROR if the thread could not be created
+             OS_FS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_StreamFlusherStart (void)
+{
+    pthread_t  thread;
+    int32      return_code = OS_FS_SUCCESS;
+
+    pthread_mutex_lock(&OS_stream_flusher_mut);
+
+    if (OS_stream_flusher_started == FALSE)
+    {
+        if (pthread_create(&thread, NULL, OS_StreamFlusherThread, NULL) == 0)
+        {
+            pthread_detach(thread);
+            OS_stream_flusher_started = TRUE;
+        }
+        else
+        {
+            return_code = OS_FS_ERROR;
+        }
+    }
+
+    pthread_mutex_unlock(&OS_stream_flusher_mut);
+
+    return return_code;
+
+}/* end OS_StreamFlusherStart */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_StreamFlusherKick
+
+    Purpose: tells the flusher thread that a stream got a new deadline, which may be
+             earlier than the one it is waiting for
+---------------------------------------------------------------------------------------*/
+void OS_StreamFlusherKick (void)
+{
+    pthread_mutex_lock(&OS_stream_flusher_mut);
+    OS_stream_flusher_kicked = TRUE;
+    pthread_cond_signal(&OS_stream_flusher_cv);
+    pthread_mutex_unlock(&OS_stream_flusher_mut);
+
+}/* end OS_StreamFlusherKick */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_StreamFlusherThread
+
+    Purpose: writes out the streams whose deadline has passed, then sleeps until the
+             earliest deadline left or until it is kicked
+---------------------------------------------------------------------------------------*/
+void *OS_StreamFlusherThread (void *arg)
+{
+    OS_stream_record_t *stream;
+    struct timespec     now;
+    struct timespec     wake;
+    uint64              now_ns;
+    uint64              next;
+    uint32              i;
+
+    pthread_mutex_lock(&OS_stream_flusher_mut);
+
+    while (1)
+    {
+        OS_stream_flusher_kicked = FALSE;
+        pthread_mutex_unlock(&OS_stream_flusher_mut);
+
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        now_ns = ((uint64)now.tv_sec * 1000000000) + (uint64)now.tv_nsec;
+        next   = 0;
+
+        for (i = 0; i < OS_MAX_STREAMS; i++)
+        {
+            stream = &OS_stream_table[i];
+
+            pthread_mutex_lock(&stream->mut);
+            if (stream->IsValid == TRUE && stream->deadline != 0)
+            {
+                /*
+                ** A write that failed is tried again flush_msec later
+                */
+                if (stream->deadline <= now_ns &&
+                    OS_StreamWriteOut(stream, NULL, 0) != OS_FS_SUCCESS)
+                {
+                    stream->deadline = now_ns + ((uint64)stream->flush_msec * 1000000);
+                }
+                if (stream->deadline != 0 && (next == 0 || stream->deadline < next))
+                {
+                    next = stream->deadline;
+                }
+            }
+            pthread_mutex_unlock(&stream->mut);
+        }
+
+        pthread_mutex_lock(&OS_stream_flusher_mut);
+
+        /*
+        ** A deadline set while the table was being scanned has kicked the thread
+        */
+        if (OS_stream_flusher_kicked == FALSE)
+        {
+            if (next == 0)
+            {
+                pthread_cond_wait(&OS_stream_flusher_cv, &OS_stream_flusher_mut);
+            }
+            else
+            {
+                wake.tv_sec  = next / 1000000000;
+                wake.tv_nsec = next % 1000000000;
+                pthread_cond_timedwait(&OS_stream_flusher_cv, &OS_stream_flusher_mut, &wake);
+            }
+        }
+    }
+
+    return NULL;
+
+}/* end OS_StreamFlusherThread */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_remove
+
+    Purpose: removes a given filename from the drive
+ 
+    Returns: OS_FS_SUCCESS if the driver returns OK
+             OS_FS_ERROR if there is no device or the driver returns error, or the
+             file is open or being opened, removed, copied to or moved
+             OS_FS_ERR_INVALID_POINTER if path is NULL
              OS_FS_ERR_PATH_TOO_LONG if path is too long to be stored locally
              OS_FS_ERR_PATH_INVALID if path cannot be parsed
              OS_FS_ERR_NAME_TOO_LONG if the name of the file to remove is too long to be
@@ -659,9 +3519,11 @@ int32 OS_lseek  (int32  filedes, int32 offset, uint32 whence)
 
 int32 OS_remove (const char *path)
 {
-    int  i;
-    int  status;
-    char local_path[OS_MAX_LOCAL_PATH_LEN];
+    int       status;
+    char      local_path[OS_MAX_LOCAL_PATH_LEN];
+    OS_fd_reserve_t reserve;
+    sigset_t  previous;
+    sigset_t  mask;
 
     /*
     ** Check to see if the path pointer is NULL
@@ -688,29 +3550,34 @@ int32 OS_remove (const char *path)
     }
 
     /*
-    ** Make sure the file is not open by the OSAL before deleting it 
+    ** Translate the path
     */
-    for ( i =0; i < OS_MAX_NUM_OPEN_FILES; i++)
+    if ( OS_TranslatePath(path, (char *)local_path) != OS_FS_SUCCESS )
     {
-       if ((OS_FDTable[i].IsValid == TRUE) &&
-          (strcmp(OS_FDTable[i].Path, path) == 0))
-       {
-          return OS_FS_ERROR;
-       }
+        return OS_FS_ERR_PATH_INVALID;
     }
- 
+
     /*
-    ** Translate the path
+    ** Make sure the file is not open by the OSAL before deleting it,
+    ** and keep it from being opened until it is gone
     */
-    if ( OS_TranslatePath(path, (char *)local_path) != OS_FS_SUCCESS )
+    OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
+    if (OS_FDPathReserve(&reserve, path, TRUE) != OS_FS_SUCCESS)
     {
-        return OS_FS_ERR_PATH_INVALID;
+        OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
+        return OS_FS_ERROR;
     }
+    OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
 
     /*
     ** Call the system to remove the file
     */
     status = remove (local_path);
+
+    OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
+    OS_FDPathUnreserve(&reserve);
+    OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
+
     if (status == 0)
     {
         return OS_FS_SUCCESS;
@@ -737,9 +3604,12 @@ int32 OS_remove (const char *path)
 
 int32 OS_rename (const char *old, const char *new)
 {
-    int status,i;
-    char old_path[OS_MAX_LOCAL_PATH_LEN];
-    char new_path[OS_MAX_LOCAL_PATH_LEN];
+    int       status;
+    int32     filedes;
+    char      old_path[OS_MAX_LOCAL_PATH_LEN];
+    char      new_path[OS_MAX_LOCAL_PATH_LEN];
+    sigset_t  previous;
+    sigset_t  mask;
 
     /*
     ** Check to see if the path pointers are NULL
@@ -785,13 +3655,19 @@ int32 OS_rename (const char *old, const char *new)
     status = rename (old_path, new_path);
     if (status == 0)
     {
-        for ( i =0; i < OS_MAX_NUM_OPEN_FILES; i++) 
+        /*
+        ** Files open under the old name move to the new one in the index
+        */
+        if (strcmp(old, new) != 0)
         {
-            if (strcmp(OS_FDTable[i].Path, old) == 0 &&
-                OS_FDTable[i].IsValid == TRUE)
+            OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
+            while ((filedes = OS_FDPathFind(old)) != OS_FD_NONE)
             {
-                strncpy (OS_FDTable[i].Path, new, OS_MAX_PATH_LEN);  
-            } 
+                OS_FDPathRemove(filedes);
+                strncpy (OS_FDTable[filedes].Path, new, OS_MAX_PATH_LEN);
+                OS_FDPathInsert(filedes);
+            }
+            OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
         }
         return OS_FS_SUCCESS;
     }
@@ -805,10 +3681,12 @@ int32 OS_rename (const char *old, const char *new)
 /*--------------------------------------------------------------------------------------
     Name: OS_cp
     
-    Purpose: Copies a single file from src to dest
+    Purpose: Copies a single file from src to dest. Like cp, if dest is an existing
+             directory the file is copied into it under the name of src.
 
     Returns: OS_FS_SUCCESS if the operation worked
-             OS_FS_ERROR if the file could not be accessed
+             OS_FS_ERROR if the file could not be accessed, or dest is open or
+             being opened, removed, copied to or moved
              OS_FS_ERR_INVALID_POINTER if src or dest are NULL
              OS_FS_ERR_PATH_INVALID if path cannot be parsed
              OS_FS_ERR_PATH_TOO_LONG if the paths given are too long to be stored locally
@@ -818,13 +3696,13 @@ int32 OS_rename (const char *old, const char *new)
 
 int32 OS_cp (const char *src, const char *dest)
 {
-    int  i;
-    int  status;
-    char src_path[OS_MAX_LOCAL_PATH_LEN];
-    char dest_path[OS_MAX_LOCAL_PATH_LEN];
-
-    /* leave enough space for the two paths and the command */
-    char command [OS_MAX_PATH_LEN * 2 + 5];
+    int32     status;
+    OS_fd_reserve_t reserve;
+    char      src_path[OS_MAX_LOCAL_PATH_LEN];
+    char      dest_path[OS_MAX_LOCAL_PATH_LEN];
+    char      dest_name[OS_MAX_PATH_LEN];
+    sigset_t  previous;
+    sigset_t  mask;
     
     /*
     ** Check to see if the path pointers are NULL
@@ -861,56 +3739,358 @@ int32 OS_cp (const char *src, const char *dest)
     }
 
     /*
-    ** Make sure the destintation file is not open by the OSAL before doing the copy 
+    ** Translate the path
+    */
+    if ( OS_TranslatePath(src, (char *)src_path) != OS_FS_SUCCESS )
+    {
+        return OS_FS_ERR_PATH_INVALID;
+    }
+
+    /*
+    ** Translate the path, into the directory if dest is one
+    */
+    status = OS_CopyTarget(src, dest, dest_name, dest_path);
+    if (status != OS_FS_SUCCESS)
+    {
+        return status;
+    }
+
+    /*
+    ** Make sure the destintation file is not open by the OSAL before doing the copy,
+    ** and keep it from being opened until the copy is done.
     ** This may be caught by the host OS call but it does not hurt to 
     ** be consistent 
     */
-    for ( i =0; i < OS_MAX_NUM_OPEN_FILES; i++)
+    OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
+    if (OS_FDPathReserve(&reserve, dest_name, TRUE) != OS_FS_SUCCESS)
+    {
+        OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
+        return OS_FS_ERROR;
+    }
+    OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
+
+    /*
+    ** Copy in this process rather than running "cp" through system(),
+    ** which forks a shell and a cp process for every file
+    */
+    status = OS_CopyLocalFile(src_path, dest_path, FALSE);
+
+    OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
+    OS_FDPathUnreserve(&reserve);
+    OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
+
+    return status;
+
+}/*end OS_cp */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_CopyTarget
+    
+    Purpose: Works out where OS_cp and OS_mv put the file. dest_name is dest and
+             dest_path its translation, unless dest is an existing directory: then
+             both get a "/" and the last component of src appended.
+
+    Returns: OS_FS_SUCCESS if dest_name and dest_path are set
+             OS_FS_ERR_PATH_INVALID if dest cannot be translated or src has no name
+             OS_FS_ERR_PATH_TOO_LONG if the name in the directory is too long
+---------------------------------------------------------------------------------------*/
+int32 OS_CopyTarget(const char *src, const char *dest, char *dest_name, char *dest_path)
+{
+    const char  *base;
+    const char  *sep;
+    struct stat  dest_stat;
+
+    if ( OS_TranslatePath(dest, dest_path) != OS_FS_SUCCESS )
+    {
+        return OS_FS_ERR_PATH_INVALID;
+    }
+
+    strcpy(dest_name, dest);
+
+    if (stat(dest_path, &dest_stat) != 0 || !S_ISDIR(dest_stat.st_mode))
+    {
+        return OS_FS_SUCCESS;
+    }
+
+    base = strrchr(src, '/');
+    base = (base == NULL) ? src : base + 1;
+    if (*base == '\0')
+    {
+        return OS_FS_ERR_PATH_INVALID;
+    }
+
+    sep = (dest[strlen(dest) - 1] == '/') ? "" : "/";
+    if (strlen(dest) + strlen(sep) + strlen(base) >= OS_MAX_PATH_LEN ||
+        strlen(dest_path) + 1 + strlen(base) >= OS_MAX_LOCAL_PATH_LEN)
+    {
+        return OS_FS_ERR_PATH_TOO_LONG;
+    }
+
+    strcat(dest_name, sep);
+    strcat(dest_name, base);
+    strcat(dest_path, "/");
+    strcat(dest_path, base);
+
+    return OS_FS_SUCCESS;
+
+}/*end OS_CopyTarget */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_CopyLocalFile
+    
+    Purpose: Copies a regular file between two host paths that have already been
+             checked and translated. If sync is TRUE the new file is flushed to
+             storage before returning, so the caller may remove the source.
+
+    Returns: OS_FS_SUCCESS if the file was copied
+             OS_FS_ERROR if the source is not a regular file, the destination is
+             the source, or any host call fails
+---------------------------------------------------------------------------------------*/
+int32 OS_CopyLocalFile(const char *src_path, const char *dest_path, uint32 sync)
+{
+    int         src_fd;
+    int         dest_fd;
+    int32       status;
+    struct stat src_stat;
+    struct stat dest_stat;
+
+    src_fd = open(src_path, O_RDONLY, 0);
+    if (src_fd < 0)
+    {
+        return OS_FS_ERROR;
+    }
+
+    if (fstat(src_fd, &src_stat) != 0 || !S_ISREG(src_stat.st_mode))
+    {
+        close(src_fd);
+        return OS_FS_ERROR;
+    }
+
+    /*
+    ** Like cp, a new file gets the mode of the source file.
+    ** The destination is only truncated once it is known not to be the source.
+    */
+    dest_fd = open(dest_path, O_WRONLY | O_CREAT, src_stat.st_mode & 0777);
+    if (dest_fd < 0)
+    {
+        close(src_fd);
+        return OS_FS_ERROR;
+    }
+
+    if (fstat(dest_fd, &dest_stat) != 0 ||
+        (dest_stat.st_dev == src_stat.st_dev && dest_stat.st_ino == src_stat.st_ino) ||
+        ftruncate(dest_fd, 0) != 0)
+    {
+        status = OS_FS_ERROR;
+    }
+    else
+    {
+        status = OS_CopyFileData(src_fd, dest_fd);
+    }
+
+    if (status == OS_FS_SUCCESS && sync == TRUE && fsync(dest_fd) != 0)
+    {
+        status = OS_FS_ERROR;
+    }
+
+    close(src_fd);
+    if (close(dest_fd) != 0)
+    {
+        status = OS_FS_ERROR;
+    }
+
+    return status;
+
+}/*end OS_CopyLocalFile */
+
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_CopyFileData
+    
+    Purpose: Copies everything from the current offset of src_fd to dest_fd.
+             Uses copy_file_range so the kernel can copy (or share) the blocks
+             itself, then sendfile, then a plain read/write loop. A method that
+             is not supported for these files is only dropped before any data
+             has been moved.
+
+    Returns: OS_FS_SUCCESS if all of the data was copied
+             OS_FS_ERROR if a read or write failed
+---------------------------------------------------------------------------------------*/
+int32 OS_CopyFileData(int src_fd, int dest_fd)
+{
+    ssize_t count;
+    ssize_t written;
+    ssize_t done;
+    char   *buffer;
+    int32   status;
+
+#ifdef __NR_copy_file_range
+    done = 0;
+    while (1)
+    {
+        count = syscall(__NR_copy_file_range, src_fd, NULL, dest_fd, NULL, (size_t)OS_CP_CHUNK_SIZE, 0);
+        if (count > 0)
+        {
+            done += count;
+        }
+        else if (count < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        else if (count == 0 && done > 0)
+        {
+            return OS_FS_SUCCESS;
+        }
+        else if (done == 0)
+        {
+            /*
+            ** Not supported here (old kernel, different file systems), or
+            ** a file such as those in /proc that reports no data this way
+            */
+            break;
+        }
+        else
+        {
+            return OS_FS_ERROR;
+        }
+    }
+#endif
+
+#ifdef __linux__
+    done = 0;
+    while (1)
+    {
+        count = sendfile(dest_fd, src_fd, NULL, (size_t)OS_CP_CHUNK_SIZE);
+        if (count > 0)
+        {
+            done += count;
+        }
+        else if (count < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        else if (count == 0 && done > 0)
+        {
+            return OS_FS_SUCCESS;
+        }
+        else if (done == 0)
+        {
+            break;
+        }
+        else
+        {
+            return OS_FS_ERROR;
+        }
+    }
+#endif
+
+    buffer = malloc(OS_CP_BUFFER_SIZE);
+    if (buffer == NULL)
+    {
+        return OS_FS_ERROR;
+    }
+
+    status = OS_FS_SUCCESS;
+    while (status == OS_FS_SUCCESS)
+    {
+        count = read(src_fd, buffer, OS_CP_BUFFER_SIZE);
+        if (count < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (count <= 0)
+        {
+            if (count < 0)
+            {
+                status = OS_FS_ERROR;
+            }
+            break;
+        }
+
+        done = 0;
+        while (done < count)
+        {
+            written = write(dest_fd, buffer + done, count - done);
+            if (written < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (written <= 0)
+            {
+                status = OS_FS_ERROR;
+                break;
+            }
+            done += written;
+        }
+    }
+
+    free(buffer);
+
+    return status;
+
+}/*end OS_CopyFileData */
+
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_SyncParentDir
+    
+    Purpose: Flushes the directory holding the host path to storage, so that a
+             file just created there is still found after a crash
+
+    Returns: OS_FS_SUCCESS if the directory was flushed
+             OS_FS_ERROR if it could not be opened or flushed
+---------------------------------------------------------------------------------------*/
+int32 OS_SyncParentDir(const char *path)
+{
+    char        dir_path[OS_MAX_LOCAL_PATH_LEN];
+    char       *slash;
+    int         dir_fd;
+    int32       status = OS_FS_SUCCESS;
+
+    strncpy(dir_path, path, sizeof(dir_path) - 1);
+    dir_path[sizeof(dir_path) - 1] = '\0';
+
+    slash = strrchr(dir_path, '/');
+    if (slash == NULL)
+    {
+        strcpy(dir_path, ".");
+    }
+    else if (slash == dir_path)
+    {
+        dir_path[1] = '\0';
+    }
+    else
     {
-        if ((OS_FDTable[i].IsValid == TRUE) &&
-           (strcmp(OS_FDTable[i].Path, dest) == 0))
-        {
-           return OS_FS_ERROR;
-        }
+        *slash = '\0';
     }
 
-    /*
-    ** Translate the path
-    */
-    if ( OS_TranslatePath(src, (char *)src_path) != OS_FS_SUCCESS )
+    dir_fd = open(dir_path, O_RDONLY, 0);
+    if (dir_fd < 0)
     {
-        return OS_FS_ERR_PATH_INVALID;
+        return OS_FS_ERROR;
     }
 
-    /*
-    ** Translate the path
-    */
-    if ( OS_TranslatePath(dest, (char *)dest_path) != OS_FS_SUCCESS )
+    if (fsync(dir_fd) != 0)
     {
-        return OS_FS_ERR_PATH_INVALID;
+        status = OS_FS_ERROR;
     }
 
-    sprintf(command,"cp %s %s",src_path, dest_path);
-     
-     status = system(command);
-     if (status == 0)
-     {
-         return OS_FS_SUCCESS;
-     }
-     else
-     {
-         return OS_FS_ERROR;
-     }
-     
-}/*end OS_cp */
+    close(dir_fd);
+
+    return status;
+
+}/*end OS_SyncParentDir */
+
 
 /*--------------------------------------------------------------------------------------
     Name: OS_mv
     
-    Purpose: moves a single file from src to dest
+    Purpose: moves a single file from src to dest. If dest is an existing
+             directory the file is moved into it, as with OS_cp.
 
     Returns: OS_FS_SUCCESS if the rename works
-             OS_FS_ERROR if the file could not be opened or renamed.
+             OS_FS_ERROR if the file could not be opened or renamed, or either
+             file is open or being opened, removed, copied to or moved
              OS_FS_ERR_INVALID_POINTER if src or dest are NULL
              OS_FS_ERR_PATH_INVALID if path cannot be parsed
              OS_FS_ERR_PATH_TOO_LONG if the paths given are too long to be stored locally
@@ -919,14 +4099,17 @@ int32 OS_cp (const char *src, const char *dest)
 
 int32 OS_mv (const char *src, const char *dest)
 {
-   int i;
-   int32 status;
+   int32     status;
+   OS_fd_reserve_t src_reserve;
+   OS_fd_reserve_t dest_reserve;
+   char      src_path[OS_MAX_LOCAL_PATH_LEN];
+   char      dest_path[OS_MAX_LOCAL_PATH_LEN];
+   char      dest_name[OS_MAX_PATH_LEN];
+   sigset_t  previous;
+   sigset_t  mask;
 
    /*
    ** Validate the source and destination
-   ** These checks may seem redundant because OS_cp and OS_remove also do 
-   ** the same checks, but this call needs to abort before doing a copy
-   ** in some cases.
    */
 
    /*
@@ -964,22 +4147,74 @@ int32 OS_mv (const char *src, const char *dest)
    }
 
    /*
-   ** Make sure the source file is not open by the OSAL before doing the move 
+   ** Translate the paths, into the directory if dest is one
+   */
+   if ( OS_TranslatePath(src, (char *)src_path) != OS_FS_SUCCESS )
+   {
+       return OS_FS_ERR_PATH_INVALID;
+   }
+
+   status = OS_CopyTarget(src, dest, dest_name, dest_path);
+   if (status != OS_FS_SUCCESS)
+   {
+       return status;
+   }
+
+   /*
+   ** Make sure neither file is open by the OSAL before doing the move,
+   ** and keep them from being opened until it is done
+   */
+   OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
+   status = OS_FDPathReserve(&src_reserve, src, TRUE);
+   if (status == OS_FS_SUCCESS && strcmp(src, dest_name) != 0)
+   {
+      status = OS_FDPathReserve(&dest_reserve, dest_name, TRUE);
+      if (status != OS_FS_SUCCESS)
+      {
+         OS_FDPathUnreserve(&src_reserve);
+      }
+   }
+   OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
+
+   if (status != OS_FS_SUCCESS)
+   {
+      return OS_FS_ERROR;
+   }
+
+   /*
+   ** Within a volume a rename moves the file without touching its data.
+   ** Only a move to another device has to copy; the copy and the directory
+   ** entry naming it are flushed to storage before the source is removed,
+   ** so a crash cannot lose both.
    */
-   for ( i =0; i < OS_MAX_NUM_OPEN_FILES; i++)
+   if (rename(src_path, dest_path) == 0)
+   {
+      status = OS_FS_SUCCESS;
+   }
+   else if (errno != EXDEV)
+   {
+      status = OS_FS_ERROR;
+   }
+   else
    {
-       if ((OS_FDTable[i].IsValid == TRUE) &&
-          (strcmp(OS_FDTable[i].Path, src) == 0))
-       {
-          return OS_FS_ERROR;
-       }
+      status = OS_CopyLocalFile(src_path, dest_path, TRUE);
+      if ( status == OS_FS_SUCCESS )
+      {
+         status = OS_SyncParentDir(dest_path);
+      }
+      if ( status == OS_FS_SUCCESS && remove(src_path) != 0 )
+      {
+         status = OS_FS_ERROR;
+      }
    }
 
-   status = OS_cp (src, dest);
-   if ( status == OS_FS_SUCCESS )
+   OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
+   OS_FDPathUnreserve(&src_reserve);
+   if (strcmp(src, dest_name) != 0)
    {
-      status = OS_remove(src);
+      OS_FDPathUnreserve(&dest_reserve);
    }
+   OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
 
    return ( status);
 }/*end OS_mv */
@@ -1167,6 +4402,404 @@ void  OS_rewinddir (os_dirp_t directory )
        rewinddir( directory);
     }
 }
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_DirReadBatch
+
+    Purpose: reads up to max_entries objects from an open directory into entries,
+             with the type, size and modification time of each. The status comes
+             from fstatat relative to the directory, so no path is translated or
+             looked up again, and the host reads the names many at a time.
+
+             "." and ".." are not returned. Neither are entries whose name does not
+             fit in Name, since they cannot be named through the OSAL, nor entries
+             removed between being listed and being looked at.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if directory or entries is NULL
+             OS_FS_ERROR if max_entries is zero or the directory cannot be read
+             the number of entries read, 0 at the end of the directory
+---------------------------------------------------------------------------------------*/
+int32 OS_DirReadBatch (os_dirp_t directory, os_dirent_stat_t *entries, uint32 max_entries)
+{
+    struct dirent *de;
+    struct stat    filestats;
+    int            dir_fd;
+    size_t         name_len;
+    uint32         count;
+
+    if (directory == NULL || entries == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+
+    if (max_entries == 0 || max_entries > 0x7FFFFFFF)
+    {
+        return OS_FS_ERROR;
+    }
+
+    dir_fd = dirfd(directory);
+    if (dir_fd < 0)
+    {
+        return OS_FS_ERROR;
+    }
+
+    count = 0;
+    while (count < max_entries)
+    {
+        errno = 0;
+        de = readdir(directory);
+        if (de == NULL)
+        {
+            if (errno != 0 && count == 0)
+            {
+                return OS_FS_ERROR;
+            }
+            break;
+        }
+
+        if (de->d_name[0] == '.' &&
+            (de->d_name[1] == '\0' || (de->d_name[1] == '.' && de->d_name[2] == '\0')))
+        {
+            continue;
+        }
+
+        name_len = strlen(de->d_name);
+        if (name_len >= sizeof(entries[count].Name) ||
+            fstatat(dir_fd, de->d_name, &filestats, AT_SYMLINK_NOFOLLOW) != 0)
+        {
+            continue;
+        }
+
+        memcpy(entries[count].Name, de->d_name, name_len + 1);
+        if (S_ISREG(filestats.st_mode))
+        {
+            entries[count].Type = OS_DIRENT_TYPE_FILE;
+        }
+        else if (S_ISDIR(filestats.st_mode))
+        {
+            entries[count].Type = OS_DIRENT_TYPE_DIR;
+        }
+        else
+        {
+            entries[count].Type = OS_DIRENT_TYPE_OTHER;
+        }
+        entries[count].Size  = (uint64)filestats.st_size;
+        entries[count].MTime = (int64)filestats.st_mtime;
+        ++count;
+    }
+
+    return (int32)count;
+
+} /* end OS_DirReadBatch */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_DirWalk
+
+    Purpose: calls callback for every object below path, found with OS_DirReadBatch,
+             and descends into the subdirectories. The entries of a directory are
+             reported before anything inside its subdirectories. Symbolic links are
+             reported but not followed.
+
+             With OS_DIRWALK_PARALLEL the subdirectories are scanned by the worker
+             tasks shared with the asynchronous I/O queues as well as by the calling
+             task, so callback may run on several tasks at once. A directory that finds
+             the work queue full is scanned by the calling task instead. callback must
+             not start a parallel walk of its own.
+
+             A callback result other than OS_SUCCESS stops the walk. A directory that
+             cannot be read, or whose path is too long, is skipped and the walk goes on.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if path or callback is NULL
+             OS_FS_ERR_PATH_TOO_LONG if path is too long, or a subdirectory was skipped
+             because its path is too long
+             OS_FS_ERR_PATH_INVALID if path cannot be parsed
+             OS_FS_ERROR if flags are unknown or a directory could not be read
+             the first value other than OS_SUCCESS returned by callback
+             OS_FS_SUCCESS if every object was reported
+---------------------------------------------------------------------------------------*/
+int32 OS_DirWalk (const char *path, OS_DirWalkCallback_t callback, void *callback_arg,
+                  uint32 flags)
+{
+    OS_dirwalk_t       walk;
+    OS_dirwalk_node_t *node;
+    char               local_path[OS_MAX_LOCAL_PATH_LEN];
+
+    if (path == NULL || callback == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+
+    if (strlen(path) >= OS_MAX_PATH_LEN)
+    {
+        return OS_FS_ERR_PATH_TOO_LONG;
+    }
+
+    if ((flags & ~OS_DIRWALK_PARALLEL) != 0)
+    {
+        return OS_FS_ERROR;
+    }
+
+    if ( OS_TranslatePath(path, (char *)local_path) != OS_FS_SUCCESS )
+    {
+        return OS_FS_ERR_PATH_INVALID;
+    }
+
+    node = malloc(sizeof(OS_dirwalk_node_t));
+    if (node == NULL)
+    {
+        return OS_FS_ERROR;
+    }
+
+    memset(&walk, 0, sizeof(walk));
+    walk.callback     = callback;
+    walk.callback_arg = callback_arg;
+    walk.status       = OS_FS_SUCCESS;
+    pthread_mutex_init(&walk.mut, NULL);
+    pthread_cond_init(&walk.cv, NULL);
+
+    /*
+    ** Without the worker tasks the walk still completes, on this task alone
+    */
+    if ((flags & OS_DIRWALK_PARALLEL) != 0 && OS_AsyncWorkersAttach() == OS_FS_SUCCESS)
+    {
+        walk.parallel = TRUE;
+    }
+
+    node->walk = &walk;
+    strcpy(node->path, path);
+    strcpy(node->local_path, local_path);
+    OS_DirWalkQueue(node);
+
+    /*
+    ** Scan what the workers leave over until no directory is pending
+    */
+    pthread_mutex_lock(&walk.mut);
+    while (walk.pending > 0)
+    {
+        if (walk.list != NULL)
+        {
+            node = walk.list;
+            walk.list = node->next;
+            pthread_mutex_unlock(&walk.mut);
+
+            OS_DirWalkScan(node);
+
+            pthread_mutex_lock(&walk.mut);
+            --walk.pending;
+        }
+        else
+        {
+            pthread_cond_wait(&walk.cv, &walk.mut);
+        }
+    }
+    pthread_mutex_unlock(&walk.mut);
+
+    if (walk.parallel)
+    {
+        OS_AsyncWorkersDetach();
+    }
+
+    pthread_cond_destroy(&walk.cv);
+    pthread_mutex_destroy(&walk.mut);
+
+    return walk.status;
+
+} /* end OS_DirWalk */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_DirWalkJoin
+
+    Purpose: writes dir/name into dest, which holds size bytes
+
+    Returns: OS_FS_ERR_PATH_TOO_LONG if the result does not fit
+             OS_FS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_DirWalkJoin (char *dest, size_t size, const char *dir, const char *name)
+{
+    size_t dir_len;
+    size_t name_len;
+    size_t sep_len;
+
+    dir_len  = strlen(dir);
+    name_len = strlen(name);
+    sep_len  = (dir_len > 0 && dir[dir_len - 1] == '/') ? 0 : 1;
+
+    if (dir_len + sep_len + name_len >= size)
+    {
+        return OS_FS_ERR_PATH_TOO_LONG;
+    }
+
+    memcpy(dest, dir, dir_len);
+    dest[dir_len] = '/';
+    memcpy(dest + dir_len + sep_len, name, name_len + 1);
+
+    return OS_FS_SUCCESS;
+
+} /* end OS_DirWalkJoin */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_DirWalkError
+
+    Purpose: records the first error of a walk, and stops the walk if stop is TRUE
+
+    Returns: nothing
+---------------------------------------------------------------------------------------*/
+void OS_DirWalkError (OS_dirwalk_t *walk, int32 status, uint8 stop)
+{
+    pthread_mutex_lock(&walk->mut);
+    if (walk->status == OS_FS_SUCCESS)
+    {
+        walk->status = status;
+    }
+    if (stop)
+    {
+        __atomic_store_n(&walk->stop, TRUE, __ATOMIC_RELAXED);
+    }
+    pthread_mutex_unlock(&walk->mut);
+
+} /* end OS_DirWalkError */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_DirWalkQueue
+
+    Purpose: hands a directory to the work queue, or to the calling task of the walk
+             if the walk is not parallel or the work queue is full
+
+    Returns: nothing
+---------------------------------------------------------------------------------------*/
+void OS_DirWalkQueue (OS_dirwalk_node_t *node)
+{
+    OS_dirwalk_t *walk = node->walk;
+
+    pthread_mutex_lock(&walk->mut);
+    ++walk->pending;
+    pthread_mutex_unlock(&walk->mut);
+
+    if (walk->parallel &&
+        OS_WorkSubmit(OS_async_work_queue_id, OS_DirWalkTask, node, NULL) == OS_SUCCESS)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&walk->mut);
+    node->next = walk->list;
+    walk->list = node;
+    pthread_cond_signal(&walk->cv);
+    pthread_mutex_unlock(&walk->mut);
+
+} /* end OS_DirWalkQueue */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_DirWalkScan
+
+    Purpose: reports the entries of one directory and queues its subdirectories.
+             The node is freed.
+
+    Returns: nothing
+---------------------------------------------------------------------------------------*/
+void OS_DirWalkScan (OS_dirwalk_node_t *node)
+{
+    OS_dirwalk_t      *walk = node->walk;
+    OS_dirwalk_node_t *child;
+    os_dirent_stat_t  *entries;
+    DIR               *dirp;
+    int32              count;
+    int32              status;
+    int32              i;
+
+    entries = malloc(sizeof(os_dirent_stat_t) * OS_DIRWALK_BATCH);
+    dirp    = opendir(node->local_path);
+
+    if (entries == NULL || dirp == NULL)
+    {
+        OS_DirWalkError(walk, OS_FS_ERROR, FALSE);
+        count = 0;
+    }
+    else
+    {
+        count = OS_DIRWALK_BATCH;
+    }
+
+    while (count > 0 && !__atomic_load_n(&walk->stop, __ATOMIC_RELAXED))
+    {
+        count = OS_DirReadBatch(dirp, entries, OS_DIRWALK_BATCH);
+        if (count < 0)
+        {
+            OS_DirWalkError(walk, count, FALSE);
+            break;
+        }
+
+        for (i = 0; i < count; i++)
+        {
+            status = walk->callback(node->path, &entries[i], walk->callback_arg);
+            if (status != OS_SUCCESS)
+            {
+                OS_DirWalkError(walk, status, TRUE);
+                break;
+            }
+
+            if (entries[i].Type != OS_DIRENT_TYPE_DIR)
+            {
+                continue;
+            }
+
+            child = malloc(sizeof(OS_dirwalk_node_t));
+            if (child == NULL)
+            {
+                OS_DirWalkError(walk, OS_FS_ERROR, FALSE);
+                continue;
+            }
+
+            status = OS_DirWalkJoin(child->path, sizeof(child->path), node->path,
+                                    entries[i].Name);
+            if (status == OS_FS_SUCCESS)
+            {
+                status = OS_DirWalkJoin(child->local_path, sizeof(child->local_path),
+                                        node->local_path, entries[i].Name);
+            }
+
+            if (status != OS_FS_SUCCESS)
+            {
+                OS_DirWalkError(walk, status, FALSE);
+                free(child);
+                continue;
+            }
+
+            child->walk = walk;
+            OS_DirWalkQueue(child);
+        }
+    }
+
+    if (dirp != NULL)
+    {
+        closedir(dirp);
+    }
+    free(entries);
+    free(node);
+
+} /* end OS_DirWalkScan */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_DirWalkTask
+
+    Purpose: work queue function that scans one directory of a parallel walk
+
+    Returns: nothing
+---------------------------------------------------------------------------------------*/
+void OS_DirWalkTask (void *arg)
+{
+    OS_dirwalk_t *walk = ((OS_dirwalk_node_t *)arg)->walk;
+
+    OS_DirWalkScan((OS_dirwalk_node_t *)arg);
+
+    pthread_mutex_lock(&walk->mut);
+    if (--walk->pending == 0)
+    {
+        pthread_cond_signal(&walk->cv);
+    }
+    pthread_mutex_unlock(&walk->mut);
+
+} /* end OS_DirWalkTask */
 /*--------------------------------------------------------------------------------------
     Name: OS_rmdir
     
@@ -1385,7 +5018,7 @@ int32 OS_FDGetInfo (int32 filedes, OS_FDTableEntry *fd_prop)
  ---------------------------------------------------------------------------------------*/
 int32 OS_FileOpenCheck(char *Filename)
 {
-    uint32    i;
+    int32     filedes;
     sigset_t  previous;
     sigset_t  mask;
 
@@ -1395,17 +5028,14 @@ int32 OS_FileOpenCheck(char *Filename)
     }
 
     OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
+    filedes = OS_FDPathFind(Filename);
+    OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
 
-    for ( i = 0; i < OS_MAX_NUM_OPEN_FILES; i++)
+    if (filedes != OS_FD_NONE)
     {
-        if ((OS_FDTable[i].IsValid == TRUE) &&  (strcmp(OS_FDTable[i].Path, Filename) == 0))
-        {
-           OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
-           return(OS_FS_SUCCESS);
-        }
-    }/* end for */
+        return(OS_FS_SUCCESS);
+    }
 
-    OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
     return OS_FS_ERROR;
 
 }/* end OS_FileOpenCheck */
@@ -1424,8 +5054,7 @@ int32 OS_FileOpenCheck(char *Filename)
  ---------------------------------------------------------------------------------------*/
 int32 OS_CloseFileByName(char *Filename)
 {
-    uint32    i;
-    int       status;
+    int32     i;
     sigset_t  previous;
     sigset_t  mask;
 
@@ -1436,56 +5065,38 @@ int32 OS_CloseFileByName(char *Filename)
 
     OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
 
-    for ( i = 0; i < OS_MAX_NUM_OPEN_FILES; i++)
+    i = OS_FDPathFind(Filename);
+    if (i == OS_FD_NONE)
     {
-        if ((OS_FDTable[i].IsValid == TRUE) &&  (strcmp(OS_FDTable[i].Path, Filename) == 0))
-        {
-           /*
-           ** Close the file
-           */
-           status = close ((int) OS_FDTable[i].OSfd);
-
-           /*
-           ** Next, remove the file from the OSAL list
-           ** to free up that slot
-           */
-           OS_FDTable[i].OSfd =       -1;
-           strcpy(OS_FDTable[i].Path, "\0");
-           OS_FDTable[i].User =       0;
-           OS_FDTable[i].IsValid =    FALSE;
-           OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
-
-           if (status == 0)
-           {
-              return(OS_FS_SUCCESS);
-           }
-           else
-           {
-              return(OS_FS_ERROR);
-           }
-        }
-
-    }/* end for */
+        OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
+        return (OS_FS_ERR_PATH_INVALID);
+    }
 
+    /*
+    ** Remove the file from the OSAL list to free up that slot,
+    ** then close it
+    */
+    OS_FDCloseStart(i);
     OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
 
-    return (OS_FS_ERR_PATH_INVALID);
+    return OS_FDCloseFinish(i);
 
 }/* end OS_CloseFileByName */
 
 /* --------------------------------------------------------------------------------------
    Name: OS_CloseAllFiles
 
-   Purpose: Closes All open files that were opened through the OSAL 
+   Purpose: Closes All open files that were opened through the OSAL, after
+            flushing and freeing their streams
 
-   Returns: OS_FS_ERROR   if one or more file close returned an error
+   Returns: OS_FS_ERROR   if one or more file close or stream flush returned an error
             OS_FS_SUCCESS if the files were all closed without error
  ---------------------------------------------------------------------------------------*/
 int32 OS_CloseAllFiles(void)
 {
     uint32    i;
     int32     return_status = OS_FS_SUCCESS;
-    int       status;
+    uint8     closing[OS_MAX_NUM_OPEN_FILES];
     sigset_t  previous;
     sigset_t  mask;
     
@@ -1493,30 +5104,31 @@ int32 OS_CloseAllFiles(void)
 
     for ( i = 0; i < OS_MAX_NUM_OPEN_FILES; i++)
     {
-        if ( OS_FDTable[i].IsValid == TRUE )
+        /*
+        ** Remove the file from the OSAL list to free up that slot
+        */
+        closing[i] = OS_FDTable[i].IsValid;
+        if ( closing[i] == TRUE )
         {
-           /*
-           ** Close the file
-           */
-           status = close ((int) OS_FDTable[i].OSfd);
-
-           /*
-           ** Next, remove the file from the OSAL list
-           ** to free up that slot
-           */
-           OS_FDTable[i].OSfd =       -1;
-           strcpy(OS_FDTable[i].Path, "\0");
-           OS_FDTable[i].User =       0;
-           OS_FDTable[i].IsValid =    FALSE;
-           if (status == ERROR)
-           {
-              return_status = OS_FS_ERROR;
-           }
+           OS_FDCloseStart(i);
         }
 
     }/* end for */
 
     OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
+
+    /*
+    ** Streams are flushed and the files closed without holding the lock
+    */
+    for ( i = 0; i < OS_MAX_NUM_OPEN_FILES; i++)
+    {
+        if ( closing[i] == TRUE && OS_FDCloseFinish(i) != OS_FS_SUCCESS )
+        {
+           return_status = OS_FS_ERROR;
+        }
+
+    }/* end for */
+
     return (return_status);
 
 }/* end OS_CloseAllFiles */
@@ -95,6 +95,7 @@
 #include <errno.h>
 #include <dirent.h>
 #include <sys/statvfs.h>
+#include <pthread.h>
 
 #include "common_types.h"
 #include "osapi.h"
@@ -107,6 +108,28 @@
 # define ERROR (-1)
 #undef OS_DEBUG_PRINTF
 
+/*
+** One mount point of the index used by OS_TranslatePath.  The names are copies,
+** so a translation never reads the volume table while OS_mount changes it.  The
+** mount point is kept without a trailing '/', which leaves "" for a root mount.
+*/
+typedef struct
+{
+    char    MountPoint [OS_MAX_PATH_LEN];
+    char    PhysDevName [OS_FS_PHYS_NAME_LEN];
+    uint32  MountLen;
+    uint32  PhysLen;
+} OS_mount_index_entry_t;
+
+/****************************************************************************************
+                                 FUNCTION PROTOTYPES
+****************************************************************************************/
+
+int32 OS_FS_MountIndexInit(void);
+void  OS_FS_MountIndexRebuild(void);
+int   OS_FS_MountIndexCompare(const char *Path, uint32 PathLen, const OS_mount_index_entry_t *Entry);
+int32 OS_FS_MountIndexFind(const char *Path, uint32 PathLen, uint32 Count);
+
 /****************************************************************************************
                                    GLOBAL DATA
 ****************************************************************************************/
@@ -120,6 +143,18 @@ extern OS_VolumeInfo_t OS_VolumeTable [NUM_TABLE_ENTRIES];
 ** Fd Table
 */
 extern OS_FDTableEntry OS_FDTable[OS_MAX_NUM_OPEN_FILES];
+extern uint32          OS_fd_free_count;
+
+/*
+** Mount point index, sorted by mount point.  OS_mount_index_seq is odd while the
+** index is being rebuilt, so a translation that overlapped a rebuild is redone.
+** Rebuilds are serialized by OS_mount_index_mut.
+*/
+OS_mount_index_entry_t OS_mount_index[NUM_TABLE_ENTRIES];
+uint32                 OS_mount_index_count;
+uint32                 OS_mount_index_depth;
+uint32                 OS_mount_index_seq;
+pthread_mutex_t        OS_mount_index_mut;
 
 /****************************************************************************************
                                 Filesys API
@@ -186,6 +221,9 @@ int32 OS_mkfs (char *address, char *devname, char * volname, uint32 blocksize,
     {
         return OS_FS_ERR_DRIVE_NOT_CREATED;
     }
+
+    OS_FS_MountIndexRebuild();
+
     return OS_FS_SUCCESS; 
     
 } /* end OS_mkfs */
@@ -234,6 +272,7 @@ int32 OS_rmfs (char *devname)
         {
             /* Free this entry in the table */
             OS_VolumeTable[i].FreeFlag = TRUE;
+            OS_FS_MountIndexRebuild();
             
             /* desconstruction of the filesystem to come later */
 
@@ -298,6 +337,8 @@ int32 OS_initfs (char *address,char *devname, char *volname,
         return OS_FS_ERR_DRIVE_NOT_CREATED;
     }
 
+   OS_FS_MountIndexRebuild();
+
    return OS_FS_SUCCESS; 
 
 }/* end OS_initfs */
@@ -341,6 +382,7 @@ int32 OS_mount (const char *devname, char* mountpoint)
     /* attach the mountpoint */
     strcpy(OS_VolumeTable[i].MountPoint, mountpoint);
     OS_VolumeTable[i].IsMounted = TRUE;
+    OS_FS_MountIndexRebuild();
 
     return OS_FS_SUCCESS;
 
@@ -388,6 +430,7 @@ int32 OS_unmount (const char *mountpoint)
     /* release the informationm from the table */
     OS_VolumeTable[i].IsMounted = FALSE;
     strcpy(OS_VolumeTable[i].MountPoint, "");
+    OS_FS_MountIndexRebuild();
     
     return OS_FS_SUCCESS;
     
@@ -573,13 +616,24 @@ int32 OS_FS_GetPhysDriveName(char * PhysDriveName, char * MountPoint)
  * Purpose: Because of the abstraction of the filesystem across OSes, we have to change
  *          the name of the {file, directory, drive} to be what the OS can actually 
  *          accept
+ *
+ * Notes: The path goes to the volume with the longest mount point that matches whole
+ *        path components, so "/drive1/x" never goes to a volume mounted on "/drive10".
+ *        Mount points are looked up in OS_mount_index by binary search, once for each
+ *        component of the path up to the deepest mount point.
 ---------------------------------------------------------------------------------------*/
 int32 OS_TranslatePath(const char *VirtualPath, char *LocalPath)
 {
-    char devname [OS_MAX_PATH_LEN];
-    char filename[OS_MAX_PATH_LEN];
-    int  NumChars;
-    int  i=0;
+    const OS_mount_index_entry_t *Entry;
+    uint32  PrefixLen[(OS_MAX_PATH_LEN / 2) + 1];
+    uint32  PathLen;
+    uint32  MountLen;
+    uint32  PhysLen;
+    uint32  Depth;
+    uint32  Pos;
+    uint32  Seq;
+    int32   Found;
+    int32   ReturnCode;
 
     /*
     ** Check to see if the path pointers are NULL
@@ -597,7 +651,8 @@ int32 OS_TranslatePath(const char *VirtualPath, char *LocalPath)
     /*
     ** Check to see if the path is too long
     */
-    if (strlen(VirtualPath) >= OS_MAX_PATH_LEN)
+    PathLen = strlen(VirtualPath);
+    if (PathLen >= OS_MAX_PATH_LEN)
     {
         return OS_FS_ERR_PATH_TOO_LONG;
     }
@@ -610,87 +665,252 @@ int32 OS_TranslatePath(const char *VirtualPath, char *LocalPath)
        return OS_FS_ERR_PATH_INVALID;
     }
 
-    /*
-    ** Fill the file and device name to be sure they do not have garbage
-    */
-    memset((void *)devname,0,OS_MAX_PATH_LEN);
-    memset((void *)filename,0,OS_MAX_PATH_LEN);
-   
-    /* 
-    ** We want to find the number of chars to where the second "/" is.
-    ** Since we know the first one is in spot 0, we start looking at 1, and go until
-    ** we find it.
-    */    
-    NumChars = 1;
-    while ((NumChars <= strlen(VirtualPath)) && (VirtualPath[NumChars] != '/'))
+    while (1)
     {
-        NumChars++;
+        Seq = __atomic_load_n(&OS_mount_index_seq, __ATOMIC_ACQUIRE);
+        if (Seq & 1)
+        {
+            continue;
+        }
+
+        /*
+        ** Find where each component of the path ends, up to the deepest mount
+        ** point.  The empty prefix stands for a volume mounted on "/".
+        */
+        Depth = 0;
+        Pos   = 0;
+        PrefixLen[Depth++] = 0;
+        while (Depth <= OS_mount_index_depth && Depth < (sizeof(PrefixLen) / sizeof(PrefixLen[0])) &&
+               Pos < PathLen)
+        {
+            ++Pos;
+            while (Pos < PathLen && VirtualPath[Pos] != '/')
+            {
+                ++Pos;
+            }
+            PrefixLen[Depth++] = Pos;
+        }
+
+        /*
+        ** The longest prefix that is a mount point wins
+        */
+        Found = -1;
+        while (Depth > 0 && Found < 0)
+        {
+            Found = OS_FS_MountIndexFind(VirtualPath, PrefixLen[--Depth], OS_mount_index_count);
+        }
+
+        ReturnCode = OS_FS_ERR_PATH_INVALID;
+        if (Found >= 0)
+        {
+            Entry    = &OS_mount_index[Found];
+            MountLen = Entry->MountLen;
+            PhysLen  = Entry->PhysLen;
+
+            /*
+            ** Replace the mount point with the physical device name, lengths are
+            ** checked again as the index may have changed under us
+            */
+            ReturnCode = OS_FS_ERR_PATH_TOO_LONG;
+            if (MountLen <= PathLen && PhysLen < OS_FS_PHYS_NAME_LEN &&
+                PhysLen + (PathLen - MountLen) < OS_MAX_LOCAL_PATH_LEN)
+            {
+                memcpy(LocalPath, Entry->PhysDevName, PhysLen);
+                memcpy(LocalPath + PhysLen, VirtualPath + MountLen, PathLen - MountLen + 1);
+                ReturnCode = OS_FS_SUCCESS;
+            }
+        }
+
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&OS_mount_index_seq, __ATOMIC_RELAXED) == Seq)
+        {
+            break;
+        }
     }
+
+#ifdef OS_DEBUG_PRINTF
+    printf("Result of TranslatePath = %s\n",LocalPath);
+#endif
+
+    return ReturnCode;
     
-    /* 
-    ** Don't let it overflow to cause a segfault when trying to get the highest level
-    ** directory 
-    */
-    if (NumChars > strlen(VirtualPath))
+} /* end OS_TranslatePath */
+
+/*-------------------------------------------------------------------------------------
+ * Name: OS_FS_MountIndexInit
+ * 
+ * Purpose: Sets up the mount point index from the volume table of the BSP
+ *
+ * Returns: OS_FS_ERROR if the mutex could not be created
+ *          OS_FS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_FS_MountIndexInit(void)
+{
+    if (pthread_mutex_init(&OS_mount_index_mut, NULL) != 0)
     {
-        NumChars = strlen(VirtualPath);
+        return OS_FS_ERROR;
     }
-  
-    /*
-    ** copy over only the part that is the device name 
-    */
-    snprintf(devname, OS_MAX_PATH_LEN, "%*s", NumChars, VirtualPath);
-    
-    /*
-    ** Copy everything after the devname as the path/filename
-    */
-    snprintf(filename, OS_MAX_PATH_LEN, "%s", VirtualPath + NumChars);
-    
-#ifdef OS_DEBUG_PRINTF 
-    printf("VirtualPath: %s, Length: %d\n",VirtualPath, (int)strlen(VirtualPath));
-    printf("NumChars: %d\n",NumChars);
-    printf("devname: %s\n",devname);
-    printf("filename: %s\n",filename);
-#endif
 
-    /*
-    ** look for the dev name we found in the VolumeTable 
-    */
+    OS_mount_index_seq = 0;
+    OS_FS_MountIndexRebuild();
+
+    return OS_FS_SUCCESS;
+
+} /* end OS_FS_MountIndexInit */
+
+/*-------------------------------------------------------------------------------------
+ * Name: OS_FS_MountIndexRebuild
+ * 
+ * Purpose: Rebuilds the mount point index from the volume table, after a volume was
+ *          created, removed, mounted or unmounted.  When two volumes have the same
+ *          mount point, the first one in the table is kept.
+---------------------------------------------------------------------------------------*/
+void OS_FS_MountIndexRebuild(void)
+{
+    OS_mount_index_entry_t  Entry;
+    const char             *Name;
+    uint32                  Count = 0;
+    uint32                  MaxDepth = 0;
+    uint32                  EntryDepth;
+    uint32                  Len;
+    uint32                  i;
+    uint32                  j;
+
+    pthread_mutex_lock(&OS_mount_index_mut);
+
+    __atomic_store_n(&OS_mount_index_seq, OS_mount_index_seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
     for (i = 0; i < NUM_TABLE_ENTRIES; i++)
     {
-        if (OS_VolumeTable[i].FreeFlag == FALSE && 
-            strncmp(OS_VolumeTable[i].MountPoint, devname,NumChars) == 0)
+        if (OS_VolumeTable[i].FreeFlag == TRUE || OS_VolumeTable[i].MountPoint[0] != '/')
         {
-            break;
+            continue;
+        }
+
+        Name = OS_VolumeTable[i].MountPoint;
+        for (Len = 0; Len < (OS_MAX_PATH_LEN - 1) && Name[Len] != '\0'; Len++);
+        while (Len > 0 && Name[Len - 1] == '/')
+        {
+            --Len;
+        }
+        memcpy(Entry.MountPoint, Name, Len);
+        Entry.MountPoint[Len] = '\0';
+        Entry.MountLen = Len;
+
+        Name = OS_VolumeTable[i].PhysDevName;
+        for (Len = 0; Len < (OS_FS_PHYS_NAME_LEN - 1) && Name[Len] != '\0'; Len++);
+        memcpy(Entry.PhysDevName, Name, Len);
+        Entry.PhysDevName[Len] = '\0';
+        Entry.PhysLen = Len;
+
+        if (OS_FS_MountIndexFind(Entry.MountPoint, Entry.MountLen, Count) >= 0)
+        {
+            continue;
         }
+
+        EntryDepth = 0;
+        for (j = 0; j < Entry.MountLen; j++)
+        {
+            if (Entry.MountPoint[j] == '/')
+            {
+                ++EntryDepth;
+            }
+        }
+        if (EntryDepth > MaxDepth)
+        {
+            MaxDepth = EntryDepth;
+        }
+
+        /*
+        ** Insert it in order
+        */
+        j = Count++;
+        while (j > 0 && OS_FS_MountIndexCompare(Entry.MountPoint, Entry.MountLen, &OS_mount_index[j - 1]) < 0)
+        {
+            OS_mount_index[j] = OS_mount_index[j - 1];
+            --j;
+        }
+        OS_mount_index[j] = Entry;
     }
 
-    /* 
-    ** Make sure we found a valid drive 
-    */
-    if (i >= NUM_TABLE_ENTRIES)
+    OS_mount_index_count = Count;
+    OS_mount_index_depth = MaxDepth;
+
+    __atomic_store_n(&OS_mount_index_seq, OS_mount_index_seq + 1, __ATOMIC_RELEASE);
+
+    pthread_mutex_unlock(&OS_mount_index_mut);
+
+} /* end OS_FS_MountIndexRebuild */
+
+/*-------------------------------------------------------------------------------------
+ * Name: OS_FS_MountIndexCompare
+ * 
+ * Purpose: Orders the first PathLen characters of Path against a mount point
+ *
+ * Returns: less than, equal to or greater than 0, like strcmp
+---------------------------------------------------------------------------------------*/
+int OS_FS_MountIndexCompare(const char *Path, uint32 PathLen, const OS_mount_index_entry_t *Entry)
+{
+    uint32  MountLen = Entry->MountLen;
+    int     Cmp;
+
+    if (MountLen >= OS_MAX_PATH_LEN)
     {
-        return OS_FS_ERR_PATH_INVALID;
+        MountLen = OS_MAX_PATH_LEN - 1;
     }
-    
-    /* 
-    ** copy over the physical first part of the drive 
-    */
-    strncpy(LocalPath,OS_VolumeTable[i].PhysDevName,OS_MAX_LOCAL_PATH_LEN);
-    NumChars = strlen(LocalPath);
 
-    /*
-    ** Add the file name
-    */
-    strncat(LocalPath, filename, (OS_MAX_LOCAL_PATH_LEN - NumChars));
+    Cmp = memcmp(Path, Entry->MountPoint, (PathLen < MountLen) ? PathLen : MountLen);
+    if (Cmp == 0)
+    {
+        Cmp = (PathLen > MountLen) - (PathLen < MountLen);
+    }
 
-#ifdef OS_DEBUG_PRINTF
-    printf("Result of TranslatePath = %s\n",LocalPath);
-#endif
+    return Cmp;
 
-    return OS_FS_SUCCESS;
-    
-} /* end OS_TranslatePath */
+} /* end OS_FS_MountIndexCompare */
+
+/*-------------------------------------------------------------------------------------
+ * Name: OS_FS_MountIndexFind
+ * 
+ * Purpose: Looks for the first PathLen characters of Path among the first Count
+ *          entries of the mount point index
+ *
+ * Returns: the position of the entry, or -1 if there is none
+---------------------------------------------------------------------------------------*/
+int32 OS_FS_MountIndexFind(const char *Path, uint32 PathLen, uint32 Count)
+{
+    uint32  Low = 0;
+    uint32  High = Count;
+    uint32  Mid;
+    int     Cmp;
+
+    if (High > NUM_TABLE_ENTRIES)
+    {
+        High = NUM_TABLE_ENTRIES;
+    }
+
+    while (Low < High)
+    {
+        Mid = (Low + High) / 2;
+        Cmp = OS_FS_MountIndexCompare(Path, PathLen, &OS_mount_index[Mid]);
+        if (Cmp == 0)
+        {
+            return Mid;
+        }
+        if (Cmp < 0)
+        {
+            High = Mid;
+        }
+        else
+        {
+            Low = Mid + 1;
+        }
+    }
+
+    return -1;
+
+} /* end OS_FS_MountIndexFind */
 
 /*---------------------------------------------------------------------------------------
     Name: OS_FS_GetErrorName()
@@ -768,15 +988,7 @@ int32 OS_GetFsInfo(os_fsinfo_t  *filesys_info)
    filesys_info->MaxFds = OS_MAX_NUM_OPEN_FILES;
    filesys_info->MaxVolumes = NUM_TABLE_ENTRIES;
 
-   filesys_info->FreeFds = 0;
-   for ( i = 0; i < OS_MAX_NUM_OPEN_FILES; i++ )
-   {
-      if ( OS_FDTable[i].IsValid == FALSE)
-      {
-         filesys_info->FreeFds++;
-      }
-
-   }
+   filesys_info->FreeFds = OS_fd_free_count;
 
    filesys_info->FreeVolumes = 0;
    for ( i = 0; i < NUM_TABLE_ENTRIES; i++ )
@@ -22,6 +22,13 @@
                                     INCLUDE FILES
 ****************************************************************************************/
 
+/*
+** _GNU_SOURCE is needed for the CPU affinity of the timer service thread
+*/
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
 #include "common_types.h"
 #include "osapi.h"
 
@@ -34,6 +41,16 @@
 #include <sys/signal.h>
 #include <sys/errno.h>
 #include <pthread.h>
+#include <sched.h>
+
+#ifdef __linux__
+#include <sys/prctl.h>
+#endif
+
+#ifdef OS_TIMER_SERVICE_THREAD
+#include <sys/timerfd.h>
+#include <sys/epoll.h>
+#endif
 
 /****************************************************************************************
                                 EXTERNAL FUNCTION PROTOTYPES
@@ -42,13 +59,34 @@
 extern uint32 OS_FindCreator(void);
 extern int    OS_InterruptSafeLock(pthread_mutex_t *lock, sigset_t *set, sigset_t *previous);
 extern void   OS_InterruptSafeUnlock(pthread_mutex_t *lock, sigset_t *previous);
+extern void   OS_TimespecAddUsec(struct timespec *ts, uint32 usec);
+
+extern int32  OS_PriorityRemap(uint32 InputPri);
+
+extern int    OS_sched_rt_permitted;
+extern int    OS_sched_rt_max_priority;
 
 /****************************************************************************************
                                 INTERNAL FUNCTION PROTOTYPES
 ****************************************************************************************/
 
-void  OS_TimespecToUsec(struct timespec time_spec, uint32 *usecs);
-void  OS_UsecToTimespec(uint32 usecs, struct timespec *time_spec);
+int32  OS_NsToTimespec(uint64 nsecs, struct timespec *time_spec);
+uint32 OS_NsToUsec(uint64 nsecs);
+void *OS_TimeBaseThread(void *arg);
+void  OS_TimeBaseTick(uint32 timebase_id, int32 tick_usec);
+void  OS_TimerHeapSiftUp(uint32 timebase_id, uint32 pos);
+void  OS_TimerHeapSiftDown(uint32 timebase_id, uint32 pos);
+void  OS_TimerHeapInsert(uint32 timebase_id, uint32 timer_id);
+void  OS_TimerHeapRemove(uint32 timebase_id, uint32 timer_id);
+void  OS_TimerSetThreadSlack(void);
+#ifdef OS_TIMER_SERVICE_THREAD
+uint64 OS_TimerServiceNow(void);
+int32 OS_TimerServiceStart(void);
+void  OS_TimerServiceCpuSet(uint32 affinity_mask, cpu_set_t *cpuset);
+int32 OS_TimerServiceProgram(uint32 timer_id);
+void  OS_TimerServiceAccount(uint64 now, uint64 expected, uint64 overruns);
+void *OS_TimerServiceThread(void *arg);
+#endif
 
 /****************************************************************************************
                                      DEFINES
@@ -62,10 +100,63 @@ void  OS_UsecToTimespec(uint32 usecs, struct timespec *time_spec);
 #define OS_STARTING_SIGNAL  (SIGRTMAX-1)
 
 /*
-** Since the API is storing the timer values in a 32 bit integer as Microseconds, 
-** there is a limit to the number of seconds that can be represented.
+** Timers added to a time base with OS_TimerAdd do not use a signal, they are
+** serviced by the thread of their time base.  They share the timer table and
+** the timer id space, using the ids from OS_MAX_TIMERS upward.
+*/
+#ifndef OS_MAX_TIMEBASE_TIMERS
+#define OS_MAX_TIMEBASE_TIMERS  4096
+#endif
+
+#define OS_TIMER_TABLE_SIZE     (OS_MAX_TIMERS + OS_MAX_TIMEBASE_TIMERS)
+
+/*
+** The armed timers of a time base are kept in a 4-ary min-heap ordered by
+** expiry, so a tick only looks at the head of the heap
+*/
+#define OS_TIMER_HEAP_ARITY     4
+
+/*
+** timebase_id of a timer created with OS_TimerCreate
+*/
+#define OS_TIMER_NO_TIMEBASE    0xFFFFFFFF
+
+/*
+** Largest absolute deadline the timer service can hold, in nanoseconds
+*/
+#define OS_TIMER_NS_MAX         ((uint64)-1)
+
+/*
+** The clock behind the host timers of OS_TimerCreate timers
+*/
+#ifdef OS_TIMER_SERVICE_THREAD
+#define OS_TIMER_HOST_CLOCK     CLOCK_MONOTONIC
+#else
+#define OS_TIMER_HOST_CLOCK     CLOCK_REALTIME
+#endif
+
+/*
+** With OS_TIMER_SERVICE_THREAD, OS_TimerCreate timers are timerfds and their
+** callbacks are called by one timer service thread.  These are its defaults.
+*/
+#ifndef OS_TIMER_SERVICE_PRIORITY
+#define OS_TIMER_SERVICE_PRIORITY   1
+#endif
+
+#ifndef OS_TIMER_SERVICE_AFFINITY
+#define OS_TIMER_SERVICE_AFFINITY   0
+#endif
+
+#ifndef OS_TIMER_SERVICE_SLACK_NS
+#define OS_TIMER_SERVICE_SLACK_NS   50000
+#endif
+
+#define OS_TIMER_SERVICE_EVENTS     16
+
+/*
+** Highest OSAL priority, as in osapi.c
 */
-#define MAX_SECS_IN_USEC 4293
+#define MAX_PRIORITY 255
 
 #define UNINITIALIZED 0
 
@@ -81,23 +172,68 @@ typedef struct
    uint32              start_time;
    uint32              interval_time;
    uint32              accuracy;
+   uint64              start_ns;
+   uint64              interval_ns;
    OS_TimerCallback_t  callback_ptr;
    timer_t              host_timerid;
+   int                 host_timerfd;
+   uint64              next_expiry;      /* nsec on CLOCK_MONOTONIC, timer service only */
+   uint64              slack_ns;         /* timer service only, see OS_TimerSetSlack */
+   uint32              timebase_id;
+   OS_ArgCallback_t    arg_callback_ptr;
+   void               *callback_arg;
+   uint32              armed;
+   uint32              heap_index;
+   uint64              expiry;
 
 } OS_timer_internal_record_t;
 
+typedef struct
+{
+   uint32              free;
+   char                name[OS_MAX_API_NAME];
+   uint32              creator;
+   OS_TimerSync_t      external_sync;
+   uint32              start_time;
+   uint32              interval_time;
+   uint32              accuracy;
+   uint32              generation;
+   uint32              shutdown;
+   pthread_t           thread;
+   pthread_cond_t      cv;
+   uint64              elapsed;      /* usec ticked since the time base was created */
+   uint32              heap_count;
+   uint32              heap[OS_MAX_TIMEBASE_TIMERS];
+
+} OS_timebase_internal_record_t;
+
 /****************************************************************************************
                                    GLOBAL DATA
 ****************************************************************************************/
 
-OS_timer_internal_record_t OS_timer_table[OS_MAX_TIMERS];
-uint32           os_clock_accuracy;
+OS_timer_internal_record_t    OS_timer_table[OS_TIMER_TABLE_SIZE];
+OS_timebase_internal_record_t OS_timebase_table[OS_MAX_TIMEBASES];
+uint32           os_clock_accuracy;          /* usec, rounded up */
+uint32           os_clock_resolution_ns;
 
 /*
-** The Mutex for protecting the above table
+** The Mutex for protecting the above tables
 */
 pthread_mutex_t    OS_timer_table_mut;
 
+#ifdef OS_TIMER_SERVICE_THREAD
+/*
+** The timer service thread and its statistics, also protected by the above mutex
+*/
+int                      OS_timer_service_epfd = -1;
+uint32                   OS_timer_service_started = FALSE;
+pthread_t                OS_timer_service_thread;
+uint32                   OS_timer_service_priority = OS_TIMER_SERVICE_PRIORITY;
+uint32                   OS_timer_service_affinity = OS_TIMER_SERVICE_AFFINITY;
+OS_timer_service_stats_t OS_timer_service_stats;
+uint64                   OS_timer_service_latency_total;
+#endif
+
 /****************************************************************************************
                                 INITIALIZATION FUNCTION
 ****************************************************************************************/
@@ -111,18 +247,29 @@ int32  OS_TimerAPIInit ( void )
    /*
    ** Mark all timers as available
    */
-   for ( i = 0; i < OS_MAX_TIMERS; i++ )
+   for ( i = 0; i < OS_TIMER_TABLE_SIZE; i++ )
    {
-      OS_timer_table[i].free      = TRUE;
-      OS_timer_table[i].creator   = UNINITIALIZED;
+      OS_timer_table[i].free        = TRUE;
+      OS_timer_table[i].creator     = UNINITIALIZED;
+      OS_timer_table[i].timebase_id = OS_TIMER_NO_TIMEBASE;
       strcpy(OS_timer_table[i].name,"");
 
    }
 
    /*
-   ** get the resolution of the realtime clock
+   ** Mark all time bases as available
+   */
+   for ( i = 0; i < OS_MAX_TIMEBASES; i++ )
+   {
+      OS_timebase_table[i].free      = TRUE;
+      OS_timebase_table[i].creator   = UNINITIALIZED;
+      strcpy(OS_timebase_table[i].name,"");
+   }
+
+   /*
+   ** get the resolution of the clock the host timers run on
    */
-   status = clock_getres(CLOCK_REALTIME, &clock_resolution);
+   status = clock_getres(OS_TIMER_HOST_CLOCK, &clock_resolution);
    if ( status < 0 )
    {
       return_code = OS_ERROR;
@@ -130,9 +277,22 @@ int32  OS_TimerAPIInit ( void )
    else
    { 
       /*
-      ** Convert to microseconds
+      ** Keep it in nanoseconds, and in microseconds for the uint32 API.  A
+      ** clock finer than a microsecond is still one microsecond accurate there.
       */
-      OS_TimespecToUsec(clock_resolution, &os_clock_accuracy);
+      if ( clock_resolution.tv_sec > 0 )
+      {
+         os_clock_resolution_ns = 0xFFFFFFFF;
+      }
+      else
+      {
+         os_clock_resolution_ns = (uint32)clock_resolution.tv_nsec;
+      }
+      if ( os_clock_resolution_ns == 0 )
+      {
+         os_clock_resolution_ns = 1;
+      }
+      os_clock_accuracy = OS_NsToUsec(os_clock_resolution_ns);
    
       /*
       ** Create the Timer Table mutex
@@ -143,6 +303,23 @@ int32  OS_TimerAPIInit ( void )
          return_code = OS_ERROR;
       }
    }
+
+#ifdef OS_TIMER_SERVICE_THREAD
+   /*
+   ** The service thread itself is started by the first OS_TimerCreate, once
+   ** OS_API_Init knows which scheduling policies it may use
+   */
+   memset(&OS_timer_service_stats, 0, sizeof(OS_timer_service_stats));
+   OS_timer_service_latency_total = 0;
+   if ( return_code == OS_SUCCESS && OS_timer_service_epfd < 0 )
+   {
+      OS_timer_service_epfd = epoll_create1(EPOLL_CLOEXEC);
+      if ( OS_timer_service_epfd < 0 )
+      {
+         return_code = OS_ERROR;
+      }
+   }
+#endif
    return(return_code);
 
 }
@@ -173,406 +350,1718 @@ void OS_TimerSignalHandler(int signum)
 }
  
 /******************************************************************************
- **  Function:  OS_UsecToTimespec
+ **  Function:  OS_NsToTimespec
  **
- **  Purpose:  Convert Microseconds to a POSIX timespec structure.
+ **  Purpose:  Convert nanoseconds to a POSIX timespec structure.  Fails with
+ **            OS_TIMER_ERR_INVALID_ARGS if the seconds do not fit in a time_t.
  **
  */
-void OS_UsecToTimespec(uint32 usecs, struct timespec *time_spec)
+int32 OS_NsToTimespec(uint64 nsecs, struct timespec *time_spec)
 {
-	
-   if ( usecs < 1000000 )
+   uint64 secs = nsecs / 1000000000;
+
+   time_spec->tv_sec = (time_t)secs;
+   time_spec->tv_nsec = (long)(nsecs % 1000000000);
+
+   if ( time_spec->tv_sec < 0 || (uint64)time_spec->tv_sec != secs )
    {
-      time_spec->tv_nsec = (usecs * 1000);
-      time_spec->tv_sec = 0;
+      return OS_TIMER_ERR_INVALID_ARGS;
    }
-   else
+
+   return OS_SUCCESS;
+}
+
+/******************************************************************************
+ **  Function:  OS_NsToUsec
+ **
+ **  Purpose:  Convert nanoseconds to the microseconds of the uint32 API,
+ **            rounding up so a time that is set stays set, and saturating.
+ **
+ */
+uint32 OS_NsToUsec(uint64 nsecs)
+{
+   uint64 usecs = (nsecs / 1000) + ((nsecs % 1000) != 0);
+
+   if ( usecs > 0xFFFFFFFF )
    {
-      time_spec->tv_sec = usecs / 1000000;
-      time_spec->tv_nsec = (usecs % 1000000) * 1000;
+      return 0xFFFFFFFF;
    }
-	
+   return (uint32)usecs;
+}
+
+/******************************************************************************
+ **  Function:  OS_TimerSetThreadSlack
+ **
+ **  Purpose:  Sets the timer slack of the calling timer thread to
+ **            OS_TIMER_SERVICE_SLACK_NS, the time by which the kernel may
+ **            delay its timed waits to merge them with other wakeups.
+ **            Threads with a real-time policy have no slack on Linux.
+ */
+void OS_TimerSetThreadSlack(void)
+{
+#ifdef PR_SET_TIMERSLACK
+   /*
+   ** A slack of 0 would select the default of the process, use 1 nsec instead
+   */
+   prctl(PR_SET_TIMERSLACK, (OS_TIMER_SERVICE_SLACK_NS > 0) ? (unsigned long)OS_TIMER_SERVICE_SLACK_NS : 1UL, 0, 0, 0);
+#endif
 }
 
 /******************************************************************************
- **  Function:  OS_TimespecToUsec
+ **  Function:  OS_TimeBaseThread
  **
- **  Purpose:  Convert a POSIX timespec structure to microseconds
+ **  Purpose:  Body of the thread behind a time base.  Each pass waits for one
+ **            tick, either on the external sync function or until the next
+ **            absolute CLOCK_MONOTONIC deadline, and then services the timers
+ **            attached to the time base.
  **
+ **            The wait on an internal time base is a timed condition wait
+ **            rather than clock_nanosleep so that OS_TimeBaseSet and
+ **            OS_TimeBaseDelete can wake the thread.  Deadlines are advanced
+ **            by the interval, so the tick does not drift.
  */
-void OS_TimespecToUsec(struct timespec time_spec, uint32 *usecs)
+void *OS_TimeBaseThread(void *arg)
 {
+   uint32                          timebase_id;
+   OS_timebase_internal_record_t  *timebase;
+   uint32                          generation;
+   uint32                          scheduled;
+   uint32                          next_tick;
+   int32                           tick_usec;
+   struct timespec                 deadline;
+   int                             ret;
+
+   timebase_id = (uint32)(cpuaddr)arg;
+   timebase = &OS_timebase_table[timebase_id];
+   generation = 0;
+   scheduled = FALSE;
+   next_tick = 0;
+
+   OS_TimerSetThreadSlack();
+
    /*
-    ** Need to account for maximum number of seconds that will fit in the
-    ** 32 bit usec integer
-    */
-   if ( time_spec.tv_sec > MAX_SECS_IN_USEC )
+   ** The thread may only be cancelled while it is inside the external
+   ** sync function, never while it holds the timer table mutex
+   */
+   pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
+
+   while (1)
    {
-      time_spec.tv_sec = MAX_SECS_IN_USEC;
-   }
-   *usecs = (time_spec.tv_sec * 1000000 ) + (time_spec.tv_nsec / 1000 );
-}
+      if (timebase->external_sync != NULL)
+      {
+         pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
+         tick_usec = timebase->external_sync(timebase_id);
+         pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
+
+         if (timebase->shutdown == TRUE)
+         {
+            break;
+         }
+      }
+      else
+      {
+         tick_usec = 0;
+
+         pthread_mutex_lock(&OS_timer_table_mut);
+         while (timebase->shutdown == FALSE && tick_usec == 0)
+         {
+            if (generation != timebase->generation)
+            {
+               /*
+               ** OS_TimeBaseSet was called, restart the schedule from now
+               */
+               generation = timebase->generation;
+               scheduled = (timebase->start_time > 0);
+               next_tick = timebase->start_time;
+               clock_gettime(CLOCK_MONOTONIC, &deadline);
+               OS_TimespecAddUsec(&deadline, next_tick);
+            }
+
+            if (scheduled == FALSE)
+            {
+               pthread_cond_wait(&timebase->cv, &OS_timer_table_mut);
+               continue;
+            }
+
+            ret = pthread_cond_timedwait(&timebase->cv, &OS_timer_table_mut, &deadline);
+            if (ret == ETIMEDOUT && generation == timebase->generation)
+            {
+               tick_usec = (int32)next_tick;
+               next_tick = timebase->interval_time;
+               if (next_tick > 0)
+               {
+                  OS_TimespecAddUsec(&deadline, next_tick);
+               }
+               else
+               {
+                  scheduled = FALSE;
+               }
+            }
+         }
+         pthread_mutex_unlock(&OS_timer_table_mut);
+
+         if (timebase->shutdown == TRUE)
+         {
+            break;
+         }
+      }
 
+      if (tick_usec > 0)
+      {
+         OS_TimeBaseTick(timebase_id, tick_usec);
+      }
+   }
 
+   return NULL;
 
-/****************************************************************************************
-                                   Timer API
-****************************************************************************************/
+}/* end OS_TimeBaseThread */
 
 /******************************************************************************
-**  Function:  OS_TimerCreate
-**
-**  Purpose:  Create a new OSAL Timer
-**
-**  Arguments:
-**
-**  Return:
-*/
-int32 OS_TimerCreate(uint32 *timer_id, const char *timer_name, uint32 *clock_accuracy, OS_TimerCallback_t  callback_ptr)
+ **  Function:  OS_TimeBaseTick
+ **
+ **  Purpose:  Advances the time base by tick_usec and calls the timers that
+ **            expired, earliest first.  A tick where nothing expires only looks
+ **            at the head of the heap.  The callbacks are called without the
+ **            timer table mutex, so they may set or delete timers.
+ */
+void OS_TimeBaseTick(uint32 timebase_id, int32 tick_usec)
 {
-   uint32    possible_tid;
-   int32     i;
-   sigset_t  previous;
-   sigset_t  mask;
+   OS_timebase_internal_record_t *timebase;
+   OS_timer_internal_record_t    *timer;
+   OS_ArgCallback_t               callback_ptr;
+   void                          *callback_arg;
+   uint32                         timer_id;
+   uint64                         interval;
 
-   int                status;
-   struct  sigaction  sig_act;
-   struct  sigevent   evp;
+   timebase = &OS_timebase_table[timebase_id];
 
-   if ( timer_id == NULL || timer_name == NULL || clock_accuracy == NULL)
-   {
-        return OS_INVALID_POINTER;
-   }
+   pthread_mutex_lock(&OS_timer_table_mut);
+   timebase->elapsed += (uint64)tick_usec;
 
-   /* 
-   ** we don't want to allow names too long
-   ** if truncated, two names might be the same 
-   */
-   if (strlen(timer_name) > OS_MAX_API_NAME)
+   while (timebase->heap_count > 0 && timebase->shutdown == FALSE)
    {
-      return OS_ERR_NAME_TOO_LONG;
+      timer_id = timebase->heap[0];
+      timer = &OS_timer_table[timer_id];
+      if (timer->expiry > timebase->elapsed)
+      {
+         break;
+      }
+
+      callback_ptr = timer->arg_callback_ptr;
+      callback_arg = timer->callback_arg;
+
+      if (timer->interval_ns > 0)
+      {
+         /*
+         ** Ticks coarser than the interval would leave the timer behind
+         ** for ever, so a timer that is still late skips ahead
+         */
+         interval = (timer->interval_ns + 999) / 1000;
+         timer->expiry += interval;
+         if (timer->expiry <= timebase->elapsed)
+         {
+            timer->expiry = timebase->elapsed + interval;
+         }
+         OS_TimerHeapSiftDown(timebase_id, 0);
+      }
+      else
+      {
+         OS_TimerHeapRemove(timebase_id, timer_id);
+         timer->armed = FALSE;
+      }
+
+      pthread_mutex_unlock(&OS_timer_table_mut);
+      (callback_ptr)(timer_id, callback_arg);
+      pthread_mutex_lock(&OS_timer_table_mut);
    }
 
-   /* 
-   ** Check Parameters 
-   */
-   OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
-    
-   for(possible_tid = 0; possible_tid < OS_MAX_TIMERS; possible_tid++)
+   pthread_mutex_unlock(&OS_timer_table_mut);
+
+}/* end OS_TimeBaseTick */
+
+/******************************************************************************
+ **  Function:  OS_TimerHeapSiftUp / OS_TimerHeapSiftDown
+ **
+ **  Purpose:  Restore the heap order of a time base after the expiry of the timer
+ **            at pos became earlier (up) or later (down).  The caller holds the
+ **            timer table mutex.
+ */
+void OS_TimerHeapSiftUp(uint32 timebase_id, uint32 pos)
+{
+   uint32 *heap = OS_timebase_table[timebase_id].heap;
+   uint32  timer_id = heap[pos];
+   uint64  expiry = OS_timer_table[timer_id].expiry;
+   uint32  parent;
+
+   while (pos > 0)
    {
-      if (OS_timer_table[possible_tid].free == TRUE)
+      parent = (pos - 1) / OS_TIMER_HEAP_ARITY;
+      if (OS_timer_table[heap[parent]].expiry <= expiry)
+      {
          break;
+      }
+      heap[pos] = heap[parent];
+      OS_timer_table[heap[pos]].heap_index = pos;
+      pos = parent;
    }
 
+   heap[pos] = timer_id;
+   OS_timer_table[timer_id].heap_index = pos;
+}
 
-   if( possible_tid >= OS_MAX_TIMERS || OS_timer_table[possible_tid].free != TRUE)
+void OS_TimerHeapSiftDown(uint32 timebase_id, uint32 pos)
+{
+   uint32 *heap = OS_timebase_table[timebase_id].heap;
+   uint32  count = OS_timebase_table[timebase_id].heap_count;
+   uint32  timer_id = heap[pos];
+   uint64  expiry = OS_timer_table[timer_id].expiry;
+   uint32  child;
+   uint32  last;
+   uint32  best;
+
+   while (1)
    {
-        OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
-        return OS_ERR_NO_FREE_IDS;
-   }
+      child = pos * OS_TIMER_HEAP_ARITY + 1;
+      if (child >= count)
+      {
+         break;
+      }
 
-   /* 
-   ** Check to see if the name is already taken 
-   */
-   for (i = 0; i < OS_MAX_TIMERS; i++)
-   {
-       if ((OS_timer_table[i].free == FALSE) &&
-            strcmp ((char*) timer_name, OS_timer_table[i].name) == 0)
-       {
-            OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
-            return OS_ERR_NAME_TAKEN;
-       }
-   }
+      last = child + OS_TIMER_HEAP_ARITY;
+      if (last > count)
+      {
+         last = count;
+      }
 
-   /*
-   ** Verify callback parameter
-   */
-   if (callback_ptr == NULL ) 
-   {
-      OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
-      return OS_TIMER_ERR_INVALID_ARGS;
-   }    
+      best = child;
+      for (++child; child < last; ++child)
+      {
+         if (OS_timer_table[heap[child]].expiry < OS_timer_table[heap[best]].expiry)
+         {
+            best = child;
+         }
+      }
 
-   /* 
-   ** Set the possible timer Id to not free so that
-   ** no other task can try to use it 
-   */
-   OS_timer_table[possible_tid].free = FALSE;
-   OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+      if (OS_timer_table[heap[best]].expiry >= expiry)
+      {
+         break;
+      }
+      heap[pos] = heap[best];
+      OS_timer_table[heap[pos]].heap_index = pos;
+      pos = best;
+   }
 
-   OS_timer_table[possible_tid].creator = OS_FindCreator();
-   strncpy(OS_timer_table[possible_tid].name, timer_name, OS_MAX_API_NAME);
-   OS_timer_table[possible_tid].start_time = 0;
-   OS_timer_table[possible_tid].interval_time = 0;
-    
-   OS_timer_table[possible_tid].callback_ptr = callback_ptr;
+   heap[pos] = timer_id;
+   OS_timer_table[timer_id].heap_index = pos;
+}
 
-   /*
-   **  Initialize the sigaction and sigevent structures for the handler.
-   */
-   memset((void *)&sig_act, 0, sizeof(sig_act));
-   sigemptyset(&sig_act.sa_mask);
-   sig_act.sa_handler = OS_TimerSignalHandler;
-   sig_act.sa_flags = SA_RESTART; 
+/******************************************************************************
+ **  Function:  OS_TimerHeapInsert / OS_TimerHeapRemove
+ **
+ **  Purpose:  Arm or disarm a timer of a time base, both O(log n).  The caller
+ **            holds the timer table mutex.
+ */
+void OS_TimerHeapInsert(uint32 timebase_id, uint32 timer_id)
+{
+   uint32 pos = OS_timebase_table[timebase_id].heap_count++;
 
-   memset((void *)&evp, 0, sizeof(evp));
-   evp.sigev_notify = SIGEV_SIGNAL; 
-   evp.sigev_signo = OS_STARTING_SIGNAL - possible_tid;
+   OS_timebase_table[timebase_id].heap[pos] = timer_id;
+   OS_TimerHeapSiftUp(timebase_id, pos);
+}
 
-   /*
-   ** Create the timer
-   */
-   status = timer_create(CLOCK_REALTIME, &evp, (timer_t *)&(OS_timer_table[possible_tid].host_timerid));
-   if (status < 0) 
+void OS_TimerHeapRemove(uint32 timebase_id, uint32 timer_id)
+{
+   OS_timebase_internal_record_t *timebase = &OS_timebase_table[timebase_id];
+   uint32 pos = OS_timer_table[timer_id].heap_index;
+   uint32 moved;
+
+   --timebase->heap_count;
+   if (pos == timebase->heap_count)
    {
-      OS_timer_table[possible_tid].free = TRUE;
-      return ( OS_TIMER_ERR_UNAVAILABLE);
+      return;
    }
-   
-   /*
-   ** Set the signal action for the timer
-   */
-   sigaction(OS_STARTING_SIGNAL - possible_tid, &(sig_act), 0); 
 
    /*
-   ** Return the clock accuracy to the user
+   ** The last entry fills the hole and moves whichever way it has to
    */
-   *clock_accuracy = os_clock_accuracy;
+   moved = timebase->heap[timebase->heap_count];
+   timebase->heap[pos] = moved;
+   OS_timer_table[moved].heap_index = pos;
+   if (pos > 0 && OS_timer_table[moved].expiry < OS_timer_table[timebase->heap[(pos - 1) / OS_TIMER_HEAP_ARITY]].expiry)
+   {
+      OS_TimerHeapSiftUp(timebase_id, pos);
+   }
+   else
+   {
+      OS_TimerHeapSiftDown(timebase_id, pos);
+   }
+}
 
-   /*
-   ** Return timer ID 
-   */
-   *timer_id = possible_tid;
+#ifdef OS_TIMER_SERVICE_THREAD
+/******************************************************************************
+ **  Function:  OS_TimerServiceNow
+ **
+ **  Purpose:  Current CLOCK_MONOTONIC time in nanoseconds, the clock of the
+ **            timerfds
+ */
+uint64 OS_TimerServiceNow(void)
+{
+   struct timespec now;
 
-   return OS_SUCCESS;
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   return ((uint64)now.tv_sec * 1000000000) + (uint64)now.tv_nsec;
 }
 
 /******************************************************************************
-**  Function:  OS_TimerSet
-**
-**  Purpose:  
-**
-**  Arguments:
-**    (none)
-**
-**  Return:
+ **  Function:  OS_TimerServiceCpuSet
+ **
+ **  Purpose:  Converts an OSAL CPU mask (bit N = CPU N) to a cpu_set_t
+ */
+void OS_TimerServiceCpuSet(uint32 affinity_mask, cpu_set_t *cpuset)
+{
+   uint32 i;
+
+   CPU_ZERO(cpuset);
+   for (i = 0; i < 32; ++i)
+   {
+      if (affinity_mask & (1UL << i))
+      {
+         CPU_SET(i, cpuset);
+      }
+   }
+}/* end OS_TimerServiceCpuSet */
+
+/******************************************************************************
+ **  Function:  OS_TimerServiceStart
+ **
+ **  Purpose:  Starts the timer service thread if it is not running yet.  It runs
+ **            at the priority set by OS_TimerSetServiceAttr, OS_TIMER_SERVICE_PRIORITY
+ **            by default, when real-time priorities may be used, and on the CPUs
+ **            set there, OS_TIMER_SERVICE_AFFINITY by default.
+ */
+int32 OS_TimerServiceStart(void)
+{
+   int                 status;
+   int32               return_code = OS_SUCCESS;
+   pthread_attr_t      attr;
+   struct sched_param  param;
+   cpu_set_t           cpuset;
+   sigset_t            previous;
+   sigset_t            mask;
+
+   OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+
+   if (OS_timer_service_started == FALSE)
+   {
+      pthread_attr_init(&attr);
+      if (OS_sched_rt_permitted == TRUE)
+      {
+         pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+         pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+         memset(&param, 0, sizeof(param));
+         param.sched_priority = OS_PriorityRemap(OS_timer_service_priority);
+         pthread_attr_setschedparam(&attr, &param);
+      }
+
+      if (OS_timer_service_affinity != 0)
+      {
+         OS_TimerServiceCpuSet(OS_timer_service_affinity, &cpuset);
+         pthread_attr_setaffinity_np(&attr, sizeof(cpuset), &cpuset);
+      }
+
+      status = pthread_create(&OS_timer_service_thread, &attr, OS_TimerServiceThread, NULL);
+      pthread_attr_destroy(&attr);
+      if (status == 0)
+      {
+         OS_timer_service_started = TRUE;
+      }
+      else
+      {
+#ifdef OS_DEBUG_PRINTF
+         printf("OS_TimerServiceStart: pthread_create error %d\n", status);
+#endif
+         return_code = OS_TIMER_ERR_INTERNAL;
+      }
+   }
+
+   OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+
+   return return_code;
+
+}/* end OS_TimerServiceStart */
+
+/******************************************************************************
+ **  Function:  OS_TimerServiceProgram
+ **
+ **  Purpose:  Programs the timerfd of a timer from its next expiry.  A timer
+ **            with slack is a one shot at the end of its window, the service
+ **            thread expires it at the first wakeup inside the window and
+ **            programs it again.  The caller holds the timer table mutex.
+ **
+ **  Return:   OS_TIMER_ERR_INVALID_ARGS if the deadline does not fit in a
+ **            timespec, the timerfd is then left as it was
+ **            OS_TIMER_ERR_INTERNAL if the timerfd could not be set
+ **            OS_SUCCESS if success
+ */
+int32 OS_TimerServiceProgram(uint32 timer_id)
+{
+   OS_timer_internal_record_t  *timer = &OS_timer_table[timer_id];
+   struct itimerspec            timeout;
+   int32                        status = OS_SUCCESS;
+
+   memset(&timeout, 0, sizeof(timeout));
+   if (timer->armed == TRUE)
+   {
+      if (timer->slack_ns > 0)
+      {
+         if (timer->slack_ns > OS_TIMER_NS_MAX - timer->next_expiry)
+         {
+            return OS_TIMER_ERR_INVALID_ARGS;
+         }
+         status = OS_NsToTimespec(timer->next_expiry + timer->slack_ns, &timeout.it_value);
+      }
+      else
+      {
+         status = OS_NsToTimespec(timer->next_expiry, &timeout.it_value);
+         if (status == OS_SUCCESS)
+         {
+            status = OS_NsToTimespec(timer->interval_ns, &timeout.it_interval);
+         }
+      }
+   }
+
+   if (status != OS_SUCCESS)
+   {
+      return status;
+   }
+
+   if (timerfd_settime(timer->host_timerfd, TFD_TIMER_ABSTIME, &timeout, NULL) < 0)
+   {
+      return OS_TIMER_ERR_INTERNAL;
+   }
+
+   return OS_SUCCESS;
+
+}/* end OS_TimerServiceProgram */
+
+/******************************************************************************
+ **  Function:  OS_TimerServiceAccount
+ **
+ **  Purpose:  Adds one expiration to the timer service statistics.  The caller
+ **            holds the timer table mutex.
+ */
+void OS_TimerServiceAccount(uint64 now, uint64 expected, uint64 overruns)
+{
+   uint32 latency;
+
+   latency = (now > expected) ? (uint32)((now - expected) / 1000) : 0;
+   ++OS_timer_service_stats.expirations;
+   OS_timer_service_stats.overruns += (uint32)overruns;
+   OS_timer_service_stats.latency_last = latency;
+   if (latency > OS_timer_service_stats.latency_max)
+   {
+      OS_timer_service_stats.latency_max = latency;
+   }
+   OS_timer_service_latency_total += latency;
+
+}/* end OS_TimerServiceAccount */
+
+/******************************************************************************
+ **  Function:  OS_TimerServiceThread
+ **
+ **  Purpose:  Waits for any timerfd to expire and calls the callback of its
+ **            timer in thread context.  Expirations that pile up while a
+ **            callback runs late are merged into one call and counted as
+ **            overruns.  The latency is measured from the expected expiry of
+ **            the last merged expiration.
+ **
+ **            Every wakeup also expires the timers with slack whose window
+ **            has opened, so timers with overlapping windows share one wakeup.
+ */
+void *OS_TimerServiceThread(void *arg)
+{
+   struct epoll_event           events[OS_TIMER_SERVICE_EVENTS];
+   OS_timer_internal_record_t  *timer;
+   OS_TimerCallback_t           callbacks[OS_MAX_TIMERS];
+   uint32                       due[OS_MAX_TIMERS];
+   uint32                       ndue;
+   uint32                       timer_id;
+   uint64                       count;
+   uint64                       interval;
+   uint64                       expected;
+   uint64                       now;
+   int                          n;
+   int                          i;
+
+   OS_TimerSetThreadSlack();
+
+   while (1)
+   {
+      n = epoll_wait(OS_timer_service_epfd, events, OS_TIMER_SERVICE_EVENTS, -1);
+      if (n < 0)
+      {
+         if (errno == EINTR)
+         {
+            continue;
+         }
+         break;
+      }
+
+      ndue = 0;
+      pthread_mutex_lock(&OS_timer_table_mut);
+      ++OS_timer_service_stats.wakeups;
+      now = OS_TimerServiceNow();
+
+      for (i = 0; i < n; ++i)
+      {
+         timer_id = events[i].data.u32;
+         if (timer_id >= OS_MAX_TIMERS)
+         {
+            continue;
+         }
+         timer = &OS_timer_table[timer_id];
+         if (timer->free == TRUE ||
+               read(timer->host_timerfd, &count, sizeof(count)) != sizeof(count) ||
+               count == 0 || timer->slack_ns > 0)
+         {
+            continue;
+         }
+
+         interval = timer->interval_ns;
+         expected = timer->next_expiry + (count - 1) * interval;
+         timer->next_expiry = expected + interval;
+         if (interval == 0)
+         {
+            /* a one shot is spent, so a later reprogram must not arm it again */
+            timer->armed = FALSE;
+         }
+         OS_TimerServiceAccount(now, expected, count - 1);
+
+         callbacks[ndue] = timer->callback_ptr;
+         due[ndue] = timer_id;
+         ++ndue;
+      }
+
+      for (timer_id = 0; timer_id < OS_MAX_TIMERS; ++timer_id)
+      {
+         timer = &OS_timer_table[timer_id];
+         if (timer->free == TRUE || timer->slack_ns == 0 ||
+               timer->armed == FALSE || timer->next_expiry > now)
+         {
+            continue;
+         }
+
+         interval = timer->interval_ns;
+         count = 1;
+         if (interval > 0)
+         {
+            count += (now - timer->next_expiry) / interval;
+            expected = timer->next_expiry + (count - 1) * interval;
+            timer->next_expiry = expected + interval;
+         }
+         else
+         {
+            expected = timer->next_expiry;
+            timer->armed = FALSE;
+         }
+         if (OS_TimerServiceProgram(timer_id) != OS_SUCCESS)
+         {
+            /* the next deadline cannot be held, stop rather than fire early */
+            timer->armed = FALSE;
+            OS_TimerServiceProgram(timer_id);
+         }
+         OS_TimerServiceAccount(now, expected, count - 1);
+
+         callbacks[ndue] = timer->callback_ptr;
+         due[ndue] = timer_id;
+         ++ndue;
+      }
+      pthread_mutex_unlock(&OS_timer_table_mut);
+
+      for (i = 0; i < (int)ndue; ++i)
+      {
+         (callbacks[i])(due[i]);
+      }
+   }
+
+   return NULL;
+
+}/* end OS_TimerServiceThread */
+#endif
+
+
+
+/****************************************************************************************
+                                   Timer API
+****************************************************************************************/
+
+/******************************************************************************
+**  Function:  OS_TimerCreate
+**
+**  Purpose:  Create a new OSAL Timer
+**
+**  Arguments:
+**
+**  Return:
+*/
+int32 OS_TimerCreate(uint32 *timer_id, const char *timer_name, uint32 *clock_accuracy, OS_TimerCallback_t  callback_ptr)
+{
+   uint32    possible_tid;
+   int32     i;
+   sigset_t  previous;
+   sigset_t  mask;
+
+#ifdef OS_TIMER_SERVICE_THREAD
+   struct  epoll_event event;
+#else
+   int                status;
+   struct  sigaction  sig_act;
+   struct  sigevent   evp;
+#endif
+
+   if ( timer_id == NULL || timer_name == NULL || clock_accuracy == NULL)
+   {
+        return OS_INVALID_POINTER;
+   }
+
+   /* 
+   ** we don't want to allow names too long
+   ** if truncated, two names might be the same 
+   */
+   if (strlen(timer_name) > OS_MAX_API_NAME)
+   {
+      return OS_ERR_NAME_TOO_LONG;
+   }
+
+   /* 
+   ** Check Parameters 
+   */
+   OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+    
+   for(possible_tid = 0; possible_tid < OS_MAX_TIMERS; possible_tid++)
+   {
+      if (OS_timer_table[possible_tid].free == TRUE)
+         break;
+   }
+
+
+   if( possible_tid >= OS_MAX_TIMERS || OS_timer_table[possible_tid].free != TRUE)
+   {
+        OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+        return OS_ERR_NO_FREE_IDS;
+   }
+
+   /* 
+   ** Check to see if the name is already taken 
+   */
+   for (i = 0; i < OS_TIMER_TABLE_SIZE; i++)
+   {
+       if ((OS_timer_table[i].free == FALSE) &&
+            strcmp ((char*) timer_name, OS_timer_table[i].name) == 0)
+       {
+            OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+            return OS_ERR_NAME_TAKEN;
+       }
+   }
+
+   /*
+   ** Verify callback parameter
+   */
+   if (callback_ptr == NULL ) 
+   {
+      OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+      return OS_TIMER_ERR_INVALID_ARGS;
+   }    
+
+#ifndef OS_TIMER_SERVICE_THREAD
+   /*
+   ** The signal of this timer must still be a RT signal
+   */
+   if ((int)(OS_STARTING_SIGNAL - possible_tid) < SIGRTMIN)
+   {
+      OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+      return OS_TIMER_ERR_UNAVAILABLE;
+   }
+#endif
+
+   /* 
+   ** Set the possible timer Id to not free so that
+   ** no other task can try to use it 
+   */
+   OS_timer_table[possible_tid].free = FALSE;
+   OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+
+   OS_timer_table[possible_tid].creator = OS_FindCreator();
+   strncpy(OS_timer_table[possible_tid].name, timer_name, OS_MAX_API_NAME);
+   OS_timer_table[possible_tid].start_time = 0;
+   OS_timer_table[possible_tid].interval_time = 0;
+   OS_timer_table[possible_tid].start_ns = 0;
+   OS_timer_table[possible_tid].interval_ns = 0;
+   OS_timer_table[possible_tid].accuracy = os_clock_accuracy;
+   OS_timer_table[possible_tid].timebase_id = OS_TIMER_NO_TIMEBASE;
+    
+   OS_timer_table[possible_tid].callback_ptr = callback_ptr;
+
+#ifdef OS_TIMER_SERVICE_THREAD
+   /*
+   ** The timer is a timerfd watched by the timer service thread
+   */
+   if (OS_TimerServiceStart() != OS_SUCCESS)
+   {
+      OS_timer_table[possible_tid].free = TRUE;
+      return ( OS_TIMER_ERR_UNAVAILABLE);
+   }
+
+   OS_timer_table[possible_tid].next_expiry = 0;
+   OS_timer_table[possible_tid].slack_ns = 0;
+   OS_timer_table[possible_tid].armed = FALSE;
+   OS_timer_table[possible_tid].host_timerfd = timerfd_create(OS_TIMER_HOST_CLOCK, TFD_NONBLOCK | TFD_CLOEXEC);
+   if (OS_timer_table[possible_tid].host_timerfd < 0)
+   {
+      OS_timer_table[possible_tid].free = TRUE;
+      return ( OS_TIMER_ERR_UNAVAILABLE);
+   }
+
+   memset(&event, 0, sizeof(event));
+   event.events = EPOLLIN;
+   event.data.u32 = possible_tid;
+   if (epoll_ctl(OS_timer_service_epfd, EPOLL_CTL_ADD, OS_timer_table[possible_tid].host_timerfd, &event) < 0)
+   {
+      close(OS_timer_table[possible_tid].host_timerfd);
+      OS_timer_table[possible_tid].free = TRUE;
+      return ( OS_TIMER_ERR_UNAVAILABLE);
+   }
+#else
+   /*
+   **  Initialize the sigaction and sigevent structures for the handler.
+   */
+   memset((void *)&sig_act, 0, sizeof(sig_act));
+   sigemptyset(&sig_act.sa_mask);
+   sig_act.sa_handler = OS_TimerSignalHandler;
+   sig_act.sa_flags = SA_RESTART; 
+
+   memset((void *)&evp, 0, sizeof(evp));
+   evp.sigev_notify = SIGEV_SIGNAL; 
+   evp.sigev_signo = OS_STARTING_SIGNAL - possible_tid;
+
+   /*
+   ** Create the timer
+   */
+   status = timer_create(OS_TIMER_HOST_CLOCK, &evp, (timer_t *)&(OS_timer_table[possible_tid].host_timerid));
+   if (status < 0) 
+   {
+      OS_timer_table[possible_tid].free = TRUE;
+      return ( OS_TIMER_ERR_UNAVAILABLE);
+   }
+   
+   /*
+   ** Set the signal action for the timer
+   */
+   sigaction(OS_STARTING_SIGNAL - possible_tid, &(sig_act), 0); 
+#endif
+
+   /*
+   ** Return the clock accuracy to the user
+   */
+   *clock_accuracy = os_clock_accuracy;
+
+   /*
+   ** Return timer ID 
+   */
+   *timer_id = possible_tid;
+
+   return OS_SUCCESS;
+}
+
+/******************************************************************************
+**  Function:  OS_TimerSet
+**
+**  Purpose:  
+**
+**  Arguments:
+**    (none)
+**
+**  Return:
+**    (none)
+*/
+int32 OS_TimerSet(uint32 timer_id, uint32 start_time, uint32 interval_time)
+{
+   return OS_TimerSetNs(timer_id, (uint64)start_time * 1000, (uint64)interval_time * 1000);
+}
+
+/******************************************************************************
+**  Function:  OS_TimerSetNs
+**
+**  Purpose:  Same as OS_TimerSet with the start and interval times in 64 bit
+**            nanoseconds, so they are neither limited to about 71 minutes nor
+**            to microseconds.  Host timers are programmed with the full
+**            timespec; timers on a time base still run on its microsecond ticks.
+**
+**  Return:   OS_ERR_INVALID_ID if the timer id is not valid
+**            OS_TIMER_ERR_INVALID_ARGS if a time does not fit in a timespec, or
+**            the first expiry is past the end of the timer service clock
+**            OS_TIMER_ERR_INTERNAL if the host timer could not be set
+**            OS_SUCCESS if success
+*/
+int32 OS_TimerSetNs(uint32 timer_id, uint64 start_time_ns, uint64 interval_time_ns)
+{
+   int32  status;
+   struct itimerspec timeout;
+   sigset_t  previous;
+   sigset_t  mask;
+   OS_timer_internal_record_t *timer;
+#ifdef OS_TIMER_SERVICE_THREAD
+   uint64 now;
+#endif
+
+   /* 
+   ** Check to see if the timer_id given is valid 
+   */
+   if (timer_id >= OS_TIMER_TABLE_SIZE || OS_timer_table[timer_id].free == TRUE)
+   {
+      return OS_ERR_INVALID_ID;
+   }
+
+   /*
+   ** A timer on a time base is only (re)queued on its time base, which
+   ** expires it.  A start time of zero disarms it.
+   */
+   if (OS_timer_table[timer_id].timebase_id != OS_TIMER_NO_TIMEBASE)
+   {
+      OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+      timer = &OS_timer_table[timer_id];
+      if (timer->free == TRUE || timer->timebase_id == OS_TIMER_NO_TIMEBASE)
+      {
+         OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+         return OS_ERR_INVALID_ID;
+      }
+
+      if (timer->armed == TRUE)
+      {
+         OS_TimerHeapRemove(timer->timebase_id, timer_id);
+      }
+      timer->start_ns = start_time_ns;
+      timer->interval_ns = interval_time_ns;
+      timer->start_time = OS_NsToUsec(start_time_ns);
+      timer->interval_time = OS_NsToUsec(interval_time_ns);
+      timer->armed = (start_time_ns > 0);
+      if (timer->armed == TRUE)
+      {
+         timer->expiry = OS_timebase_table[timer->timebase_id].elapsed + ((start_time_ns + 999) / 1000);
+         OS_TimerHeapInsert(timer->timebase_id, timer_id);
+      }
+      OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+
+      return OS_SUCCESS;
+   }
+
+   /*
+   ** Round up the accuracy of the start time and interval times 
+   */
+   if (( start_time_ns > 0 ) && ( start_time_ns < os_clock_resolution_ns ))
+   {
+      start_time_ns = os_clock_resolution_ns;
+   }
+ 
+   if (( interval_time_ns > 0) && ( interval_time_ns < os_clock_resolution_ns ))
+   {
+      interval_time_ns = os_clock_resolution_ns;
+   }
+
+   /*
+   ** Convert from nanoseconds to timespec structures
+   */
+   if (OS_NsToTimespec(start_time_ns, &(timeout.it_value)) != OS_SUCCESS ||
+         OS_NsToTimespec(interval_time_ns, &(timeout.it_interval)) != OS_SUCCESS)
+   {
+      return OS_TIMER_ERR_INVALID_ARGS;
+   }
+
+#ifdef OS_TIMER_SERVICE_THREAD
+   /*
+   ** The service thread programs absolute deadlines, which must not wrap
+   */
+   now = OS_TimerServiceNow();
+   if (start_time_ns > OS_TIMER_NS_MAX - now)
+   {
+      return OS_TIMER_ERR_INVALID_ARGS;
+   }
+#endif
+
+   /*
+   ** Save the start and interval times 
+   */
+   OS_timer_table[timer_id].start_ns = start_time_ns;
+   OS_timer_table[timer_id].interval_ns = interval_time_ns;
+   OS_timer_table[timer_id].start_time = OS_NsToUsec(start_time_ns);
+   OS_timer_table[timer_id].interval_time = OS_NsToUsec(interval_time_ns);
+	
+   /*
+   ** Program the real timer
+   */
+#ifdef OS_TIMER_SERVICE_THREAD
+   OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+   OS_timer_table[timer_id].armed = (start_time_ns > 0);
+   OS_timer_table[timer_id].next_expiry = now + start_time_ns;
+   status = OS_TimerServiceProgram(timer_id);
+   if (status != OS_SUCCESS)
+   {
+      /* do not leave a timer armed that was never programmed */
+      OS_timer_table[timer_id].armed = FALSE;
+      OS_TimerServiceProgram(timer_id);
+   }
+   OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+
+   if (status != OS_SUCCESS)
+   {
+      return status;
+   }
+#else
+   status = timer_settime((timer_t)(OS_timer_table[timer_id].host_timerid), 
+                             0,              /* Flags field can be zero */
+                             &timeout,       /* struct itimerspec */
+		             NULL);         /* Oldvalue */
+   if (status < 0) 
+   {
+      return ( OS_TIMER_ERR_INTERNAL);
+   }
+#endif
+	
+   return OS_SUCCESS;
+
+}/* end OS_TimerSetNs */
+
+
+/******************************************************************************
+**  Function:  OS_TimerSetSlack
+**
+**  Purpose:  Lets a timer expire up to slack_usec microseconds late, so the
+**            timer service thread can expire it together with other timers in
+**            one wakeup instead of waking up for it alone.  A timer with slack
+**            never expires early.  Zero turns the slack off.  Timers on a time
+**            base already expire together on its ticks and are not changed.
+**
+**  Return:   OS_ERR_INVALID_ID if the timer id is not valid
+**            OS_ERR_NOT_IMPLEMENTED if the timers use signals
+**            OS_TIMER_ERR_INVALID_ARGS if the end of the slack window is past
+**            the end of the timer service clock, the slack is then unchanged
+**            OS_TIMER_ERR_INTERNAL if the host timer could not be set
+**            OS_SUCCESS if success
+*/
+int32 OS_TimerSetSlack(uint32 timer_id, uint32 slack_usec)
+{
+#ifdef OS_TIMER_SERVICE_THREAD
+   int32     status;
+   uint64    old_slack_ns;
+   sigset_t  previous;
+   sigset_t  mask;
+#endif
+
+   /* 
+   ** Check to see if the timer_id given is valid 
+   */
+   if (timer_id >= OS_TIMER_TABLE_SIZE || OS_timer_table[timer_id].free == TRUE)
+   {
+      return OS_ERR_INVALID_ID;
+   }
+
+   if (OS_timer_table[timer_id].timebase_id != OS_TIMER_NO_TIMEBASE)
+   {
+      return OS_SUCCESS;
+   }
+
+#ifdef OS_TIMER_SERVICE_THREAD
+   OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+   if (OS_timer_table[timer_id].free == TRUE)
+   {
+      OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+      return OS_ERR_INVALID_ID;
+   }
+   old_slack_ns = OS_timer_table[timer_id].slack_ns;
+   OS_timer_table[timer_id].slack_ns = (uint64)slack_usec * 1000;
+   status = OS_TimerServiceProgram(timer_id);
+   if (status == OS_TIMER_ERR_INVALID_ARGS)
+   {
+      OS_timer_table[timer_id].slack_ns = old_slack_ns;
+   }
+   OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+
+   return status;
+#else
+   return OS_ERR_NOT_IMPLEMENTED;
+#endif
+
+}/* end OS_TimerSetSlack */
+
+/******************************************************************************
+**  Function:  OS_TimerDelete
+**
+**  Purpose: 
+**
+**  Arguments:
+**    (none)
+**
+**  Return:
 **    (none)
 */
-int32 OS_TimerSet(uint32 timer_id, uint32 start_time, uint32 interval_time)
+int32 OS_TimerDelete(uint32 timer_id)
+{
+   int status;
+   sigset_t  previous;
+   sigset_t  mask;
+
+   /* 
+   ** Check to see if the timer_id given is valid 
+   */
+   if (timer_id >= OS_TIMER_TABLE_SIZE || OS_timer_table[timer_id].free == TRUE)
+   {
+      return OS_ERR_INVALID_ID;
+   }
+
+   /*
+   ** A timer on a time base has no host timer, it only needs to leave the table
+   */
+   if (OS_timer_table[timer_id].timebase_id != OS_TIMER_NO_TIMEBASE)
+   {
+      OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+      if (OS_timer_table[timer_id].free == TRUE || OS_timer_table[timer_id].timebase_id == OS_TIMER_NO_TIMEBASE)
+      {
+         OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+         return OS_ERR_INVALID_ID;
+      }
+      if (OS_timer_table[timer_id].armed == TRUE)
+      {
+         OS_TimerHeapRemove(OS_timer_table[timer_id].timebase_id, timer_id);
+      }
+      OS_timer_table[timer_id].armed = FALSE;
+      OS_timer_table[timer_id].timebase_id = OS_TIMER_NO_TIMEBASE;
+      OS_timer_table[timer_id].free = TRUE;
+      OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+
+      return OS_SUCCESS;
+   }
+
+   /*
+   ** Delete the timer 
+   */
+#ifdef OS_TIMER_SERVICE_THREAD
+   OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+   status = close(OS_timer_table[timer_id].host_timerfd);
+   OS_timer_table[timer_id].free = TRUE;
+   OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+#else
+   status = timer_delete((timer_t)(OS_timer_table[timer_id].host_timerid));
+   OS_timer_table[timer_id].free = TRUE;
+#endif
+   if (status < 0)
+   {
+      return ( OS_TIMER_ERR_INTERNAL);
+   }
+	
+   return OS_SUCCESS;
+}
+
+/***********************************************************************************
+**
+**    Name: OS_TimerGetIdByName
+**
+**    Purpose: This function tries to find a Timer Id given the name 
+**             The id is returned through timer_id
+**
+**    Returns: OS_INVALID_POINTER if timer_id or timer_name are NULL pointers
+**             OS_ERR_NAME_TOO_LONG if the name given is to long to have been stored
+**             OS_ERR_NAME_NOT_FOUND if the name was not found in the table
+**             OS_SUCCESS if success
+**             
+*/
+int32 OS_TimerGetIdByName (uint32 *timer_id, const char *timer_name)
+{
+    uint32 i;
+
+    if (timer_id == NULL || timer_name == NULL)
+    {
+        return OS_INVALID_POINTER;
+    }
+
+    /* 
+    ** a name too long wouldn't have been allowed in the first place
+    ** so we definitely won't find a name too long
+    */
+    if (strlen(timer_name) > OS_MAX_API_NAME)
+    {
+        return OS_ERR_NAME_TOO_LONG;
+    }
+
+    for (i = 0; i < OS_TIMER_TABLE_SIZE; i++)
+    {
+        if (OS_timer_table[i].free != TRUE &&
+                (strcmp (OS_timer_table[i].name , (char*) timer_name) == 0))
+        {
+            *timer_id = i;
+            return OS_SUCCESS;
+        }
+    }
+   
+    /* 
+    ** The name was not found in the table,
+    **  or it was, and the sem_id isn't valid anymore 
+    */
+    return OS_ERR_NAME_NOT_FOUND;
+    
+}/* end OS_TimerGetIdByName */
+
+/***************************************************************************************
+**    Name: OS_TimerGetInfo
+**
+**    Purpose: This function will pass back a pointer to structure that contains 
+**             all of the relevant info( name and creator) about the specified timer.
+**             
+**    Returns: OS_ERR_INVALID_ID if the id passed in is not a valid timer 
+**             OS_INVALID_POINTER if the timer_prop pointer is null
+**             OS_SUCCESS if success
+*/
+int32 OS_TimerGetInfo (uint32 timer_id, OS_timer_prop_t *timer_prop)  
+{
+    sigset_t  previous;
+    sigset_t  mask;
+
+    /* 
+    ** Check to see that the id given is valid 
+    */
+    if (timer_id >= OS_TIMER_TABLE_SIZE || OS_timer_table[timer_id].free == TRUE)
+    {
+       return OS_ERR_INVALID_ID;
+    }
+
+    if (timer_prop == NULL)
+    {
+        return OS_INVALID_POINTER;
+    }
+
+    /* 
+    ** put the info into the stucture 
+    */
+    OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+
+    timer_prop ->creator       = OS_timer_table[timer_id].creator;
+    strcpy(timer_prop-> name, OS_timer_table[timer_id].name);
+    timer_prop ->start_time    = OS_timer_table[timer_id].start_time;
+    timer_prop ->interval_time = OS_timer_table[timer_id].interval_time;
+    timer_prop ->start_time_ns    = OS_timer_table[timer_id].start_ns;
+    timer_prop ->interval_time_ns = OS_timer_table[timer_id].interval_ns;
+    if (OS_timer_table[timer_id].timebase_id != OS_TIMER_NO_TIMEBASE)
+    {
+       timer_prop ->accuracy   = OS_timebase_table[OS_timer_table[timer_id].timebase_id].accuracy;
+       if (timer_prop ->accuracy > 0xFFFFFFFF / 1000)
+       {
+          timer_prop ->accuracy_ns = 0xFFFFFFFF;
+       }
+       else
+       {
+          timer_prop ->accuracy_ns = timer_prop ->accuracy * 1000;
+       }
+    }
+    else
+    {
+       timer_prop ->accuracy   = OS_timer_table[timer_id].accuracy;
+       timer_prop ->accuracy_ns = os_clock_resolution_ns;
+    }
+    
+    OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+
+    return OS_SUCCESS;
+    
+} /* end OS_TimerGetInfo */
+
+/***************************************************************************************
+**    Name: OS_TimerGetServiceStats
+**
+**    Purpose: Passes back the statistics of the timer service thread that calls the
+**             callbacks of OS_TimerCreate timers when OS_TIMER_SERVICE_THREAD is defined.
+**             The latency is the time from the expiry of a timer to its callback.
+**
+**    Returns: OS_INVALID_POINTER if the stats pointer is null
+**             OS_ERR_NOT_IMPLEMENTED if the timers use signals
+**             OS_SUCCESS if success
+*/
+int32 OS_TimerGetServiceStats (OS_timer_service_stats_t *stats)
+{
+#ifdef OS_TIMER_SERVICE_THREAD
+    sigset_t  previous;
+    sigset_t  mask;
+
+    if (stats == NULL)
+    {
+        return OS_INVALID_POINTER;
+    }
+
+    OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+
+    *stats = OS_timer_service_stats;
+    if (OS_timer_service_stats.expirations > 0)
+    {
+        stats->latency_avg = (uint32)(OS_timer_service_latency_total / OS_timer_service_stats.expirations);
+    }
+
+    OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+
+    return OS_SUCCESS;
+#else
+    return OS_ERR_NOT_IMPLEMENTED;
+#endif
+
+} /* end OS_TimerGetServiceStats */
+
+/***************************************************************************************
+**    Name: OS_TimerSetServiceAttr
+**
+**    Purpose: Sets the OSAL priority and the CPU mask (bit N = CPU N, 0 = any CPU) of
+**             the timer service thread, replacing OS_TIMER_SERVICE_PRIORITY and
+**             OS_TIMER_SERVICE_AFFINITY.  Called before the first OS_TimerCreate the
+**             thread starts with them, called later they are applied to the running
+**             thread.  The priority only takes effect when real-time priorities may
+**             be used.
+**
+**    Returns: OS_ERR_INVALID_PRIORITY if the priority is bad
+**             OS_ERR_NOT_IMPLEMENTED if the timers use signals
+**             OS_TIMER_ERR_INTERNAL if the running thread could not be changed
+**             OS_SUCCESS if success
+*/
+int32 OS_TimerSetServiceAttr (uint32 priority, uint32 affinity_mask)
+{
+#ifdef OS_TIMER_SERVICE_THREAD
+    struct sched_param  param;
+    cpu_set_t           cpuset;
+    uint32              i;
+    int32               return_code = OS_SUCCESS;
+    sigset_t            previous;
+    sigset_t            mask;
+
+    if (priority > MAX_PRIORITY)
+    {
+        return OS_ERR_INVALID_PRIORITY;
+    }
+
+    OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+
+    OS_timer_service_priority = priority;
+    OS_timer_service_affinity = affinity_mask;
+
+    if (OS_timer_service_started == TRUE)
+    {
+        if (OS_sched_rt_permitted == TRUE)
+        {
+            memset(&param, 0, sizeof(param));
+            param.sched_priority = OS_PriorityRemap(priority);
+            if (pthread_setschedparam(OS_timer_service_thread, SCHED_FIFO, &param) != 0)
+            {
+                return_code = OS_TIMER_ERR_INTERNAL;
+            }
+        }
+
+        if (affinity_mask != 0)
+        {
+            OS_TimerServiceCpuSet(affinity_mask, &cpuset);
+        }
+        else
+        {
+            /* any CPU */
+            CPU_ZERO(&cpuset);
+            for (i = 0; i < CPU_SETSIZE; ++i)
+            {
+                CPU_SET(i, &cpuset);
+            }
+        }
+        if (pthread_setaffinity_np(OS_timer_service_thread, sizeof(cpuset), &cpuset) != 0)
+        {
+            return_code = OS_TIMER_ERR_INTERNAL;
+        }
+    }
+
+    OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+
+    return return_code;
+#else
+    return OS_ERR_NOT_IMPLEMENTED;
+#endif
+
+} /* end OS_TimerSetServiceAttr */
+
+/****************************************************************************************
+                                   Time Base API
+****************************************************************************************/
+
+/******************************************************************************
+**  Function:  OS_TimeBaseCreate
+**
+**  Purpose:  Create a new OSAL time base.  Each time base is served by its own
+**            thread, which ticks either on its own schedule (see OS_TimeBaseSet)
+**            or, if external_sync is not NULL, every time external_sync returns.
+**            external_sync blocks until the next tick and returns the number of
+**            microseconds elapsed since the previous one, a value <= 0 means no tick.
+**
+**  Returns: OS_INVALID_POINTER if timer_id or timebase_name are NULL
+**           OS_ERR_NAME_TOO_LONG if the name is too long
+**           OS_ERR_NO_FREE_IDS if all time bases are in use
+**           OS_ERR_NAME_TAKEN if the name is already used by a time base
+**           OS_TIMER_ERR_INTERNAL if the thread could not be created
+**           OS_SUCCESS if success
+*/
+int32 OS_TimeBaseCreate(uint32 *timer_id, const char *timebase_name, OS_TimerSync_t external_sync)
 {
-   int    status;
-   struct itimerspec timeout;
+   uint32              possible_id;
+   uint32              i;
+   sigset_t            previous;
+   sigset_t            mask;
+   int                 status;
+   pthread_attr_t      attr;
+   pthread_condattr_t  cond_attr;
+   struct sched_param  param;
+   OS_timebase_internal_record_t *timebase;
+
+   if ( timer_id == NULL || timebase_name == NULL )
+   {
+      return OS_INVALID_POINTER;
+   }
 
-   /* 
-   ** Check to see if the timer_id given is valid 
+   if (strlen(timebase_name) >= OS_MAX_API_NAME)
+   {
+      return OS_ERR_NAME_TOO_LONG;
+   }
+
+   OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+
+   for (possible_id = 0; possible_id < OS_MAX_TIMEBASES; possible_id++)
+   {
+      if (OS_timebase_table[possible_id].free == TRUE)
+         break;
+   }
+
+   if (possible_id >= OS_MAX_TIMEBASES)
+   {
+      OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+      return OS_ERR_NO_FREE_IDS;
+   }
+
+   for (i = 0; i < OS_MAX_TIMEBASES; i++)
+   {
+      if ((OS_timebase_table[i].free == FALSE) &&
+           strcmp (timebase_name, OS_timebase_table[i].name) == 0)
+      {
+         OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+         return OS_ERR_NAME_TAKEN;
+      }
+   }
+
+   timebase = &OS_timebase_table[possible_id];
+   timebase->free = FALSE;
+   timebase->creator = OS_FindCreator();
+   strncpy(timebase->name, timebase_name, OS_MAX_API_NAME);
+   timebase->external_sync = external_sync;
+   timebase->start_time = 0;
+   timebase->interval_time = 0;
+   timebase->accuracy = os_clock_accuracy;
+   timebase->generation = 0;
+   timebase->shutdown = FALSE;
+   timebase->elapsed = 0;
+   timebase->heap_count = 0;
+
+   OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+
+   /*
+   ** Deadlines are on CLOCK_MONOTONIC so that setting the date does not
+   ** disturb the tick
    */
-   if (timer_id >= OS_MAX_TIMERS || OS_timer_table[timer_id].free == TRUE)
+   pthread_condattr_init(&cond_attr);
+   pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC);
+   status = pthread_cond_init(&timebase->cv, &cond_attr);
+   pthread_condattr_destroy(&cond_attr);
+   if (status != 0)
    {
-      return OS_ERR_INVALID_ID;
+      timebase->free = TRUE;
+      return OS_TIMER_ERR_INTERNAL;
    }
 
    /*
-   ** Round up the accuracy of the start time and interval times 
+   ** The time base thread runs at the highest real-time priority when the
+   ** process is allowed to use one, like the main thread after OS_API_Init
    */
+   pthread_attr_init(&attr);
+   if (OS_sched_rt_permitted == TRUE)
+   {
+      pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+      pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+      memset(&param, 0, sizeof(param));
+      param.sched_priority = OS_sched_rt_max_priority;
+      pthread_attr_setschedparam(&attr, &param);
+   }
+
+   status = pthread_create(&timebase->thread, &attr, OS_TimeBaseThread, (void *)(cpuaddr)possible_id);
+   pthread_attr_destroy(&attr);
+   if (status != 0)
+   {
+#ifdef OS_DEBUG_PRINTF
+      printf("OS_TimeBaseCreate: pthread_create error %d\n", status);
+#endif
+      pthread_cond_destroy(&timebase->cv);
+      timebase->free = TRUE;
+      return OS_TIMER_ERR_INTERNAL;
+   }
+
+   *timer_id = possible_id;
+
+   return OS_SUCCESS;
+
+}/* end OS_TimeBaseCreate */
+
+/******************************************************************************
+**  Function:  OS_TimeBaseSet
+**
+**  Purpose:  Sets the tick of a time base.  The first tick comes start_time
+**            microseconds from now and the following ones every interval_time
+**            microseconds.  A start_time of zero stops the time base.  This has
+**            no effect on the tick of a time base with an external sync function.
+**
+**  Returns: OS_ERR_INVALID_ID if the id passed in is not a valid time base
+**           OS_SUCCESS if success
+*/
+int32 OS_TimeBaseSet(uint32 timer_id, uint32 start_time, uint32 interval_time)
+{
+   sigset_t  previous;
+   sigset_t  mask;
+
+   if (timer_id >= OS_MAX_TIMEBASES || OS_timebase_table[timer_id].free == TRUE)
+   {
+      return OS_ERR_INVALID_ID;
+   }
+
    if (( start_time > 0 ) && ( start_time < os_clock_accuracy ))
    {
       start_time = os_clock_accuracy;
    }
- 
+
    if (( interval_time > 0) && ( interval_time < os_clock_accuracy ))
    {
       interval_time = os_clock_accuracy;
    }
 
-   /*
-   ** Save the start and interval times 
-   */
-   OS_timer_table[timer_id].start_time = start_time;
-   OS_timer_table[timer_id].interval_time = interval_time;
+   OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
 
-   /*
-   ** Convert from Microseconds to timespec structures
-   */
-   OS_UsecToTimespec(start_time, &(timeout.it_value));
-   OS_UsecToTimespec(interval_time, &(timeout.it_interval));
-	
-   /*
-   ** Program the real timer
-   */
-   status = timer_settime((timer_t)(OS_timer_table[timer_id].host_timerid), 
-                             0,              /* Flags field can be zero */
-                             &timeout,       /* struct itimerspec */
-		             NULL);         /* Oldvalue */
-   if (status < 0) 
+   OS_timebase_table[timer_id].start_time = start_time;
+   OS_timebase_table[timer_id].interval_time = interval_time;
+   if (interval_time > 0)
    {
-      return ( OS_TIMER_ERR_INTERNAL);
+      OS_timebase_table[timer_id].accuracy = interval_time;
    }
-	
+   ++OS_timebase_table[timer_id].generation;
+   pthread_cond_signal(&OS_timebase_table[timer_id].cv);
+
+   OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+
    return OS_SUCCESS;
-}
 
+}/* end OS_TimeBaseSet */
 
 /******************************************************************************
-**  Function:  OS_TimerDelete
+**  Function:  OS_TimeBaseDelete
 **
-**  Purpose: 
-**
-**  Arguments:
-**    (none)
+**  Purpose:  Stops the thread of a time base and deletes the time base along
+**            with all the timers that were added to it.  This may not be called
+**            from a timer callback of the same time base.
 **
-**  Return:
-**    (none)
+**  Returns: OS_ERR_INVALID_ID if the id passed in is not a valid time base
+**           OS_ERROR if called from the thread of the time base
+**           OS_SUCCESS if success
 */
-int32 OS_TimerDelete(uint32 timer_id)
+int32 OS_TimeBaseDelete(uint32 timer_id)
 {
-   int status;
+   uint32    i;
+   sigset_t  previous;
+   sigset_t  mask;
+   OS_timebase_internal_record_t *timebase;
 
-   /* 
-   ** Check to see if the timer_id given is valid 
-   */
-   if (timer_id >= OS_MAX_TIMERS || OS_timer_table[timer_id].free == TRUE)
+   if (timer_id >= OS_MAX_TIMEBASES || OS_timebase_table[timer_id].free == TRUE)
    {
       return OS_ERR_INVALID_ID;
    }
 
+   timebase = &OS_timebase_table[timer_id];
+
+   if (pthread_equal(pthread_self(), timebase->thread))
+   {
+      return OS_ERROR;
+   }
+
+   OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+
+   timebase->shutdown = TRUE;
+   timebase->heap_count = 0;
+   pthread_cond_signal(&timebase->cv);
+
+   for (i = OS_MAX_TIMERS; i < OS_TIMER_TABLE_SIZE; i++)
+   {
+      if (OS_timer_table[i].free == FALSE && OS_timer_table[i].timebase_id == timer_id)
+      {
+         OS_timer_table[i].armed = FALSE;
+         OS_timer_table[i].timebase_id = OS_TIMER_NO_TIMEBASE;
+         OS_timer_table[i].free = TRUE;
+      }
+   }
+
+   OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+
    /*
-   ** Delete the timer 
+   ** The external sync function may block for ever, so that thread
+   ** is cancelled; it can only be cancelled inside that function
    */
-   status = timer_delete((timer_t)(OS_timer_table[timer_id].host_timerid));
-   OS_timer_table[timer_id].free = TRUE;
-   if (status < 0)
+   if (timebase->external_sync != NULL)
    {
-      return ( OS_TIMER_ERR_INTERNAL);
+      pthread_cancel(timebase->thread);
    }
-	
+   pthread_join(timebase->thread, NULL);
+   pthread_cond_destroy(&timebase->cv);
+
+   OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+   timebase->free = TRUE;
+   timebase->creator = UNINITIALIZED;
+   strcpy(timebase->name, "");
+   OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+
    return OS_SUCCESS;
-}
+
+}/* end OS_TimeBaseDelete */
 
 /***********************************************************************************
 **
-**    Name: OS_TimerGetIdByName
+**    Name: OS_TimeBaseGetIdByName
 **
-**    Purpose: This function tries to find a Timer Id given the name 
+**    Purpose: This function tries to find a time base Id given the name
 **             The id is returned through timer_id
 **
-**    Returns: OS_INVALID_POINTER if timer_id or timer_name are NULL pointers
+**    Returns: OS_INVALID_POINTER if timer_id or timebase_name are NULL pointers
 **             OS_ERR_NAME_TOO_LONG if the name given is to long to have been stored
 **             OS_ERR_NAME_NOT_FOUND if the name was not found in the table
 **             OS_SUCCESS if success
-**             
 */
-int32 OS_TimerGetIdByName (uint32 *timer_id, const char *timer_name)
+int32 OS_TimeBaseGetIdByName (uint32 *timer_id, const char *timebase_name)
 {
     uint32 i;
 
-    if (timer_id == NULL || timer_name == NULL)
+    if (timer_id == NULL || timebase_name == NULL)
     {
         return OS_INVALID_POINTER;
     }
 
-    /* 
-    ** a name too long wouldn't have been allowed in the first place
-    ** so we definitely won't find a name too long
-    */
-    if (strlen(timer_name) > OS_MAX_API_NAME)
+    if (strlen(timebase_name) >= OS_MAX_API_NAME)
     {
         return OS_ERR_NAME_TOO_LONG;
     }
 
-    for (i = 0; i < OS_MAX_TIMERS; i++)
+    for (i = 0; i < OS_MAX_TIMEBASES; i++)
     {
-        if (OS_timer_table[i].free != TRUE &&
-                (strcmp (OS_timer_table[i].name , (char*) timer_name) == 0))
+        if (OS_timebase_table[i].free != TRUE &&
+                (strcmp (OS_timebase_table[i].name, timebase_name) == 0))
         {
             *timer_id = i;
             return OS_SUCCESS;
         }
     }
-   
-    /* 
-    ** The name was not found in the table,
-    **  or it was, and the sem_id isn't valid anymore 
-    */
+
     return OS_ERR_NAME_NOT_FOUND;
-    
-}/* end OS_TimerGetIdByName */
 
-/***************************************************************************************
-**    Name: OS_TimerGetInfo
+}/* end OS_TimeBaseGetIdByName */
+
+/******************************************************************************
+**  Function:  OS_TimerAdd
 **
-**    Purpose: This function will pass back a pointer to structure that contains 
-**             all of the relevant info( name and creator) about the specified timer.
-**             
-**    Returns: OS_ERR_INVALID_ID if the id passed in is not a valid timer 
-**             OS_INVALID_POINTER if the timer_prop pointer is null
-**             OS_SUCCESS if success
+**  Purpose:  Create a new OSAL timer on an existing time base.  The timer uses no
+**            OS resources; the thread of the time base counts it down and calls
+**            callback_ptr with the timer id and callback_arg when it expires.
+**            The timer is started with OS_TimerSet and its resolution is the
+**            tick of the time base.
+**
+**  Returns: OS_INVALID_POINTER if timer_id or timer_name are NULL
+**           OS_ERR_NAME_TOO_LONG if the name is too long
+**           OS_ERR_INVALID_ID if timebase_id is not a valid time base
+**           OS_TIMER_ERR_INVALID_ARGS if callback_ptr is NULL
+**           OS_ERR_NO_FREE_IDS if all time base timers are in use
+**           OS_ERR_NAME_TAKEN if the name is already used by a timer
+**           OS_SUCCESS if success
 */
-int32 OS_TimerGetInfo (uint32 timer_id, OS_timer_prop_t *timer_prop)  
+int32 OS_TimerAdd(uint32 *timer_id, const char *timer_name, uint32 timebase_id, OS_ArgCallback_t  callback_ptr, void *callback_arg)
 {
-    sigset_t  previous;
-    sigset_t  mask;
+   uint32    possible_tid;
+   uint32    i;
+   sigset_t  previous;
+   sigset_t  mask;
+   OS_timer_internal_record_t *timer;
 
-    /* 
-    ** Check to see that the id given is valid 
-    */
-    if (timer_id >= OS_MAX_TIMERS || OS_timer_table[timer_id].free == TRUE)
-    {
-       return OS_ERR_INVALID_ID;
-    }
+   if ( timer_id == NULL || timer_name == NULL )
+   {
+      return OS_INVALID_POINTER;
+   }
 
-    if (timer_prop == NULL)
-    {
-        return OS_INVALID_POINTER;
-    }
+   if (strlen(timer_name) >= OS_MAX_API_NAME)
+   {
+      return OS_ERR_NAME_TOO_LONG;
+   }
 
-    /* 
-    ** put the info into the stucture 
-    */
-    OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+   if (callback_ptr == NULL)
+   {
+      return OS_TIMER_ERR_INVALID_ARGS;
+   }
 
-    timer_prop ->creator       = OS_timer_table[timer_id].creator;
-    strcpy(timer_prop-> name, OS_timer_table[timer_id].name);
-    timer_prop ->start_time    = OS_timer_table[timer_id].start_time;
-    timer_prop ->interval_time = OS_timer_table[timer_id].interval_time;
-    timer_prop ->accuracy      = OS_timer_table[timer_id].accuracy;
-    
-    OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+   OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
 
-    return OS_SUCCESS;
-    
-} /* end OS_TimerGetInfo */
+   if (timebase_id >= OS_MAX_TIMEBASES || OS_timebase_table[timebase_id].free == TRUE ||
+         OS_timebase_table[timebase_id].shutdown == TRUE)
+   {
+      OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+      return OS_ERR_INVALID_ID;
+   }
 
-/****************************************************************
- * TIME BASE API
- *
- * This is not implemented by this OSAL, so return "OS_ERR_NOT_IMPLEMENTED"
- * for all calls defined by this API.  This is necessary for forward
- * compatibility (runtime code can check for this return code and use
- * an alternative API where appropriate).
- */
+   for (possible_tid = OS_MAX_TIMERS; possible_tid < OS_TIMER_TABLE_SIZE; possible_tid++)
+   {
+      if (OS_timer_table[possible_tid].free == TRUE)
+         break;
+   }
 
-int32 OS_TimeBaseCreate(uint32 *timer_id, const char *timebase_name, OS_TimerSync_t external_sync)
-{
-    return OS_ERR_NOT_IMPLEMENTED;
-}
+   if (possible_tid >= OS_TIMER_TABLE_SIZE)
+   {
+      OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+      return OS_ERR_NO_FREE_IDS;
+   }
 
-int32 OS_TimeBaseSet(uint32 timer_id, uint32 start_time, uint32 interval_time)
-{
-    return OS_ERR_NOT_IMPLEMENTED;
-}
+   for (i = 0; i < OS_TIMER_TABLE_SIZE; i++)
+   {
+      if ((OS_timer_table[i].free == FALSE) &&
+           strcmp (timer_name, OS_timer_table[i].name) == 0)
+      {
+         OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+         return OS_ERR_NAME_TAKEN;
+      }
+   }
 
-int32 OS_TimeBaseDelete(uint32 timer_id)
-{
-    return OS_ERR_NOT_IMPLEMENTED;
-}
+   timer = &OS_timer_table[possible_tid];
+   timer->free = FALSE;
+   timer->creator = OS_FindCreator();
+   strncpy(timer->name, timer_name, OS_MAX_API_NAME);
+   timer->start_time = 0;
+   timer->interval_time = 0;
+   timer->start_ns = 0;
+   timer->interval_ns = 0;
+   timer->accuracy = OS_timebase_table[timebase_id].accuracy;
+   timer->callback_ptr = NULL;
+   timer->timebase_id = timebase_id;
+   timer->arg_callback_ptr = callback_ptr;
+   timer->callback_arg = callback_arg;
+   timer->armed = FALSE;
+   timer->expiry = 0;
 
-int32 OS_TimeBaseGetIdByName (uint32 *timer_id, const char *timebase_name)
-{
-    return OS_ERR_NOT_IMPLEMENTED;
-}
+   OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
 
-int32 OS_TimerAdd(uint32 *timer_id, const char *timer_name, uint32 timebase_id, OS_ArgCallback_t  callback_ptr, void *callback_arg)
-{
-    return OS_ERR_NOT_IMPLEMENTED;
-}
+   *timer_id = possible_tid;
+
+   return OS_SUCCESS;
 
+}/* end OS_TimerAdd */
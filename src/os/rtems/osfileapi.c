@@ -113,6 +113,7 @@
 #include <errno.h>
 #include <dirent.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <rtems.h>
 #include <rtems/shell.h>
 
@@ -139,6 +140,7 @@
 ***************************************************************************************/
 
 int32 OS_check_name_length(const char *path);
+int32 OS_IovecCheck(int32 filedes, const os_iovec_t *iov, uint32 iovcnt);
 extern uint32 OS_FindCreator(void);
 
 /****************************************************************************************
@@ -583,6 +585,327 @@ int32 OS_write (int32  filedes, void *buffer, uint32 nbytes)
     
 }/* end OS_write */
 
+/*--------------------------------------------------------------------------------------
+    Name: OS_pread
+    
+    Purpose: reads up to nbytes from a file starting at offset, and puts them into
+             buffer. The file offset is left unchanged, so several tasks may read
+             different parts of the same file at once without a seek.
+    
+    Returns: OS_FS_ERR_INVALID_POINTER if buffer is a null pointer
+             OS_FS_ERROR if offset is beyond what the host supports or OS call failed
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             number of bytes read if success
+---------------------------------------------------------------------------------------*/
+int32 OS_pread  (int32  filedes, void *buffer, uint32 nbytes, uint64 offset)
+{
+    int32 status;
+
+    if (buffer == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+
+    /* Make sure the file descriptor is legit before using it */
+    if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
+    {
+        return OS_FS_ERR_INVALID_FD;
+    }
+
+    /* off_t may be narrower than 64 bits, and it is signed */
+    if ((off_t)offset < 0 || (uint64)(off_t)offset != offset)
+    {
+        return OS_FS_ERROR;
+    }
+
+    status = pread (OS_FDTable[filedes].OSfd, buffer, nbytes, (off_t)offset);
+
+    if (status == ERROR)
+    {
+        return OS_FS_ERROR;
+    }
+
+    return status;
+    
+}/* end OS_pread */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_pwrite
+
+    Purpose: writes up to nbytes of buffer to the file described in filedes, starting
+             at offset. The file offset is left unchanged.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if buffer is NULL
+             OS_FS_ERROR if offset is beyond what the host supports or OS call failed
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             number of bytes written if success
+---------------------------------------------------------------------------------------*/
+
+int32 OS_pwrite (int32  filedes, void *buffer, uint32 nbytes, uint64 offset)
+{
+    int32 status;
+
+    if (buffer == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+
+    /* Make sure the file descriptor is legit before using it */
+    if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
+    {
+        return OS_FS_ERR_INVALID_FD;
+    }
+
+    /* off_t may be narrower than 64 bits, and it is signed */
+    if ((off_t)offset < 0 || (uint64)(off_t)offset != offset)
+    {
+        return OS_FS_ERROR;
+    }
+
+    status = pwrite(OS_FDTable[filedes].OSfd, buffer, nbytes, (off_t)offset);
+
+    if (status != ERROR)
+    {
+        return  status;
+    }
+    else
+    {
+        return OS_FS_ERROR;
+    }
+    
+}/* end OS_pwrite */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_IovecCheck
+
+    Purpose: Checks the arguments common to the scatter/gather calls
+
+    Returns: OS_FS_ERR_INVALID_POINTER if iov or a segment buffer is NULL
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             OS_FS_ERROR if there are too many segments or they total over 2 GB
+             OS_FS_SUCCESS if the arguments are usable
+---------------------------------------------------------------------------------------*/
+int32 OS_IovecCheck(int32 filedes, const os_iovec_t *iov, uint32 iovcnt)
+{
+    uint32 i;
+    uint32 total;
+
+    if (iov == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+
+    /* Make sure the file descriptor is legit before using it */
+    if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
+    {
+        return OS_FS_ERR_INVALID_FD;
+    }
+
+    if (iovcnt > OS_FS_MAX_IOVEC)
+    {
+        return OS_FS_ERROR;
+    }
+
+    /* the byte count is returned as an int32, so the total must fit in one */
+    total = 0;
+    for (i = 0; i < iovcnt; ++i)
+    {
+        if (iov[i].buffer == NULL)
+        {
+            return OS_FS_ERR_INVALID_POINTER;
+        }
+        if (iov[i].length > (uint32)0x7FFFFFFF - total)
+        {
+            return OS_FS_ERROR;
+        }
+        total += iov[i].length;
+    }
+
+    return OS_FS_SUCCESS;
+
+}/* end OS_IovecCheck */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_readv
+
+    Purpose: reads from a file into iovcnt buffers, filling each one before moving
+             to the next.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if iov or a segment buffer is NULL
+             OS_FS_ERROR if there are more than OS_FS_MAX_IOVEC segments or OS call failed
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             number of bytes transferred if success
+---------------------------------------------------------------------------------------*/
+int32 OS_readv (int32  filedes, const os_iovec_t *iov, uint32 iovcnt)
+{
+    struct iovec host_iov[OS_FS_MAX_IOVEC];
+    int32        status;
+    uint32       i;
+
+    status = OS_IovecCheck(filedes, iov, iovcnt);
+    if (status != OS_FS_SUCCESS)
+    {
+        return status;
+    }
+
+    for (i = 0; i < iovcnt; ++i)
+    {
+        host_iov[i].iov_base = iov[i].buffer;
+        host_iov[i].iov_len = iov[i].length;
+    }
+
+    status = readv(OS_FDTable[filedes].OSfd, host_iov, (int)iovcnt);
+    if (status == ERROR)
+    {
+        return OS_FS_ERROR;
+    }
+
+    return status;
+
+}/* end OS_readv */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_writev
+
+    Purpose: writes iovcnt buffers to a file, one after the other, in one call.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if iov or a segment buffer is NULL
+             OS_FS_ERROR if there are more than OS_FS_MAX_IOVEC segments or OS call failed
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             number of bytes transferred if success
+---------------------------------------------------------------------------------------*/
+int32 OS_writev (int32  filedes, const os_iovec_t *iov, uint32 iovcnt)
+{
+    struct iovec host_iov[OS_FS_MAX_IOVEC];
+    int32        status;
+    uint32       i;
+
+    status = OS_IovecCheck(filedes, iov, iovcnt);
+    if (status != OS_FS_SUCCESS)
+    {
+        return status;
+    }
+
+    for (i = 0; i < iovcnt; ++i)
+    {
+        host_iov[i].iov_base = iov[i].buffer;
+        host_iov[i].iov_len = iov[i].length;
+    }
+
+    status = writev(OS_FDTable[filedes].OSfd, host_iov, (int)iovcnt);
+    if (status == ERROR)
+    {
+        return OS_FS_ERROR;
+    }
+
+    return status;
+
+}/* end OS_writev */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_preadv
+
+    Purpose: as OS_readv, but reads starting at offset and leaves the file offset
+             unchanged. RTEMS has no preadv, so this reads each segment with pread.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if iov or a segment buffer is NULL
+             OS_FS_ERROR if there are more than OS_FS_MAX_IOVEC segments or OS call failed
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             number of bytes transferred if success
+---------------------------------------------------------------------------------------*/
+int32 OS_preadv (int32  filedes, const os_iovec_t *iov, uint32 iovcnt, uint64 offset)
+{
+    int32  status;
+    int32  total;
+    uint32 i;
+
+    status = OS_IovecCheck(filedes, iov, iovcnt);
+    if (status != OS_FS_SUCCESS)
+    {
+        return status;
+    }
+
+    if ((off_t)offset < 0 || (uint64)(off_t)offset != offset)
+    {
+        return OS_FS_ERROR;
+    }
+
+    /*
+    ** One host call per segment; stop at the first short transfer,
+    ** the same point a single readv/writev would have stopped
+    */
+    total = 0;
+    for (i = 0; i < iovcnt; ++i)
+    {
+        status = pread(OS_FDTable[filedes].OSfd, iov[i].buffer, iov[i].length, (off_t)offset);
+        if (status == ERROR)
+        {
+            return (total > 0) ? total : OS_FS_ERROR;
+        }
+        total += status;
+        offset += status;
+        if (status < (int32)iov[i].length)
+        {
+            break;
+        }
+    }
+
+    return total;
+
+}/* end OS_preadv */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_pwritev
+
+    Purpose: as OS_writev, but writes starting at offset and leaves the file offset
+             unchanged. RTEMS has no pwritev, so this writes each segment with pwrite.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if iov or a segment buffer is NULL
+             OS_FS_ERROR if there are more than OS_FS_MAX_IOVEC segments or OS call failed
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             number of bytes transferred if success
+---------------------------------------------------------------------------------------*/
+int32 OS_pwritev (int32  filedes, const os_iovec_t *iov, uint32 iovcnt, uint64 offset)
+{
+    int32  status;
+    int32  total;
+    uint32 i;
+
+    status = OS_IovecCheck(filedes, iov, iovcnt);
+    if (status != OS_FS_SUCCESS)
+    {
+        return status;
+    }
+
+    if ((off_t)offset < 0 || (uint64)(off_t)offset != offset)
+    {
+        return OS_FS_ERROR;
+    }
+
+    /*
+    ** One host call per segment; stop at the first short transfer,
+    ** the same point a single readv/writev would have stopped
+    */
+    total = 0;
+    for (i = 0; i < iovcnt; ++i)
+    {
+        status = pwrite(OS_FDTable[filedes].OSfd, iov[i].buffer, iov[i].length, (off_t)offset);
+        if (status == ERROR)
+        {
+            return (total > 0) ? total : OS_FS_ERROR;
+        }
+        total += status;
+        offset += status;
+        if (status < (int32)iov[i].length)
+        {
+            break;
+        }
+    }
+
+    return total;
+
+}/* end OS_pwritev */
+
 /*--------------------------------------------------------------------------------------
     Name: OS_chmod
 
@@ -650,6 +973,70 @@ int32 OS_stat   (const char *path, os_fstat_t  *filestats)
     
 } /* end OS_stat */
 
+/*--------------------------------------------------------------------------------------
+    Name: OS_fstat
+    
+    Purpose: returns information about an open file in filestats
+
+    Returns: OS_FS_ERR_INVALID_POINTER if filestats is NULL
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             OS_FS_ERROR if the OS call failed
+             OS_FS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+
+int32 OS_fstat (int32 filedes, os_fstat_t *filestats)
+{
+    if (filestats == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+
+    /* Make sure the file descriptor is legit before using it */
+    if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
+    {
+        return OS_FS_ERR_INVALID_FD;
+    }
+
+    if (fstat(OS_FDTable[filedes].OSfd, filestats) == ERROR)
+    {
+        return OS_FS_ERROR;
+    }
+
+    return OS_FS_SUCCESS;
+
+} /* end OS_fstat */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FDGetSize
+    
+    Purpose: returns the size in bytes of an open file in size
+
+    Returns: OS_FS_ERR_INVALID_POINTER if size is NULL
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             OS_FS_ERROR if the OS call failed
+             OS_FS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+
+int32 OS_FDGetSize (int32 filedes, uint64 *size)
+{
+    struct stat filestats;
+    int32       status;
+
+    if (size == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+
+    status = OS_fstat(filedes, &filestats);
+    if (status == OS_FS_SUCCESS)
+    {
+        *size = (uint64)filestats.st_size;
+    }
+
+    return status;
+
+} /* end OS_FDGetSize */
+
 /*--------------------------------------------------------------------------------------
     Name: OS_lseek
 
@@ -658,7 +1045,8 @@ int32 OS_stat   (const char *path, os_fstat_t  *filestats)
 
     Returns: the new offset from the beginning of the file
              OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
-             OS_FS_ERROR if OS call failed
+             OS_FS_ERROR if OS call failed, or the new offset does not fit an int32.
+             The seek has still been done in that case; OS_lseek64 returns it.
 ---------------------------------------------------------------------------------------*/
 
 int32 OS_lseek  (int32  filedes, int32 offset, uint32 whence)
@@ -691,7 +1079,7 @@ int32 OS_lseek  (int32  filedes, int32 offset, uint32 whence)
     
         status = lseek( OS_FDTable[filedes].OSfd, (off_t) offset, (int) where );
 
-        if ( (int) status != ERROR)
+        if ( status != ERROR && status <= (off_t) 0x7FFFFFFF )
         {
             return (int32) status;
         }
@@ -703,6 +1091,238 @@ int32 OS_lseek  (int32  filedes, int32 offset, uint32 whence)
  
 }/* end OS_lseek */
 
+/*--------------------------------------------------------------------------------------
+    Name: OS_lseek64
+
+    Purpose: sets the read/write pointer to a specific offset in a specific file,
+             for files larger than 2 GB. Whence is either OS_SEEK_SET, OS_SEEK_CUR,
+             or OS_SEEK_END. The new offset from the beginning of the file is
+             returned in new_offset, which may be NULL if it is not needed.
+
+    Returns: OS_FS_SUCCESS if success
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             OS_FS_ERROR if whence is unknown, offset is beyond what the host
+             supports or OS call failed
+---------------------------------------------------------------------------------------*/
+
+int32 OS_lseek64 (int32 filedes, int64 offset, uint32 whence, uint64 *new_offset)
+{
+    off_t status;
+    int   where;
+
+    /* Make sure the file descriptor is legit before using it */
+    if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
+    {
+        return OS_FS_ERR_INVALID_FD;
+    }
+
+    switch(whence)
+    {
+        case OS_SEEK_SET:
+            where = SEEK_SET;
+            break;
+        case OS_SEEK_CUR:
+            where = SEEK_CUR;
+            break;
+        case OS_SEEK_END:
+            where = SEEK_END;
+            break;
+        default:
+            return OS_FS_ERROR;
+    }
+
+    if ((int64)(off_t)offset != offset)
+    {
+        return OS_FS_ERROR;
+    }
+
+    status = lseek(OS_FDTable[filedes].OSfd, (off_t)offset, where);
+    if (status == ERROR)
+    {
+        return OS_FS_ERROR;
+    }
+
+    if (new_offset != NULL)
+    {
+        *new_offset = (uint64)status;
+    }
+
+    return OS_FS_SUCCESS;
+
+}/* end OS_lseek64 */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FileMap
+
+    Purpose: maps part of an open file into memory.
+
+    Notes: Not implemented. RTEMS has no file backed mmap.
+---------------------------------------------------------------------------------------*/
+int32 OS_FileMap (int32 filedes, uint64 offset, uint32 length, uint32 access, void **addr)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_FileMap */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FileUnmap
+
+    Purpose: removes a mapping made by OS_FileMap.
+
+    Notes: Not implemented. RTEMS has no file backed mmap.
+---------------------------------------------------------------------------------------*/
+int32 OS_FileUnmap (void *addr)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_FileUnmap */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FileSync
+
+    Purpose: writes changes made through a mapping back to the file.
+
+    Notes: Not implemented. RTEMS has no file backed mmap.
+---------------------------------------------------------------------------------------*/
+int32 OS_FileSync (void *addr)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_FileSync */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_AsyncQueueCreate
+
+    Purpose: creates an asynchronous file I/O queue.
+
+    Notes: Not implemented. The RTEMS port has no work queue to run the requests on.
+---------------------------------------------------------------------------------------*/
+int32 OS_AsyncQueueCreate (uint32 *queue_id, uint32 depth, uint32 flags)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_AsyncQueueCreate */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_AsyncQueueDelete
+
+    Purpose: deletes an asynchronous file I/O queue.
+
+    Notes: Not implemented. The RTEMS port has no work queue to run the requests on.
+---------------------------------------------------------------------------------------*/
+int32 OS_AsyncQueueDelete (uint32 queue_id)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_AsyncQueueDelete */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_AsyncRead
+
+    Purpose: queues a read from an open file.
+
+    Notes: Not implemented. The RTEMS port has no work queue to run the requests on.
+---------------------------------------------------------------------------------------*/
+int32 OS_AsyncRead (uint32 queue_id, int32 filedes, void *buffer, uint32 nbytes,
+                    uint64 offset, void *user_arg)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_AsyncRead */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_AsyncWrite
+
+    Purpose: queues a write to an open file.
+
+    Notes: Not implemented. The RTEMS port has no work queue to run the requests on.
+---------------------------------------------------------------------------------------*/
+int32 OS_AsyncWrite (uint32 queue_id, int32 filedes, void *buffer, uint32 nbytes,
+                     uint64 offset, void *user_arg)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_AsyncWrite */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_AsyncWait
+
+    Purpose: collects the requests of a queue that have completed.
+
+    Notes: Not implemented. The RTEMS port has no work queue to run the requests on.
+---------------------------------------------------------------------------------------*/
+int32 OS_AsyncWait (uint32 queue_id, os_async_completion_t *completions, uint32 max_count,
+                    int32 msecs)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_AsyncWait */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_StreamOpen
+
+    Purpose: creates a buffered stream on an open file.
+
+    Notes: Not implemented. The RTEMS port has no thread to flush the streams on time.
+---------------------------------------------------------------------------------------*/
+int32 OS_StreamOpen (uint32 *stream_id, int32 filedes, uint32 buffer_size,
+                     uint32 flush_size, uint32 flush_msec)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_StreamOpen */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_StreamWrite
+
+    Purpose: adds data to a buffered stream.
+
+    Notes: Not implemented. The RTEMS port has no thread to flush the streams on time.
+---------------------------------------------------------------------------------------*/
+int32 OS_StreamWrite (uint32 stream_id, const void *buffer, uint32 nbytes)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_StreamWrite */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_StreamFlush
+
+    Purpose: writes out the data buffered by a stream.
+
+    Notes: Not implemented. The RTEMS port has no thread to flush the streams on time.
+---------------------------------------------------------------------------------------*/
+int32 OS_StreamFlush (uint32 stream_id)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_StreamFlush */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_StreamFlushAll
+
+    Purpose: writes out the data buffered by all the streams.
+
+    Notes: Not implemented. The RTEMS port has no thread to flush the streams on time.
+---------------------------------------------------------------------------------------*/
+int32 OS_StreamFlushAll (void)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_StreamFlushAll */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_StreamClose
+
+    Purpose: flushes and frees a buffered stream.
+
+    Notes: Not implemented. The RTEMS port has no thread to flush the streams on time.
+---------------------------------------------------------------------------------------*/
+int32 OS_StreamClose (uint32 stream_id)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_StreamClose */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_StreamGetInfo
+
+    Purpose: fills in the state of a buffered stream.
+
+    Notes: Not implemented. The RTEMS port has no thread to flush the streams on time.
+---------------------------------------------------------------------------------------*/
+int32 OS_StreamGetInfo (uint32 stream_id, os_stream_prop_t *stream_prop)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_StreamGetInfo */
+
 /*--------------------------------------------------------------------------------------
     Name: OS_remove
 
@@ -1264,6 +1884,31 @@ void  OS_rewinddir (os_dirp_t directory )
        rewinddir( directory);
     }
 }
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_DirReadBatch
+
+    Purpose: reads several directory entries with their status at once.
+
+    Notes: Not implemented. The RTEMS port has no fstatat to stat entries relative to the directory.
+---------------------------------------------------------------------------------------*/
+int32 OS_DirReadBatch (os_dirp_t directory, os_dirent_stat_t *entries, uint32 max_entries)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_DirReadBatch */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_DirWalk
+
+    Purpose: reports every object below a directory.
+
+    Notes: Not implemented. The RTEMS port has no fstatat to stat entries relative to the directory.
+---------------------------------------------------------------------------------------*/
+int32 OS_DirWalk (const char *path, OS_DirWalkCallback_t callback, void *callback_arg,
+                  uint32 flags)
+{
+    return (OS_FS_UNIMPLEMENTED);
+} /* end OS_DirWalk */
 /*--------------------------------------------------------------------------------------
     Name: OS_rmdir
     
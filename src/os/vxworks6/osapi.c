@@ -604,6 +604,21 @@ int32 OS_TaskCreate (uint32 *task_id,  const char *task_name,
 
 } /* end OS_TaskCreate */
 
+/*---------------------------------------------------------------------------------------
+   Name: OS_TaskCreateEx
+
+   Purpose: Creates a task that receives an argument and optional attributes.
+
+   returns: OS_ERR_NOT_IMPLEMENTED, this is not implemented by this OSAL. Runtime
+            code can check for this return code and fall back to OS_TaskCreate.
+---------------------------------------------------------------------------------------*/
+int32 OS_TaskCreateEx (uint32 *task_id, const char *task_name, osal_task_entry_arg function_pointer,
+                       void *entry_arg, uint32 stack_size, uint32 priority, uint32 flags,
+                       const OS_task_attr_t *attr)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}/* end OS_TaskCreateEx */
+
 /*--------------------------------------------------------------------------------------
      Name: OS_TaskDelete
 
@@ -752,6 +767,24 @@ int32 OS_TaskDelay (uint32 milli_second)
 
 }/* end OS_TaskDelay */
 
+/*---------------------------------------------------------------------------------------
+   Name: OS_TaskPeriodicInit, OS_TaskWaitNextPeriod
+
+   Purpose: Drift free periodic execution of the calling task.
+
+   returns: OS_ERR_NOT_IMPLEMENTED, this is not implemented by this OSAL. Runtime
+            code can check for this return code and fall back to OS_TaskDelay.
+---------------------------------------------------------------------------------------*/
+int32 OS_TaskPeriodicInit(uint32 period_usec)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}/* end OS_TaskPeriodicInit */
+
+int32 OS_TaskWaitNextPeriod(void)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}/* end OS_TaskWaitNextPeriod */
+
 
 /*---------------------------------------------------------------------------------------
    Name: OS_TaskSetPriority
@@ -941,6 +974,8 @@ int32 OS_TaskGetInfo (uint32 task_id, OS_task_prop_t *task_prop)
     task_prop -> creator =    OS_task_table[task_id].creator;
     task_prop -> stack_size = OS_task_table[task_id].stack_size;
     task_prop -> priority =   OS_task_table[task_id].priority;
+    task_prop -> policy =     OS_SCHED_DEFAULT;
+    task_prop -> os_priority = OS_task_table[task_id].priority;
     /* why is OStask_id a uint32, the VxWorks type for a task id is int,
      * not changing this at this time */
     task_prop -> OStask_id =  (uint32)OS_task_table[task_id].id;
@@ -955,6 +990,36 @@ int32 OS_TaskGetInfo (uint32 task_id, OS_task_prop_t *task_prop)
 
 } /* end OS_TaskGetInfo */
 
+/*---------------------------------------------------------------------------------------
+   Name: OS_TaskGetStats, OS_TaskGetStatsAll, OS_TaskStatsMonitorStart,
+         OS_TaskStatsMonitorStop
+
+   Purpose: Report per task runtime statistics.
+
+   returns: OS_ERR_NOT_IMPLEMENTED, this is not implemented by this OSAL. Runtime
+            code can check for this return code and do without the statistics.
+---------------------------------------------------------------------------------------*/
+int32 OS_TaskGetStats (uint32 task_id, OS_task_stats_t *task_stats)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}/* end OS_TaskGetStats */
+
+int32 OS_TaskGetStatsAll (OS_task_stats_t *task_stats, uint32 max_count, uint32 *count)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}/* end OS_TaskGetStatsAll */
+
+int32 OS_TaskStatsMonitorStart (uint32 period_msec, uint32 priority,
+                                OS_TaskStatsCallback_t callback)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}/* end OS_TaskStatsMonitorStart */
+
+int32 OS_TaskStatsMonitorStop (void)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}/* end OS_TaskStatsMonitorStop */
+
 /*--------------------------------------------------------------------------------------
      Name: OS_TaskInstallDeleteHandler
 
@@ -1005,6 +1070,147 @@ int32 OS_TaskInstallDeleteHandler(osal_task_entry function_pointer)
     
 }/*end OS_TaskInstallDeleteHandler */
 
+/****************************************************************
+ * WORK QUEUE API
+ *
+ * This is not implemented by this OSAL, so return "OS_ERR_NOT_IMPLEMENTED"
+ * for all calls defined by this API.  This is necessary for forward
+ * compatibility (runtime code can check for this return code and use
+ * an alternative API where appropriate).
+ */
+
+int32 OS_WorkQueueCreate (uint32 *queue_id, const char *queue_name, uint32 num_workers,
+                          uint32 priority, uint32 affinity_mask)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_WorkQueueDelete (uint32 queue_id)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_WorkQueueGetIdByName (uint32 *queue_id, const char *queue_name)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_WorkQueueGetInfo (uint32 queue_id, OS_work_queue_prop_t *queue_prop)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_WorkSubmit (uint32 queue_id, OS_WorkFunc_t function, void *arg, uint32 *work_id)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_WorkSubmitGroup (uint32 queue_id, uint32 group, OS_WorkFunc_t function, void *arg)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_WorkWait (uint32 queue_id, uint32 work_id)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_WorkGroupWait (uint32 queue_id, uint32 group)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+/****************************************************************
+ * FIBER API
+ *
+ * This is not implemented by this OSAL, so return "OS_ERR_NOT_IMPLEMENTED"
+ * for all calls defined by this API.  This is necessary for forward
+ * compatibility (runtime code can check for this return code and use
+ * an alternative API where appropriate).
+ */
+
+int32 OS_FiberSchedCreate (uint32 *sched_id, const char *sched_name, uint32 num_workers,
+                           uint32 priority, uint32 affinity_mask)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_FiberSchedDelete (uint32 sched_id)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_FiberSchedGetInfo (uint32 sched_id, OS_fiber_sched_prop_t *sched_prop)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_FiberCreate (uint32 *fiber_id, uint32 sched_id, OS_FiberFunc_t function,
+                      void *arg, uint32 stack_size)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+void OS_FiberExit (void)
+{
+}
+
+int32 OS_FiberYield (void)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_FiberDelay (uint32 millisecond)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_FiberGetId (uint32 *fiber_id)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_FiberSemCreate (uint32 *sem_id, uint32 sem_initial_value)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_FiberSemDelete (uint32 sem_id)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_FiberSemGive (uint32 sem_id)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_FiberSemTake (uint32 sem_id)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_FiberQueueCreate (uint32 *queue_id, uint32 queue_depth, uint32 data_size)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_FiberQueueDelete (uint32 queue_id)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_FiberQueuePut (uint32 queue_id, const void *data, uint32 size)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_FiberQueueGet (uint32 queue_id, void *data, uint32 size, uint32 *size_copied,
+                        int32 timeout)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
 /****************************************************************************************
                                 MESSAGE QUEUE API
 ****************************************************************************************/
@@ -2708,6 +2914,62 @@ int32 OS_GetLocalTime(OS_time_t *time_struct)
 
 } /* end OS_GetLocalTime */
 
+/*---------------------------------------------------------------------------------------
+ * Name: OS_GetMonotonicNs
+ * 
+ * Purpose: Returns the time in nanoseconds on a clock that only moves forward and
+ *          is not changed by OS_SetLocalTime
+ * ------------------------------------------------------------------------------------*/
+
+int32 OS_GetMonotonicNs(uint64 *nsecs)
+{
+   int               status;
+   struct  timespec  time;
+
+   if (nsecs == NULL)
+   {
+      return OS_INVALID_POINTER;
+   }
+
+   status = clock_gettime(CLOCK_MONOTONIC, &time);
+   if (status != OK)
+   {
+        return OS_ERROR;
+   }
+
+   *nsecs = ((uint64)time.tv_sec * 1000000000) + (uint64)time.tv_nsec;
+
+   return OS_SUCCESS;
+
+} /* end OS_GetMonotonicNs */
+
+/*---------------------------------------------------------------------------------------
+ * Name: OS_GetMonotonicTime
+ * 
+ * Purpose: OS_GetMonotonicNs as seconds and microseconds
+ * ------------------------------------------------------------------------------------*/
+
+int32 OS_GetMonotonicTime(OS_time_t *time_struct)
+{
+   uint64 nsecs;
+   int32  status;
+
+   if (time_struct == NULL)
+   {
+      return OS_INVALID_POINTER;
+   }
+
+   status = OS_GetMonotonicNs(&nsecs);
+   if (status == OS_SUCCESS)
+   {
+      time_struct -> seconds = (uint32)(nsecs / 1000000000);
+      time_struct -> microsecs = (uint32)((nsecs % 1000000000) / 1000);
+   }
+
+   return status;
+
+} /* end OS_GetMonotonicTime */
+
 /*---------------------------------------------------------------------------------------
  * Name: OS_SetLocalTime
  * 
@@ -2918,6 +3180,19 @@ int32 OS_HeapGetInfo       (OS_heap_prop_t *heap_prop)
 
 }
 
+/*---------------------------------------------------------------------------------------
+   Name: OS_DeterministicModeEnable
+
+   Purpose: Locks memory and prefaults task stacks and heap.
+
+   returns: OS_ERR_NOT_IMPLEMENTED, this is not implemented by this OSAL. Runtime
+            code can check for this return code and run without it.
+---------------------------------------------------------------------------------------*/
+int32 OS_DeterministicModeEnable (uint32 heap_reserve_size)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}/* end OS_DeterministicModeEnable */
+
 /*---------------------------------------------------------------------------------------
  *  Name: OS_GetErrorName()
 ---------------------------------------------------------------------------------------*/
@@ -0,0 +1,337 @@
+/*
+** async-io-test.c
+**
+** This program is an OSAL sample that measures OS_AsyncRead and OS_AsyncWrite.
+** Random 4 KB reads and writes are made within one file, keeping a fixed
+** number of requests in flight (the queue depth), from 1 to 64.  Each engine
+** is measured in turn: io_uring (when the host allows it) and the worker tasks.
+** OS_pread and OS_pwrite, one at a time, are measured as a reference.
+**
+** The file lives on the RAM disk, so it stays in the page cache and the
+** numbers show the cost of the engines more than that of the storage.
+**
+** Besides the human readable report, one line per run is printed in CSV form,
+** starting with "async-io,", so results can be compared across releases.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+
+#define ASYNC_BLOCK_SIZE     4096
+#define ASYNC_FILE_BLOCKS    2048
+#define ASYNC_REQUESTS       8192
+#define ASYNC_MAX_DEPTH      64
+#define ASYNC_ENGINES        3
+
+#define ASYNC_FILE_NAME      "/drive0/async.dat"
+
+void TestAsyncSetup(void);
+void TestAsyncIO(void);
+void TestAsyncTeardown(void);
+
+const char  *AsyncEngineNames[ASYNC_ENGINES] = { "sync", "threads", "io_uring" };
+const uint32 AsyncEngineFlags[ASYNC_ENGINES] = { 0, OS_ASYNC_THREADS, OS_ASYNC_IO_URING };
+
+/*
+** One request kept in flight.  Its address is the user argument of the request.
+*/
+typedef struct
+{
+   uint64 submit_ns;
+   uint8  buffer[ASYNC_BLOCK_SIZE];
+} AsyncSlot_t;
+
+typedef struct
+{
+   uint64 elapsed_ns;
+   uint32 failed;
+   uint32 avg_ns;
+   uint32 p99_ns;
+} AsyncResult_t;
+
+AsyncSlot_t           AsyncSlots[ASYNC_MAX_DEPTH];
+os_async_completion_t AsyncCompletions[ASYNC_MAX_DEPTH];
+uint32                AsyncLatencyNs[ASYNC_REQUESTS];
+uint32                AsyncRandom;
+
+static uint64 AsyncNextOffset(void)
+{
+   AsyncRandom = AsyncRandom * 1103515245 + 12345;
+   return (uint64)((AsyncRandom >> 8) % ASYNC_FILE_BLOCKS) * ASYNC_BLOCK_SIZE;
+}
+
+static int AsyncCompareLatency(const void *a, const void *b)
+{
+   uint32 la = *(const uint32 *)a;
+   uint32 lb = *(const uint32 *)b;
+
+   return (la > lb) - (la < lb);
+}
+
+static void AsyncSummarize(AsyncResult_t *result)
+{
+   uint64 total;
+   uint32 i;
+
+   total = 0;
+   for (i = 0; i < ASYNC_REQUESTS; i++)
+   {
+      total += AsyncLatencyNs[i];
+   }
+   qsort(AsyncLatencyNs, ASYNC_REQUESTS, sizeof(AsyncLatencyNs[0]), AsyncCompareLatency);
+
+   result->avg_ns = (uint32)(total / ASYNC_REQUESTS);
+   result->p99_ns = AsyncLatencyNs[(ASYNC_REQUESTS * 99) / 100];
+}
+
+static int32 AsyncSubmit(uint32 queue_id, int32 fd, uint32 is_write, AsyncSlot_t *slot)
+{
+   OS_GetMonotonicNs(&slot->submit_ns);
+   if (is_write)
+   {
+      return OS_AsyncWrite(queue_id, fd, slot->buffer, ASYNC_BLOCK_SIZE, AsyncNextOffset(), slot);
+   }
+
+   return OS_AsyncRead(queue_id, fd, slot->buffer, ASYNC_BLOCK_SIZE, AsyncNextOffset(), slot);
+}
+
+/*
+** Keeps depth requests in flight until ASYNC_REQUESTS have completed
+*/
+static void AsyncRun(uint32 queue_id, int32 fd, uint32 is_write, uint32 depth, AsyncResult_t *result)
+{
+   AsyncSlot_t *slot;
+   uint64       start;
+   uint64       now;
+   uint32       submitted;
+   uint32       done;
+   int32        count;
+   int32        i;
+
+   result->failed = 0;
+   submitted = 0;
+   done = 0;
+
+   OS_GetMonotonicNs(&start);
+   while (submitted < depth)
+   {
+      if (AsyncSubmit(queue_id, fd, is_write, &AsyncSlots[submitted]) != OS_FS_SUCCESS)
+      {
+         result->failed = ASYNC_REQUESTS;
+         return;
+      }
+      ++submitted;
+   }
+
+   while (done < ASYNC_REQUESTS)
+   {
+      count = OS_AsyncWait(queue_id, AsyncCompletions, depth, OS_PEND);
+      if (count <= 0)
+      {
+         result->failed += ASYNC_REQUESTS - done;
+         break;
+      }
+
+      OS_GetMonotonicNs(&now);
+      for (i = 0; i < count; i++)
+      {
+         slot = (AsyncSlot_t *)AsyncCompletions[i].user_arg;
+         AsyncLatencyNs[done++] = (uint32)(now - slot->submit_ns);
+         if (AsyncCompletions[i].result != ASYNC_BLOCK_SIZE)
+         {
+            ++result->failed;
+         }
+
+         if (submitted < ASYNC_REQUESTS)
+         {
+            if (AsyncSubmit(queue_id, fd, is_write, slot) != OS_FS_SUCCESS)
+            {
+               ++result->failed;
+            }
+            ++submitted;
+         }
+      }
+   }
+   OS_GetMonotonicNs(&now);
+
+   result->elapsed_ns = now - start;
+}
+
+/*
+** The reference: one OS_pread or OS_pwrite at a time
+*/
+static void AsyncRunSync(int32 fd, uint32 is_write, AsyncResult_t *result)
+{
+   uint64 start;
+   uint64 begin;
+   uint64 now;
+   int32  status;
+   uint32 i;
+
+   result->failed = 0;
+
+   OS_GetMonotonicNs(&start);
+   for (i = 0; i < ASYNC_REQUESTS; i++)
+   {
+      OS_GetMonotonicNs(&begin);
+      if (is_write)
+      {
+         status = OS_pwrite(fd, AsyncSlots[0].buffer, ASYNC_BLOCK_SIZE, AsyncNextOffset());
+      }
+      else
+      {
+         status = OS_pread(fd, AsyncSlots[0].buffer, ASYNC_BLOCK_SIZE, AsyncNextOffset());
+      }
+      OS_GetMonotonicNs(&now);
+
+      AsyncLatencyNs[i] = (uint32)(now - begin);
+      if (status != ASYNC_BLOCK_SIZE)
+      {
+         ++result->failed;
+      }
+   }
+
+   result->elapsed_ns = now - start;
+}
+
+static void AsyncReport(uint32 engine, uint32 is_write, uint32 depth, AsyncResult_t *result)
+{
+   uint32 iops;
+
+   AsyncSummarize(result);
+   iops = (uint32)(((uint64)ASYNC_REQUESTS * 1000000000) / (result->elapsed_ns ? result->elapsed_ns : 1));
+
+   UtAssert_True(result->failed == 0, "%s %s depth %u: %u of %u requests failed", AsyncEngineNames[engine],
+         is_write ? "write" : "read", (unsigned int)depth, (unsigned int)result->failed,
+         (unsigned int)ASYNC_REQUESTS);
+
+   UtPrintf("%-8s %-5s depth %2u: %7u IOPS, latency avg %u.%02u usec, p99 %u.%02u usec",
+         AsyncEngineNames[engine], is_write ? "write" : "read", (unsigned int)depth, (unsigned int)iops,
+         (unsigned int)(result->avg_ns / 1000), (unsigned int)((result->avg_ns % 1000) / 10),
+         (unsigned int)(result->p99_ns / 1000), (unsigned int)((result->p99_ns % 1000) / 10));
+   printf("async-io,%s,%s,%u,%u,%u,%u.%02u,%u.%02u\n", AsyncEngineNames[engine], is_write ? "write" : "read",
+         (unsigned int)depth, (unsigned int)ASYNC_REQUESTS, (unsigned int)iops,
+         (unsigned int)(result->avg_ns / 1000), (unsigned int)((result->avg_ns % 1000) / 10),
+         (unsigned int)(result->p99_ns / 1000), (unsigned int)((result->p99_ns % 1000) / 10));
+}
+
+
+/* *************************************** MAIN ************************************** */
+
+void OS_Application_Startup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    UtTest_Add(TestAsyncSetup, NULL, NULL, "TestAsyncSetup");
+    UtTest_Add(TestAsyncIO, NULL, NULL, "TestAsyncIO");
+    UtTest_Add(TestAsyncTeardown, NULL, NULL, "TestAsyncTeardown");
+}
+
+void TestAsyncSetup(void)
+{
+    int    status;
+    int32  fd;
+    uint32 i;
+
+    status = OS_mkfs(0,"/ramdev0","RAM",512,200);
+    UtAssert_True(status == OS_SUCCESS, "status after mkfs = %d",(int)status);
+
+    status = OS_mount("/ramdev0","/drive0");
+    UtAssert_True(status == OS_SUCCESS, "status after mount = %d",(int)status);
+
+    fd = OS_creat(ASYNC_FILE_NAME, OS_READ_WRITE);
+    UtAssert_True(fd >= 0, "create RC=%d", (int)fd);
+
+    memset(AsyncSlots[0].buffer, 0xA5, ASYNC_BLOCK_SIZE);
+    for (i = 0; fd >= 0 && i < ASYNC_FILE_BLOCKS; i++)
+    {
+        if (OS_write(fd, AsyncSlots[0].buffer, ASYNC_BLOCK_SIZE) != ASYNC_BLOCK_SIZE)
+        {
+            break;
+        }
+    }
+    UtAssert_True(i == ASYNC_FILE_BLOCKS, "%u of %u blocks written", (unsigned int)i,
+          (unsigned int)ASYNC_FILE_BLOCKS);
+
+    OS_close(fd);
+}
+
+void TestAsyncIO(void)
+{
+    AsyncResult_t result;
+    uint32        queue_id;
+    uint32        engine;
+    uint32        is_write;
+    uint32        depth;
+    int32         fd;
+    int32         status;
+
+    fd = OS_open(ASYNC_FILE_NAME, OS_READ_WRITE, 0);
+    UtAssert_True(fd >= 0, "open RC=%d", (int)fd);
+    if (fd < 0)
+    {
+        return;
+    }
+
+    printf("async-io,engine,op,queue_depth,requests,iops,avg_usec,p99_usec\n");
+
+    for (engine = 0; engine < ASYNC_ENGINES; engine++)
+    {
+        for (is_write = 0; is_write < 2; is_write++)
+        {
+            AsyncRandom = 1;
+
+            if (engine == 0)
+            {
+                AsyncRunSync(fd, is_write, &result);
+                AsyncReport(engine, is_write, 1, &result);
+                continue;
+            }
+
+            for (depth = 1; depth <= ASYNC_MAX_DEPTH; depth *= 2)
+            {
+                status = OS_AsyncQueueCreate(&queue_id, depth, AsyncEngineFlags[engine]);
+                if (status == OS_FS_UNIMPLEMENTED)
+                {
+                    UtPrintf("%-8s not available on this host", AsyncEngineNames[engine]);
+                    break;
+                }
+                UtAssert_True(status == OS_FS_SUCCESS, "%s queue create RC=%d", AsyncEngineNames[engine],
+                      (int)status);
+                if (status != OS_FS_SUCCESS)
+                {
+                    break;
+                }
+
+                AsyncRun(queue_id, fd, is_write, depth, &result);
+                AsyncReport(engine, is_write, depth, &result);
+
+                OS_AsyncQueueDelete(queue_id);
+            }
+        }
+    }
+
+    OS_close(fd);
+}
+
+void TestAsyncTeardown(void)
+{
+    int status;
+
+    status = OS_remove(ASYNC_FILE_NAME);
+    UtAssert_True(status == OS_SUCCESS, "status after remove = %d",(int)status);
+
+    status = OS_unmount("/drive0");
+    UtAssert_True(status == OS_SUCCESS, "status after unmount = %d",(int)status);
+}
@@ -0,0 +1,308 @@
+/*
+** file-copy-test.c
+**
+** This program is an OSAL sample that measures OS_cp throughput for small and
+** large files, and checks that every copy is identical to its source.
+**
+** For comparison the small file case is also run through system("cp"),
+** which is how OS_cp used to copy on POSIX hosts.
+**
+** It also measures moving a large file within a volume with OS_mv, against
+** OS_cp followed by OS_remove, which is how OS_mv used to move on POSIX hosts.
+**
+** Besides the human readable report, one line per case is printed in CSV form,
+** starting with "file-copy,", so results can be compared across releases.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+
+#define COPY_SMALL_SIZE      4096
+#define COPY_SMALL_COUNT     200
+#define COPY_SHELL_COUNT     20
+#define COPY_LARGE_SIZE      (32 * 1024 * 1024)
+#define COPY_LARGE_COUNT     4
+#define COPY_MOVE_COUNT      4
+#define COPY_BLOCK_SIZE      (64 * 1024)
+
+#define COPY_SRC_NAME        "/drive0/copysrc.dat"
+#define COPY_DEST_NAME       "/drive0/copydst.dat"
+
+void TestCopySetup(void);
+void TestCopySmall(void);
+void TestCopyShell(void);
+void TestCopyLarge(void);
+void TestMoveLarge(void);
+void TestCopyTeardown(void);
+
+char CopyBlock[COPY_BLOCK_SIZE];
+char CopyCheckBlock[COPY_BLOCK_SIZE];
+
+/*
+** Writes a file of the given size, filled with a pattern that
+** differs from block to block so misplaced data is caught
+*/
+static int32 CopyMakeFile(const char *path, uint32 size)
+{
+   int32  fd;
+   uint32 done;
+   uint32 len;
+   uint32 i;
+
+   fd = OS_creat(path, OS_WRITE_ONLY);
+   if (fd < 0)
+   {
+      return fd;
+   }
+
+   for (done = 0; done < size; done += len)
+   {
+      len = size - done;
+      if (len > COPY_BLOCK_SIZE)
+      {
+         len = COPY_BLOCK_SIZE;
+      }
+      for (i = 0; i < len; i++)
+      {
+         CopyBlock[i] = (char)((done / COPY_BLOCK_SIZE) * 7 + i * 13);
+      }
+      if (OS_write(fd, CopyBlock, len) != (int32)len)
+      {
+         OS_close(fd);
+         return OS_FS_ERROR;
+      }
+   }
+
+   return OS_close(fd);
+}
+
+/*
+** Returns TRUE if both files hold the same data
+*/
+static uint32 CopySameData(const char *path1, const char *path2)
+{
+   int32  fd1;
+   int32  fd2;
+   int32  len1;
+   int32  len2;
+   uint32 same;
+
+   fd1 = OS_open(path1, OS_READ_ONLY, 0);
+   fd2 = OS_open(path2, OS_READ_ONLY, 0);
+   same = (fd1 >= 0 && fd2 >= 0);
+
+   while (same)
+   {
+      len1 = OS_read(fd1, CopyBlock, COPY_BLOCK_SIZE);
+      len2 = OS_read(fd2, CopyCheckBlock, COPY_BLOCK_SIZE);
+      if (len1 != len2 || len1 < 0 || memcmp(CopyBlock, CopyCheckBlock, len1) != 0)
+      {
+         same = FALSE;
+      }
+      else if (len1 == 0)
+      {
+         break;
+      }
+   }
+
+   if (fd1 >= 0)
+   {
+      OS_close(fd1);
+   }
+   if (fd2 >= 0)
+   {
+      OS_close(fd2);
+   }
+
+   return same;
+}
+
+static void CopyReport(const char *name, uint32 size, uint32 count, uint64 elapsed_ns)
+{
+   uint64 usec_per_copy;
+   uint64 mb_per_sec;
+
+   usec_per_copy = elapsed_ns / count / 1000;
+   mb_per_sec = 0;
+   if (elapsed_ns > 0)
+   {
+      mb_per_sec = ((uint64)size * count * 1000) / elapsed_ns;
+   }
+
+   UtPrintf("%-6s %8u bytes x %3u: %8u usec per copy, %6u MB/s", name, (unsigned int)size,
+         (unsigned int)count, (unsigned int)usec_per_copy, (unsigned int)mb_per_sec);
+   printf("file-copy,%s,%u,%u,%u,%u\n", name, (unsigned int)size, (unsigned int)count,
+         (unsigned int)usec_per_copy, (unsigned int)mb_per_sec);
+}
+
+static void CopyRun(const char *name, uint32 size, uint32 count)
+{
+   int32  status;
+   uint32 i;
+   uint32 failed;
+   uint64 start;
+   uint64 end;
+
+   status = CopyMakeFile(COPY_SRC_NAME, size);
+   UtAssert_True(status == OS_FS_SUCCESS, "Create %u byte source RC=%d", (unsigned int)size, (int)status);
+
+   failed = 0;
+   OS_GetMonotonicNs(&start);
+   for (i = 0; i < count; i++)
+   {
+      if (OS_cp(COPY_SRC_NAME, COPY_DEST_NAME) != OS_FS_SUCCESS)
+      {
+         ++failed;
+      }
+   }
+   OS_GetMonotonicNs(&end);
+
+   UtAssert_True(failed == 0, "%u of %u copies failed", (unsigned int)failed, (unsigned int)count);
+   UtAssert_True(CopySameData(COPY_SRC_NAME, COPY_DEST_NAME), "Copy of %u bytes matches source", (unsigned int)size);
+
+   CopyReport(name, size, count, end - start);
+
+   OS_remove(COPY_DEST_NAME);
+   OS_remove(COPY_SRC_NAME);
+}
+
+
+/* *************************************** MAIN ************************************** */
+
+void OS_Application_Startup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    UtTest_Add(TestCopySetup, NULL, NULL, "TestCopySetup");
+    UtTest_Add(TestCopySmall, NULL, NULL, "TestCopySmall");
+    UtTest_Add(TestCopyShell, NULL, NULL, "TestCopyShell");
+    UtTest_Add(TestCopyLarge, NULL, NULL, "TestCopyLarge");
+    UtTest_Add(TestMoveLarge, NULL, NULL, "TestMoveLarge");
+    UtTest_Add(TestCopyTeardown, NULL, NULL, "TestCopyTeardown");
+}
+
+void TestCopySetup(void)
+{
+    int status;
+
+    status = OS_mkfs(0,"/ramdev0","RAM",512,200);
+    UtAssert_True(status == OS_SUCCESS, "status after mkfs = %d",(int)status);
+
+    status = OS_mount("/ramdev0","/drive0");
+    UtAssert_True(status == OS_SUCCESS, "status after mount = %d",(int)status);
+
+    printf("file-copy,method,bytes,copies,usec_per_copy,mb_per_sec\n");
+}
+
+void TestCopySmall(void)
+{
+    CopyRun("os_cp", COPY_SMALL_SIZE, COPY_SMALL_COUNT);
+}
+
+void TestCopyShell(void)
+{
+    char   src_path[OS_MAX_LOCAL_PATH_LEN];
+    char   dest_path[OS_MAX_LOCAL_PATH_LEN];
+    char   command[OS_MAX_LOCAL_PATH_LEN * 2 + 5];
+    int32  status;
+    uint32 i;
+    uint32 failed;
+    uint64 start;
+    uint64 end;
+
+    status = CopyMakeFile(COPY_SRC_NAME, COPY_SMALL_SIZE);
+    UtAssert_True(status == OS_FS_SUCCESS, "Create source RC=%d", (int)status);
+
+    OS_TranslatePath(COPY_SRC_NAME, src_path);
+    OS_TranslatePath(COPY_DEST_NAME, dest_path);
+    sprintf(command, "cp %s %s", src_path, dest_path);
+
+    failed = 0;
+    OS_GetMonotonicNs(&start);
+    for (i = 0; i < COPY_SHELL_COUNT; i++)
+    {
+        if (system(command) != 0)
+        {
+            ++failed;
+        }
+    }
+    OS_GetMonotonicNs(&end);
+
+    UtAssert_True(failed == 0, "%u of %u shell copies failed", (unsigned int)failed, (unsigned int)COPY_SHELL_COUNT);
+
+    CopyReport("shell", COPY_SMALL_SIZE, COPY_SHELL_COUNT, end - start);
+
+    OS_remove(COPY_DEST_NAME);
+    OS_remove(COPY_SRC_NAME);
+}
+
+void TestCopyLarge(void)
+{
+    CopyRun("os_cp", COPY_LARGE_SIZE, COPY_LARGE_COUNT);
+}
+
+void TestMoveLarge(void)
+{
+    const char *names[2] = { COPY_SRC_NAME, COPY_DEST_NAME };
+    int32       status;
+    uint32      i;
+    uint32      failed;
+    uint64      start;
+    uint64      end;
+
+    status = CopyMakeFile(COPY_SRC_NAME, COPY_LARGE_SIZE);
+    UtAssert_True(status == OS_FS_SUCCESS, "Create source RC=%d", (int)status);
+
+    /*
+    ** Each pass moves the file to the other name, so it ends where it began
+    */
+    failed = 0;
+    OS_GetMonotonicNs(&start);
+    for (i = 0; i < COPY_MOVE_COUNT; i++)
+    {
+        if (OS_cp(names[i & 1], names[(i + 1) & 1]) != OS_FS_SUCCESS ||
+            OS_remove(names[i & 1]) != OS_FS_SUCCESS)
+        {
+            ++failed;
+        }
+    }
+    OS_GetMonotonicNs(&end);
+
+    UtAssert_True(failed == 0, "%u of %u copy and remove moves failed", (unsigned int)failed, (unsigned int)COPY_MOVE_COUNT);
+    CopyReport("cp+rm", COPY_LARGE_SIZE, COPY_MOVE_COUNT, end - start);
+
+    failed = 0;
+    OS_GetMonotonicNs(&start);
+    for (i = 0; i < COPY_MOVE_COUNT; i++)
+    {
+        if (OS_mv(names[i & 1], names[(i + 1) & 1]) != OS_FS_SUCCESS)
+        {
+            ++failed;
+        }
+    }
+    OS_GetMonotonicNs(&end);
+
+    UtAssert_True(failed == 0, "%u of %u moves failed", (unsigned int)failed, (unsigned int)COPY_MOVE_COUNT);
+    CopyReport("os_mv", COPY_LARGE_SIZE, COPY_MOVE_COUNT, end - start);
+
+    OS_remove(COPY_SRC_NAME);
+}
+
+void TestCopyTeardown(void)
+{
+    int status;
+
+    status = OS_unmount("/drive0");
+    UtAssert_True(status == OS_SUCCESS, "status after unmount = %d",(int)status);
+}
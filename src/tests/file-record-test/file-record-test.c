@@ -0,0 +1,217 @@
+/*
+** file-record-test.c
+**
+** This program is an OSAL sample that measures writing small records, each
+** made of a header and a payload, in three ways:
+**
+**   write2 - one OS_write for the header and one for the payload
+**   copy   - both copied into a staging buffer, then one OS_write
+**   writev - one OS_writev with a segment for each
+**
+** Every file is read back with OS_readv and checked against what was written.
+**
+** Besides the human readable report, one line per method is printed in CSV
+** form, starting with "file-record,", so results can be compared across releases.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+
+#define RECORD_COUNT         100000
+#define RECORD_HEADER_SIZE   16
+#define RECORD_PAYLOAD_SIZE  48
+#define RECORD_SIZE          (RECORD_HEADER_SIZE + RECORD_PAYLOAD_SIZE)
+#define RECORD_METHODS       3
+
+#define RECORD_FILE_NAME     "/drive0/records.dat"
+
+void TestRecordSetup(void);
+void TestRecordWrite(void);
+void TestRecordTeardown(void);
+
+const char *RecordMethodNames[RECORD_METHODS] = { "write2", "copy", "writev" };
+
+typedef struct
+{
+   uint32 sequence;
+   uint32 length;
+   uint64 time;
+} RecordHeader_t;
+
+RecordHeader_t RecordHeader;
+uint8          RecordPayload[RECORD_PAYLOAD_SIZE];
+uint8          RecordStaging[RECORD_SIZE];
+
+static void RecordFill(uint32 sequence)
+{
+   RecordHeader.sequence = sequence;
+   RecordHeader.length = RECORD_PAYLOAD_SIZE;
+   RecordHeader.time = (uint64)sequence * 1000;
+   memset(RecordPayload, (int)(sequence & 0xFF), sizeof(RecordPayload));
+}
+
+static int32 RecordWriteOne(int32 fd, uint32 method)
+{
+   os_iovec_t iov[2];
+   int32      status;
+
+   switch (method)
+   {
+      case 0:
+         status = OS_write(fd, &RecordHeader, RECORD_HEADER_SIZE);
+         if (status == RECORD_HEADER_SIZE)
+         {
+            status = OS_write(fd, RecordPayload, RECORD_PAYLOAD_SIZE);
+            if (status == RECORD_PAYLOAD_SIZE)
+            {
+               status = RECORD_SIZE;
+            }
+         }
+         break;
+
+      case 1:
+         memcpy(RecordStaging, &RecordHeader, RECORD_HEADER_SIZE);
+         memcpy(RecordStaging + RECORD_HEADER_SIZE, RecordPayload, RECORD_PAYLOAD_SIZE);
+         status = OS_write(fd, RecordStaging, RECORD_SIZE);
+         break;
+
+      default:
+         iov[0].buffer = &RecordHeader;
+         iov[0].length = RECORD_HEADER_SIZE;
+         iov[1].buffer = RecordPayload;
+         iov[1].length = RECORD_PAYLOAD_SIZE;
+         status = OS_writev(fd, iov, 2);
+         break;
+   }
+
+   return status;
+}
+
+/*
+** Reads the file back one record at a time and returns how many records
+** do not match what RecordFill produced for them
+*/
+static uint32 RecordCheckFile(int32 fd)
+{
+   os_iovec_t     iov[2];
+   RecordHeader_t header;
+   uint8          payload[RECORD_PAYLOAD_SIZE];
+   uint32         i;
+   uint32         bad;
+
+   iov[0].buffer = &header;
+   iov[0].length = RECORD_HEADER_SIZE;
+   iov[1].buffer = payload;
+   iov[1].length = RECORD_PAYLOAD_SIZE;
+
+   bad = 0;
+   OS_lseek(fd, 0, OS_SEEK_SET);
+   for (i = 0; i < RECORD_COUNT; i++)
+   {
+      RecordFill(i);
+      if (OS_readv(fd, iov, 2) != RECORD_SIZE ||
+          memcmp(&header, &RecordHeader, RECORD_HEADER_SIZE) != 0 ||
+          memcmp(payload, RecordPayload, RECORD_PAYLOAD_SIZE) != 0)
+      {
+         ++bad;
+      }
+   }
+
+   return bad;
+}
+
+
+/* *************************************** MAIN ************************************** */
+
+void OS_Application_Startup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    UtTest_Add(TestRecordSetup, NULL, NULL, "TestRecordSetup");
+    UtTest_Add(TestRecordWrite, NULL, NULL, "TestRecordWrite");
+    UtTest_Add(TestRecordTeardown, NULL, NULL, "TestRecordTeardown");
+}
+
+void TestRecordSetup(void)
+{
+    int status;
+
+    status = OS_mkfs(0,"/ramdev0","RAM",512,200);
+    UtAssert_True(status == OS_SUCCESS, "status after mkfs = %d",(int)status);
+
+    status = OS_mount("/ramdev0","/drive0");
+    UtAssert_True(status == OS_SUCCESS, "status after mount = %d",(int)status);
+}
+
+void TestRecordWrite(void)
+{
+    int32  fd;
+    uint32 method;
+    uint32 i;
+    uint32 failed;
+    uint64 start;
+    uint64 end;
+    uint64 elapsed;
+
+    printf("file-record,method,records,record_bytes,nsec_per_record,mb_per_sec\n");
+
+    for (method = 0; method < RECORD_METHODS; method++)
+    {
+        fd = OS_creat(RECORD_FILE_NAME, OS_READ_WRITE);
+        UtAssert_True(fd >= 0, "%s: create RC=%d", RecordMethodNames[method], (int)fd);
+        if (fd < 0)
+        {
+            continue;
+        }
+
+        failed = 0;
+        OS_GetMonotonicNs(&start);
+        for (i = 0; i < RECORD_COUNT; i++)
+        {
+            RecordFill(i);
+            if (RecordWriteOne(fd, method) != RECORD_SIZE)
+            {
+                ++failed;
+            }
+        }
+        OS_GetMonotonicNs(&end);
+        elapsed = end - start;
+
+        UtAssert_True(failed == 0, "%s: %u of %u records failed", RecordMethodNames[method],
+              (unsigned int)failed, (unsigned int)RECORD_COUNT);
+        UtAssert_True(OS_lseek(fd, 0, OS_SEEK_END) == RECORD_COUNT * RECORD_SIZE, "%s: file size",
+              RecordMethodNames[method]);
+        UtAssert_True(RecordCheckFile(fd) == 0, "%s: records read back intact", RecordMethodNames[method]);
+
+        UtPrintf("%-6s %u records of %u bytes: %u nsec per record, %u MB/s", RecordMethodNames[method],
+              (unsigned int)RECORD_COUNT, (unsigned int)RECORD_SIZE,
+              (unsigned int)(elapsed / RECORD_COUNT),
+              (unsigned int)(((uint64)RECORD_COUNT * RECORD_SIZE * 1000) / (elapsed ? elapsed : 1)));
+        printf("file-record,%s,%u,%u,%u,%u\n", RecordMethodNames[method],
+              (unsigned int)RECORD_COUNT, (unsigned int)RECORD_SIZE,
+              (unsigned int)(elapsed / RECORD_COUNT),
+              (unsigned int)(((uint64)RECORD_COUNT * RECORD_SIZE * 1000) / (elapsed ? elapsed : 1)));
+
+        OS_close(fd);
+        OS_remove(RECORD_FILE_NAME);
+    }
+}
+
+void TestRecordTeardown(void)
+{
+    int status;
+
+    status = OS_unmount("/drive0");
+    UtAssert_True(status == OS_SUCCESS, "status after unmount = %d",(int)status);
+}
@@ -0,0 +1,178 @@
+/*
+** monotonic-time-test.c
+**
+** This program is an OSAL sample that compares the cost of one call to each
+** OSAL time query: OS_GetLocalTime, OS_GetMonotonicTime and OS_GetMonotonicNs.
+** It also checks that OS_GetMonotonicNs never goes back and keeps pace with
+** OS_GetLocalTime over a task delay.
+**
+** Besides the human readable report, one line per call is printed in CSV form,
+** starting with "monotonic-time,", so results can be compared across releases
+** and with OS_MONOTONIC_TSC on and off.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+
+#define CLOCK_CALLS        1000000
+#define CLOCK_APIS         3
+#define CLOCK_DELAY_MSEC   200
+
+#define TASK_1_STACK_SIZE 16384
+#define TASK_1_PRIORITY   101
+
+void MonotonicTimeSetup(void);
+void MonotonicTimeTask(void);
+void MonotonicTimeCheck(void);
+
+uint32 MonotonicTimeTaskStack[TASK_1_STACK_SIZE];
+
+const char      *ClockApiNames[CLOCK_APIS] = { "OS_GetLocalTime", "OS_GetMonotonicTime", "OS_GetMonotonicNs" };
+
+uint64           ClockCallNs[CLOCK_APIS];
+uint32           ClockBackwards;
+int64            ClockMonotonicDelayUsec;
+int64            ClockLocalDelayUsec;
+uint32           ClockRan;
+
+static void ClockRun(uint32 api)
+{
+   OS_time_t time_struct;
+   uint64    nsecs;
+   uint64    start;
+   uint64    end;
+   uint32    i;
+
+   OS_GetMonotonicNs(&start);
+   switch (api)
+   {
+      case 0:
+         for (i = 0; i < CLOCK_CALLS; i++)
+         {
+            OS_GetLocalTime(&time_struct);
+         }
+         break;
+
+      case 1:
+         for (i = 0; i < CLOCK_CALLS; i++)
+         {
+            OS_GetMonotonicTime(&time_struct);
+         }
+         break;
+
+      default:
+         for (i = 0; i < CLOCK_CALLS; i++)
+         {
+            OS_GetMonotonicNs(&nsecs);
+         }
+         break;
+   }
+   OS_GetMonotonicNs(&end);
+
+   ClockCallNs[api] = end - start;
+}
+
+
+/* ********************** MAIN **************************** */
+
+void OS_Application_Startup(void)
+{
+
+  if (OS_API_Init() != OS_SUCCESS)
+  {
+      UtAssert_Abort("OS_API_Init() failed");
+  }
+
+  UtTest_Add(MonotonicTimeCheck, MonotonicTimeSetup, NULL, "MonotonicTimeTest");
+}
+
+void MonotonicTimeSetup(void)
+{
+    int32  status;
+    uint32 MonotonicTimeTaskId;
+
+    status = OS_TaskCreate( &MonotonicTimeTaskId, "Task 1", MonotonicTimeTask, MonotonicTimeTaskStack, sizeof(MonotonicTimeTaskStack), TASK_1_PRIORITY, 0);
+    UtAssert_True(status == OS_SUCCESS, "Monotonic Time Task Created RC=%d", (int)status);
+
+    /*
+     * OS_IdleLoop() returns once MonotonicTimeTask calls OS_ApplicationShutdown
+     */
+    OS_IdleLoop();
+}
+
+void MonotonicTimeTask(void)
+{
+   uint32    api;
+   uint32    i;
+   uint64    last;
+   uint64    now;
+   OS_time_t local_start;
+   OS_time_t local_end;
+
+   for (api = 0; api < CLOCK_APIS; api++)
+   {
+      ClockRun(api);
+   }
+
+   /*
+   ** Consecutive reads must never go back
+   */
+   OS_GetMonotonicNs(&last);
+   for (i = 0; i < CLOCK_CALLS; i++)
+   {
+      OS_GetMonotonicNs(&now);
+      if (now < last)
+      {
+         ++ClockBackwards;
+      }
+      last = now;
+   }
+
+   /*
+   ** Both clocks must see the same delay
+   */
+   OS_GetLocalTime(&local_start);
+   OS_GetMonotonicNs(&last);
+   OS_TaskDelay(CLOCK_DELAY_MSEC);
+   OS_GetMonotonicNs(&now);
+   OS_GetLocalTime(&local_end);
+
+   ClockMonotonicDelayUsec = (int64)((now - last) / 1000);
+   ClockLocalDelayUsec = ((int64)local_end.seconds - (int64)local_start.seconds) * 1000000 +
+         ((int64)local_end.microsecs - (int64)local_start.microsecs);
+   ClockRan = TRUE;
+
+   OS_ApplicationShutdown(TRUE);
+   OS_TaskExit();
+}
+
+void MonotonicTimeCheck(void)
+{
+   uint32 api;
+   int64  diff;
+
+   UtAssert_True(ClockRan == TRUE, "Measurements done");
+   UtAssert_True(ClockBackwards == 0, "OS_GetMonotonicNs never went back (%u)", (unsigned int)ClockBackwards);
+
+   diff = ClockMonotonicDelayUsec - ClockLocalDelayUsec;
+   UtAssert_True(ClockMonotonicDelayUsec >= CLOCK_DELAY_MSEC * 1000 && diff < 2000 && diff > -2000,
+         "Delay of %u msec: monotonic %d usec, local %d usec", (unsigned int)CLOCK_DELAY_MSEC,
+         (int)ClockMonotonicDelayUsec, (int)ClockLocalDelayUsec);
+
+   printf("monotonic-time,api,calls,nsec_per_call\n");
+   for (api = 0; api < CLOCK_APIS; api++)
+   {
+      UtPrintf("%-20s %u calls, %u.%02u nsec per call", ClockApiNames[api], (unsigned int)CLOCK_CALLS,
+            (unsigned int)(ClockCallNs[api] / CLOCK_CALLS),
+            (unsigned int)(((ClockCallNs[api] % CLOCK_CALLS) * 100) / CLOCK_CALLS));
+      printf("monotonic-time,%s,%u,%u.%02u\n", ClockApiNames[api], (unsigned int)CLOCK_CALLS,
+            (unsigned int)(ClockCallNs[api] / CLOCK_CALLS),
+            (unsigned int)(((ClockCallNs[api] % CLOCK_CALLS) * 100) / CLOCK_CALLS));
+   }
+}
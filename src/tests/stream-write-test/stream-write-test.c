@@ -0,0 +1,232 @@
+/*
+** stream-write-test.c
+**
+** This program is an OSAL sample that measures writing small records, of 50
+** to 200 bytes, one OS_write per record and through buffered streams
+** (OS_StreamOpen/OS_StreamWrite) of a few buffer sizes.  One stream also has
+** a flush time, so the cost of the time policy shows.
+**
+** The calls made to the file are counted: one per record for OS_write, and
+** the write_calls of OS_StreamGetInfo for the streams.  Every file is read
+** back and checked against what was written.
+**
+** Besides the human readable report, one line per method is printed in CSV
+** form, starting with "stream-write,", so results can be compared across releases.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+
+#define STREAM_RECORDS       200000
+#define STREAM_RECORD_MIN    50
+#define STREAM_RECORD_MAX    200
+#define STREAM_METHODS       5
+
+#define STREAM_FILE_NAME     "/drive0/stream.dat"
+
+void TestStreamSetup(void);
+void TestStreamWrite(void);
+void TestStreamTeardown(void);
+
+/*
+** buffer_size 0 means one OS_write per record
+*/
+const char  *StreamMethodNames[STREAM_METHODS] = { "write", "stream-4k", "stream-16k", "stream-64k", "stream-64k-10ms" };
+const uint32 StreamBufferSizes[STREAM_METHODS] = { 0, 4096, 16384, 65536, 65536 };
+const uint32 StreamFlushMsecs[STREAM_METHODS]  = { 0, 0, 0, 0, 10 };
+
+uint8        StreamRecord[STREAM_RECORD_MAX];
+uint8        StreamReadBuffer[STREAM_RECORD_MAX];
+uint32       StreamRandom;
+
+static uint32 StreamNextLength(void)
+{
+   StreamRandom = StreamRandom * 1103515245 + 12345;
+   return STREAM_RECORD_MIN + ((StreamRandom >> 8) % (STREAM_RECORD_MAX - STREAM_RECORD_MIN + 1));
+}
+
+/*
+** Writes all the records with one method, and returns the calls made to the file
+*/
+static uint32 StreamRun(uint32 method, int32 fd, uint64 *total_bytes)
+{
+   os_stream_prop_t prop;
+   uint32           stream_id = 0;
+   uint32           calls = 0;
+   uint32           length;
+   uint32           i;
+   int32            status;
+
+   *total_bytes = 0;
+   StreamRandom = 1;
+
+   if (StreamBufferSizes[method] != 0)
+   {
+      status = OS_StreamOpen(&stream_id, fd, StreamBufferSizes[method], 0, StreamFlushMsecs[method]);
+      UtAssert_True(status == OS_FS_SUCCESS, "%s stream open RC=%d", StreamMethodNames[method], (int)status);
+      if (status != OS_FS_SUCCESS)
+      {
+         return 0;
+      }
+   }
+
+   for (i = 0; i < STREAM_RECORDS; i++)
+   {
+      length = StreamNextLength();
+      memset(StreamRecord, (int)(i & 0xFF), length);
+
+      if (StreamBufferSizes[method] == 0)
+      {
+         status = OS_write(fd, StreamRecord, length);
+         ++calls;
+      }
+      else
+      {
+         status = OS_StreamWrite(stream_id, StreamRecord, length);
+      }
+
+      if (status != length)
+      {
+         break;
+      }
+      *total_bytes += length;
+   }
+   UtAssert_True(i == STREAM_RECORDS, "%s: %u of %u records written", StreamMethodNames[method],
+         (unsigned int)i, (unsigned int)STREAM_RECORDS);
+
+   if (StreamBufferSizes[method] != 0)
+   {
+      status = OS_StreamFlush(stream_id);
+      UtAssert_True(status == OS_FS_SUCCESS, "%s stream flush RC=%d", StreamMethodNames[method], (int)status);
+
+      OS_StreamGetInfo(stream_id, &prop);
+      calls = prop.write_calls;
+      UtAssert_True(prop.bytes_written == *total_bytes, "%s: %u of %u bytes reached the file",
+            StreamMethodNames[method], (unsigned int)prop.bytes_written, (unsigned int)*total_bytes);
+
+      OS_StreamClose(stream_id);
+   }
+
+   return calls;
+}
+
+/*
+** Reads the file back and compares it with the records
+*/
+static uint32 StreamCheck(int32 fd)
+{
+   uint32 length;
+   uint32 i;
+
+   StreamRandom = 1;
+   OS_lseek(fd, 0, OS_SEEK_SET);
+
+   for (i = 0; i < STREAM_RECORDS; i++)
+   {
+      length = StreamNextLength();
+      memset(StreamRecord, (int)(i & 0xFF), length);
+
+      if (OS_read(fd, StreamReadBuffer, length) != length ||
+          memcmp(StreamReadBuffer, StreamRecord, length) != 0)
+      {
+         break;
+      }
+   }
+
+   return (i == STREAM_RECORDS && OS_read(fd, StreamReadBuffer, 1) == 0);
+}
+
+
+/* *************************************** MAIN ************************************** */
+
+void OS_Application_Startup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    UtTest_Add(TestStreamSetup, NULL, NULL, "TestStreamSetup");
+    UtTest_Add(TestStreamWrite, NULL, NULL, "TestStreamWrite");
+    UtTest_Add(TestStreamTeardown, NULL, NULL, "TestStreamTeardown");
+}
+
+void TestStreamSetup(void)
+{
+    int status;
+
+    status = OS_mkfs(0,"/ramdev0","RAM",512,200);
+    UtAssert_True(status == OS_SUCCESS, "status after mkfs = %d",(int)status);
+
+    status = OS_mount("/ramdev0","/drive0");
+    UtAssert_True(status == OS_SUCCESS, "status after mount = %d",(int)status);
+}
+
+void TestStreamWrite(void)
+{
+    uint64  total_bytes;
+    uint64  start;
+    uint64  end;
+    uint64  elapsed_ns;
+    uint32  method;
+    uint32  calls;
+    uint32  calls_per_mb;
+    uint32  mb_per_sec;
+    int32   fd;
+
+    printf("stream-write,method,buffer_size,flush_msec,records,bytes,write_calls,calls_per_mb,mb_per_sec\n");
+
+    for (method = 0; method < STREAM_METHODS; method++)
+    {
+        if (StreamBufferSizes[method] != 0 && OS_StreamFlushAll() == OS_FS_UNIMPLEMENTED)
+        {
+            UtPrintf("%-16s not available on this host", StreamMethodNames[method]);
+            continue;
+        }
+
+        fd = OS_creat(STREAM_FILE_NAME, OS_READ_WRITE);
+        UtAssert_True(fd >= 0, "create RC=%d", (int)fd);
+        if (fd < 0)
+        {
+            return;
+        }
+
+        OS_GetMonotonicNs(&start);
+        calls = StreamRun(method, fd, &total_bytes);
+        OS_GetMonotonicNs(&end);
+
+        UtAssert_True(StreamCheck(fd), "%s: file matches the records", StreamMethodNames[method]);
+        OS_close(fd);
+
+        elapsed_ns   = (end > start) ? (end - start) : 1;
+        calls_per_mb = (uint32)(((uint64)calls * 1048576) / (total_bytes ? total_bytes : 1));
+        mb_per_sec   = (uint32)((total_bytes * 1000000000 / 1048576) / elapsed_ns);
+
+        UtPrintf("%-16s %u bytes in %u calls, %u calls per MB, %u MB/s", StreamMethodNames[method],
+              (unsigned int)total_bytes, (unsigned int)calls, (unsigned int)calls_per_mb,
+              (unsigned int)mb_per_sec);
+        printf("stream-write,%s,%u,%u,%u,%u,%u,%u,%u\n", StreamMethodNames[method],
+              (unsigned int)StreamBufferSizes[method], (unsigned int)StreamFlushMsecs[method],
+              (unsigned int)STREAM_RECORDS, (unsigned int)total_bytes, (unsigned int)calls,
+              (unsigned int)calls_per_mb, (unsigned int)mb_per_sec);
+    }
+}
+
+void TestStreamTeardown(void)
+{
+    int status;
+
+    status = OS_remove(STREAM_FILE_NAME);
+    UtAssert_True(status == OS_SUCCESS, "status after remove = %d",(int)status);
+
+    status = OS_unmount("/drive0");
+    UtAssert_True(status == OS_SUCCESS, "status after unmount = %d",(int)status);
+}
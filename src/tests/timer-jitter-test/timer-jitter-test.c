@@ -0,0 +1,501 @@
+/*
+** timer-jitter-test.c
+**
+** This program is an OSAL sample that measures when timers fire.  It runs
+** OS_TimerCreate timers and time base timers at intervals from 100 usec to
+** 1 sec, optionally next to CPU load tasks, records how late every expiry is
+** into log-linear histograms and reports p50/p99/p99.9/max and missed ticks.
+** Time base timers are quantized to the JITTER_TICK_USEC tick of their time
+** base, so they may also fire up to one tick early; those are counted apart.
+**
+** Last, a set of housekeeping timers with unrelated periods runs once without
+** and once with OS_TimerSetSlack, and the wakeups per second of the timer
+** service thread are compared.
+**
+** The run can be tuned with two environment variables:
+**    TIMER_JITTER_SECONDS  how long each kind of timer runs (default 3)
+**    TIMER_JITTER_LOAD     number of busy tasks loading the CPUs (default 0)
+**
+** Besides the human readable report, one line per timer is printed in CSV form,
+** starting with "timer-jitter,", and one line per slack setting, starting with
+** "timer-wakeups,", so results can be compared across releases.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+
+#define JITTER_TIMERS          5
+#define JITTER_SOURCES         2
+#define JITTER_DEFAULT_SECONDS 3
+#define JITTER_MAX_LOAD        16
+#define JITTER_TICK_USEC       100
+#define JITTER_SLACK_USEC      5000
+
+/*
+** Log-linear histogram, 16 sub-buckets per power of two, so every bucket is
+** within about 6% of the values it holds
+*/
+#define JITTER_SUB_BUCKETS     16
+#define JITTER_BUCKETS         512
+
+#define TASK_1_STACK_SIZE 16384
+#define TASK_1_PRIORITY   101
+#define LOAD_STACK_SIZE   16384
+#define LOAD_PRIORITY     250
+
+typedef struct
+{
+   uint32  interval;
+   int64   expected;
+   uint32  samples;
+   uint32  missed;
+   uint32  early;
+   uint32  max;
+   uint32  histogram[JITTER_BUCKETS];
+} JitterRecord_t;
+
+void TimerJitterSetup(void);
+void TimerJitterTask(void);
+void TimerJitterCheck(void);
+void JitterLoadTask(void);
+
+uint32 TimerJitterTaskStack[TASK_1_STACK_SIZE];
+uint32 JitterLoadStacks[JITTER_MAX_LOAD][LOAD_STACK_SIZE];
+
+const uint32     JitterIntervals[JITTER_TIMERS] = { 100, 1000, 10000, 100000, 1000000 };
+const char      *JitterSourceNames[JITTER_SOURCES] = { "timer", "timebase" };
+const uint32     JitterHousekeeping[JITTER_TIMERS] = { 10000, 10300, 11100, 12700, 13300 };
+
+JitterRecord_t   JitterRecords[JITTER_SOURCES][JITTER_TIMERS];
+uint32           JitterTimerIndex[OS_MAX_TIMERS];
+uint32           JitterTimerCount;
+uint32           JitterSeconds;
+uint32           JitterLoad;
+uint32           JitterTimeBaseRan;
+uint32           JitterCoalesceRan;
+uint32           JitterExpirations[2];
+uint32           JitterWakeups[2];
+volatile uint32  JitterCount;
+volatile uint32  JitterLoadRunning;
+
+static int64 JitterNow(void)
+{
+   uint64 now;
+
+   OS_GetMonotonicNs(&now);
+   return (int64)(now / 1000);
+}
+
+static uint32 JitterBucket(uint32 value)
+{
+   uint32 shift = 0;
+
+   if (value < 2 * JITTER_SUB_BUCKETS)
+   {
+      return value;
+   }
+
+   while ((value >> shift) >= 2 * JITTER_SUB_BUCKETS)
+   {
+      ++shift;
+   }
+
+   return (2 * JITTER_SUB_BUCKETS) + ((shift - 1) * JITTER_SUB_BUCKETS) +
+         ((value >> shift) - JITTER_SUB_BUCKETS);
+}
+
+/*
+** Highest value that lands in the bucket, so percentiles are never flattering
+*/
+static uint32 JitterBucketValue(uint32 bucket)
+{
+   uint32 shift;
+   uint32 sub;
+
+   if (bucket < 2 * JITTER_SUB_BUCKETS)
+   {
+      return bucket;
+   }
+
+   shift = ((bucket - (2 * JITTER_SUB_BUCKETS)) / JITTER_SUB_BUCKETS) + 1;
+   sub = ((bucket - (2 * JITTER_SUB_BUCKETS)) % JITTER_SUB_BUCKETS) + JITTER_SUB_BUCKETS;
+
+   return ((sub + 1) << shift) - 1;
+}
+
+static uint32 JitterPercentile(const JitterRecord_t *rec, uint32 per_mille)
+{
+   uint32 target;
+   uint32 count = 0;
+   uint32 i;
+
+   if (rec->samples == 0)
+   {
+      return 0;
+   }
+
+   target = (uint32)(((uint64)rec->samples * per_mille + 999) / 1000);
+   for (i = 0; i < JITTER_BUCKETS; ++i)
+   {
+      count += rec->histogram[i];
+      if (count >= target)
+      {
+         break;
+      }
+   }
+
+   if (i >= JITTER_BUCKETS)
+   {
+      return rec->max;
+   }
+
+   return (JitterBucketValue(i) < rec->max) ? JitterBucketValue(i) : rec->max;
+}
+
+/*
+** Records one expiry against the schedule of the timer.  An expiry that is
+** more than a whole interval late means the ticks in between were lost.
+*/
+static void JitterRecord(JitterRecord_t *rec)
+{
+   int64  now = JitterNow();
+   int64  late = now - rec->expected;
+   uint32 value;
+   uint32 bucket;
+
+   if (late >= rec->interval)
+   {
+      rec->missed += (uint32)(late / rec->interval);
+      rec->expected += (late / rec->interval) * rec->interval;
+      late = now - rec->expected;
+   }
+
+   if (late < 0)
+   {
+      ++rec->early;
+      late = -late;
+   }
+
+   value = (late > 0x7FFFFFFF) ? 0x7FFFFFFF : (uint32)late;
+   bucket = JitterBucket(value);
+   if (bucket >= JITTER_BUCKETS)
+   {
+      bucket = JITTER_BUCKETS - 1;
+   }
+   ++rec->histogram[bucket];
+   if (value > rec->max)
+   {
+      rec->max = value;
+   }
+
+   ++rec->samples;
+   rec->expected += rec->interval;
+}
+
+void JitterTimerCallback(uint32 timer_id)
+{
+   if (timer_id < OS_MAX_TIMERS)
+   {
+      JitterRecord(&JitterRecords[0][JitterTimerIndex[timer_id]]);
+   }
+}
+
+void JitterTimeBaseCallback(uint32 timer_id, void *arg)
+{
+   JitterRecord(&JitterRecords[1][(uint32)(cpuaddr)arg]);
+}
+
+void JitterCountCallback(uint32 timer_id)
+{
+   ++JitterCount;
+}
+
+/*
+** Runs the housekeeping timers for JitterSeconds with the given slack and
+** counts the expirations and the wakeups of the timer service thread
+*/
+static int32 JitterCoalesce(uint32 slack_usec, uint32 *expirations, uint32 *wakeups)
+{
+   OS_timer_service_stats_t before;
+   OS_timer_service_stats_t after;
+   uint32                   TimerID[JITTER_TIMERS];
+   uint32                   ClockAccuracy;
+   uint32                   count;
+   uint32                   i;
+   char                     Name[OS_MAX_API_NAME];
+   int32                    status = OS_SUCCESS;
+
+   for (count = 0; count < JITTER_TIMERS && count < OS_MAX_TIMERS && status == OS_SUCCESS; count++)
+   {
+      snprintf(Name, sizeof(Name), "HOUSEKEEP%u", (unsigned int)count);
+      status = OS_TimerCreate(&TimerID[count], Name, &ClockAccuracy, JitterCountCallback);
+      if (status != OS_SUCCESS)
+      {
+         break;
+      }
+      status = OS_TimerSetSlack(TimerID[count], slack_usec);
+   }
+
+   if (status == OS_SUCCESS)
+   {
+      status = OS_TimerGetServiceStats(&before);
+   }
+
+   if (status == OS_SUCCESS)
+   {
+      JitterCount = 0;
+      for (i = 0; i < count; i++)
+      {
+         OS_TimerSet(TimerID[i], JitterHousekeeping[i], JitterHousekeeping[i]);
+      }
+      OS_TaskDelay(JitterSeconds * 1000);
+      for (i = 0; i < count; i++)
+      {
+         OS_TimerSet(TimerID[i], 0, 0);
+      }
+      status = OS_TimerGetServiceStats(&after);
+      *expirations = JitterCount;
+      *wakeups = after.wakeups - before.wakeups;
+   }
+
+   for (i = 0; i < count; i++)
+   {
+      OS_TimerDelete(TimerID[i]);
+   }
+
+   return status;
+}
+
+void JitterLoadTask(void)
+{
+   volatile uint32 spin = 0;
+
+   OS_TaskRegister();
+
+   while (JitterLoadRunning)
+   {
+      ++spin;
+   }
+
+   OS_TaskExit();
+}
+
+static uint32 JitterEnv(const char *name, uint32 def, uint32 max)
+{
+   const char *value = getenv(name);
+   uint32      result = def;
+
+   if (value != NULL && *value != 0)
+   {
+      result = (uint32)strtoul(value, NULL, 0);
+   }
+
+   return (result > max) ? max : result;
+}
+
+
+/* ********************** MAIN **************************** */
+
+void OS_Application_Startup(void)
+{
+
+  if (OS_API_Init() != OS_SUCCESS)
+  {
+      UtAssert_Abort("OS_API_Init() failed");
+  }
+
+  UtTest_Add(TimerJitterCheck, TimerJitterSetup, NULL, "TimerJitterTest");
+}
+
+void TimerJitterSetup(void)
+{
+    int32  status;
+    uint32 TimerJitterTaskId;
+
+    status = OS_TaskCreate( &TimerJitterTaskId, "Task 1", TimerJitterTask, TimerJitterTaskStack, sizeof(TimerJitterTaskStack), TASK_1_PRIORITY, 0);
+    UtAssert_True(status == OS_SUCCESS, "Timer Jitter Task Created RC=%d", (int)status);
+
+    /*
+     * OS_IdleLoop() returns once TimerJitterTask calls OS_ApplicationShutdown
+     */
+    OS_IdleLoop();
+}
+
+void TimerJitterTask(void)
+{
+   uint32           i;
+   int32            status;
+   uint32           TimerID[JITTER_TIMERS];
+   uint32           LoadID;
+   uint32           TimeBaseId;
+   uint32           ClockAccuracy;
+   char             Name[OS_MAX_API_NAME];
+   int64            now;
+
+   JitterSeconds = JitterEnv("TIMER_JITTER_SECONDS", JITTER_DEFAULT_SECONDS, 3600);
+   if (JitterSeconds == 0)
+   {
+      JitterSeconds = 1;
+   }
+   JitterLoad = JitterEnv("TIMER_JITTER_LOAD", 0, JITTER_MAX_LOAD);
+   UtPrintf("Running each kind of timer for %u sec with %u load tasks\n",
+         (unsigned int)JitterSeconds, (unsigned int)JitterLoad);
+
+   memset(JitterRecords, 0, sizeof(JitterRecords));
+   for (i = 0; i < JITTER_TIMERS; i++)
+   {
+      JitterRecords[0][i].interval = JitterIntervals[i];
+      JitterRecords[1][i].interval = JitterIntervals[i];
+   }
+
+   JitterLoadRunning = TRUE;
+   for (i = 0; i < JitterLoad; i++)
+   {
+      snprintf(Name, sizeof(Name), "LOAD%u", (unsigned int)i);
+      status = OS_TaskCreate(&LoadID, Name, JitterLoadTask, JitterLoadStacks[i], sizeof(JitterLoadStacks[i]), LOAD_PRIORITY, 0);
+      UtAssert_True(status == OS_SUCCESS, "Load task %u created RC=%d", (unsigned int)i, (int)status);
+   }
+
+   /*
+   ** Timers from OS_TimerCreate
+   */
+   JitterTimerCount = 0;
+   for (i = 0; i < JITTER_TIMERS && i < OS_MAX_TIMERS; i++)
+   {
+      snprintf(Name, sizeof(Name), "JITTER%u", (unsigned int)i);
+      status = OS_TimerCreate(&TimerID[i], Name, &ClockAccuracy, JitterTimerCallback);
+      UtAssert_True(status == OS_SUCCESS, "Timer %u created RC=%d", (unsigned int)i, (int)status);
+      if (status != OS_SUCCESS)
+      {
+         break;
+      }
+      JitterTimerIndex[TimerID[i]] = i;
+   }
+   JitterTimerCount = i;
+
+   now = JitterNow();
+   for (i = 0; i < JitterTimerCount; i++)
+   {
+      JitterRecords[0][i].expected = now + JitterIntervals[i];
+      OS_TimerSet(TimerID[i], JitterIntervals[i], JitterIntervals[i]);
+   }
+   OS_TaskDelay(JitterSeconds * 1000);
+   for (i = 0; i < JitterTimerCount; i++)
+   {
+      OS_TimerDelete(TimerID[i]);
+   }
+
+   /*
+   ** Timers on a time base
+   */
+   status = OS_TimeBaseCreate(&TimeBaseId, "TB_JITTER", NULL);
+   if (status == OS_SUCCESS)
+   {
+      for (i = 0; i < JITTER_TIMERS; i++)
+      {
+         snprintf(Name, sizeof(Name), "TBJITTER%u", (unsigned int)i);
+         status = OS_TimerAdd(&TimerID[i], Name, TimeBaseId, JitterTimeBaseCallback, (void *)(cpuaddr)i);
+         UtAssert_True(status == OS_SUCCESS, "Time base timer %u added RC=%d", (unsigned int)i, (int)status);
+      }
+
+      OS_TimeBaseSet(TimeBaseId, JITTER_TICK_USEC, JITTER_TICK_USEC);
+      now = JitterNow();
+      for (i = 0; i < JITTER_TIMERS; i++)
+      {
+         JitterRecords[1][i].expected = now + JitterIntervals[i];
+         OS_TimerSet(TimerID[i], JitterIntervals[i], JitterIntervals[i]);
+      }
+      OS_TaskDelay(JitterSeconds * 1000);
+      OS_TimeBaseDelete(TimeBaseId);
+      JitterTimeBaseRan = TRUE;
+   }
+   else
+   {
+      UtPrintf("Time bases are not available RC=%d\n", (int)status);
+   }
+
+   /*
+   ** Housekeeping timers without and with slack
+   */
+   status = JitterCoalesce(0, &JitterExpirations[0], &JitterWakeups[0]);
+   if (status == OS_SUCCESS)
+   {
+      status = JitterCoalesce(JITTER_SLACK_USEC, &JitterExpirations[1], &JitterWakeups[1]);
+   }
+   if (status == OS_SUCCESS)
+   {
+      JitterCoalesceRan = TRUE;
+   }
+   else
+   {
+      UtPrintf("Timer slack is not available RC=%d\n", (int)status);
+   }
+
+   JitterLoadRunning = FALSE;
+
+   OS_ApplicationShutdown(TRUE);
+   OS_TaskExit();
+}
+
+void TimerJitterCheck(void)
+{
+   uint32          s;
+   uint32          i;
+   JitterRecord_t *rec;
+
+   UtPrintf("%-9s %10s %8s %7s %7s %8s %8s %8s %8s\n", "source", "interval", "samples", "missed",
+         "early", "p50", "p99", "p99.9", "max");
+
+   printf("timer-jitter,source,interval_usec,load_tasks,samples,missed,early,p50_usec,p99_usec,p999_usec,max_usec\n");
+
+   for (s = 0; s < JITTER_SOURCES; s++)
+   {
+      for (i = 0; i < JITTER_TIMERS; i++)
+      {
+         rec = &JitterRecords[s][i];
+         if ((s == 0 && i >= JitterTimerCount) || (s == 1 && !JitterTimeBaseRan))
+         {
+            continue;
+         }
+
+         UtAssert_True(rec->samples > 0, "%s %u usec fired", JitterSourceNames[s], (unsigned int)rec->interval);
+
+         UtPrintf("%-9s %10u %8u %7u %7u %8u %8u %8u %8u\n", JitterSourceNames[s],
+               (unsigned int)rec->interval, (unsigned int)rec->samples, (unsigned int)rec->missed,
+               (unsigned int)rec->early, (unsigned int)JitterPercentile(rec, 500),
+               (unsigned int)JitterPercentile(rec, 990), (unsigned int)JitterPercentile(rec, 999),
+               (unsigned int)rec->max);
+
+         printf("timer-jitter,%s,%u,%u,%u,%u,%u,%u,%u,%u,%u\n", JitterSourceNames[s],
+               (unsigned int)rec->interval, (unsigned int)JitterLoad, (unsigned int)rec->samples,
+               (unsigned int)rec->missed, (unsigned int)rec->early, (unsigned int)JitterPercentile(rec, 500),
+               (unsigned int)JitterPercentile(rec, 990), (unsigned int)JitterPercentile(rec, 999),
+               (unsigned int)rec->max);
+      }
+   }
+
+   if (JitterCoalesceRan == TRUE)
+   {
+      UtAssert_True(JitterWakeups[1] < JitterWakeups[0], "Slack of %u usec saves wakeups",
+            (unsigned int)JITTER_SLACK_USEC);
+
+      printf("timer-wakeups,slack_usec,timers,expirations_per_sec,wakeups_per_sec\n");
+      for (s = 0; s < 2; s++)
+      {
+         i = (s == 0) ? 0 : JITTER_SLACK_USEC;
+         UtPrintf("Housekeeping timers with %u usec slack: %u expirations/s, %u wakeups/s\n",
+               (unsigned int)i, (unsigned int)(JitterExpirations[s] / JitterSeconds),
+               (unsigned int)(JitterWakeups[s] / JitterSeconds));
+         printf("timer-wakeups,%u,%u,%u,%u\n", (unsigned int)i,
+               (unsigned int)((JITTER_TIMERS < OS_MAX_TIMERS) ? JITTER_TIMERS : OS_MAX_TIMERS),
+               (unsigned int)(JitterExpirations[s] / JitterSeconds), (unsigned int)(JitterWakeups[s] / JitterSeconds));
+      }
+   }
+}
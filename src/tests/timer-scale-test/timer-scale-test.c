@@ -0,0 +1,239 @@
+/*
+** timer-scale-test.c
+**
+** This program is an OSAL sample that measures the cost of software timers
+** added to a time base.  It arms and cancels 100k timers, then lets thousands
+** of one shot timers expire and reports the per-tick dispatch cost and the
+** expiry jitter.
+**
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+
+#define SCALE_TIMERS        4000
+#define SCALE_ARM_CANCEL    100000
+#define SCALE_TICK_MSEC     1
+#define SCALE_SPREAD_USEC   1000000
+
+#define TASK_1_STACK_SIZE 16384
+#define TASK_1_PRIORITY   101
+
+void TimerScaleSetup(void);
+void TimerScaleTask(void);
+void TimerScaleCheck(void);
+
+uint32 TimerScaleTaskStack[TASK_1_STACK_SIZE];
+
+uint32           ScaleTimerCount;
+uint32           ScaleTimerId[SCALE_TIMERS];
+int64            ScaleExpected[SCALE_TIMERS];
+int32            ScaleJitter[SCALE_TIMERS];
+volatile uint32  ScaleFired;
+volatile uint32  ScaleRunning;
+
+uint32           ScaleArmCancelUsec;
+uint32           ScaleTicks;
+uint32           ScaleIdleTicks;
+int64            ScaleTickUsecTotal;
+int64            ScaleIdleTickUsecTotal;
+int32            ScaleTickUsecMax;
+
+int64            ScaleLastTick;
+int64            ScaleTickStart;
+uint32           ScaleTickFired;
+
+static int64 ScaleNow(void)
+{
+   uint64 now;
+
+   OS_GetMonotonicNs(&now);
+   return (int64)(now / 1000);
+}
+
+static int ScaleCompare(const void *a, const void *b)
+{
+   return (*(const int32 *)a > *(const int32 *)b) - (*(const int32 *)a < *(const int32 *)b);
+}
+
+/*
+** Time base sync function.  Each call closes the dispatch of the previous tick,
+** waits for the next one and returns the real time that elapsed, so the time
+** base follows the wall clock and expiry jitter is measured against it.
+*/
+int32 ScaleSync(uint32 timebase_id)
+{
+   int64 now = ScaleNow();
+   int32 cost;
+   int32 elapsed;
+
+   if (ScaleTickStart != 0)
+   {
+      cost = (int32)(now - ScaleTickStart);
+      ++ScaleTicks;
+      ScaleTickUsecTotal += cost;
+      if (cost > ScaleTickUsecMax)
+      {
+         ScaleTickUsecMax = cost;
+      }
+      if (ScaleTickFired == ScaleFired)
+      {
+         ++ScaleIdleTicks;
+         ScaleIdleTickUsecTotal += cost;
+      }
+   }
+
+   OS_TaskDelay(SCALE_TICK_MSEC);
+
+   now = ScaleNow();
+   elapsed = 0;
+   if (ScaleRunning == TRUE && ScaleLastTick != 0)
+   {
+      elapsed = (int32)(now - ScaleLastTick);
+   }
+   ScaleLastTick = (ScaleRunning == TRUE) ? now : 0;
+   ScaleTickStart = (elapsed > 0) ? now : 0;
+   ScaleTickFired = ScaleFired;
+
+   return elapsed;
+}
+
+void ScaleCallback(uint32 timer_id, void *arg)
+{
+   uint32 idx = (uint32)(cpuaddr)arg;
+
+   ScaleJitter[idx] = (int32)(ScaleNow() - ScaleExpected[idx]);
+   ++ScaleFired;
+}
+
+
+/* ********************** MAIN **************************** */
+
+void OS_Application_Startup(void)
+{
+
+  if (OS_API_Init() != OS_SUCCESS)
+  {
+      UtAssert_Abort("OS_API_Init() failed");
+  }
+
+  UtTest_Add(TimerScaleCheck, TimerScaleSetup, NULL, "TimerScaleTest");
+}
+
+void TimerScaleSetup(void)
+{
+    int32  status;
+    uint32 TimerScaleTaskId;
+
+    status = OS_TaskCreate( &TimerScaleTaskId, "Task 1", TimerScaleTask, TimerScaleTaskStack, sizeof(TimerScaleTaskStack), TASK_1_PRIORITY, 0);
+    UtAssert_True(status == OS_SUCCESS, "Timer Scale Task Created RC=%d", (int)status);
+
+    /*
+     * OS_IdleLoop() returns once TimerScaleTask calls OS_ApplicationShutdown
+     */
+    OS_IdleLoop();
+}
+
+void TimerScaleTask(void)
+{
+   uint32           i;
+   uint32           k;
+   int32            status;
+   uint32           TimeBaseId;
+   char             TimerName[OS_MAX_API_NAME];
+   int64            start;
+   int64            now;
+
+   status = OS_TimeBaseCreate(&TimeBaseId, "TB_SCALE", ScaleSync);
+   UtAssert_True(status == OS_SUCCESS, "Time base created RC=%d", (int)status);
+
+   for ( i = 0; i < SCALE_TIMERS; i++ )
+   {
+      snprintf(TimerName, sizeof(TimerName), "SCALE%u", (unsigned int)i);
+      if (OS_TimerAdd(&ScaleTimerId[i], TimerName, TimeBaseId, ScaleCallback, (void *)(cpuaddr)i) != OS_SUCCESS)
+      {
+         break;
+      }
+   }
+   ScaleTimerCount = i;
+   UtPrintf("Added %u timers to the time base\n", (unsigned int)ScaleTimerCount);
+   UtAssert_True(ScaleTimerCount > OS_MAX_TIMERS, "More timers than OS_MAX_TIMERS added");
+
+   if (ScaleTimerCount > 0)
+   {
+      /*
+      ** Arm everything once so the cancel/arm pairs below run against a full heap
+      */
+      for ( i = 0; i < ScaleTimerCount; i++ )
+      {
+         OS_TimerSet(ScaleTimerId[i], 10000000 + (i * 7919) % SCALE_SPREAD_USEC, 0);
+      }
+
+      start = ScaleNow();
+      for ( k = 0; k < SCALE_ARM_CANCEL; k++ )
+      {
+         i = (k * 7919) % ScaleTimerCount;
+         OS_TimerSet(ScaleTimerId[i], 0, 0);
+         OS_TimerSet(ScaleTimerId[i], 10000000 + (k * 104729) % SCALE_SPREAD_USEC, 0);
+      }
+      ScaleArmCancelUsec = (uint32)(ScaleNow() - start);
+      UtPrintf("%u cancel+arm pairs on %u armed timers: %u usec, %u nsec per pair\n",
+            (unsigned int)SCALE_ARM_CANCEL, (unsigned int)ScaleTimerCount, (unsigned int)ScaleArmCancelUsec,
+            (unsigned int)(((uint64)ScaleArmCancelUsec * 1000) / SCALE_ARM_CANCEL));
+
+      /*
+      ** Now spread one shot expiries over SCALE_SPREAD_USEC and let them run
+      */
+      ScaleRunning = TRUE;
+      OS_TaskDelay(20);
+      now = ScaleNow();
+      for ( i = 0; i < ScaleTimerCount; i++ )
+      {
+         ScaleExpected[i] = now + 10000 + (i * 7919) % SCALE_SPREAD_USEC;
+         OS_TimerSet(ScaleTimerId[i], (uint32)(ScaleExpected[i] - now), 0);
+      }
+
+      for ( i = 0; i < 20 && ScaleFired < ScaleTimerCount; i++ )
+      {
+         OS_TaskDelay(100);
+      }
+      ScaleRunning = FALSE;
+   }
+
+   status = OS_TimeBaseDelete(TimeBaseId);
+   UtAssert_True(status == OS_SUCCESS, "Time base deleted RC=%d", (int)status);
+
+   OS_ApplicationShutdown(TRUE);
+   OS_TaskExit();
+}
+
+void TimerScaleCheck(void)
+{
+   uint32 n = ScaleFired;
+
+   UtAssert_True(n == ScaleTimerCount, "All %u timers expired (%u)", (unsigned int)ScaleTimerCount, (unsigned int)n);
+
+   if (ScaleTicks > 0)
+   {
+      UtPrintf("Ticks: %u, dispatch cost avg %u usec, max %d usec\n", (unsigned int)ScaleTicks,
+            (unsigned int)(ScaleTickUsecTotal / ScaleTicks), (int)ScaleTickUsecMax);
+   }
+   if (ScaleIdleTicks > 0)
+   {
+      UtPrintf("Ticks without expiry: %u, dispatch cost avg %u usec\n", (unsigned int)ScaleIdleTicks,
+            (unsigned int)(ScaleIdleTickUsecTotal / ScaleIdleTicks));
+   }
+
+   if (n > 0 && n <= SCALE_TIMERS)
+   {
+      qsort(ScaleJitter, n, sizeof(ScaleJitter[0]), ScaleCompare);
+      UtPrintf("Expiry jitter usec: min %d p50 %d p99 %d max %d\n", (int)ScaleJitter[0],
+            (int)ScaleJitter[n / 2], (int)ScaleJitter[(n * 99) / 100], (int)ScaleJitter[n - 1]);
+   }
+}
@@ -0,0 +1,159 @@
+/*
+** translate-path-test.c
+**
+** This program is an OSAL sample that measures OS_TranslatePath, which every
+** file API call goes through to turn a virtual path into a host path.  Paths
+** are translated with one volume mounted and with six, for a short and a deep
+** path on the last mount point, and for a path that matches no mount point.
+**
+** Besides the human readable report, one line per case is printed in CSV form,
+** starting with "translate-path,", so results can be compared across releases.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+
+#define TRANSLATE_CALLS      1000000
+#define TRANSLATE_VOLUMES    6
+#define TRANSLATE_CASES      3
+#define TRANSLATE_RUNS       2
+
+void TestTranslateSetup(void);
+void TestTranslatePath(void);
+void TestTranslateTeardown(void);
+
+const char   *TranslateCaseNames[TRANSLATE_CASES]   = { "short", "deep", "miss" };
+const uint32  TranslateVolumeCounts[TRANSLATE_RUNS] = { 1, TRANSLATE_VOLUMES };
+
+char         TranslateDevNames[TRANSLATE_VOLUMES][16];
+char         TranslateMountPoints[TRANSLATE_VOLUMES][16];
+uint32       TranslateMounted;
+
+/*
+** Translates path TRANSLATE_CALLS times, and returns the translations per second
+*/
+static uint32 TranslateRun(const char *path, int32 expected)
+{
+   char   local_path[OS_MAX_LOCAL_PATH_LEN];
+   uint64 start;
+   uint64 end;
+   uint32 failed = 0;
+   uint32 i;
+
+   OS_GetMonotonicNs(&start);
+   for (i = 0; i < TRANSLATE_CALLS; i++)
+   {
+      if (OS_TranslatePath(path, local_path) != expected)
+      {
+         ++failed;
+      }
+   }
+   OS_GetMonotonicNs(&end);
+
+   UtAssert_True(failed == 0, "%s: %u of %u translations failed", path, (unsigned int)failed,
+         (unsigned int)TRANSLATE_CALLS);
+
+   return (uint32)(((uint64)TRANSLATE_CALLS * 1000000000) / ((end > start) ? (end - start) : 1));
+}
+
+static void TranslateReport(uint32 volumes, uint32 path_case, const char *path, int32 expected)
+{
+   uint32 rate = TranslateRun(path, expected);
+
+   UtPrintf("%u volumes, %-5s path: %u.%03u M translations per second", (unsigned int)volumes,
+         TranslateCaseNames[path_case], (unsigned int)(rate / 1000000), (unsigned int)((rate % 1000000) / 1000));
+   printf("translate-path,%u,%s,%u,%u\n", (unsigned int)volumes, TranslateCaseNames[path_case],
+         (unsigned int)TRANSLATE_CALLS, (unsigned int)rate);
+}
+
+
+/* *************************************** MAIN ************************************** */
+
+void OS_Application_Startup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    UtTest_Add(TestTranslateSetup, NULL, NULL, "TestTranslateSetup");
+    UtTest_Add(TestTranslatePath, NULL, NULL, "TestTranslatePath");
+    UtTest_Add(TestTranslateTeardown, NULL, NULL, "TestTranslateTeardown");
+}
+
+void TestTranslateSetup(void)
+{
+    int    status;
+    uint32 i;
+
+    for (i = 0; i < TRANSLATE_VOLUMES; i++)
+    {
+        snprintf(TranslateDevNames[i], sizeof(TranslateDevNames[i]), "/ramdev%u", (unsigned int)i);
+        snprintf(TranslateMountPoints[i], sizeof(TranslateMountPoints[i]), "/drive%u", (unsigned int)i);
+
+        status = OS_mkfs(0, TranslateDevNames[i], "RAM", 512, 200);
+        UtAssert_True(status == OS_SUCCESS, "status after mkfs %s = %d", TranslateDevNames[i], (int)status);
+    }
+}
+
+void TestTranslatePath(void)
+{
+    char   short_path[OS_MAX_PATH_LEN];
+    char   deep_path[OS_MAX_PATH_LEN];
+    uint32 run;
+    int    status;
+
+    printf("translate-path,volumes,path,calls,per_sec\n");
+
+    for (run = 0; run < TRANSLATE_RUNS; run++)
+    {
+        while (TranslateMounted < TranslateVolumeCounts[run])
+        {
+            status = OS_mount(TranslateDevNames[TranslateMounted], TranslateMountPoints[TranslateMounted]);
+            UtAssert_True(status == OS_SUCCESS, "status after mount %s = %d",
+                  TranslateMountPoints[TranslateMounted], (int)status);
+            if (status != OS_SUCCESS)
+            {
+                return;
+            }
+            ++TranslateMounted;
+        }
+
+        /*
+        ** The last volume mounted is used
+        */
+        snprintf(short_path, sizeof(short_path), "%s/file.dat", TranslateMountPoints[TranslateMounted - 1]);
+        snprintf(deep_path, sizeof(deep_path), "%s/a/b/c/d/e/f/g/h/file.dat",
+              TranslateMountPoints[TranslateMounted - 1]);
+
+        TranslateReport(TranslateMounted, 0, short_path, OS_FS_SUCCESS);
+        TranslateReport(TranslateMounted, 1, deep_path, OS_FS_SUCCESS);
+        TranslateReport(TranslateMounted, 2, "/nodrive/file.dat", OS_FS_ERR_PATH_INVALID);
+    }
+}
+
+void TestTranslateTeardown(void)
+{
+    int    status;
+    uint32 i;
+
+    for (i = 0; i < TranslateMounted; i++)
+    {
+        status = OS_unmount(TranslateMountPoints[i]);
+        UtAssert_True(status == OS_SUCCESS, "status after unmount %s = %d", TranslateMountPoints[i], (int)status);
+    }
+
+    for (i = 0; i < TRANSLATE_VOLUMES; i++)
+    {
+        status = OS_rmfs(TranslateDevNames[i]);
+        UtAssert_True(status == OS_SUCCESS, "status after rmfs %s = %d", TranslateDevNames[i], (int)status);
+    }
+}
@@ -0,0 +1,749 @@
+/*================================================================================*
+** File:  ut_oscore_fiber_test.c
+**================================================================================*/
+
+/*--------------------------------------------------------------------------------*
+** Includes
+**--------------------------------------------------------------------------------*/
+
+#include "ut_oscore_fiber_test.h"
+
+/*--------------------------------------------------------------------------------*
+** Macros
+**--------------------------------------------------------------------------------*/
+
+#define UT_FIBER_SCHED_WORKERS     2
+#define UT_FIBER_SCHED_PRIORITY  150
+#define UT_FIBER_COUNT           256     /* well beyond OS_MAX_TASKS */
+#define UT_FIBER_ROUNDS         1000
+#define UT_FIBER_MESSAGES        100
+
+/*--------------------------------------------------------------------------------*
+** Data types
+**--------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*
+** External global variables
+**--------------------------------------------------------------------------------*/
+
+extern UT_OsLogInfo_t g_logInfo;
+
+/*--------------------------------------------------------------------------------*
+** Global variables
+**--------------------------------------------------------------------------------*/
+
+uint32 g_fiber_count = 0;
+uint32 g_fiber_ids[2];
+uint32 g_fiber_self_ids[2];
+uint32 g_fiber_sem_ids[2];
+uint32 g_fiber_queue_id = 0;
+int32  g_fiber_result = 0;
+uint32 g_fiber_spins = 0;
+uint32 g_fiber_elapsed_usec = 0;
+uint32 g_fiber_messages[UT_FIBER_MESSAGES];
+
+/*--------------------------------------------------------------------------------*
+** Local function prototypes
+**--------------------------------------------------------------------------------*/
+
+void UT_os_fiber_wait_count(uint32 count);
+void UT_os_fiber_counter(void *arg);
+void UT_os_fiber_get_id(void *arg);
+void UT_os_fiber_sleeper(void *arg);
+void UT_os_fiber_spinner(void *arg);
+void UT_os_fiber_ping(void *arg);
+void UT_os_fiber_taker(void *arg);
+void UT_os_fiber_producer(void *arg);
+void UT_os_fiber_consumer(void *arg);
+void UT_os_fiber_timed_getter(void *arg);
+
+/*--------------------------------------------------------------------------------*
+** Local function definitions
+**--------------------------------------------------------------------------------*/
+
+/* Waits up to two seconds for g_fiber_count to reach count */
+void UT_os_fiber_wait_count(uint32 count)
+{
+    uint32 i;
+
+    for (i = 0; i < 200 && __atomic_load_n(&g_fiber_count, __ATOMIC_ACQUIRE) < count; i++)
+    {
+        OS_TaskDelay(10);
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+
+void UT_os_fiber_counter(void *arg)
+{
+    OS_FiberYield();
+    __atomic_add_fetch(&g_fiber_count, 1, __ATOMIC_RELEASE);
+}
+
+/*--------------------------------------------------------------------------------*/
+
+void UT_os_fiber_get_id(void *arg)
+{
+    OS_FiberGetId((uint32 *)arg);
+    __atomic_add_fetch(&g_fiber_count, 1, __ATOMIC_RELEASE);
+}
+
+/*--------------------------------------------------------------------------------*/
+
+void UT_os_fiber_sleeper(void *arg)
+{
+    uint64 start_time;
+    uint64 end_time;
+
+    OS_GetMonotonicNs(&start_time);
+    OS_FiberDelay(50);
+    OS_GetMonotonicNs(&end_time);
+
+    g_fiber_elapsed_usec = (uint32)((end_time - start_time) / 1000);
+    __atomic_add_fetch(&g_fiber_count, 1, __ATOMIC_RELEASE);
+}
+
+/*--------------------------------------------------------------------------------*/
+
+/* Keeps yielding until the sleeper is done, shows that the worker was not blocked */
+void UT_os_fiber_spinner(void *arg)
+{
+    while (__atomic_load_n(&g_fiber_count, __ATOMIC_ACQUIRE) == 0)
+    {
+        g_fiber_spins++;
+        OS_FiberYield();
+    }
+    __atomic_add_fetch(&g_fiber_count, 1, __ATOMIC_RELEASE);
+}
+
+/*--------------------------------------------------------------------------------*/
+
+/* Takes its own semaphore and gives the other one, UT_FIBER_ROUNDS times */
+void UT_os_fiber_ping(void *arg)
+{
+    uint32 self = (uint32)(cpuaddr)arg;
+    uint32 i;
+
+    for (i = 0; i < UT_FIBER_ROUNDS; i++)
+    {
+        if (OS_FiberSemTake(g_fiber_sem_ids[self]) != OS_SUCCESS)
+        {
+            break;
+        }
+        OS_FiberSemGive(g_fiber_sem_ids[1 - self]);
+    }
+    __atomic_add_fetch(&g_fiber_count, 1, __ATOMIC_RELEASE);
+}
+
+/*--------------------------------------------------------------------------------*/
+
+void UT_os_fiber_taker(void *arg)
+{
+    g_fiber_result = OS_FiberSemTake(g_fiber_sem_ids[0]);
+    __atomic_add_fetch(&g_fiber_count, 1, __ATOMIC_RELEASE);
+}
+
+/*--------------------------------------------------------------------------------*/
+
+void UT_os_fiber_producer(void *arg)
+{
+    uint32 i;
+
+    for (i = 0; i < UT_FIBER_MESSAGES; i++)
+    {
+        while (OS_FiberQueuePut(g_fiber_queue_id, &i, sizeof(i)) == OS_QUEUE_FULL)
+        {
+            OS_FiberYield();
+        }
+    }
+    __atomic_add_fetch(&g_fiber_count, 1, __ATOMIC_RELEASE);
+}
+
+/*--------------------------------------------------------------------------------*/
+
+void UT_os_fiber_consumer(void *arg)
+{
+    uint32 i;
+    uint32 size_copied;
+
+    for (i = 0; i < UT_FIBER_MESSAGES; i++)
+    {
+        if (OS_FiberQueueGet(g_fiber_queue_id, &g_fiber_messages[i], sizeof(uint32),
+                             &size_copied, OS_PEND) != OS_SUCCESS)
+        {
+            break;
+        }
+    }
+    __atomic_add_fetch(&g_fiber_count, 1, __ATOMIC_RELEASE);
+}
+
+/*--------------------------------------------------------------------------------*/
+
+void UT_os_fiber_timed_getter(void *arg)
+{
+    uint32 data;
+    uint32 size_copied;
+
+    g_fiber_result = OS_FiberQueueGet(g_fiber_queue_id, &data, sizeof(data), &size_copied, 20);
+    __atomic_add_fetch(&g_fiber_count, 1, __ATOMIC_RELEASE);
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_FiberSchedCreate
+** Purpose: Creates a fiber scheduler and its worker tasks
+** Parameters: To-be-filled-in
+** Returns: OS_INVALID_POINTER if any of the pointers passed in is null
+**          OS_ERR_NAME_TOO_LONG if the name passed in is too long
+**          OS_ERR_INVALID_PRIORITY if the priority passed in is bad
+**          OS_ERR_NAME_TAKEN if the name passed in has already been used
+**          OS_ERROR if the number of workers is bad or the OS call failed
+**          OS_SUCCESS if succeeded
+**          (OS_TaskDelete returns OS_ERR_INVALID_ID for the scheduler's worker tasks)
+**--------------------------------------------------------------------------------*/
+void UT_os_fiber_sched_create_test()
+{
+    UT_OsApiInfo_t apiInfo;
+    int32 res = 0, idx = 0;
+    const char* testDesc = NULL;
+    uint32 sched_id;
+    uint32 sched_id2;
+    uint32 task_id;
+    char   long_sched_name[OS_MAX_API_NAME];
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_FiberSchedCreate(&sched_id, "FiberS", 1, UT_FIBER_SCHED_PRIORITY, 0);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_fiber_sched_create_test_exit_tag;
+    }
+
+    /* Clean up */
+    res = OS_FiberSchedDelete(sched_id);
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg-1";
+
+    res = OS_FiberSchedCreate(NULL, "FiberS", 1, UT_FIBER_SCHED_PRIORITY, 0);
+    if (res == OS_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Null-pointer-arg-2";
+
+    res = OS_FiberSchedCreate(&sched_id, NULL, 1, UT_FIBER_SCHED_PRIORITY, 0);
+    if (res == OS_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Name-too-long";
+
+    /* must leave room for the worker task suffix */
+    memset(long_sched_name, 'X', sizeof(long_sched_name));
+    long_sched_name[sizeof(long_sched_name)-3] = '\0';
+    res = OS_FiberSchedCreate(&sched_id, long_sched_name, 1, UT_FIBER_SCHED_PRIORITY, 0);
+    if (res == OS_ERR_NAME_TOO_LONG)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Invalid-priority";
+
+    res = OS_FiberSchedCreate(&sched_id, "FiberS", 1, 256, 0);
+    if (res == OS_ERR_INVALID_PRIORITY)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Invalid-worker-count";
+
+    res = OS_FiberSchedCreate(&sched_id, "FiberS", 0, UT_FIBER_SCHED_PRIORITY, 0);
+    if (res == OS_ERROR)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#6 Duplicate-name";
+
+    res = OS_FiberSchedCreate(&sched_id, "FiberS", 1, UT_FIBER_SCHED_PRIORITY, 0);
+    if (res != OS_SUCCESS)
+    {
+        testDesc = "#6 Duplicate-name - Fiber-Sched-Create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        res = OS_FiberSchedCreate(&sched_id2, "FiberS", 1, UT_FIBER_SCHED_PRIORITY, 0);
+        if (res == OS_ERR_NAME_TAKEN)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Reset test environment */
+        res = OS_FiberSchedDelete(sched_id);
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#7 Nominal";
+
+    /* The workers must show up in the task table, and leave it on delete */
+    res = OS_FiberSchedCreate(&sched_id, "FiberS", UT_FIBER_SCHED_WORKERS,
+                              UT_FIBER_SCHED_PRIORITY, 0);
+    if (res == OS_SUCCESS && OS_TaskGetIdByName(&task_id, "FiberS.1") == OS_SUCCESS &&
+        OS_FiberSchedDelete(sched_id) == OS_SUCCESS &&
+        OS_TaskGetIdByName(&task_id, "FiberS.1") == OS_ERR_NAME_NOT_FOUND)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#8 Worker-task-delete";
+
+    /* The workers can only be stopped by deleting the scheduler */
+    res = OS_FiberSchedCreate(&sched_id, "FiberS", UT_FIBER_SCHED_WORKERS,
+                              UT_FIBER_SCHED_PRIORITY, 0);
+    if (res != OS_SUCCESS || OS_TaskGetIdByName(&task_id, "FiberS.0") != OS_SUCCESS)
+    {
+        testDesc = "#8 Worker-task-delete - Fiber-Sched-Create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        if (res == OS_SUCCESS)
+            OS_FiberSchedDelete(sched_id);
+    }
+    else
+    {
+        if (OS_TaskDelete(task_id) == OS_ERR_INVALID_ID &&
+            OS_FiberSchedDelete(sched_id) == OS_SUCCESS &&
+            OS_TaskGetIdByName(&task_id, "FiberS.0") == OS_ERR_NAME_NOT_FOUND)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+UT_os_fiber_sched_create_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_FiberSchedCreate", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_FiberCreate
+** Purpose: Creates a fiber on a fiber scheduler
+** Parameters: To-be-filled-in
+** Returns: OS_INVALID_POINTER if any of the pointers passed in is null
+**          OS_ERR_INVALID_ID if the scheduler id passed in is not valid
+**          OS_ERR_NO_FREE_IDS if the fiber table is full
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_fiber_create_test()
+{
+    UT_OsApiInfo_t apiInfo;
+    int32 res = 0, idx = 0;
+    const char* testDesc = NULL;
+    OS_fiber_sched_prop_t sched_prop;
+    uint32 sched_id;
+    uint32 fiber_id;
+    uint32 created;
+    uint32 i;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_FiberCreate(&fiber_id, 99999, UT_os_fiber_counter, NULL, 0) == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_fiber_create_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Invalid-ID-arg";
+
+    if (OS_FiberCreate(&fiber_id, 99999, UT_os_fiber_counter, NULL, 0) == OS_ERR_INVALID_ID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    res = OS_FiberSchedCreate(&sched_id, "FiberC", UT_FIBER_SCHED_WORKERS,
+                              UT_FIBER_SCHED_PRIORITY, 0);
+    if (res != OS_SUCCESS)
+    {
+        testDesc = "#2 Null-pointer-arg - Fiber-Sched-Create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_fiber_create_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Null-pointer-arg";
+
+    if (OS_FiberCreate(&fiber_id, sched_id, NULL, NULL, 0) == OS_INVALID_POINTER &&
+        OS_FiberCreate(NULL, sched_id, UT_os_fiber_counter, NULL, 0) == OS_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Not-in-fiber";
+
+    if (OS_FiberGetId(&fiber_id) == OS_ERROR && OS_FiberYield() == OS_ERROR)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 More-fibers-than-tasks";
+
+    g_fiber_count = 0;
+    created = 0;
+    for (i = 0; i < UT_FIBER_COUNT; i++)
+    {
+        if (OS_FiberCreate(&fiber_id, sched_id, UT_os_fiber_counter, NULL, 0) == OS_SUCCESS)
+        {
+            created++;
+        }
+    }
+    UT_os_fiber_wait_count(UT_FIBER_COUNT);
+
+    /* the worker frees a fiber right after it returns, give it a moment */
+    OS_TaskDelay(10);
+    res = OS_FiberSchedGetInfo(sched_id, &sched_prop);
+    if (created == UT_FIBER_COUNT && g_fiber_count == UT_FIBER_COUNT &&
+        res == OS_SUCCESS && sched_prop.fibers == 0 &&
+        sched_prop.switches >= 2 * UT_FIBER_COUNT)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Get-id";
+
+    g_fiber_count = 0;
+    g_fiber_self_ids[0] = 0xFFFFFFFF;
+    res = OS_FiberCreate(&g_fiber_ids[0], sched_id, UT_os_fiber_get_id, &g_fiber_self_ids[0], 0);
+    UT_os_fiber_wait_count(1);
+    if (res == OS_SUCCESS && g_fiber_count == 1 && g_fiber_self_ids[0] == g_fiber_ids[0])
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    res = OS_FiberSchedDelete(sched_id);
+
+UT_os_fiber_create_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_FiberCreate", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_FiberDelay
+** Purpose: Suspends the calling fiber while the other fibers keep running
+** Parameters: To-be-filled-in
+** Returns: OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_fiber_delay_test()
+{
+    UT_OsApiInfo_t apiInfo;
+    int32 res = 0, idx = 0;
+    const char* testDesc = NULL;
+    uint32 sched_id;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_FiberSchedCreate(&sched_id, "FiberD", 1, UT_FIBER_SCHED_PRIORITY, 0);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_fiber_delay_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Nominal";
+
+    if (res != OS_SUCCESS)
+    {
+        testDesc = "#1 Nominal - Fiber-Sched-Create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_fiber_delay_test_exit_tag;
+    }
+
+    /* one worker only: the spinner can only run if the delay does not block it */
+    g_fiber_count = 0;
+    g_fiber_spins = 0;
+    g_fiber_elapsed_usec = 0;
+    OS_FiberCreate(&g_fiber_ids[0], sched_id, UT_os_fiber_sleeper, NULL, 0);
+    OS_FiberCreate(&g_fiber_ids[1], sched_id, UT_os_fiber_spinner, NULL, 0);
+    UT_os_fiber_wait_count(2);
+
+    if (g_fiber_count == 2 && g_fiber_spins > 0 &&
+        g_fiber_elapsed_usec >= 50000 && g_fiber_elapsed_usec < 500000)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    res = OS_FiberSchedDelete(sched_id);
+
+UT_os_fiber_delay_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_FiberDelay", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_FiberSemTake, OS_FiberSemGive
+** Purpose: Blocks fibers on a fiber semaphore without blocking their worker
+** Parameters: To-be-filled-in
+** Returns: OS_ERR_INVALID_ID if the id passed in is not a valid fiber semaphore
+**          OS_ERROR if the semaphore is deleted while waited on
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_fiber_sem_test()
+{
+    UT_OsApiInfo_t apiInfo;
+    int32 res = 0, idx = 0;
+    const char* testDesc = NULL;
+    uint32 sched_id;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_FiberSemGive(99999) == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_fiber_sem_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Invalid-ID-arg";
+
+    if (OS_FiberSemGive(99999) == OS_ERR_INVALID_ID &&
+        OS_FiberSemTake(99999) == OS_ERR_INVALID_ID &&
+        OS_FiberSemDelete(99999) == OS_ERR_INVALID_ID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Null-pointer-arg";
+
+    if (OS_FiberSemCreate(NULL, 0) == OS_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    if (OS_FiberSchedCreate(&sched_id, "FiberSem", 1, UT_FIBER_SCHED_PRIORITY, 0) != OS_SUCCESS ||
+        OS_FiberSemCreate(&g_fiber_sem_ids[0], 1) != OS_SUCCESS ||
+        OS_FiberSemCreate(&g_fiber_sem_ids[1], 0) != OS_SUCCESS)
+    {
+        testDesc = "#3 Ping-pong - Setup failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_fiber_sem_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Ping-pong";
+
+    /* both fibers share one worker, each take switches to the other fiber */
+    g_fiber_count = 0;
+    OS_FiberCreate(&g_fiber_ids[0], sched_id, UT_os_fiber_ping, (void *)0, 0);
+    OS_FiberCreate(&g_fiber_ids[1], sched_id, UT_os_fiber_ping, (void *)1, 0);
+    UT_os_fiber_wait_count(2);
+
+    if (g_fiber_count == 2)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Delete-while-waited-on";
+
+    /* sem 0 was given back by the last round, empty it first */
+    OS_FiberSemTake(g_fiber_sem_ids[0]);
+    g_fiber_count = 0;
+    g_fiber_result = OS_ERROR;
+    OS_FiberCreate(&g_fiber_ids[0], sched_id, UT_os_fiber_taker, NULL, 0);
+    OS_TaskDelay(50);
+
+    if (g_fiber_count == 0 && OS_FiberSemDelete(g_fiber_sem_ids[0]) == OS_ERROR)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Task-gives-to-fiber";
+
+    res = OS_FiberSemGive(g_fiber_sem_ids[0]);
+    UT_os_fiber_wait_count(1);
+
+    if (res == OS_SUCCESS && g_fiber_count == 1 && g_fiber_result == OS_SUCCESS)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#6 Task-takes";
+
+    OS_FiberSemGive(g_fiber_sem_ids[1]);
+    if (OS_FiberSemTake(g_fiber_sem_ids[1]) == OS_SUCCESS)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_FiberSemDelete(g_fiber_sem_ids[0]);
+    OS_FiberSemDelete(g_fiber_sem_ids[1]);
+    OS_FiberSchedDelete(sched_id);
+
+UT_os_fiber_sem_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_FiberSemTake", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_FiberQueuePut, OS_FiberQueueGet
+** Purpose: Passes messages between fibers and tasks
+** Parameters: To-be-filled-in
+** Returns: OS_INVALID_POINTER if a pointer passed in is null
+**          OS_QUEUE_INVALID_SIZE if the buffer size is wrong
+**          OS_QUEUE_EMPTY if the queue is empty and OS_CHECK was given
+**          OS_QUEUE_TIMEOUT if no message arrived in time
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_fiber_queue_test()
+{
+    UT_OsApiInfo_t apiInfo;
+    int32 res = 0, idx = 0;
+    const char* testDesc = NULL;
+    uint32 sched_id;
+    uint32 data;
+    uint32 size_copied;
+    uint32 i;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_FiberQueueCreate(&g_fiber_queue_id, 4, sizeof(uint32)) == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_fiber_queue_test_exit_tag;
+    }
+
+    /* Clean up */
+    OS_FiberQueueDelete(g_fiber_queue_id);
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if (OS_FiberQueueCreate(NULL, 4, sizeof(uint32)) == OS_INVALID_POINTER &&
+        OS_FiberQueuePut(0, NULL, 0) == OS_INVALID_POINTER &&
+        OS_FiberQueueGet(0, NULL, sizeof(uint32), &size_copied, OS_CHECK) == OS_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    if (OS_FiberSchedCreate(&sched_id, "FiberQ", UT_FIBER_SCHED_WORKERS,
+                            UT_FIBER_SCHED_PRIORITY, 0) != OS_SUCCESS ||
+        OS_FiberQueueCreate(&g_fiber_queue_id, 4, sizeof(uint32)) != OS_SUCCESS)
+    {
+        testDesc = "#2 Invalid-size - Setup failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_fiber_queue_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-size";
+
+    if (OS_FiberQueuePut(g_fiber_queue_id, &data, sizeof(data) + 1) == OS_QUEUE_INVALID_SIZE &&
+        OS_FiberQueueGet(g_fiber_queue_id, &data, sizeof(data) - 1, &size_copied,
+                         OS_CHECK) == OS_QUEUE_INVALID_SIZE)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Queue-empty";
+
+    res = OS_FiberQueueGet(g_fiber_queue_id, &data, sizeof(data), &size_copied, OS_CHECK);
+    if (res == OS_QUEUE_EMPTY)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Fiber-timeout";
+
+    g_fiber_count = 0;
+    g_fiber_result = OS_ERROR;
+    OS_FiberCreate(&g_fiber_ids[0], sched_id, UT_os_fiber_timed_getter, NULL, 0);
+    UT_os_fiber_wait_count(1);
+
+    if (g_fiber_count == 1 && g_fiber_result == OS_QUEUE_TIMEOUT)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Nominal";
+
+    /* the queue is shorter than the message count, so both sides have to wait */
+    g_fiber_count = 0;
+    memset(g_fiber_messages, 0xFF, sizeof(g_fiber_messages));
+    OS_FiberCreate(&g_fiber_ids[0], sched_id, UT_os_fiber_consumer, NULL, 0);
+    OS_FiberCreate(&g_fiber_ids[1], sched_id, UT_os_fiber_producer, NULL, 0);
+    UT_os_fiber_wait_count(2);
+
+    for (i = 0; i < UT_FIBER_MESSAGES && g_fiber_messages[i] == i; i++)
+    {
+    }
+
+    if (g_fiber_count == 2 && i == UT_FIBER_MESSAGES)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#6 Task-waits-for-fiber";
+
+    OS_FiberCreate(&g_fiber_ids[0], sched_id, UT_os_fiber_producer, NULL, 0);
+    for (i = 0; i < UT_FIBER_MESSAGES; i++)
+    {
+        res = OS_FiberQueueGet(g_fiber_queue_id, &data, sizeof(data), &size_copied, 1000);
+        if (res != OS_SUCCESS || data != i || size_copied != sizeof(data))
+        {
+            break;
+        }
+    }
+
+    if (i == UT_FIBER_MESSAGES)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_FiberSchedDelete(sched_id);
+    OS_FiberQueueDelete(g_fiber_queue_id);
+
+UT_os_fiber_queue_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_FiberQueueGet", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*================================================================================*
+** End of File: ut_oscore_fiber_test.c
+**================================================================================*/
@@ -0,0 +1,46 @@
+/*================================================================================*
+** File:  ut_oscore_fiber_test.h
+**================================================================================*/
+
+#ifndef _UT_OSCORE_FIBER_TEST_H_
+#define _UT_OSCORE_FIBER_TEST_H_
+
+/*--------------------------------------------------------------------------------*
+** Includes
+**--------------------------------------------------------------------------------*/
+
+#include "ut_os_stubs.h"
+
+/*--------------------------------------------------------------------------------*
+** Macros
+**--------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*
+** Data types
+**--------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*
+** External global variables
+**--------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*
+** Global variables
+**--------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*
+** Function prototypes
+**--------------------------------------------------------------------------------*/
+
+void UT_os_fiber_sched_create_test(void);
+void UT_os_fiber_create_test(void);
+void UT_os_fiber_delay_test(void);
+void UT_os_fiber_sem_test(void);
+void UT_os_fiber_queue_test(void);
+
+/*--------------------------------------------------------------------------------*/
+
+#endif  /* _UT_OSCORE_FIBER_TEST_H_ */
+
+/*================================================================================*
+** End of File: ut_oscore_fiber_test.h
+**================================================================================*/
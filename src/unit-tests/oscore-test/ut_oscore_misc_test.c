@@ -642,6 +642,162 @@ UT_os_setlocaltime_test_exit_tag:
     UT_OS_LOG_API_MACRO(apiInfo)
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_GetMonotonicNs(uint64 *nsecs)
+** Purpose: Returns the time in nanoseconds on a clock that only moves forward
+** Parameters: *nsecs - a pointer that will hold the time in nanoseconds
+** Returns: OS_INVALID_POINTER if the pointer passed in is null
+**          OS_ERROR if the OS call failed
+**          OS_SUCCESS if succeeded
+**          OS_ERR_NOT_IMPLEMENTED
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_ERR_NOT_IMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-argument condition
+**   1) Call this routine with a null-pointer argument
+**   2) Expect the returned value to be
+**        (a) OS_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Nominal condition
+**   1) Call this routine 1000 times, then around a 100 msec task delay
+**   2) Expect the returned value to be
+**        (a) OS_SUCCESS __and__
+**        (b) the time to never go back __and__
+**        (c) at least 100 msec to pass over the task delay
+**--------------------------------------------------------------------------------*/
+void UT_os_getmonotonicns_test()
+{
+    uint64 last_ns = 0, now_ns = 0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc = NULL;
+    int32 res = 0, idx = 0, i = 0, backwards = 0;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_GetMonotonicNs(NULL);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_getmonotonicns_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+    res = OS_GetMonotonicNs(NULL);
+    if (res == OS_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Nominal";
+
+    res = OS_GetMonotonicNs(&last_ns);
+    for (i = 0; i < 1000 && res == OS_SUCCESS; i++)
+    {
+        res = OS_GetMonotonicNs(&now_ns);
+        if (now_ns < last_ns)
+        {
+            ++backwards;
+        }
+        last_ns = now_ns;
+    }
+
+    OS_TaskDelay(100);
+    if (res == OS_SUCCESS)
+    {
+        res = OS_GetMonotonicNs(&now_ns);
+    }
+
+    if ((res == OS_SUCCESS) && (backwards == 0) && (now_ns - last_ns >= 100000000))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+UT_os_getmonotonicns_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_GetMonotonicNs", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_GetMonotonicTime(OS_time_t *time_struct)
+** Purpose: Returns the time of OS_GetMonotonicNs in seconds and microseconds
+** Parameters: *time_struct - a pointer to an OS_time_t structure that will hold
+**                            the time in seconds and microseconds
+** Returns: OS_INVALID_POINTER if the pointer passed in is null
+**          OS_ERROR if the OS call failed
+**          OS_SUCCESS if succeeded
+**          OS_ERR_NOT_IMPLEMENTED
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_ERR_NOT_IMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-argument condition
+**   1) Call this routine with a null-pointer argument
+**   2) Expect the returned value to be
+**        (a) OS_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Nominal condition
+**   1) Call OS_GetMonotonicNs, this routine and OS_GetMonotonicNs again
+**   2) Expect the returned value to be
+**        (a) OS_SUCCESS __and__
+**        (b) the time returned to lie between the two times of OS_GetMonotonicNs
+**--------------------------------------------------------------------------------*/
+void UT_os_getmonotonictime_test()
+{
+    OS_time_t time_struct;
+    uint64 before_ns = 0, after_ns = 0, time_ns = 0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc = NULL;
+    int32 res = 0, idx = 0;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_GetMonotonicTime(NULL);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_getmonotonictime_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+    res = OS_GetMonotonicTime(NULL);
+    if (res == OS_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Nominal";
+
+    OS_GetMonotonicNs(&before_ns);
+    res = OS_GetMonotonicTime(&time_struct);
+    OS_GetMonotonicNs(&after_ns);
+
+    time_ns = ((uint64)time_struct.seconds * 1000000000) + ((uint64)time_struct.microsecs * 1000);
+    if ((res == OS_SUCCESS) && (time_struct.microsecs < 1000000) &&
+        (time_ns + 1000 > before_ns) && (time_ns <= after_ns))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+UT_os_getmonotonictime_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_GetMonotonicTime", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
 /*--------------------------------------------------------------------------------*
 ** Syntax: void OS_GetErrorName(int32 error_num, os_err_name_t * err_name)
 ** Purpose: Returns the string name of the error value
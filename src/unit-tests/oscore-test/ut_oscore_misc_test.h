@@ -44,6 +44,8 @@ void UT_os_milli2ticks_test(void);
 
 void UT_os_getlocaltime_test(void);
 void UT_os_setlocaltime_test(void);
+void UT_os_getmonotonicns_test(void);
+void UT_os_getmonotonictime_test(void);
 
 void UT_os_geterrorname_test(void);
 
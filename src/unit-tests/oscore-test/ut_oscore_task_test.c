@@ -17,6 +17,12 @@
 #define UT_TASK_STACK_SIZE  0x2000
 #define UT_TASK_PRIORITY       111
 
+#define UT_TASK_STATS_STACK_SIZE  0x4000
+#define UT_TASK_STATS_STACK_USE   0x1000
+
+#define UT_DETERMINISTIC_HEAP_SIZE  (1024 * 1024)
+#define UT_DETERMINISTIC_BLOCK_SIZE (256 * 1024)
+
 /* This is not global in the OSAL */
 #define MAX_PRIORITY  255    
 
@@ -45,6 +51,15 @@ uint32 g_task_sync_sem = 0;
 uint32 g_task_ids[UT_OS_TASK_LIST_LEN];
 uint32 g_task_stacks[UT_OS_TASK_LIST_LEN][UT_TASK_STACK_SIZE];
 
+volatile uint32 g_task_stats_ready = 0;
+volatile uint32 g_periodic_done = 0;
+int32  g_periodic_not_init_result = 0;
+int32  g_periodic_init_result = 0;
+uint32 g_periodic_elapsed_usec = 0;
+uint32 g_task_stats_calls = 0;
+uint32 g_task_stats_count = 0;
+volatile uint32 g_deterministic_cycles = 0;
+
 /*--------------------------------------------------------------------------------*
 ** External function prototypes
 **--------------------------------------------------------------------------------*/
@@ -161,6 +176,111 @@ void generic_test_task(void)
     }
 }
 
+/*--------------------------------------------------------------------------------*/
+
+void generic_test_task_ex(void *arg)
+{
+    g_task_result = *((uint32 *)arg);
+
+    while (1)
+    {
+        OS_TaskDelay(1000);
+    }
+}
+
+/* Uses a known amount of stack and some CPU time, then blocks */
+void stats_test_task(void *arg)
+{
+    volatile uint8  stack_use[UT_TASK_STATS_STACK_USE];
+    volatile uint32 i;
+
+    for (i = 0; i < sizeof(stack_use); i++)
+    {
+        stack_use[i] = (uint8)i;
+    }
+    for (i = 0; i < 2000000; i++)
+    {
+    }
+
+    OS_TaskDelay(10);
+    g_task_stats_ready = 1;
+
+    while (1)
+    {
+        OS_TaskDelay(1000);
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+
+void deterministic_test_task(void)
+{
+    volatile uint8  stack_use[UT_TASK_STATS_STACK_USE];
+    uint8          *block;
+    uint32          i;
+
+    OS_TaskRegister();
+
+    /* Each cycle uses the same stack and heap a real-time loop would */
+    while (1)
+    {
+        for (i = 0; i < sizeof(stack_use); i++)
+        {
+            stack_use[i] = (uint8)i;
+        }
+
+        block = malloc(UT_DETERMINISTIC_BLOCK_SIZE);
+        if (block != NULL)
+        {
+            memset(block, (int)g_deterministic_cycles, UT_DETERMINISTIC_BLOCK_SIZE);
+            free(block);
+        }
+
+        g_deterministic_cycles++;
+        OS_TaskDelay(10);
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+
+/* Runs ten 10 ms periods, optionally overrunning the third one */
+void periodic_test_task(void *arg)
+{
+    uint32 overrun = *((uint32 *)arg);
+    uint64 start_time, end_time;
+    uint32 i;
+
+    g_periodic_not_init_result = OS_TaskWaitNextPeriod();
+    g_periodic_init_result = OS_TaskPeriodicInit(10000);
+    OS_GetMonotonicNs(&start_time);
+
+    for (i = 0; i < 10; i++)
+    {
+        if (overrun && i == 2)
+        {
+            OS_TaskDelay(35);
+        }
+        OS_TaskWaitNextPeriod();
+    }
+
+    OS_GetMonotonicNs(&end_time);
+    g_periodic_elapsed_usec = (uint32)((end_time - start_time) / 1000);
+    g_periodic_done = 1;
+
+    while (1)
+    {
+        OS_TaskDelay(1000);
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+
+void stats_monitor_callback(const OS_task_stats_t *task_stats, uint32 count)
+{
+    g_task_stats_calls++;
+    g_task_stats_count = count;
+}
+
 /*--------------------------------------------------------------------------------*
 ** Syntax: OS_TaskCreate
 ** Purpose: Creates a task
@@ -340,6 +460,139 @@ UT_os_task_create_test_exit_tag:
     UT_OS_LOG_API_MACRO(apiInfo)
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_TaskCreateEx
+** Purpose: Creates a task that is passed an argument, with optional attributes
+** Parameters: To-be-filled-in
+** Returns: OS_INVALID_POINTER if any of the pointers passed in is null
+**          OS_INVALID_PRIORITY if the priority passed in is bad
+**          OS_ERR_NAME_TOO_LONG if the name passed in is too long
+**          OS_ERR_NAME_TAKEN if the name passed in has already been used
+**          OS_ERR_NO_FREE_IDS if there no more task can be created
+**          OS_ERROR if the attributes are bad or the OS call failed
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_task_create_ex_test()
+{
+    UT_OsApiInfo_t apiInfo;
+    int32 res=0, idx=0;
+    const char* testDesc=NULL;
+    uint32 task_arg = 0x5A5A;
+    OS_task_attr_t task_attr;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_TaskCreateEx(&g_task_ids[0], g_task_names[0], generic_test_task_ex, &task_arg,
+                          UT_TASK_STACK_SIZE, UT_TASK_PRIORITY, 0, NULL);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_task_create_ex_test_exit_tag;
+    }
+
+    /* Delay to let child task run */
+    OS_TaskDelay(200);
+
+    /* Reset test environment */
+    res = OS_TaskDelete(g_task_ids[0]);
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    res = OS_TaskCreateEx(&g_task_ids[1], g_task_names[1], NULL, &task_arg,
+                          UT_TASK_STACK_SIZE, UT_TASK_PRIORITY, 0, NULL);
+    if (res == OS_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Name-too-long";
+
+    res = OS_TaskCreateEx(&g_task_ids[2], g_long_task_name, generic_test_task_ex, &task_arg,
+                          UT_TASK_STACK_SIZE, UT_TASK_PRIORITY, 0, NULL);
+    if (res == OS_ERR_NAME_TOO_LONG)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Invalid-priority";
+
+    res = OS_TaskCreateEx(&g_task_ids[3], g_task_names[3], generic_test_task_ex, &task_arg,
+                          UT_TASK_STACK_SIZE, MAX_PRIORITY+1, 0, NULL);
+    if (res == OS_ERR_INVALID_PRIORITY)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Invalid-policy";
+
+    memset(&task_attr, 0, sizeof(task_attr));
+    task_attr.policy = 0xFF;
+    res = OS_TaskCreateEx(&g_task_ids[4], g_task_names[4], generic_test_task_ex, &task_arg,
+                          UT_TASK_STACK_SIZE, UT_TASK_PRIORITY, 0, &task_attr);
+    if (res == OS_ERROR)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Attributes";
+
+    memset(&task_attr, 0, sizeof(task_attr));
+    task_attr.affinity_mask = 0x1;
+    task_attr.policy = OS_SCHED_OTHER;
+    task_attr.guard_size = 0x1000;
+    res = OS_TaskCreateEx(&g_task_ids[5], g_task_names[5], generic_test_task_ex, &task_arg,
+                          UT_TASK_STACK_SIZE, UT_TASK_PRIORITY, 0, &task_attr);
+    if (res == OS_SUCCESS)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+
+        /* Delay to let child task run */
+        OS_TaskDelay(200);
+
+        /* Reset test environment */
+        res = OS_TaskDelete(g_task_ids[5]);
+    }
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#6 Nominal";
+
+    g_task_result = 0;
+    res = OS_TaskCreateEx(&g_task_ids[6], g_task_names[6], generic_test_task_ex, &task_arg,
+                          UT_TASK_STACK_SIZE, UT_TASK_PRIORITY, 0, NULL);
+    if (res != OS_SUCCESS)
+    {
+        testDesc = "#6 Nominal - Task-Create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        /* Delay to let child task run */
+        OS_TaskDelay(200);
+
+        if (g_task_result == task_arg)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Reset test environment */
+        res = OS_TaskDelete(g_task_ids[6]);
+    }
+
+UT_os_task_create_ex_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_TaskCreateEx", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
 /*--------------------------------------------------------------------------------*
 ** Syntax: OS_TaskDelete
 ** Purpose: Deletes a task
@@ -669,6 +922,120 @@ UT_os_task_delay_test_exit_tag:
     UT_OS_LOG_API_MACRO(apiInfo)
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_TaskPeriodicInit / OS_TaskWaitNextPeriod
+** Purpose: Runs the calling task at a fixed period without drift
+** Parameters: To-be-filled-in
+** Returns: OS_ERR_INVALID_ID if the caller is not an OSAL task
+**          OS_ERROR if the period is 0 or the task is not periodic
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_task_periodic_test()
+{
+    int32 res=0, idx=0;
+    UT_OsApiInfo_t apiInfo;
+    OS_task_stats_t task_stats;
+    uint32 overrun=0;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_TaskPeriodicInit(0);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_task_periodic_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Invalid-period-arg";
+
+    res = OS_TaskPeriodicInit(0);
+    if (res == OS_ERROR)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Not-an-OSAL-task";
+
+    /* the test main thread was not created by OS_TaskCreate */
+    res = OS_TaskWaitNextPeriod();
+    if (res == OS_ERR_INVALID_ID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Nominal";
+
+    /* Setup */
+    g_periodic_done = 0;
+    overrun = 0;
+    res = OS_TaskCreateEx(&g_task_ids[1], g_task_names[1], periodic_test_task, &overrun,
+                          UT_TASK_STACK_SIZE, UT_TASK_PRIORITY, 0, NULL);
+    if (res != OS_SUCCESS)
+    {
+        testDesc = "#3 Nominal - Task-Create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        /* Delay to let child task run */
+        OS_TaskDelay(500);
+
+        /* ten periods of 10 ms must take 100 ms, whatever the task does in between */
+        res = OS_TaskGetStats(g_task_ids[1], &task_stats);
+        if ((g_periodic_done == 1) && (g_periodic_not_init_result == OS_ERROR) &&
+            (g_periodic_init_result == OS_SUCCESS) &&
+            (g_periodic_elapsed_usec >= 95000) && (g_periodic_elapsed_usec <= 130000) &&
+            (res != OS_SUCCESS || task_stats.period_overruns == 0))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Reset test environment */
+        res = OS_TaskDelete(g_task_ids[1]);
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Overrun";
+
+    /* Setup */
+    g_periodic_done = 0;
+    overrun = 1;
+    res = OS_TaskCreateEx(&g_task_ids[2], g_task_names[2], periodic_test_task, &overrun,
+                          UT_TASK_STACK_SIZE, UT_TASK_PRIORITY, 0, NULL);
+    if (res != OS_SUCCESS)
+    {
+        testDesc = "#4 Overrun - Task-Create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        /* Delay to let child task run */
+        OS_TaskDelay(500);
+
+        /* a 35 ms stall inside a 10 ms period skips whole releases */
+        res = OS_TaskGetStats(g_task_ids[2], &task_stats);
+        if ((g_periodic_done == 1) && (res == OS_SUCCESS) &&
+            (task_stats.period_overruns >= 2) && (task_stats.period_overruns <= 4))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Reset test environment */
+        res = OS_TaskDelete(g_task_ids[2]);
+    }
+
+UT_os_task_periodic_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_TaskWaitNextPeriod", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
 /*--------------------------------------------------------------------------------*
 ** Syntax: OS_TaskSetPriority
 ** Purpose: Sets task priority for the given task id
@@ -1081,6 +1448,8 @@ void UT_os_task_get_info_test()
     int32 res=0, idx=0;
     UT_OsApiInfo_t apiInfo;
     OS_task_prop_t task_prop;
+    OS_task_attr_t task_attr;
+    uint32 task_arg = 1;
     const char* testDesc=NULL;
 
     UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
@@ -1156,11 +1525,435 @@ void UT_os_task_get_info_test()
         res = OS_TaskDelete(g_task_ids[3]);
     }
 
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Effective-policy";
+
+    /* Setup */
+    memset(&task_attr, 0, sizeof(task_attr));
+    task_attr.policy = OS_SCHED_OTHER;
+    res = OS_TaskCreateEx(&g_task_ids[4], g_task_names[4], generic_test_task_ex, &task_arg,
+                          UT_TASK_STACK_SIZE, UT_TASK_PRIORITY, 0, &task_attr);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+    }
+    else if (res != OS_SUCCESS)
+    {
+        testDesc = "#4 Effective-policy - Task-Create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        /* A task asking for SCHED_OTHER must never be reported as real-time */
+        res = OS_TaskGetInfo(g_task_ids[4], &task_prop);
+        if ((res == OS_SUCCESS) && (task_prop.policy == OS_SCHED_OTHER) &&
+            (task_prop.os_priority >= -20) && (task_prop.os_priority <= 19))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Reset test environment */
+        res = OS_TaskDelete(g_task_ids[4]);
+    }
+
 UT_os_task_get_info_test_exit_tag:
     UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_TaskGetInfo", idx)
     UT_OS_LOG_API_MACRO(apiInfo)
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_TaskGetStats
+** Purpose: Returns runtime statistics about the given task
+** Parameters: To-be-filled-in
+** Returns: OS_ERR_INVALID_ID if the id passed in is not a valid task
+**          OS_INVALID_POINTER if the pointer passed in is null
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_task_get_stats_test()
+{
+    int32 res=0, idx=0;
+    UT_OsApiInfo_t apiInfo;
+    OS_task_stats_t task_stats;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_TaskGetStats(99999, &task_stats);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_task_get_stats_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Invalid-ID-arg";
+
+    res = OS_TaskGetStats(99999, &task_stats);
+    if (res == OS_ERR_INVALID_ID)
+       UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+       UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-pointer-arg";
+
+    /* Setup */
+    res = OS_TaskCreate(&g_task_ids[1], g_task_names[1], generic_test_task, g_task_stacks[1],
+                        UT_TASK_STACK_SIZE, UT_TASK_PRIORITY, 0);
+    if (res != OS_SUCCESS)
+    {
+        testDesc = "#2 Invalid-pointer-arg - Task-Create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        res = OS_TaskGetStats(g_task_ids[1], NULL);
+        if (res == OS_INVALID_POINTER)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Reset test environment */
+        res = OS_TaskDelete(g_task_ids[1]);
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Nominal";
+
+    /* Setup */
+    g_task_stats_ready = 0;
+    res = OS_TaskCreateEx(&g_task_ids[2], g_task_names[2], stats_test_task, NULL,
+                          UT_TASK_STATS_STACK_SIZE, UT_TASK_PRIORITY, 0, NULL);
+    if (res != OS_SUCCESS)
+    {
+        testDesc = "#3 Nominal - Task-Create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        /* Delay to let child task run */
+        OS_TaskDelay(500);
+
+        res = OS_TaskGetStats(g_task_ids[2], &task_stats);
+        if ((res == OS_SUCCESS) && (g_task_stats_ready == 1) &&
+            (strcmp(task_stats.name, g_task_names[2]) == 0) &&
+            (task_stats.cpu_time.seconds > 0 || task_stats.cpu_time.microsecs > 0) &&
+            (task_stats.voluntary_switches > 0) &&
+            (task_stats.current_cpu >= 0) &&
+            (task_stats.stack_high_water >= UT_TASK_STATS_STACK_USE) &&
+            (task_stats.stack_high_water <= UT_TASK_STATS_STACK_SIZE))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Reset test environment */
+        res = OS_TaskDelete(g_task_ids[2]);
+    }
+
+UT_os_task_get_stats_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_TaskGetStats", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_TaskGetStatsAll
+** Purpose: Returns runtime statistics about all tasks
+** Parameters: To-be-filled-in
+** Returns: OS_INVALID_POINTER if a pointer passed in is null
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_task_get_stats_all_test()
+{
+    int32 res=0, idx=0;
+    UT_OsApiInfo_t apiInfo;
+    static OS_task_stats_t task_stats[OS_MAX_TASKS];
+    uint32 count=0, i=0;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_TaskGetStatsAll(task_stats, OS_MAX_TASKS, &count);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_task_get_stats_all_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if ((OS_TaskGetStatsAll(NULL, OS_MAX_TASKS, &count) == OS_INVALID_POINTER) &&
+        (OS_TaskGetStatsAll(task_stats, OS_MAX_TASKS, NULL) == OS_INVALID_POINTER))
+       UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+       UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Nominal";
+
+    /* Setup */
+    res = OS_TaskCreate(&g_task_ids[1], g_task_names[1], generic_test_task, g_task_stacks[1],
+                        UT_TASK_STACK_SIZE, UT_TASK_PRIORITY, 0);
+    if (res != OS_SUCCESS)
+    {
+        testDesc = "#2 Nominal - Task-Create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        res = OS_TaskGetStatsAll(task_stats, OS_MAX_TASKS, &count);
+        for (i = 0; res == OS_SUCCESS && i < count; i++)
+        {
+            if (task_stats[i].task_id == g_task_ids[1] &&
+                strcmp(task_stats[i].name, g_task_names[1]) == 0)
+            {
+                break;
+            }
+        }
+
+        /* a zero sized snapshot must stay empty */
+        if ((res == OS_SUCCESS) && (i < count) &&
+            (OS_TaskGetStatsAll(task_stats, 0, &count) == OS_SUCCESS) && (count == 0))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Reset test environment */
+        res = OS_TaskDelete(g_task_ids[1]);
+    }
+
+UT_os_task_get_stats_all_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_TaskGetStatsAll", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_TaskStatsMonitorStart / OS_TaskStatsMonitorStop
+** Purpose: Periodically hands a snapshot of all task statistics to a callback
+** Parameters: To-be-filled-in
+** Returns: OS_INVALID_POINTER if the callback is null
+**          OS_ERROR if the period is 0, or on start while running or stop while stopped
+**          OS_SUCCESS if succeeded
+**          (OS_TaskDelete returns OS_ERROR for the monitor task)
+**--------------------------------------------------------------------------------*/
+void UT_os_task_stats_monitor_test()
+{
+    int32 res=0, idx=0;
+    uint32 task_id=0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_TaskStatsMonitorStop();
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_task_stats_monitor_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    res = OS_TaskStatsMonitorStart(10, UT_TASK_PRIORITY, NULL);
+    if (res == OS_INVALID_POINTER)
+       UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+       UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-period-arg";
+
+    res = OS_TaskStatsMonitorStart(0, UT_TASK_PRIORITY, stats_monitor_callback);
+    if (res == OS_ERROR)
+       UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+       UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Not-running";
+
+    res = OS_TaskStatsMonitorStop();
+    if (res == OS_ERROR)
+       UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+       UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Already-running";
+
+    res = OS_TaskStatsMonitorStart(10, UT_TASK_PRIORITY, stats_monitor_callback);
+    if (res != OS_SUCCESS)
+    {
+        testDesc = "#4 Already-running - Monitor-Start failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        res = OS_TaskStatsMonitorStart(10, UT_TASK_PRIORITY, stats_monitor_callback);
+        if (res == OS_ERROR)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Reset test environment */
+        res = OS_TaskStatsMonitorStop();
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Nominal";
+
+    g_task_stats_calls = 0;
+    g_task_stats_count = 0;
+    res = OS_TaskStatsMonitorStart(10, UT_TASK_PRIORITY, stats_monitor_callback);
+    if (res != OS_SUCCESS)
+    {
+        testDesc = "#5 Nominal - Monitor-Start failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        /* Delay to let the monitor take a few snapshots */
+        OS_TaskDelay(200);
+
+        /* the snapshot includes at least the monitor task itself */
+        res = OS_TaskStatsMonitorStop();
+        if ((res == OS_SUCCESS) && (g_task_stats_calls > 0) && (g_task_stats_count > 0))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#6 Monitor-task-delete";
+
+    /* The monitor can only be stopped by OS_TaskStatsMonitorStop */
+    res = OS_TaskStatsMonitorStart(10, UT_TASK_PRIORITY, stats_monitor_callback);
+    if (res != OS_SUCCESS || OS_TaskGetIdByName(&task_id, "OS_TaskStatsMon") != OS_SUCCESS)
+    {
+        testDesc = "#6 Monitor-task-delete - Monitor-Start failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        if (res == OS_SUCCESS)
+            OS_TaskStatsMonitorStop();
+    }
+    else
+    {
+        if (OS_TaskDelete(task_id) == OS_ERROR &&
+            OS_TaskStatsMonitorStop() == OS_SUCCESS &&
+            OS_TaskGetIdByName(&task_id, "OS_TaskStatsMon") == OS_ERR_NAME_NOT_FOUND)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+UT_os_task_stats_monitor_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_TaskStatsMonitor", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_DeterministicModeEnable(uint32 heap_reserve_size)
+** Purpose: Locks memory and prefaults task stacks and heap
+** Parameters: heap_reserve_size - bytes of heap to fault in
+** Returns: OS_ERR_NOT_IMPLEMENTED if not implemented
+**          OS_ERROR if memory could not be locked or reserved
+**          OS_SUCCESS if succeeded
+** -----------------------------------------------------
+** Test #1: Nominal condition
+**   1) Call this routine
+**   2) Expect the returned value to be
+**        (a) OS_SUCCESS
+**      or a test setup failure if the process is not allowed to lock memory
+** -----------------------------------------------------
+** Test #2: No-faults-after-startup condition
+**   1) Create a task that touches its stack and allocates and frees a heap block
+**      on every cycle
+**   2) Wait until the task has run a few cycles, then call OS_TaskGetStats
+**   3) Wait for more cycles and call OS_TaskGetStats again
+**   4) Expect the task to have run and the page fault counts not to have changed
+**--------------------------------------------------------------------------------*/
+void UT_os_deterministic_mode_test()
+{
+    int32 res=0, idx=0;
+    uint32 cycles;
+    UT_OsApiInfo_t apiInfo;
+    OS_task_stats_t stats_before;
+    OS_task_stats_t stats_after;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_DeterministicModeEnable(UT_DETERMINISTIC_HEAP_SIZE);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_deterministic_mode_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Nominal";
+
+    if (res == OS_SUCCESS)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+    {
+        testDesc = "#1 Nominal - Memory-lock not permitted";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_deterministic_mode_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 No-faults-after-startup";
+
+    /* Setup */
+    g_deterministic_cycles = 0;
+    res = OS_TaskCreate(&g_task_ids[1], g_task_names[1], deterministic_test_task, g_task_stacks[1],
+                        UT_TASK_STATS_STACK_SIZE, UT_TASK_PRIORITY, 0);
+    if (res != OS_SUCCESS)
+    {
+        testDesc = "#2 No-faults-after-startup - Task-Create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        /* Let the task through its first cycles */
+        OS_TaskDelay(200);
+
+        res = OS_TaskGetStats(g_task_ids[1], &stats_before);
+        cycles = g_deterministic_cycles;
+
+        OS_TaskDelay(500);
+
+        if ((res == OS_SUCCESS) &&
+            (OS_TaskGetStats(g_task_ids[1], &stats_after) == OS_SUCCESS) &&
+            (g_deterministic_cycles > cycles) &&
+            (stats_after.minor_faults == stats_before.minor_faults) &&
+            (stats_after.major_faults == stats_before.major_faults))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Reset test environment */
+        res = OS_TaskDelete(g_task_ids[1]);
+    }
+
+UT_os_deterministic_mode_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_DeterministicModeEnable", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
 /*================================================================================*
 ** End of File: ut_oscore_task_test.c
 **================================================================================*/
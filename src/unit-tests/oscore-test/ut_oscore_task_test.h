@@ -36,6 +36,7 @@
 **--------------------------------------------------------------------------------*/
 
 void UT_os_task_create_test(void);
+void UT_os_task_create_ex_test(void);
 void UT_os_task_delete_test(void);
 void UT_os_task_install_delete_handler_test(void);
 void UT_os_task_exit_test(void);
@@ -44,8 +45,13 @@ void UT_os_task_register_test(void);
 void UT_os_task_get_id(void);
 void UT_os_task_get_id_by_name_test(void);
 void UT_os_task_get_info_test(void);
+void UT_os_task_get_stats_test(void);
+void UT_os_task_get_stats_all_test(void);
+void UT_os_task_stats_monitor_test(void);
 void UT_os_task_delay_test(void);
+void UT_os_task_periodic_test(void);
 void UT_os_task_get_id_test(void);
+void UT_os_deterministic_mode_test(void);
 
 /*--------------------------------------------------------------------------------*/
 
@@ -44,15 +44,20 @@ char  g_long_task_name[OS_MAX_API_NAME+5];
 
 void UT_os_init_task_misc(void);
 void UT_os_init_task_create_test(void);
+void UT_os_init_task_create_ex_test(void);
 void UT_os_init_task_delete_test(void);
 void UT_os_setup_install_delete_handler_test(void);
 void UT_os_init_task_exit_test(void);
 void UT_os_init_task_delay_test(void);
+void UT_os_init_task_periodic_test(void);
 void UT_os_init_task_set_priority_test(void);
 void UT_os_init_task_register_test(void);
 void UT_os_init_task_get_id_test(void);
 void UT_os_init_task_get_id_by_name_test(void);
 void UT_os_init_task_get_info_test(void);
+void UT_os_init_task_get_stats_test(void);
+void UT_os_init_task_get_stats_all_test(void);
+void UT_os_init_deterministic_mode_test(void);
 
 /*--------------------------------------------------------------------------------*
 ** Local function definitions
@@ -82,6 +87,19 @@ void UT_os_init_task_create_test()
 
 /*--------------------------------------------------------------------------------*/
 
+void UT_os_init_task_create_ex_test()
+{
+    g_task_names[0] = "CreateEx_NotImpl";
+    g_task_names[1] = "CreateEx_NullPtr";
+    g_task_names[2] = "CreateEx_LongName";
+    g_task_names[3] = "CreateEx_InvPrior";
+    g_task_names[4] = "CreateEx_InvPolicy";
+    g_task_names[5] = "CreateEx_Attr";
+    g_task_names[6] = "CreateEx_Nominal";
+}
+
+/*--------------------------------------------------------------------------------*/
+
 void UT_os_init_task_delete_test()
 {
     g_task_names[0] = "Delete_NotImpl";
@@ -118,6 +136,15 @@ void UT_os_init_task_delay_test()
 
 /*--------------------------------------------------------------------------------*/
 
+void UT_os_init_task_periodic_test()
+{
+    g_task_names[0] = "Periodic_NotImpl";
+    g_task_names[1] = "Periodic_Nominal";
+    g_task_names[2] = "Periodic_Overrun";
+}
+
+/*--------------------------------------------------------------------------------*/
+
 void UT_os_init_task_set_priority_test()
 {
     g_task_names[0] = "SetPrio_NotImpl";
@@ -165,6 +192,31 @@ void UT_os_init_task_get_info_test()
     g_task_names[1] = "GetInfo_InvId";
     g_task_names[2] = "GetInfo_InvPtr";
     g_task_names[3] = "GetInfo_Nominal";
+    g_task_names[4] = "GetInfo_Policy";
+}
+
+/*--------------------------------------------------------------------------------*/
+
+void UT_os_init_task_get_stats_test()
+{
+    g_task_names[0] = "GetStats_NotImpl";
+    g_task_names[1] = "GetStats_InvPtr";
+    g_task_names[2] = "GetStats_Nominal";
+}
+
+/*--------------------------------------------------------------------------------*/
+
+void UT_os_init_task_get_stats_all_test()
+{
+    g_task_names[0] = "GetStatsAll_NotImpl";
+    g_task_names[1] = "GetStatsAll_Nominal";
+}
+
+/*--------------------------------------------------------------------------------*/
+
+void UT_os_init_deterministic_mode_test()
+{
+    g_task_names[1] = "Determ_Nominal";
 }
 
 /*--------------------------------------------------------------------------------*
@@ -224,6 +276,9 @@ void OS_Application_Startup(void)
     UT_os_init_task_create_test();
     UT_os_task_create_test();
 
+    UT_os_init_task_create_ex_test();
+    UT_os_task_create_ex_test();
+
     UT_os_init_task_delete_test();
     UT_os_task_delete_test();
 
@@ -236,6 +291,9 @@ void OS_Application_Startup(void)
     UT_os_init_task_delay_test();
     UT_os_task_delay_test();
 
+    UT_os_init_task_periodic_test();
+    UT_os_task_periodic_test();
+
     UT_os_init_task_set_priority_test();
     UT_os_task_set_priority_test();
 
@@ -253,6 +311,25 @@ void OS_Application_Startup(void)
     UT_os_init_task_get_info_test();
     UT_os_task_get_info_test();
 
+    UT_os_init_task_get_stats_test();
+    UT_os_task_get_stats_test();
+
+    UT_os_init_task_get_stats_all_test();
+    UT_os_task_get_stats_all_test();
+    UT_os_task_stats_monitor_test();
+
+    UT_os_work_queue_create_test();
+    UT_os_work_queue_delete_test();
+    UT_os_work_submit_test();
+    UT_os_work_group_wait_test();
+    UT_os_work_queue_get_info_test();
+
+    UT_os_fiber_sched_create_test();
+    UT_os_fiber_create_test();
+    UT_os_fiber_delay_test();
+    UT_os_fiber_sem_test();
+    UT_os_fiber_queue_test();
+
     UT_os_geterrorname_test();
 
     UT_os_tick2micros_test();
@@ -262,6 +339,12 @@ void OS_Application_Startup(void)
     UT_os_getlocaltime_test();
     UT_OS_LOG_MACRO("============================================\n")
     UT_os_setlocaltime_test();
+    UT_os_getmonotonicns_test();
+    UT_os_getmonotonictime_test();
+
+    /* Locks memory for the rest of the process, so this runs last */
+    UT_os_init_deterministic_mode_test();
+    UT_os_deterministic_mode_test();
 
     UT_os_teardown("ut_oscore");
 
@@ -18,6 +18,8 @@
 #include "ut_oscore_mutex_test.h"
 #include "ut_oscore_queue_test.h"
 #include "ut_oscore_task_test.h"
+#include "ut_oscore_workqueue_test.h"
+#include "ut_oscore_fiber_test.h"
 
 /*--------------------------------------------------------------------------------*
 ** Macros
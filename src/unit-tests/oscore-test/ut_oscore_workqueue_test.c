@@ -0,0 +1,521 @@
+/*================================================================================*
+** File:  ut_oscore_workqueue_test.c
+**================================================================================*/
+
+/*--------------------------------------------------------------------------------*
+** Includes
+**--------------------------------------------------------------------------------*/
+
+#include "ut_oscore_workqueue_test.h"
+
+/*--------------------------------------------------------------------------------*
+** Macros
+**--------------------------------------------------------------------------------*/
+
+#define UT_WORK_QUEUE_WORKERS      4
+#define UT_WORK_QUEUE_PRIORITY   150
+#define UT_WORK_ITEM_COUNT       100
+
+/*--------------------------------------------------------------------------------*
+** Data types
+**--------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*
+** External global variables
+**--------------------------------------------------------------------------------*/
+
+extern UT_OsLogInfo_t g_logInfo;
+
+/*--------------------------------------------------------------------------------*
+** Global variables
+**--------------------------------------------------------------------------------*/
+
+uint32 g_work_queue_id = 0;
+uint32 g_work_count = 0;
+uint32 g_work_results[UT_WORK_ITEM_COUNT];
+
+/*--------------------------------------------------------------------------------*
+** Local function prototypes
+**--------------------------------------------------------------------------------*/
+
+void UT_os_work_item(void *arg);
+void UT_os_work_item_fanout(void *arg);
+
+/*--------------------------------------------------------------------------------*
+** Local function definitions
+**--------------------------------------------------------------------------------*/
+
+void UT_os_work_item(void *arg)
+{
+    uint32 *result = (uint32 *)arg;
+
+    *result = 1;
+    __atomic_add_fetch(&g_work_count, 1, __ATOMIC_RELAXED);
+}
+
+/*--------------------------------------------------------------------------------*/
+
+/* Runs on a worker, submits to its own deque and waits on the items it submitted */
+void UT_os_work_item_fanout(void *arg)
+{
+    uint32 work_ids[4];
+    uint32 i;
+
+    for (i = 0; i < 4; i++)
+    {
+        OS_WorkSubmit(g_work_queue_id, UT_os_work_item, &g_work_results[i], &work_ids[i]);
+    }
+
+    for (i = 0; i < 4; i++)
+    {
+        OS_WorkWait(g_work_queue_id, work_ids[i]);
+    }
+
+    *((uint32 *)arg) = 1;
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_WorkQueueCreate
+** Purpose: Creates a work queue and its worker tasks
+** Parameters: To-be-filled-in
+** Returns: OS_INVALID_POINTER if any of the pointers passed in is null
+**          OS_ERR_NAME_TOO_LONG if the name passed in is too long
+**          OS_ERR_INVALID_PRIORITY if the priority passed in is bad
+**          OS_ERR_NAME_TAKEN if the name passed in has already been used
+**          OS_ERROR if the number of workers is bad or the OS call failed
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_work_queue_create_test()
+{
+    UT_OsApiInfo_t apiInfo;
+    int32 res = 0, idx = 0;
+    const char* testDesc = NULL;
+    uint32 queue_id;
+    uint32 queue_id2;
+    uint32 task_id;
+    char   long_queue_name[OS_MAX_API_NAME];
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_WorkQueueCreate(&queue_id, "WorkQ", 1, UT_WORK_QUEUE_PRIORITY, 0);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_work_queue_create_test_exit_tag;
+    }
+
+    /* Clean up */
+    res = OS_WorkQueueDelete(queue_id);
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg-1";
+
+    res = OS_WorkQueueCreate(NULL, "WorkQ", 1, UT_WORK_QUEUE_PRIORITY, 0);
+    if (res == OS_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Null-pointer-arg-2";
+
+    res = OS_WorkQueueCreate(&queue_id, NULL, 1, UT_WORK_QUEUE_PRIORITY, 0);
+    if (res == OS_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Name-too-long";
+
+    /* must leave room for the worker task suffix */
+    memset(long_queue_name, 'X', sizeof(long_queue_name));
+    long_queue_name[sizeof(long_queue_name)-3] = '\0';
+    res = OS_WorkQueueCreate(&queue_id, long_queue_name, 1, UT_WORK_QUEUE_PRIORITY, 0);
+    if (res == OS_ERR_NAME_TOO_LONG)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Invalid-priority";
+
+    res = OS_WorkQueueCreate(&queue_id, "WorkQ", 1, 256, 0);
+    if (res == OS_ERR_INVALID_PRIORITY)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Invalid-worker-count";
+
+    res = OS_WorkQueueCreate(&queue_id, "WorkQ", 0, UT_WORK_QUEUE_PRIORITY, 0);
+    if (res == OS_ERROR)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#6 Duplicate-name";
+
+    res = OS_WorkQueueCreate(&queue_id, "WorkQ", 1, UT_WORK_QUEUE_PRIORITY, 0);
+    if (res != OS_SUCCESS)
+    {
+        testDesc = "#6 Duplicate-name - Work-Queue-Create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        res = OS_WorkQueueCreate(&queue_id2, "WorkQ", 1, UT_WORK_QUEUE_PRIORITY, 0);
+        if (res == OS_ERR_NAME_TAKEN)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Reset test environment */
+        res = OS_WorkQueueDelete(queue_id);
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#7 Nominal";
+
+    /* The workers must show up in the task table */
+    res = OS_WorkQueueCreate(&queue_id, "WorkQ", UT_WORK_QUEUE_WORKERS, UT_WORK_QUEUE_PRIORITY, 0);
+    if (res == OS_SUCCESS && OS_TaskGetIdByName(&task_id, "WorkQ.0") == OS_SUCCESS)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    res = OS_WorkQueueDelete(queue_id);
+
+UT_os_work_queue_create_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_WorkQueueCreate", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_WorkQueueDelete
+** Purpose: Stops the workers and frees a work queue
+** Parameters: To-be-filled-in
+** Returns: OS_ERR_INVALID_ID if the id passed in is not a valid work queue
+**          OS_SUCCESS if succeeded
+**          (OS_TaskDelete returns OS_ERROR for the queue's worker tasks)
+**--------------------------------------------------------------------------------*/
+void UT_os_work_queue_delete_test()
+{
+    UT_OsApiInfo_t apiInfo;
+    int32 res = 0, idx = 0;
+    const char* testDesc = NULL;
+    uint32 queue_id;
+    uint32 task_id;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_WorkQueueDelete(99999) == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_work_queue_delete_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Invalid-ID-arg";
+
+    if (OS_WorkQueueDelete(99999) == OS_ERR_INVALID_ID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Nominal";
+
+    /* Items still queued at delete time are run before the workers exit */
+    res = OS_WorkQueueCreate(&queue_id, "DeleteQ", 2, UT_WORK_QUEUE_PRIORITY, 0);
+    if (res != OS_SUCCESS)
+    {
+        testDesc = "#2 Nominal - Work-Queue-Create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        g_work_count = 0;
+        OS_WorkSubmit(queue_id, UT_os_work_item, &g_work_results[0], NULL);
+        OS_WorkSubmit(queue_id, UT_os_work_item, &g_work_results[1], NULL);
+
+        res = OS_WorkQueueDelete(queue_id);
+        if (res == OS_SUCCESS && g_work_count == 2 &&
+            OS_TaskGetIdByName(&task_id, "DeleteQ.0") == OS_ERR_NAME_NOT_FOUND)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Worker-task-delete";
+
+    /* Workers can not be deleted on their own, or OS_WorkQueueDelete would wait forever */
+    res = OS_WorkQueueCreate(&queue_id, "DeleteQ", 1, UT_WORK_QUEUE_PRIORITY, 0);
+    if (res != OS_SUCCESS)
+    {
+        testDesc = "#3 Worker-task-delete - Work-Queue-Create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        if (OS_TaskGetIdByName(&task_id, "DeleteQ.0") == OS_SUCCESS &&
+            OS_TaskDelete(task_id) == OS_ERROR &&
+            OS_WorkQueueDelete(queue_id) == OS_SUCCESS)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+UT_os_work_queue_delete_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_WorkQueueDelete", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_WorkSubmit / OS_WorkWait
+** Purpose: Queues a work item and waits for it to complete
+** Parameters: To-be-filled-in
+** Returns: OS_INVALID_POINTER if the function pointer is null
+**          OS_ERR_INVALID_ID if the queue or work id is not valid
+**          OS_QUEUE_FULL if too many items are outstanding
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_work_submit_test()
+{
+    UT_OsApiInfo_t apiInfo;
+    int32 res = 0, idx = 0;
+    const char* testDesc = NULL;
+    uint32 work_id;
+    uint32 done = 0;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_WorkQueueCreate(&g_work_queue_id, "SubmitQ", UT_WORK_QUEUE_WORKERS,
+                             UT_WORK_QUEUE_PRIORITY, 0);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_work_submit_test_exit_tag;
+    }
+    else if (res != OS_SUCCESS)
+    {
+        testDesc = "#0 Setup - Work-Queue-Create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_work_submit_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if (OS_WorkSubmit(g_work_queue_id, NULL, NULL, &work_id) == OS_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-ID-arg";
+
+    if (OS_WorkSubmit(99999, UT_os_work_item, &done, &work_id) == OS_ERR_INVALID_ID &&
+        OS_WorkWait(g_work_queue_id, 0xFFFFFFFF) == OS_ERR_INVALID_ID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Wait-from-worker";
+
+    memset(g_work_results, 0, sizeof(g_work_results));
+    res = OS_WorkSubmit(g_work_queue_id, UT_os_work_item_fanout, &done, &work_id);
+    if (res == OS_SUCCESS && OS_WorkWait(g_work_queue_id, work_id) == OS_SUCCESS &&
+        done == 1 && g_work_results[0] == 1 && g_work_results[3] == 1)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Nominal";
+
+    memset(g_work_results, 0, sizeof(g_work_results));
+    res = OS_WorkSubmit(g_work_queue_id, UT_os_work_item, &g_work_results[0], &work_id);
+    if (res == OS_SUCCESS && OS_WorkWait(g_work_queue_id, work_id) == OS_SUCCESS &&
+        g_work_results[0] == 1 && OS_WorkWait(g_work_queue_id, work_id) == OS_ERR_INVALID_ID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    res = OS_WorkQueueDelete(g_work_queue_id);
+
+UT_os_work_submit_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_WorkSubmit", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_WorkSubmitGroup / OS_WorkGroupWait
+** Purpose: Waits for all the items of a group to complete
+** Parameters: To-be-filled-in
+** Returns: OS_ERR_INVALID_ID if the id passed in is not a valid work queue
+**          OS_ERROR if the group number is bad
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_work_group_wait_test()
+{
+    UT_OsApiInfo_t apiInfo;
+    int32 res = 0, idx = 0;
+    const char* testDesc = NULL;
+    uint32 queue_id;
+    uint32 i;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_WorkGroupWait(99999, 0) == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_work_group_wait_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Invalid-ID-arg";
+
+    if (OS_WorkGroupWait(99999, 0) == OS_ERR_INVALID_ID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    res = OS_WorkQueueCreate(&queue_id, "GroupQ", UT_WORK_QUEUE_WORKERS, UT_WORK_QUEUE_PRIORITY, 0);
+    if (res != OS_SUCCESS)
+    {
+        testDesc = "#2 Setup - Work-Queue-Create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_work_group_wait_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-group-arg";
+
+    if (OS_WorkGroupWait(queue_id, 0xFFFF) == OS_ERROR &&
+        OS_WorkSubmitGroup(queue_id, 0xFFFF, UT_os_work_item, &g_work_results[0]) == OS_ERROR)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Nominal";
+
+    memset(g_work_results, 0, sizeof(g_work_results));
+    g_work_count = 0;
+    for (i = 0; i < UT_WORK_ITEM_COUNT; i++)
+    {
+        res = OS_WorkSubmitGroup(queue_id, 1, UT_os_work_item, &g_work_results[i]);
+        if (res != OS_SUCCESS)
+        {
+            break;
+        }
+    }
+
+    if (res == OS_SUCCESS && OS_WorkGroupWait(queue_id, 1) == OS_SUCCESS &&
+        g_work_count == UT_WORK_ITEM_COUNT && g_work_results[UT_WORK_ITEM_COUNT-1] == 1)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    res = OS_WorkQueueDelete(queue_id);
+
+UT_os_work_group_wait_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_WorkGroupWait", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_WorkQueueGetInfo
+** Purpose: Returns the properties of a work queue
+** Parameters: To-be-filled-in
+** Returns: OS_INVALID_POINTER if the pointer passed in is null
+**          OS_ERR_INVALID_ID if the id passed in is not a valid work queue
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_work_queue_get_info_test()
+{
+    UT_OsApiInfo_t apiInfo;
+    int32 res = 0, idx = 0;
+    const char* testDesc = NULL;
+    uint32 queue_id;
+    uint32 work_id;
+    OS_work_queue_prop_t queue_prop;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_WorkQueueGetInfo(99999, &queue_prop) == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_work_queue_get_info_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Invalid-ID-arg";
+
+    if (OS_WorkQueueGetInfo(99999, &queue_prop) == OS_ERR_INVALID_ID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    res = OS_WorkQueueCreate(&queue_id, "InfoQ", 2, UT_WORK_QUEUE_PRIORITY, 0);
+    if (res != OS_SUCCESS)
+    {
+        testDesc = "#2 Setup - Work-Queue-Create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_work_queue_get_info_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-pointer-arg";
+
+    if (OS_WorkQueueGetInfo(queue_id, NULL) == OS_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Nominal";
+
+    OS_WorkSubmit(queue_id, UT_os_work_item, &g_work_results[0], &work_id);
+    OS_WorkWait(queue_id, work_id);
+    res = OS_WorkQueueGetInfo(queue_id, &queue_prop);
+    if (res == OS_SUCCESS && strcmp(queue_prop.name, "InfoQ") == 0 &&
+        queue_prop.num_workers == 2 && queue_prop.completed == 1 && queue_prop.pending == 0)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    res = OS_WorkQueueDelete(queue_id);
+
+UT_os_work_queue_get_info_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_WorkQueueGetInfo", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*================================================================================*
+** End of File: ut_oscore_workqueue_test.c
+**================================================================================*/
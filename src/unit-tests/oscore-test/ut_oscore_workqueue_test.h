@@ -0,0 +1,46 @@
+/*================================================================================*
+** File:  ut_oscore_workqueue_test.h
+**================================================================================*/
+
+#ifndef _UT_OSCORE_WORKQUEUE_TEST_H_
+#define _UT_OSCORE_WORKQUEUE_TEST_H_
+
+/*--------------------------------------------------------------------------------*
+** Includes
+**--------------------------------------------------------------------------------*/
+
+#include "ut_os_stubs.h"
+
+/*--------------------------------------------------------------------------------*
+** Macros
+**--------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*
+** Data types
+**--------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*
+** External global variables
+**--------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*
+** Global variables
+**--------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*
+** Function prototypes
+**--------------------------------------------------------------------------------*/
+
+void UT_os_work_queue_create_test(void);
+void UT_os_work_queue_delete_test(void);
+void UT_os_work_submit_test(void);
+void UT_os_work_group_wait_test(void);
+void UT_os_work_queue_get_info_test(void);
+
+/*--------------------------------------------------------------------------------*/
+
+#endif  /* _UT_OSCORE_WORKQUEUE_TEST_H_ */
+
+/*================================================================================*
+** End of File: ut_oscore_workqueue_test.h
+**================================================================================*/
@@ -52,6 +52,7 @@ char  g_dirItems[UT_OS_FILE_MAX_DIRS][UT_OS_SM_TEXT_LEN];
 **--------------------------------------------------------------------------------*/
 
 void UT_os_read_n_sort_dirs(os_dirp_t);
+int32 UT_os_dirwalk_callback(const char *, const os_dirent_stat_t *, void *);
 
 /*--------------------------------------------------------------------------------*
 ** Local function definitions
@@ -902,6 +903,392 @@ UT_os_removedir_test_exit_tag:
     UT_OS_LOG_API_MACRO(apiInfo)
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_DirReadBatch(os_dirp_t directory, os_dirent_stat_t *entries,
+**                               uint32 max_entries)
+** Purpose: Reads several directory entries with their type, size and modification time
+** Parameters: directory - a directory descriptor pointer that was returned from
+**                         a call to OS_opendir()
+**             *entries - array that will hold the entries read
+**             max_entries - number of elements in entries
+** Returns: OS_FS_ERR_INVALID_POINTER if any of the pointers passed in is null
+**          OS_FS_ERROR if max_entries is zero or the OS call failed
+**          The number of entries read, 0 at the end of the directory
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null directory and then null entries as argument
+**   2) Expect both returned values to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Nominal condition
+**   1) Call OS_mkdir() to create a directory, then a subdirectory and a file of
+**      known size in it
+**   2) Call OS_opendir() with directory name used in #1 as argument
+**   3) Call this routine with the directory descriptor pointer returned in #2
+**   4) Expect the returned value to be
+**        (a) 2, with the subdirectory as OS_DIRENT_TYPE_DIR __and__
+**        (b) the file as OS_DIRENT_TYPE_FILE of the size written
+**   5) Call this routine again
+**   6) Expect the returned value to be
+**        (a) 0
+**--------------------------------------------------------------------------------*/
+void UT_os_readdirbatch_test()
+{
+    int32 idx=0, i=0, count=0, fileDesc=-1;
+    int32 foundDir=0, foundFile=0;
+    os_dirp_t dirHdl=NULL;
+    os_dirent_stat_t entries[8];
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    strcpy(g_subdirNames[0], " ");
+    strcpy(g_fileName, " ");
+    strcpy(g_dirName, " ");
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_DirReadBatch(NULL, entries, 8) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_readdirbatch_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    memset(g_dirName, '\0', sizeof(g_dirName));
+    UT_os_sprintf(g_dirName, "%s/batch_Nominal", g_mntName);
+    if (OS_mkdir(g_dirName, 755) != OS_FS_SUCCESS)
+    {
+        testDesc = "#1 Null-pointer-arg - Dir-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_readdirbatch_test_exit_tag;
+    }
+
+    dirHdl = OS_opendir(g_dirName);
+    if (dirHdl == NULL)
+    {
+        testDesc = "#1 Null-pointer-arg - Dir-open failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_readdirbatch_test_exit_tag;
+    }
+
+    if ((OS_DirReadBatch(NULL, entries, 8) == OS_FS_ERR_INVALID_POINTER) &&
+        (OS_DirReadBatch(dirHdl, NULL, 8) == OS_FS_ERR_INVALID_POINTER))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    OS_closedir(dirHdl);
+    dirHdl = NULL;
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Nominal";
+
+    memset(g_subdirNames[0], '\0', sizeof(g_subdirNames[0]));
+    UT_os_sprintf(g_subdirNames[0], "%s/batch_Nominal/%s", g_mntName, g_tgtSubdirs[0]);
+    memset(g_fileName, '\0', sizeof(g_fileName));
+    UT_os_sprintf(g_fileName, "%s/batch_Nominal/batch_File.txt", g_mntName);
+
+    if (OS_mkdir(g_subdirNames[0], 755) != OS_FS_SUCCESS)
+    {
+        testDesc = "#2 Nominal - Dir-create(subdir1) failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_readdirbatch_test_exit_tag;
+    }
+
+    fileDesc = OS_creat(g_fileName, OS_READ_WRITE);
+    if ((fileDesc < 0) || (OS_write(fileDesc, "12345", 5) != 5))
+    {
+        testDesc = "#2 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_readdirbatch_test_exit_tag;
+    }
+    OS_close(fileDesc);
+
+    dirHdl = OS_opendir(g_dirName);
+    if (dirHdl == NULL)
+    {
+        testDesc = "#2 Nominal - Dir-open failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_readdirbatch_test_exit_tag;
+    }
+
+    count = OS_DirReadBatch(dirHdl, entries, 8);
+    for (i=0; i < count; i++)
+    {
+        if ((strcmp(entries[i].Name, g_tgtSubdirs[0]) == 0) &&
+            (entries[i].Type == OS_DIRENT_TYPE_DIR))
+            foundDir++;
+        if ((strcmp(entries[i].Name, "batch_File.txt") == 0) &&
+            (entries[i].Type == OS_DIRENT_TYPE_FILE) && (entries[i].Size == 5) &&
+            (entries[i].MTime > 0))
+            foundFile++;
+    }
+
+    if ((count == 2) && (foundDir == 1) && (foundFile == 1) &&
+        (OS_DirReadBatch(dirHdl, entries, 8) == 0))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+UT_os_readdirbatch_test_exit_tag:
+    /* Reset test environment */
+    if (dirHdl != NULL)
+        OS_closedir(dirHdl);
+    OS_remove(g_fileName);
+    OS_rmdir(g_subdirNames[0]);
+    OS_rmdir(g_dirName);
+
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_DirReadBatch", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+typedef struct
+{
+    uint32 mutId;
+    uint32 calls;
+    uint32 dirs;
+    uint32 files;
+    uint64 bytes;
+    int32  result;
+} UT_os_dirwalk_count_t;
+
+int32 UT_os_dirwalk_callback(const char *dir_path, const os_dirent_stat_t *entry, void *arg)
+{
+    UT_os_dirwalk_count_t *counts = (UT_os_dirwalk_count_t *)arg;
+
+    OS_MutSemTake(counts->mutId);
+    counts->calls++;
+    if (entry->Type == OS_DIRENT_TYPE_DIR)
+        counts->dirs++;
+    else if (entry->Type == OS_DIRENT_TYPE_FILE)
+    {
+        counts->files++;
+        counts->bytes += entry->Size;
+    }
+    OS_MutSemGive(counts->mutId);
+
+    return (counts->result);
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_DirWalk(const char *path, OS_DirWalkCallback_t callback,
+**                          void *callback_arg, uint32 flags)
+** Purpose: Calls a function for every object below a directory
+** Parameters: *path - pointer to the absolute pathname of the directory to walk
+**             callback - function called for every object found
+**             *callback_arg - argument passed to callback
+**             flags - OS_DIRWALK_PARALLEL or 0
+** Returns: OS_FS_ERR_INVALID_POINTER if any of the pointers passed in is null
+**          OS_FS_ERR_PATH_TOO_LONG if path is too long
+**          OS_FS_ERR_PATH_INVALID if path is invalid
+**          OS_FS_ERROR if the flags are unknown or a directory could not be read
+**          The first value other than OS_SUCCESS returned by callback
+**          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null path and then a null callback as argument
+**   2) Expect both returned values to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Path-too-long-arg condition
+**   1) Call this routine with a really long path as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_PATH_TOO_LONG
+** -----------------------------------------------------
+** Test #3: Invalid-path-arg condition
+**   1) Call this routine with a non-existing path as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_PATH_INVALID
+** -----------------------------------------------------
+** Test #4: Invalid-flags-arg condition
+**   1) Call this routine with an unknown flag
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #5: Nominal condition
+**   1) Create a directory holding two subdirectories and a file, with another
+**      file in the first subdirectory
+**   2) Call this routine on the directory of #1
+**   3) Expect the returned value to be
+**        (a) OS_FS_SUCCESS __and__
+**        (b) callback to have seen both subdirectories, both files and their sizes
+** -----------------------------------------------------
+** Test #6: Parallel condition
+**   1) Repeat #5 with OS_DIRWALK_PARALLEL
+** -----------------------------------------------------
+** Test #7: Callback-stop condition
+**   1) Call this routine on the directory of #5 with a callback that returns OS_ERROR
+**   2) Expect the returned value to be
+**        (a) OS_ERROR __and__
+**        (b) callback to have been called once
+**--------------------------------------------------------------------------------*/
+void UT_os_dirwalk_test()
+{
+    int32 idx=0, i=0, res=0, fileDesc=-1, mutCreated=0;
+    UT_os_dirwalk_count_t counts;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+    char walkFiles[2][UT_OS_SM_TEXT_LEN];
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    memset(&counts, 0, sizeof(counts));
+    strcpy(g_subdirNames[0], " ");
+    strcpy(g_subdirNames[1], " ");
+    strcpy(walkFiles[0], " ");
+    strcpy(walkFiles[1], " ");
+    strcpy(g_dirName, " ");
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_DirWalk(NULL, NULL, NULL, 0) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_dirwalk_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if ((OS_DirWalk(NULL, UT_os_dirwalk_callback, &counts, 0) == OS_FS_ERR_INVALID_POINTER) &&
+        (OS_DirWalk(g_mntName, NULL, &counts, 0) == OS_FS_ERR_INVALID_POINTER))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Path-too-long-arg";
+
+    if (OS_DirWalk(g_longPathName, UT_os_dirwalk_callback, &counts, 0) == OS_FS_ERR_PATH_TOO_LONG)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Invalid-path-arg";
+
+    if (OS_DirWalk("tmpDir", UT_os_dirwalk_callback, &counts, 0) == OS_FS_ERR_PATH_INVALID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Invalid-flags-arg";
+
+    if (OS_DirWalk(g_mntName, UT_os_dirwalk_callback, &counts, 0x80) == OS_FS_ERROR)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Nominal";
+
+    if (OS_MutSemCreate(&counts.mutId, "UT_DirWalk", 0) != OS_SUCCESS)
+    {
+        testDesc = "#5 Nominal - Mutex-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_dirwalk_test_exit_tag;
+    }
+    mutCreated = 1;
+
+    memset(g_dirName, '\0', sizeof(g_dirName));
+    UT_os_sprintf(g_dirName, "%s/walk_Nominal", g_mntName);
+    for (i=0; i < 2; i++)
+    {
+        memset(g_subdirNames[i], '\0', sizeof(g_subdirNames[i]));
+        UT_os_sprintf(g_subdirNames[i], "%s/%s", g_dirName, g_tgtSubdirs[i]);
+        memset(walkFiles[i], '\0', sizeof(walkFiles[i]));
+    }
+    UT_os_sprintf(walkFiles[0], "%s/walk_Nominal/%s/walk_File1.txt", g_mntName, g_tgtSubdirs[0]);
+    UT_os_sprintf(walkFiles[1], "%s/walk_Nominal/walk_File2.txt", g_mntName);
+
+    if ((OS_mkdir(g_dirName, 755) != OS_FS_SUCCESS) ||
+        (OS_mkdir(g_subdirNames[0], 755) != OS_FS_SUCCESS) ||
+        (OS_mkdir(g_subdirNames[1], 755) != OS_FS_SUCCESS))
+    {
+        testDesc = "#5 Nominal - Dir-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_dirwalk_test_exit_tag;
+    }
+
+    for (i=0; i < 2; i++)
+    {
+        fileDesc = OS_creat(walkFiles[i], OS_READ_WRITE);
+        if ((fileDesc < 0) || (OS_write(fileDesc, "1234567", 3 + i) != 3 + i))
+        {
+            testDesc = "#5 Nominal - File-create failed";
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+            OS_close(fileDesc);
+            goto UT_os_dirwalk_test_exit_tag;
+        }
+        OS_close(fileDesc);
+    }
+
+    counts.calls = counts.dirs = counts.files = 0;
+    counts.bytes = 0;
+    counts.result = OS_SUCCESS;
+    res = OS_DirWalk(g_dirName, UT_os_dirwalk_callback, &counts, 0);
+    if ((res == OS_FS_SUCCESS) && (counts.calls == 4) && (counts.dirs == 2) &&
+        (counts.files == 2) && (counts.bytes == 7))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#6 Parallel";
+
+    counts.calls = counts.dirs = counts.files = 0;
+    counts.bytes = 0;
+    res = OS_DirWalk(g_dirName, UT_os_dirwalk_callback, &counts, OS_DIRWALK_PARALLEL);
+    if ((res == OS_FS_SUCCESS) && (counts.calls == 4) && (counts.dirs == 2) &&
+        (counts.files == 2) && (counts.bytes == 7))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#7 Callback-stop";
+
+    counts.calls = 0;
+    counts.result = OS_ERROR;
+    res = OS_DirWalk(g_dirName, UT_os_dirwalk_callback, &counts, 0);
+    if ((res == OS_ERROR) && (counts.calls == 1))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+UT_os_dirwalk_test_exit_tag:
+    /* Reset test environment */
+    OS_remove(walkFiles[0]);
+    OS_remove(walkFiles[1]);
+    OS_rmdir(g_subdirNames[0]);
+    OS_rmdir(g_subdirNames[1]);
+    OS_rmdir(g_dirName);
+    if (mutCreated)
+        OS_MutSemDelete(counts.mutId);
+
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_DirWalk", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
 /*--------------------------------------------------------------------------------*
  * Internal helper function
 **--------------------------------------------------------------------------------*/
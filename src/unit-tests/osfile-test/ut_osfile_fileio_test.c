@@ -1084,19 +1084,3229 @@ UT_os_writefile_test_exit_tag:
     UT_OS_LOG_API_MACRO(apiInfo)
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_pread(int32 filedes, void *buffer, uint32 nbytes, uint64 offset)
+** Purpose: Reads nBytes from the given offset of the file of a given file descriptor
+**          without moving the file offset
+** Parameters: filedes - a file descriptor
+**             *buffer - pointer that will hold the data read from file
+**             nbytes - the number of bytes to be read from file
+**             offset - the position in the file to read from
+** Returns: OS_FS_ERR_INVALID_POINTER if the pointer passed in is null
+**          OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+**          OS_FS_ERROR if the offset is not supported or the OS call failed
+**          The number of bytes read if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null pointer as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Invalid-offset-arg condition
+**   1) Call this routine with an offset that does not fit a signed 64 bit value
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #3: Invalid-file-desc-arg condition
+**   1) Call this routine with a file descriptor of 99999 as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_FD
+** -----------------------------------------------------
+** Test #4: OS-call-failure condition
+**   1) Setup the test to fail OS call inside this routine
+**   2) Call this routine
+**   3) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #5: Nominal condition
+**   1) Call OS_creat() to create and open a file
+**   2) Call OS_write() to write some text to the file
+**   3) Call this routine to read part of the text from the middle of the file
+**   4) Expect the returned value to be
+**        (a) the number of bytes asked for __and__
+**        (b) the read buffer to hold the text at that offset
+**   5) Call OS_lseek() with OS_SEEK_CUR and a zero offset
+**   6) Expect the returned value to be
+**        (a) the length of the text written in #2
+**--------------------------------------------------------------------------------*/
+void UT_os_preadfile_test()
+{
+    int32 idx=0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_pread(99999, NULL, 0, 0) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_preadfile_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Pread_NullPtr.txt", g_mntName);
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#1 Null-pointer-arg - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        if (OS_pread(g_fDescs[0], NULL, sizeof(g_readBuff), 0) == OS_FS_ERR_INVALID_POINTER)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /*-----------------------------------------------------*/
+        testDesc = "#2 Invalid-offset-arg";
+
+        if (OS_pread(g_fDescs[0], g_readBuff, sizeof(g_readBuff), 0x8000000000000000ULL) == OS_FS_ERROR)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Reset test environment */
+        OS_close(g_fDescs[0]);
+        OS_remove(g_fNames[0]);
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Invalid-file-desc-arg";
+
+    if (OS_pread(99999, g_readBuff, sizeof(g_readBuff), 0) == OS_FS_ERR_INVALID_FD)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 OS-call-failure";
+
+    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_UOF)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Nominal";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Pread_Nominal.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#5 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_preadfile_test_exit_tag;
+    }
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "A HORSE! A HORSE! MY KINGDOM FOR A HORSE!");
+    if (OS_write(g_fDescs[0], g_writeBuff, strlen(g_writeBuff)) != strlen(g_writeBuff))
+    {
+        testDesc = "#5 Nominal - File-write failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+
+        /* Reset test environment */
+        OS_close(g_fDescs[0]);
+        OS_remove(g_fNames[0]);
+
+        goto UT_os_preadfile_test_exit_tag;
+    }
+
+    memset(g_readBuff, '\0', sizeof(g_readBuff));
+    if ((OS_pread(g_fDescs[0], g_readBuff, 10, 18) == 10) &&
+        (strcmp(g_readBuff, "MY KINGDOM") == 0) &&
+        (OS_lseek(g_fDescs[0], 0, OS_SEEK_CUR) == strlen(g_writeBuff)))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_preadfile_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_pread", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_pwrite(int32 filedes, void *buffer, uint32 nbytes, uint64 offset)
+** Purpose: Writes nBytes from the given buffer at the given offset of the file of a
+**          given file descriptor without moving the file offset
+** Parameters: filedes - a file descriptor
+**             *buffer - pointer that holds the data to be written to file
+**             nbytes - the maximum number of bytes to copy to file
+**             offset - the position in the file to write at
+** Returns: OS_FS_ERR_INVALID_POINTER if the pointer passed in is null
+**          OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+**          OS_FS_ERROR if the offset is not supported or the OS call failed
+**          The number of bytes written if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null pointer as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Invalid-file-desc-arg condition
+**   1) Call this routine with a file descriptor of 99999 as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_FD
+** -----------------------------------------------------
+** Test #3: OS-call-failure condition
+**   1) Setup the test to fail OS call inside this routine
+**   2) Call this routine
+**   3) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #4: Nominal condition
+**   1) Call OS_creat() to create and open a file
+**   2) Call OS_write() to write some text to the file
+**   3) Call this routine to overwrite part of the text in the middle of the file
+**   4) Expect the returned value to be
+**        (a) the number of bytes in the write buffer
+**   5) Call OS_lseek() with OS_SEEK_CUR and a zero offset
+**   6) Expect the returned value to be
+**        (a) the length of the text written in #2
+**   7) Call OS_pread() to read the whole file back
+**   8) Expect the text to hold the bytes written in #3 at their offset and the
+**      text from #2 everywhere else
+**--------------------------------------------------------------------------------*/
+void UT_os_pwritefile_test()
+{
+    int32 idx=0;
+    char patchBuff[] = "QUEENDOM";
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_pwrite(99999, NULL, 0, 0) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_pwritefile_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Pwrite_NullPtr.txt", g_mntName);
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#1 Null-pointer-arg - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        if (OS_pwrite(g_fDescs[0], NULL, sizeof(g_writeBuff), 0) == OS_FS_ERR_INVALID_POINTER)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Reset test environment */
+        OS_close(g_fDescs[0]);
+        OS_remove(g_fNames[0]);
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-file-desc-arg";
+
+    if (OS_pwrite(99999, g_writeBuff, sizeof(g_writeBuff), 0) == OS_FS_ERR_INVALID_FD)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 OS-call-failure";
+
+    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_UOF)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Nominal";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Pwrite_Nominal.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#4 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_pwritefile_test_exit_tag;
+    }
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "A HORSE! A HORSE! MY KINGDOM FOR A HORSE!");
+    if (OS_write(g_fDescs[0], g_writeBuff, strlen(g_writeBuff)) != strlen(g_writeBuff))
+    {
+        testDesc = "#4 Nominal - File-write failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+
+        /* Reset test environment */
+        OS_close(g_fDescs[0]);
+        OS_remove(g_fNames[0]);
+
+        goto UT_os_pwritefile_test_exit_tag;
+    }
+
+    memset(g_readBuff, '\0', sizeof(g_readBuff));
+    if ((OS_pwrite(g_fDescs[0], patchBuff, strlen(patchBuff), 23) == strlen(patchBuff)) &&
+        (OS_lseek(g_fDescs[0], 0, OS_SEEK_CUR) == strlen(g_writeBuff)) &&
+        (OS_pread(g_fDescs[0], g_readBuff, strlen(g_writeBuff), 0) == strlen(g_writeBuff)) &&
+        (strcmp(g_readBuff, "A HORSE! A HORSE! MY KIQUEENDOMR A HORSE!") == 0))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_pwritefile_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_pwrite", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_readv(int32 filedes, const os_iovec_t *iov, uint32 iovcnt)
+** Purpose: Reads from the file of a given file descriptor into several buffers in turn
+** Parameters: filedes - a file descriptor
+**             *iov - pointer to an array of iovcnt segments
+**             iovcnt - the number of segments, at most OS_FS_MAX_IOVEC
+** Returns: OS_FS_ERR_INVALID_POINTER if iov or a segment buffer is null
+**          OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+**          OS_FS_ERROR if there are too many segments or the OS call failed
+**          The number of bytes transferred if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null iov, then with a segment whose buffer is null
+**   2) Expect both returned values to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Too-many-segments-arg condition
+**   1) Call this routine with iovcnt of OS_FS_MAX_IOVEC+1
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #3: Invalid-file-desc-arg condition
+**   1) Call this routine with a file descriptor of 99999 as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_FD
+** -----------------------------------------------------
+** Test #4: OS-call-failure condition
+**   1) Setup the test to fail OS call inside this routine
+**   2) Call this routine
+**   3) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #5: Nominal condition
+**   1) Call OS_creat() to create and open a file
+**   2) Call OS_write() to write some text to the file
+**   3) Call OS_lseek() to go back to the start of the file
+**   4) Call this routine with two segments, one of 8 bytes and one for the rest
+**   5) Expect the returned value to be
+**        (a) the number of bytes written in #2 __and__
+**        (b) the two segments to hold the text split after 8 bytes
+**--------------------------------------------------------------------------------*/
+void UT_os_readvfile_test()
+{
+    int32 idx=0;
+    uint32 idx2;
+    char hdrBuff[8];
+    os_iovec_t iov[OS_FS_MAX_IOVEC + 1];
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_readv(99999, NULL, 0) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_readvfile_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Readv_NullPtr.txt", g_mntName);
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#1 Null-pointer-arg - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        iov[0].buffer = hdrBuff;
+        iov[0].length = sizeof(hdrBuff);
+        iov[1].buffer = NULL;
+        iov[1].length = sizeof(hdrBuff);
+        if ((OS_readv(g_fDescs[0], NULL, 1) == OS_FS_ERR_INVALID_POINTER) &&
+            (OS_readv(g_fDescs[0], iov, 2) == OS_FS_ERR_INVALID_POINTER))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /*-----------------------------------------------------*/
+        testDesc = "#2 Too-many-segments-arg";
+
+        for (idx2 = 0; idx2 <= OS_FS_MAX_IOVEC; ++idx2)
+        {
+            iov[idx2].buffer = hdrBuff;
+            iov[idx2].length = 1;
+        }
+        if (OS_readv(g_fDescs[0], iov, OS_FS_MAX_IOVEC + 1) == OS_FS_ERROR)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Reset test environment */
+        OS_close(g_fDescs[0]);
+        OS_remove(g_fNames[0]);
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Invalid-file-desc-arg";
+
+    iov[0].buffer = hdrBuff;
+    iov[0].length = sizeof(hdrBuff);
+    if (OS_readv(99999, iov, 1) == OS_FS_ERR_INVALID_FD)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 OS-call-failure";
+
+    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_UOF)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Nominal";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Readv_Nominal.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#5 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_readvfile_test_exit_tag;
+    }
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "A HORSE! A HORSE! MY KINGDOM FOR A HORSE!");
+    memcpy(hdrBuff, "HEADER: ", sizeof(hdrBuff));
+    if ((OS_write(g_fDescs[0], g_writeBuff, strlen(g_writeBuff)) != strlen(g_writeBuff)) ||
+        (OS_lseek(g_fDescs[0], 0, OS_SEEK_SET) != 0))
+    {
+        testDesc = "#5 Nominal - File-write failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        memset(hdrBuff, '\0', sizeof(hdrBuff));
+        memset(g_readBuff, '\0', sizeof(g_readBuff));
+        iov[0].buffer = hdrBuff;
+        iov[0].length = sizeof(hdrBuff);
+        iov[1].buffer = g_readBuff;
+        iov[1].length = sizeof(g_readBuff) - 1;
+
+        if ((OS_readv(g_fDescs[0], iov, 2) == strlen(g_writeBuff)) &&
+            (memcmp(hdrBuff, g_writeBuff, sizeof(hdrBuff)) == 0) &&
+            (strcmp(g_readBuff, g_writeBuff + sizeof(hdrBuff)) == 0))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_readvfile_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_readv", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_writev(int32 filedes, const os_iovec_t *iov, uint32 iovcnt)
+** Purpose: Writes several buffers in turn to the file of a given file descriptor
+** Parameters: filedes - a file descriptor
+**             *iov - pointer to an array of iovcnt segments
+**             iovcnt - the number of segments, at most OS_FS_MAX_IOVEC
+** Returns: OS_FS_ERR_INVALID_POINTER if iov or a segment buffer is null
+**          OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+**          OS_FS_ERROR if there are too many segments or the OS call failed
+**          The number of bytes transferred if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null iov, then with a segment whose buffer is null
+**   2) Expect both returned values to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Too-many-segments-arg condition
+**   1) Call this routine with iovcnt of OS_FS_MAX_IOVEC+1
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #3: Invalid-file-desc-arg condition
+**   1) Call this routine with a file descriptor of 99999 as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_FD
+** -----------------------------------------------------
+** Test #4: OS-call-failure condition
+**   1) Setup the test to fail OS call inside this routine
+**   2) Call this routine
+**   3) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #5: Nominal condition
+**   1) Call OS_creat() to create and open a file
+**   2) Call this routine with two segments, a header and some text
+**   3) Expect the returned value to be
+**        (a) the total number of bytes in both segments
+**   4) Call OS_pread() to read the file back
+**   5) Expect the file to hold the header followed by the text
+**--------------------------------------------------------------------------------*/
+void UT_os_writevfile_test()
+{
+    int32 idx=0;
+    uint32 idx2;
+    char hdrBuff[8];
+    os_iovec_t iov[OS_FS_MAX_IOVEC + 1];
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_writev(99999, NULL, 0) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_writevfile_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Writev_NullPtr.txt", g_mntName);
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#1 Null-pointer-arg - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        iov[0].buffer = hdrBuff;
+        iov[0].length = sizeof(hdrBuff);
+        iov[1].buffer = NULL;
+        iov[1].length = sizeof(hdrBuff);
+        if ((OS_writev(g_fDescs[0], NULL, 1) == OS_FS_ERR_INVALID_POINTER) &&
+            (OS_writev(g_fDescs[0], iov, 2) == OS_FS_ERR_INVALID_POINTER))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /*-----------------------------------------------------*/
+        testDesc = "#2 Too-many-segments-arg";
+
+        for (idx2 = 0; idx2 <= OS_FS_MAX_IOVEC; ++idx2)
+        {
+            iov[idx2].buffer = hdrBuff;
+            iov[idx2].length = 1;
+        }
+        if (OS_writev(g_fDescs[0], iov, OS_FS_MAX_IOVEC + 1) == OS_FS_ERROR)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Reset test environment */
+        OS_close(g_fDescs[0]);
+        OS_remove(g_fNames[0]);
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Invalid-file-desc-arg";
+
+    iov[0].buffer = hdrBuff;
+    iov[0].length = sizeof(hdrBuff);
+    if (OS_writev(99999, iov, 1) == OS_FS_ERR_INVALID_FD)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 OS-call-failure";
+
+    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_UOF)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Nominal";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Writev_Nominal.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#5 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_writevfile_test_exit_tag;
+    }
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "A HORSE! A HORSE! MY KINGDOM FOR A HORSE!");
+    memcpy(hdrBuff, "HEADER: ", sizeof(hdrBuff));
+    iov[0].buffer = hdrBuff;
+    iov[0].length = sizeof(hdrBuff);
+    iov[1].buffer = g_writeBuff;
+    iov[1].length = strlen(g_writeBuff);
+
+    memset(g_readBuff, '\0', sizeof(g_readBuff));
+    if ((OS_writev(g_fDescs[0], iov, 2) == sizeof(hdrBuff) + strlen(g_writeBuff)) &&
+        (OS_pread(g_fDescs[0], g_readBuff, sizeof(g_readBuff) - 1, 0) == sizeof(hdrBuff) + strlen(g_writeBuff)) &&
+        (memcmp(g_readBuff, hdrBuff, sizeof(hdrBuff)) == 0) &&
+        (strcmp(g_readBuff + sizeof(hdrBuff), g_writeBuff) == 0))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_writevfile_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_writev", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_preadv(int32 filedes, const os_iovec_t *iov, uint32 iovcnt, uint64 offset)
+** Purpose: Reads into several buffers in turn from the given offset of the file of a given
+**          file descriptor without moving the file offset
+** Parameters: filedes - a file descriptor
+**             *iov - pointer to an array of iovcnt segments
+**             iovcnt - the number of segments, at most OS_FS_MAX_IOVEC
+**             offset - the position in the file to start at
+** Returns: OS_FS_ERR_INVALID_POINTER if iov or a segment buffer is null
+**          OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+**          OS_FS_ERROR if there are too many segments or the OS call failed
+**          The number of bytes transferred if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null iov, then with a segment whose buffer is null
+**   2) Expect both returned values to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Too-many-segments-arg condition
+**   1) Call this routine with iovcnt of OS_FS_MAX_IOVEC+1
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #3: Invalid-file-desc-arg condition
+**   1) Call this routine with a file descriptor of 99999 as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_FD
+** -----------------------------------------------------
+** Test #4: OS-call-failure condition
+**   1) Setup the test to fail OS call inside this routine
+**   2) Call this routine
+**   3) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #5: Nominal condition
+**   1) Call OS_creat() to create and open a file
+**   2) Call OS_write() to write some text to the file
+**   3) Call this routine with two segments, one of 8 bytes and one for the rest,
+**      starting at offset 9
+**   4) Expect the returned value to be
+**        (a) the number of bytes in the text after offset 9 __and__
+**        (b) the two segments to hold that text split after 8 bytes __and__
+**        (c) OS_lseek() with OS_SEEK_CUR to still report the end of #2
+**--------------------------------------------------------------------------------*/
+void UT_os_preadvfile_test()
+{
+    int32 idx=0;
+    uint32 idx2;
+    char hdrBuff[8];
+    os_iovec_t iov[OS_FS_MAX_IOVEC + 1];
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_preadv(99999, NULL, 0, 0) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_preadvfile_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Preadv_NullPtr.txt", g_mntName);
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#1 Null-pointer-arg - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        iov[0].buffer = hdrBuff;
+        iov[0].length = sizeof(hdrBuff);
+        iov[1].buffer = NULL;
+        iov[1].length = sizeof(hdrBuff);
+        if ((OS_preadv(g_fDescs[0], NULL, 1, 0) == OS_FS_ERR_INVALID_POINTER) &&
+            (OS_preadv(g_fDescs[0], iov, 2, 0) == OS_FS_ERR_INVALID_POINTER))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /*-----------------------------------------------------*/
+        testDesc = "#2 Too-many-segments-arg";
+
+        for (idx2 = 0; idx2 <= OS_FS_MAX_IOVEC; ++idx2)
+        {
+            iov[idx2].buffer = hdrBuff;
+            iov[idx2].length = 1;
+        }
+        if (OS_preadv(g_fDescs[0], iov, OS_FS_MAX_IOVEC + 1, 0) == OS_FS_ERROR)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Reset test environment */
+        OS_close(g_fDescs[0]);
+        OS_remove(g_fNames[0]);
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Invalid-file-desc-arg";
+
+    iov[0].buffer = hdrBuff;
+    iov[0].length = sizeof(hdrBuff);
+    if (OS_preadv(99999, iov, 1, 0) == OS_FS_ERR_INVALID_FD)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 OS-call-failure";
+
+    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_UOF)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Nominal";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Preadv_Nominal.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#5 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_preadvfile_test_exit_tag;
+    }
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "A HORSE! A HORSE! MY KINGDOM FOR A HORSE!");
+    memcpy(hdrBuff, "HEADER: ", sizeof(hdrBuff));
+    if (OS_write(g_fDescs[0], g_writeBuff, strlen(g_writeBuff)) != strlen(g_writeBuff))
+    {
+        testDesc = "#5 Nominal - File-write failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        memset(hdrBuff, '\0', sizeof(hdrBuff));
+        memset(g_readBuff, '\0', sizeof(g_readBuff));
+        iov[0].buffer = hdrBuff;
+        iov[0].length = sizeof(hdrBuff);
+        iov[1].buffer = g_readBuff;
+        iov[1].length = sizeof(g_readBuff) - 1;
+
+        if ((OS_preadv(g_fDescs[0], iov, 2, 9) == strlen(g_writeBuff) - 9) &&
+            (memcmp(hdrBuff, g_writeBuff + 9, sizeof(hdrBuff)) == 0) &&
+            (strcmp(g_readBuff, g_writeBuff + 9 + sizeof(hdrBuff)) == 0) &&
+            (OS_lseek(g_fDescs[0], 0, OS_SEEK_CUR) == strlen(g_writeBuff)))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_preadvfile_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_preadv", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_pwritev(int32 filedes, const os_iovec_t *iov, uint32 iovcnt, uint64 offset)
+** Purpose: Writes several buffers in turn at the given offset of the file of a given file
+**          descriptor without moving the file offset
+** Parameters: filedes - a file descriptor
+**             *iov - pointer to an array of iovcnt segments
+**             iovcnt - the number of segments, at most OS_FS_MAX_IOVEC
+**             offset - the position in the file to start at
+** Returns: OS_FS_ERR_INVALID_POINTER if iov or a segment buffer is null
+**          OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+**          OS_FS_ERROR if there are too many segments or the OS call failed
+**          The number of bytes transferred if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null iov, then with a segment whose buffer is null
+**   2) Expect both returned values to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Too-many-segments-arg condition
+**   1) Call this routine with iovcnt of OS_FS_MAX_IOVEC+1
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #3: Invalid-file-desc-arg condition
+**   1) Call this routine with a file descriptor of 99999 as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_FD
+** -----------------------------------------------------
+** Test #4: OS-call-failure condition
+**   1) Setup the test to fail OS call inside this routine
+**   2) Call this routine
+**   3) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #5: Nominal condition
+**   1) Call OS_creat() to create and open a file
+**   2) Call OS_write() to write some text to the file
+**   3) Call this routine with two segments, a header and the same text, at the
+**      end of the text written in #2
+**   4) Expect the returned value to be
+**        (a) the total number of bytes in both segments __and__
+**        (b) OS_lseek() with OS_SEEK_CUR to still report the end of #2
+**   5) Call OS_pread() to read the file back
+**   6) Expect the file to hold the text, the header and the text again
+**--------------------------------------------------------------------------------*/
+void UT_os_pwritevfile_test()
+{
+    int32 idx=0;
+    uint32 idx2;
+    char hdrBuff[8];
+    os_iovec_t iov[OS_FS_MAX_IOVEC + 1];
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_pwritev(99999, NULL, 0, 0) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_pwritevfile_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Pwritev_NullPtr.txt", g_mntName);
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#1 Null-pointer-arg - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        iov[0].buffer = hdrBuff;
+        iov[0].length = sizeof(hdrBuff);
+        iov[1].buffer = NULL;
+        iov[1].length = sizeof(hdrBuff);
+        if ((OS_pwritev(g_fDescs[0], NULL, 1, 0) == OS_FS_ERR_INVALID_POINTER) &&
+            (OS_pwritev(g_fDescs[0], iov, 2, 0) == OS_FS_ERR_INVALID_POINTER))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /*-----------------------------------------------------*/
+        testDesc = "#2 Too-many-segments-arg";
+
+        for (idx2 = 0; idx2 <= OS_FS_MAX_IOVEC; ++idx2)
+        {
+            iov[idx2].buffer = hdrBuff;
+            iov[idx2].length = 1;
+        }
+        if (OS_pwritev(g_fDescs[0], iov, OS_FS_MAX_IOVEC + 1, 0) == OS_FS_ERROR)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Reset test environment */
+        OS_close(g_fDescs[0]);
+        OS_remove(g_fNames[0]);
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Invalid-file-desc-arg";
+
+    iov[0].buffer = hdrBuff;
+    iov[0].length = sizeof(hdrBuff);
+    if (OS_pwritev(99999, iov, 1, 0) == OS_FS_ERR_INVALID_FD)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 OS-call-failure";
+
+    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_UOF)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Nominal";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Pwritev_Nominal.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#5 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_pwritevfile_test_exit_tag;
+    }
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "A HORSE! A HORSE! MY KINGDOM FOR A HORSE!");
+    memcpy(hdrBuff, "HEADER: ", sizeof(hdrBuff));
+    if (OS_write(g_fDescs[0], g_writeBuff, strlen(g_writeBuff)) != strlen(g_writeBuff))
+    {
+        testDesc = "#5 Nominal - File-write failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        iov[0].buffer = hdrBuff;
+        iov[0].length = sizeof(hdrBuff);
+        iov[1].buffer = g_writeBuff;
+        iov[1].length = strlen(g_writeBuff);
+
+        memset(g_readBuff, '\0', sizeof(g_readBuff));
+        if ((OS_pwritev(g_fDescs[0], iov, 2, strlen(g_writeBuff)) == sizeof(hdrBuff) + strlen(g_writeBuff)) &&
+            (OS_lseek(g_fDescs[0], 0, OS_SEEK_CUR) == strlen(g_writeBuff)) &&
+            (OS_pread(g_fDescs[0], g_readBuff, sizeof(g_readBuff) - 1, 0) == sizeof(hdrBuff) + 2 * strlen(g_writeBuff)) &&
+            (strncmp(g_readBuff, g_writeBuff, strlen(g_writeBuff)) == 0) &&
+            (memcmp(g_readBuff + strlen(g_writeBuff), hdrBuff, sizeof(hdrBuff)) == 0) &&
+            (strcmp(g_readBuff + strlen(g_writeBuff) + sizeof(hdrBuff), g_writeBuff) == 0))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_pwritevfile_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_pwritev", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_FileMap(int32 filedes, uint64 offset, uint32 length, uint32 access,
+**                          void **addr)
+** Purpose: Maps part of an open file into memory
+** Parameters: filedes - a file descriptor
+**             offset - the position in the file where the mapping starts
+**             length - the number of bytes to map
+**             access - OS_READ_ONLY or OS_READ_WRITE, optionally with
+**                      OS_FILEMAP_* hints
+**             **addr - pointer that will hold the address of the mapping
+** Returns: OS_FS_ERR_INVALID_POINTER if the pointer passed in is null
+**          OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+**          OS_ERR_NO_FREE_IDS if there are no free mapping slots
+**          OS_FS_ERROR if the arguments are not usable or the OS call failed
+**          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null pointer as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Invalid-arg condition
+**   1) Call this routine with a zero length, then with an unknown access value,
+**      then with OS_WRITE_ONLY access
+**   2) Expect all three returned values to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #3: Invalid-file-desc-arg condition
+**   1) Call this routine with a file descriptor of 99999 as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_FD
+** -----------------------------------------------------
+** Test #4: OS-call-failure condition
+**   1) Setup the test to fail OS call inside this routine
+**   2) Call this routine
+**   3) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #5: Nominal condition
+**   1) Call OS_creat() to create and open a file, and OS_write() to write some text
+**   2) Call this routine to map 10 bytes at offset 18, which is not page aligned,
+**      read only with the OS_FILEMAP_WILLNEED hint
+**   3) Expect the returned value to be
+**        (a) OS_FS_SUCCESS __and__
+**        (b) the mapping to hold the text at that offset
+**   4) Call OS_close() on the file
+**   5) Expect OS_FileUnmap() on the mapping to return OS_FS_ERROR, because closing
+**      the file removed it
+**--------------------------------------------------------------------------------*/
+void UT_os_filemap_test()
+{
+    int32 idx=0;
+    void *addr;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_FileMap(99999, 0, 0, OS_READ_ONLY, NULL) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_filemap_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Map_NullPtr.txt", g_mntName);
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#1 Null-pointer-arg - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        if (OS_FileMap(g_fDescs[0], 0, 16, OS_READ_ONLY, NULL) == OS_FS_ERR_INVALID_POINTER)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /*-----------------------------------------------------*/
+        testDesc = "#2 Invalid-arg";
+
+        if ((OS_FileMap(g_fDescs[0], 0, 0, OS_READ_ONLY, &addr) == OS_FS_ERROR) &&
+            (OS_FileMap(g_fDescs[0], 0, 16, 0x7F, &addr) == OS_FS_ERROR) &&
+            (OS_FileMap(g_fDescs[0], 0, 16, OS_WRITE_ONLY, &addr) == OS_FS_ERROR))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Reset test environment */
+        OS_close(g_fDescs[0]);
+        OS_remove(g_fNames[0]);
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Invalid-file-desc-arg";
+
+    if (OS_FileMap(99999, 0, 16, OS_READ_ONLY, &addr) == OS_FS_ERR_INVALID_FD)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 OS-call-failure";
+
+    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_UOF)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Nominal";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Map_Nominal.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#5 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_filemap_test_exit_tag;
+    }
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "A HORSE! A HORSE! MY KINGDOM FOR A HORSE!");
+    if (OS_write(g_fDescs[0], g_writeBuff, strlen(g_writeBuff)) != strlen(g_writeBuff))
+    {
+        testDesc = "#5 Nominal - File-write failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        OS_close(g_fDescs[0]);
+    }
+    else if ((OS_FileMap(g_fDescs[0], 18, 10, OS_READ_ONLY | OS_FILEMAP_WILLNEED, &addr) == OS_FS_SUCCESS) &&
+             (memcmp(addr, "MY KINGDOM", 10) == 0) &&
+             (OS_close(g_fDescs[0]) == OS_FS_SUCCESS) &&
+             (OS_FileUnmap(addr) == OS_FS_ERROR))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+        OS_close(g_fDescs[0]);
+    }
+
+    /* Reset test environment */
+    OS_remove(g_fNames[0]);
+
+UT_os_filemap_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_FileMap", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_FileUnmap(void *addr)
+** Purpose: Removes a mapping made by OS_FileMap
+** Parameters: *addr - the address returned by OS_FileMap
+** Returns: OS_FS_ERR_INVALID_POINTER if the pointer passed in is null
+**          OS_FS_ERROR if the address is not a mapping or the OS call failed
+**          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null pointer as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Invalid-arg condition
+**   1) Call this routine with an address that was not returned by OS_FileMap
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #3: Nominal condition
+**   1) Call OS_creat() to create and open a file, and OS_write() to write some text
+**   2) Call OS_FileMap() to map the text
+**   3) Call this routine on the mapping twice
+**   4) Expect the returned values to be
+**        (a) OS_FS_SUCCESS, then OS_FS_ERROR
+**--------------------------------------------------------------------------------*/
+void UT_os_fileunmap_test()
+{
+    int32 idx=0;
+    void *addr;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_FileUnmap(NULL) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_fileunmap_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if (OS_FileUnmap(NULL) == OS_FS_ERR_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-arg";
+
+    if (OS_FileUnmap(g_readBuff) == OS_FS_ERROR)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Nominal";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Unmap_Nominal.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#3 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_fileunmap_test_exit_tag;
+    }
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "A HORSE! A HORSE! MY KINGDOM FOR A HORSE!");
+    if ((OS_write(g_fDescs[0], g_writeBuff, strlen(g_writeBuff)) != strlen(g_writeBuff)) ||
+        (OS_FileMap(g_fDescs[0], 0, strlen(g_writeBuff), OS_READ_ONLY, &addr) != OS_FS_SUCCESS))
+    {
+        testDesc = "#3 Nominal - File-map failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else if ((OS_FileUnmap(addr) == OS_FS_SUCCESS) &&
+             (OS_FileUnmap(addr) == OS_FS_ERROR))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_fileunmap_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_FileUnmap", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_FileSync(void *addr)
+** Purpose: Writes changes made through a mapping back to the file
+** Parameters: *addr - the address returned by OS_FileMap
+** Returns: OS_FS_ERR_INVALID_POINTER if the pointer passed in is null
+**          OS_FS_ERROR if the address is not a mapping or the OS call failed
+**          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null pointer as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Invalid-arg condition
+**   1) Call this routine with an address that was not returned by OS_FileMap
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #3: OS-call-failure condition
+**   1) Setup the test to fail OS call inside this routine
+**   2) Call this routine
+**   3) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #4: Nominal condition
+**   1) Call OS_creat() to create and open a file, and OS_write() to write some text
+**   2) Call OS_FileMap() to map the text for reading and writing
+**   3) Change the text through the mapping and call this routine
+**   4) Expect the returned value to be
+**        (a) OS_FS_SUCCESS __and__
+**        (b) OS_pread() to return the changed text
+**--------------------------------------------------------------------------------*/
+void UT_os_filesync_test()
+{
+    int32 idx=0;
+    void *addr;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_FileSync(NULL) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_filesync_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if (OS_FileSync(NULL) == OS_FS_ERR_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-arg";
+
+    if (OS_FileSync(g_readBuff) == OS_FS_ERROR)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 OS-call-failure";
+
+    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_UOF)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Nominal";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Sync_Nominal.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#4 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_filesync_test_exit_tag;
+    }
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "A HORSE! A HORSE! MY KINGDOM FOR A HORSE!");
+    if ((OS_write(g_fDescs[0], g_writeBuff, strlen(g_writeBuff)) != strlen(g_writeBuff)) ||
+        (OS_FileMap(g_fDescs[0], 0, strlen(g_writeBuff), OS_READ_WRITE, &addr) != OS_FS_SUCCESS))
+    {
+        testDesc = "#4 Nominal - File-map failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        memcpy((char *)addr + 23, "QUEENDOM", 8);
+        memset(g_readBuff, '\0', sizeof(g_readBuff));
+        if ((OS_FileSync(addr) == OS_FS_SUCCESS) &&
+            (OS_pread(g_fDescs[0], g_readBuff, strlen(g_writeBuff), 0) == strlen(g_writeBuff)) &&
+            (strcmp(g_readBuff, "A HORSE! A HORSE! MY KIQUEENDOMR A HORSE!") == 0))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        OS_FileUnmap(addr);
+    }
+
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_filesync_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_FileSync", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_AsyncQueueCreate(uint32 *queue_id, uint32 depth, uint32 flags)
+** Purpose: Creates a queue for asynchronous reads and writes
+** Parameters: *queue_id - pointer that will hold the id of the new queue
+**             depth - the most requests the queue may have outstanding
+**             flags - OS_ASYNC_IO_URING, OS_ASYNC_THREADS or 0
+** Returns: OS_FS_ERR_INVALID_POINTER if the pointer passed in is null
+**          OS_FS_ERROR if the depth or the flags are out of range
+**          OS_ERR_NO_FREE_IDS if there are no free queues
+**          OS_FS_UNIMPLEMENTED if io_uring is asked for but not available
+**          OS_FS_SUCCESS if succeeded
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null pointer as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Invalid-arg condition
+**   1) Call this routine with a zero depth, a depth of OS_ASYNC_QUEUE_MAX_DEPTH+1,
+**      both engine flags and an unknown flag
+**   2) Expect all returned values to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #3: No-free-IDs condition
+**   1) Call this routine OS_MAX_ASYNC_QUEUES times
+**   2) Call this routine once more
+**   3) Expect the returned value to be
+**        (a) OS_ERR_NO_FREE_IDS
+** -----------------------------------------------------
+** Test #4: Nominal condition
+**   1) Call this routine with OS_ASYNC_THREADS, then with OS_ASYNC_IO_URING
+**   2) Expect the returned values to be
+**        (a) OS_FS_SUCCESS __and__
+**        (b) OS_FS_SUCCESS or OS_FS_UNIMPLEMENTED, depending on the host
+**   3) Call OS_AsyncQueueDelete() on the queues created
+**--------------------------------------------------------------------------------*/
+void UT_os_asyncqueuecreate_test()
+{
+    int32 idx=0, i=0;
+    int32 res=0, res2=0;
+    uint32 queueIds[OS_MAX_ASYNC_QUEUES+1];
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_AsyncQueueCreate(NULL, 0, 0) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_asyncqueuecreate_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if (OS_AsyncQueueCreate(NULL, 8, 0) == OS_FS_ERR_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-arg";
+
+    if ((OS_AsyncQueueCreate(&queueIds[0], 0, 0) == OS_FS_ERROR) &&
+        (OS_AsyncQueueCreate(&queueIds[0], OS_ASYNC_QUEUE_MAX_DEPTH+1, 0) == OS_FS_ERROR) &&
+        (OS_AsyncQueueCreate(&queueIds[0], 8, OS_ASYNC_IO_URING | OS_ASYNC_THREADS) == OS_FS_ERROR) &&
+        (OS_AsyncQueueCreate(&queueIds[0], 8, 0x80) == OS_FS_ERROR))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 No-free-IDs";
+
+    for (i=0; i < OS_MAX_ASYNC_QUEUES; i++)
+    {
+        if (OS_AsyncQueueCreate(&queueIds[i], 8, 0) != OS_FS_SUCCESS)
+        {
+            testDesc = "#3 No-free-IDs - Queue-create failed";
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+            break;
+        }
+    }
+
+    if (i == OS_MAX_ASYNC_QUEUES)
+    {
+        if (OS_AsyncQueueCreate(&queueIds[i], 8, 0) == OS_ERR_NO_FREE_IDS)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+    /* Reset test environment */
+    while (i > 0)
+    {
+        OS_AsyncQueueDelete(queueIds[--i]);
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Nominal";
+
+    res = OS_AsyncQueueCreate(&queueIds[0], 8, OS_ASYNC_THREADS);
+    res2 = OS_AsyncQueueCreate(&queueIds[1], 8, OS_ASYNC_IO_URING);
+    if ((res == OS_FS_SUCCESS) &&
+        ((res2 == OS_FS_SUCCESS) || (res2 == OS_FS_UNIMPLEMENTED)))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    if (res == OS_FS_SUCCESS)
+        OS_AsyncQueueDelete(queueIds[0]);
+    if (res2 == OS_FS_SUCCESS)
+        OS_AsyncQueueDelete(queueIds[1]);
+
+UT_os_asyncqueuecreate_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_AsyncQueueCreate", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_AsyncQueueDelete(uint32 queue_id)
+** Purpose: Deletes an asynchronous I/O queue once its requests have completed
+** Parameters: queue_id - the id of the queue
+** Returns: OS_ERR_INVALID_ID if the id passed in is not a valid queue
+**          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Invalid-ID-arg condition
+**   1) Call this routine with an id of 99999 as argument
+**   2) Expect the returned value to be
+**        (a) OS_ERR_INVALID_ID
+** -----------------------------------------------------
+** Test #2: Nominal condition
+**   1) Call OS_creat() to create and open a file
+**   2) Call OS_AsyncQueueCreate() and OS_AsyncWrite() to queue a write that is never
+**      collected
+**   3) Call this routine twice
+**   4) Expect the returned values to be
+**        (a) OS_FS_SUCCESS, then OS_ERR_INVALID_ID __and__
+**        (b) the file to hold the text written
+**--------------------------------------------------------------------------------*/
+void UT_os_asyncqueuedelete_test()
+{
+    int32 idx=0;
+    uint32 queueId=0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_AsyncQueueDelete(99999) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_asyncqueuedelete_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Invalid-ID-arg";
+
+    if (OS_AsyncQueueDelete(99999) == OS_ERR_INVALID_ID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Nominal";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/AsyncDel_Nominal.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#2 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_asyncqueuedelete_test_exit_tag;
+    }
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "A HORSE! A HORSE! MY KINGDOM FOR A HORSE!");
+    if ((OS_AsyncQueueCreate(&queueId, 8, 0) != OS_FS_SUCCESS) ||
+        (OS_AsyncWrite(queueId, g_fDescs[0], g_writeBuff, strlen(g_writeBuff), 0, NULL) != OS_FS_SUCCESS))
+    {
+        testDesc = "#2 Nominal - Async-write failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        OS_AsyncQueueDelete(queueId);
+    }
+    else
+    {
+        memset(g_readBuff, '\0', sizeof(g_readBuff));
+        if ((OS_AsyncQueueDelete(queueId) == OS_FS_SUCCESS) &&
+            (OS_AsyncQueueDelete(queueId) == OS_ERR_INVALID_ID) &&
+            (OS_pread(g_fDescs[0], g_readBuff, strlen(g_writeBuff), 0) == strlen(g_writeBuff)) &&
+            (strcmp(g_readBuff, g_writeBuff) == 0))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_asyncqueuedelete_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_AsyncQueueDelete", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_AsyncRead(uint32 queue_id, int32 filedes, void *buffer, uint32 nbytes,
+**                            uint64 offset, void *user_arg)
+** Purpose: Queues a read from an open file
+** Parameters: queue_id - the id of the queue
+**             filedes - a file descriptor
+**             *buffer - pointer that will hold the data read from file
+**             nbytes - the number of bytes to be read
+**             offset - the position in the file where the read starts
+**             *user_arg - value returned with the completion
+** Returns: OS_FS_ERR_INVALID_POINTER if the pointer passed in is null
+**          OS_ERR_INVALID_ID if the queue id passed in is invalid
+**          OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+**          OS_QUEUE_FULL if the queue already has depth requests outstanding
+**          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null pointer as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Invalid-ID-arg condition
+**   1) Call this routine with a queue id of 99999 as argument
+**   2) Expect the returned value to be
+**        (a) OS_ERR_INVALID_ID
+** -----------------------------------------------------
+** Test #3: Invalid-file-desc-arg condition
+**   1) Call this routine with a file descriptor of 99999 as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_FD
+** -----------------------------------------------------
+** Test #4: Queue-full condition
+**   1) Call OS_AsyncQueueCreate() to create a queue of depth 1
+**   2) Call this routine twice
+**   3) Expect the returned values to be
+**        (a) OS_FS_SUCCESS, then OS_QUEUE_FULL
+** -----------------------------------------------------
+** Test #5: Nominal condition
+**   1) Call OS_creat() to create and open a file, and OS_write() to write some text
+**   2) For a queue using the worker tasks and a queue using the default engine, call
+**      this routine to read 10 bytes at offset 18, then OS_AsyncWait()
+**   3) Expect the returned values to be
+**        (a) OS_FS_SUCCESS __and__
+**        (b) one completion with the user argument given and a result of 10 __and__
+**        (c) the buffer to hold the text at that offset
+** -----------------------------------------------------
+** Test #6: Close-while-pending condition
+**   1) For a queue using the worker tasks and a queue using the default engine, call
+**      OS_open() to open the file of test #5, this routine to read 10 bytes at
+**      offset 18, then OS_close() before OS_AsyncWait()
+**   2) Expect the returned values to be
+**        (a) OS_FS_SUCCESS from OS_close() __and__
+**        (b) one completion with a result of 10 __and__
+**        (c) the buffer to hold the text at that offset __and__
+**        (d) OS_FS_ERR_INVALID_FD from this routine on the closed file descriptor
+**--------------------------------------------------------------------------------*/
+void UT_os_asyncread_test()
+{
+    int32 idx=0, i=0;
+    int32 res=0;
+    uint32 queueId=0;
+    uint32 flags[2] = { OS_ASYNC_THREADS, 0 };
+    os_async_completion_t completion;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_AsyncRead(99999, 99999, NULL, 0, 0, NULL) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_asyncread_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if (OS_AsyncRead(99999, 99999, NULL, 0, 0, NULL) == OS_FS_ERR_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-ID-arg";
+
+    if (OS_AsyncRead(99999, 99999, g_readBuff, 1, 0, NULL) == OS_ERR_INVALID_ID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Invalid-file-desc-arg";
+
+    if (OS_AsyncQueueCreate(&queueId, 1, 0) != OS_FS_SUCCESS)
+    {
+        testDesc = "#3 Invalid-file-desc-arg - Queue-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_asyncread_test_exit_tag;
+    }
+
+    if (OS_AsyncRead(queueId, 99999, g_readBuff, 1, 0, NULL) == OS_FS_ERR_INVALID_FD)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Queue-full";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/AsyncRd_Nominal.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#4 Queue-full - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        OS_AsyncQueueDelete(queueId);
+        goto UT_os_asyncread_test_exit_tag;
+    }
+
+    if ((OS_AsyncRead(queueId, g_fDescs[0], g_readBuff, 1, 0, NULL) == OS_FS_SUCCESS) &&
+        (OS_AsyncRead(queueId, g_fDescs[0], g_readBuff, 1, 0, NULL) == OS_QUEUE_FULL))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_AsyncQueueDelete(queueId);
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Nominal";
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "A HORSE! A HORSE! MY KINGDOM FOR A HORSE!");
+    if (OS_write(g_fDescs[0], g_writeBuff, strlen(g_writeBuff)) != strlen(g_writeBuff))
+    {
+        testDesc = "#5 Nominal - File-write failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_asyncread_test_exit_tag_2;
+    }
+
+    for (i=0; i < 2; i++)
+    {
+        if (OS_AsyncQueueCreate(&queueId, 4, flags[i]) != OS_FS_SUCCESS)
+        {
+            testDesc = "#5 Nominal - Queue-create failed";
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+            goto UT_os_asyncread_test_exit_tag_2;
+        }
+
+        memset(g_readBuff, '\0', sizeof(g_readBuff));
+        memset(&completion, 0, sizeof(completion));
+        res = OS_AsyncRead(queueId, g_fDescs[0], g_readBuff, 10, 18, g_fNames[0]);
+        if ((res != OS_FS_SUCCESS) ||
+            (OS_AsyncWait(queueId, &completion, 1, OS_PEND) != 1) ||
+            (completion.user_arg != g_fNames[0]) ||
+            (completion.result != 10) ||
+            (strcmp(g_readBuff, "MY KINGDOM") != 0))
+        {
+            break;
+        }
+
+        OS_AsyncQueueDelete(queueId);
+    }
+
+    if (i == 2)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+        OS_AsyncQueueDelete(queueId);
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#6 Close-while-pending";
+
+    OS_close(g_fDescs[0]);
+
+    for (i=0; i < 2; i++)
+    {
+        g_fDescs[0] = OS_open(g_fNames[0], OS_READ_ONLY, 0644);
+        if (g_fDescs[0] < 0)
+        {
+            testDesc = "#6 Close-while-pending - File-open failed";
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+            goto UT_os_asyncread_test_exit_tag_2;
+        }
+
+        if (OS_AsyncQueueCreate(&queueId, 4, flags[i]) != OS_FS_SUCCESS)
+        {
+            testDesc = "#6 Close-while-pending - Queue-create failed";
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+            goto UT_os_asyncread_test_exit_tag_2;
+        }
+
+        memset(g_readBuff, '\0', sizeof(g_readBuff));
+        memset(&completion, 0, sizeof(completion));
+        res = OS_AsyncRead(queueId, g_fDescs[0], g_readBuff, 10, 18, NULL);
+        if ((res != OS_FS_SUCCESS) ||
+            (OS_close(g_fDescs[0]) != OS_FS_SUCCESS) ||
+            (OS_AsyncWait(queueId, &completion, 1, OS_PEND) != 1) ||
+            (completion.result != 10) ||
+            (strcmp(g_readBuff, "MY KINGDOM") != 0) ||
+            (OS_AsyncRead(queueId, g_fDescs[0], g_readBuff, 10, 18, NULL) != OS_FS_ERR_INVALID_FD))
+        {
+            break;
+        }
+
+        OS_AsyncQueueDelete(queueId);
+    }
+
+    if (i == 2)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+        OS_AsyncQueueDelete(queueId);
+    }
+
+UT_os_asyncread_test_exit_tag_2:
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_asyncread_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_AsyncRead", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_AsyncWrite(uint32 queue_id, int32 filedes, void *buffer, uint32 nbytes,
+**                             uint64 offset, void *user_arg)
+** Purpose: Queues a write to an open file
+** Parameters: queue_id - the id of the queue
+**             filedes - a file descriptor
+**             *buffer - pointer that holds the data to be written to file
+**             nbytes - the number of bytes to be written
+**             offset - the position in the file where the write starts
+**             *user_arg - value returned with the completion
+** Returns: OS_FS_ERR_INVALID_POINTER if the pointer passed in is null
+**          OS_ERR_INVALID_ID if the queue id passed in is invalid
+**          OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+**          OS_QUEUE_FULL if the queue already has depth requests outstanding
+**          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null pointer as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Invalid-ID-arg condition
+**   1) Call this routine with a queue id of 99999 as argument
+**   2) Expect the returned value to be
+**        (a) OS_ERR_INVALID_ID
+** -----------------------------------------------------
+** Test #3: Invalid-file-desc-arg condition
+**   1) Call this routine with a file descriptor of 99999 as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_FD
+** -----------------------------------------------------
+** Test #4: Nominal condition
+**   1) Call OS_creat() to create and open a file, and OS_write() to write some text
+**   2) Call this routine to write 8 bytes at offset 23, then OS_AsyncWait()
+**   3) Expect the returned values to be
+**        (a) OS_FS_SUCCESS __and__
+**        (b) one completion with a result of 8 __and__
+**        (c) OS_pread() to return the changed text
+**--------------------------------------------------------------------------------*/
+void UT_os_asyncwrite_test()
+{
+    int32 idx=0;
+    uint32 queueId=0;
+    char patchBuff[] = "QUEENDOM";
+    os_async_completion_t completion;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_AsyncWrite(99999, 99999, NULL, 0, 0, NULL) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_asyncwrite_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if (OS_AsyncWrite(99999, 99999, NULL, 0, 0, NULL) == OS_FS_ERR_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-ID-arg";
+
+    if (OS_AsyncWrite(99999, 99999, g_writeBuff, 1, 0, NULL) == OS_ERR_INVALID_ID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Invalid-file-desc-arg";
+
+    if (OS_AsyncQueueCreate(&queueId, 4, 0) != OS_FS_SUCCESS)
+    {
+        testDesc = "#3 Invalid-file-desc-arg - Queue-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_asyncwrite_test_exit_tag;
+    }
+
+    if (OS_AsyncWrite(queueId, 99999, g_writeBuff, 1, 0, NULL) == OS_FS_ERR_INVALID_FD)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Nominal";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/AsyncWr_Nominal.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#4 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        OS_AsyncQueueDelete(queueId);
+        goto UT_os_asyncwrite_test_exit_tag;
+    }
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "A HORSE! A HORSE! MY KINGDOM FOR A HORSE!");
+    if (OS_write(g_fDescs[0], g_writeBuff, strlen(g_writeBuff)) != strlen(g_writeBuff))
+    {
+        testDesc = "#4 Nominal - File-write failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        memset(g_readBuff, '\0', sizeof(g_readBuff));
+        memset(&completion, 0, sizeof(completion));
+        if ((OS_AsyncWrite(queueId, g_fDescs[0], patchBuff, 8, 23, NULL) == OS_FS_SUCCESS) &&
+            (OS_AsyncWait(queueId, &completion, 1, OS_PEND) == 1) &&
+            (completion.result == 8) &&
+            (OS_pread(g_fDescs[0], g_readBuff, strlen(g_writeBuff), 0) == strlen(g_writeBuff)) &&
+            (strcmp(g_readBuff, "A HORSE! A HORSE! MY KIQUEENDOMR A HORSE!") == 0))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+    /* Reset test environment */
+    OS_AsyncQueueDelete(queueId);
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_asyncwrite_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_AsyncWrite", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_AsyncWait(uint32 queue_id, os_async_completion_t *completions,
+**                            uint32 max_count, int32 msecs)
+** Purpose: Collects the requests of a queue that have completed
+** Parameters: queue_id - the id of the queue
+**             *completions - array that will hold the completions
+**             max_count - the number of entries in the array
+**             msecs - how long to wait, or OS_PEND/OS_CHECK
+** Returns: OS_FS_ERR_INVALID_POINTER if the pointer passed in is null
+**          OS_ERR_INVALID_ID if the queue id passed in is invalid
+**          OS_FS_ERROR if max_count or msecs are out of range
+**          OS_ERROR_TIMEOUT if no request completed in time
+**          the number of completions stored if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null pointer as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Invalid-ID-arg condition
+**   1) Call this routine with a queue id of 99999 as argument
+**   2) Expect the returned value to be
+**        (a) OS_ERR_INVALID_ID
+** -----------------------------------------------------
+** Test #3: Invalid-arg condition
+**   1) Call this routine with a zero max_count, then with msecs of -5
+**   2) Expect both returned values to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #4: Timeout condition
+**   1) Call this routine on an empty queue with OS_CHECK, then with 10 msecs
+**   2) Expect both returned values to be
+**        (a) OS_ERROR_TIMEOUT
+** -----------------------------------------------------
+** Test #5: Nominal condition
+**   1) Call OS_creat() to create and open a file, and OS_write() to write some text
+**   2) Call OS_AsyncRead() three times, with a different user argument each time
+**   3) Call this routine with a max_count of 2 until three completions are collected
+**   4) Expect the returned values to be
+**        (a) 1 or 2 __and__
+**        (b) each user argument to be returned once
+**--------------------------------------------------------------------------------*/
+void UT_os_asyncwait_test()
+{
+    int32 idx=0, i=0, j=0;
+    int32 res=0;
+    uint32 queueId=0;
+    uint32 count=0;
+    uint32 seen[3] = { 0, 0, 0 };
+    os_async_completion_t completions[2];
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_AsyncWait(99999, NULL, 0, OS_CHECK) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_asyncwait_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if (OS_AsyncWait(99999, NULL, 0, OS_CHECK) == OS_FS_ERR_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-ID-arg";
+
+    if (OS_AsyncWait(99999, completions, 2, OS_CHECK) == OS_ERR_INVALID_ID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Invalid-arg";
+
+    if (OS_AsyncQueueCreate(&queueId, 4, 0) != OS_FS_SUCCESS)
+    {
+        testDesc = "#3 Invalid-arg - Queue-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_asyncwait_test_exit_tag;
+    }
+
+    if ((OS_AsyncWait(queueId, completions, 0, OS_CHECK) == OS_FS_ERROR) &&
+        (OS_AsyncWait(queueId, completions, 2, -5) == OS_FS_ERROR))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Timeout";
+
+    if ((OS_AsyncWait(queueId, completions, 2, OS_CHECK) == OS_ERROR_TIMEOUT) &&
+        (OS_AsyncWait(queueId, completions, 2, 10) == OS_ERROR_TIMEOUT))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Nominal";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/AsyncWt_Nominal.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#5 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        OS_AsyncQueueDelete(queueId);
+        goto UT_os_asyncwait_test_exit_tag;
+    }
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "A HORSE! A HORSE! MY KINGDOM FOR A HORSE!");
+    res = OS_write(g_fDescs[0], g_writeBuff, strlen(g_writeBuff));
+    for (i=0; i < 3 && res == strlen(g_writeBuff); i++)
+    {
+        if (OS_AsyncRead(queueId, g_fDescs[0], &g_readBuff[i * 8], 8, i * 9, &seen[i]) != OS_FS_SUCCESS)
+        {
+            res = -1;
+        }
+    }
+
+    if (res != strlen(g_writeBuff))
+    {
+        testDesc = "#5 Nominal - Async-read failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        while (count < 3)
+        {
+            res = OS_AsyncWait(queueId, completions, 2, OS_PEND);
+            if (res < 1 || res > 2)
+            {
+                break;
+            }
+
+            for (j=0; j < res; j++)
+            {
+                for (i=0; i < 3; i++)
+                {
+                    if (completions[j].user_arg == &seen[i])
+                    {
+                        seen[i]++;
+                    }
+                }
+            }
+            count += res;
+        }
+
+        if ((count == 3) && (seen[0] == 1) && (seen[1] == 1) && (seen[2] == 1))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+    /* Reset test environment */
+    OS_AsyncQueueDelete(queueId);
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_asyncwait_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_AsyncWait", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_StreamOpen(uint32 *stream_id, int32 filedes, uint32 buffer_size,
+**                             uint32 flush_size, uint32 flush_msec)
+** Purpose: Creates a buffered stream on an open file
+** Parameters: *stream_id - pointer that will hold the id of the stream
+**             filedes - the file descriptor of the open file
+**             buffer_size - bytes the stream can hold
+**             flush_size - buffered bytes that trigger a write, 0 for buffer_size
+**             flush_msec - longest time data stays buffered, 0 for no limit
+** Returns: OS_FS_ERR_INVALID_POINTER if the pointer passed in is null
+**          OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+**          OS_FS_ERROR if the sizes are out of range or the OS call failed
+**          OS_ERR_NO_FREE_IDS if there are no free streams
+**          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null pointer as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Invalid-file-desc-arg condition
+**   1) Call this routine with a file descriptor of 99999 as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_FD
+** -----------------------------------------------------
+** Test #3: Invalid-arg condition
+**   1) Call OS_creat() to create and open a file
+**   2) Call this routine with a zero buffer size, then with a flush size larger
+**      than the buffer size
+**   3) Expect both returned values to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #4: No-free-IDs condition
+**   1) Call this routine OS_MAX_STREAMS times on the file opened in #3
+**   2) Call this routine once more
+**   3) Expect the returned value to be
+**        (a) OS_ERR_NO_FREE_IDS
+** -----------------------------------------------------
+** Test #5: Nominal condition
+**   1) Call this routine with a flush size of 0 on the file opened in #3
+**   2) Expect the returned value to be
+**        (a) OS_FS_SUCCESS __and__
+**        (b) OS_StreamGetInfo() to report a flush size equal to the buffer size
+**--------------------------------------------------------------------------------*/
+void UT_os_streamopen_test()
+{
+    int32 idx=0, i=0;
+    uint32 streamIds[OS_MAX_STREAMS+1];
+    uint32 streamId=0;
+    os_stream_prop_t streamProp;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_StreamOpen(NULL, 99999, 0, 0, 0) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_streamopen_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if (OS_StreamOpen(NULL, 99999, 64, 0, 0) == OS_FS_ERR_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-file-desc-arg";
+
+    if (OS_StreamOpen(&streamId, 99999, 64, 0, 0) == OS_FS_ERR_INVALID_FD)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Invalid-arg";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/StrmOpen.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#3 Invalid-arg - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_streamopen_test_exit_tag;
+    }
+
+    if ((OS_StreamOpen(&streamId, g_fDescs[0], 0, 0, 0) == OS_FS_ERROR) &&
+        (OS_StreamOpen(&streamId, g_fDescs[0], 64, 65, 0) == OS_FS_ERROR))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 No-free-IDs";
+
+    for (i = 0; i < OS_MAX_STREAMS; i++)
+    {
+        if (OS_StreamOpen(&streamIds[i], g_fDescs[0], 64, 0, 0) != OS_FS_SUCCESS)
+        {
+            break;
+        }
+    }
+
+    if (i < OS_MAX_STREAMS)
+    {
+        testDesc = "#4 No-free-IDs - Stream-open failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else if (OS_StreamOpen(&streamIds[i], g_fDescs[0], 64, 0, 0) == OS_ERR_NO_FREE_IDS)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    while (i > 0)
+    {
+        OS_StreamClose(streamIds[--i]);
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Nominal";
+
+    if ((OS_StreamOpen(&streamId, g_fDescs[0], 64, 0, 0) == OS_FS_SUCCESS) &&
+        (OS_StreamGetInfo(streamId, &streamProp) == OS_FS_SUCCESS) &&
+        (streamProp.flush_size == 64))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_StreamClose(streamId);
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_streamopen_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_StreamOpen", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_StreamWrite(uint32 stream_id, const void *buffer, uint32 nbytes)
+** Purpose: Adds data to a buffered stream
+** Parameters: stream_id - the id of the stream
+**             *buffer - pointer to the data to write
+**             nbytes - the number of bytes to write
+** Returns: OS_FS_ERR_INVALID_POINTER if the pointer passed in is null
+**          OS_ERR_INVALID_ID if the stream id passed in is invalid
+**          OS_FS_ERROR if the data could not be written
+**          nbytes if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null pointer as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Invalid-ID-arg condition
+**   1) Call this routine with a stream id of 99999 as argument
+**   2) Expect the returned value to be
+**        (a) OS_ERR_INVALID_ID
+** -----------------------------------------------------
+** Test #3: Nominal condition
+**   1) Call OS_creat() to create and open a file, and OS_StreamOpen() to open a
+**      stream of 16 bytes on it
+**   2) Call this routine with 8 bytes, then with the rest of a longer text
+**   3) Expect the returned values to be
+**        (a) the number of bytes given __and__
+**        (b) nothing to be in the file after the first call __and__
+**        (c) the whole text to be in the file after the second call
+** -----------------------------------------------------
+** Test #4: Flush-on-size condition
+**   1) Call OS_StreamOpen() to open a stream of 64 bytes with a flush size of 16
+**   2) Call this routine twice with 8 bytes
+**   3) Expect the returned values to be
+**        (a) 8 __and__
+**        (b) OS_StreamGetInfo() to report nothing buffered and one write call
+** -----------------------------------------------------
+** Test #5: Flush-on-time condition
+**   1) Call OS_StreamOpen() to open a stream of 64 bytes with a flush time of 20 msecs
+**   2) Call this routine with 8 bytes, and OS_TaskDelay() to wait 500 msecs
+**   3) Expect the returned value to be
+**        (a) 8 __and__
+**        (b) OS_StreamGetInfo() to report nothing buffered
+**--------------------------------------------------------------------------------*/
+void UT_os_streamwrite_test()
+{
+    int32 idx=0;
+    uint32 streamId=0;
+    os_stream_prop_t streamProp;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_StreamWrite(99999, NULL, 0) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_streamwrite_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if (OS_StreamWrite(99999, NULL, 0) == OS_FS_ERR_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-ID-arg";
+
+    if (OS_StreamWrite(99999, g_writeBuff, 1) == OS_ERR_INVALID_ID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Nominal";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/StrmWrite.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#3 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_streamwrite_test_exit_tag;
+    }
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "A HORSE! A HORSE! MY KINGDOM FOR A HORSE!");
+    memset(g_readBuff, '\0', sizeof(g_readBuff));
+
+    if (OS_StreamOpen(&streamId, g_fDescs[0], 16, 0, 0) != OS_FS_SUCCESS)
+    {
+        testDesc = "#3 Nominal - Stream-open failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        if ((OS_StreamWrite(streamId, g_writeBuff, 8) == 8) &&
+            (OS_pread(g_fDescs[0], g_readBuff, sizeof(g_readBuff), 0) == 0) &&
+            (OS_StreamWrite(streamId, g_writeBuff + 8, strlen(g_writeBuff) - 8) == strlen(g_writeBuff) - 8) &&
+            (OS_pread(g_fDescs[0], g_readBuff, strlen(g_writeBuff), 0) == strlen(g_writeBuff)) &&
+            (strcmp(g_readBuff, g_writeBuff) == 0))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        OS_StreamClose(streamId);
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Flush-on-size";
+
+    if (OS_StreamOpen(&streamId, g_fDescs[0], 64, 16, 0) != OS_FS_SUCCESS)
+    {
+        testDesc = "#4 Flush-on-size - Stream-open failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        if ((OS_StreamWrite(streamId, g_writeBuff, 8) == 8) &&
+            (OS_StreamWrite(streamId, g_writeBuff, 8) == 8) &&
+            (OS_StreamGetInfo(streamId, &streamProp) == OS_FS_SUCCESS) &&
+            (streamProp.buffered == 0) && (streamProp.write_calls == 1))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        OS_StreamClose(streamId);
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Flush-on-time";
+
+    if (OS_StreamOpen(&streamId, g_fDescs[0], 64, 0, 20) != OS_FS_SUCCESS)
+    {
+        testDesc = "#5 Flush-on-time - Stream-open failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        if ((OS_StreamWrite(streamId, g_writeBuff, 8) == 8) &&
+            (OS_TaskDelay(500) == OS_SUCCESS) &&
+            (OS_StreamGetInfo(streamId, &streamProp) == OS_FS_SUCCESS) &&
+            (streamProp.buffered == 0) && (streamProp.write_calls == 1))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        OS_StreamClose(streamId);
+    }
+
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_streamwrite_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_StreamWrite", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_StreamFlush(uint32 stream_id)
+** Purpose: Writes out the data buffered by a stream
+** Parameters: stream_id - the id of the stream
+** Returns: OS_ERR_INVALID_ID if the stream id passed in is invalid
+**          OS_FS_ERROR if the data could not be written
+**          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Invalid-ID-arg condition
+**   1) Call this routine with a stream id of 99999 as argument
+**   2) Expect the returned value to be
+**        (a) OS_ERR_INVALID_ID
+** -----------------------------------------------------
+** Test #2: Nominal condition
+**   1) Call OS_creat() to create and open a file, OS_StreamOpen() to open a stream
+**      on it and OS_StreamWrite() to write some text
+**   2) Call this routine
+**   3) Expect the returned value to be
+**        (a) OS_FS_SUCCESS __and__
+**        (b) OS_pread() to return the text
+**--------------------------------------------------------------------------------*/
+void UT_os_streamflush_test()
+{
+    int32 idx=0;
+    uint32 streamId=0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_StreamFlush(99999) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_streamflush_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Invalid-ID-arg";
+
+    if (OS_StreamFlush(99999) == OS_ERR_INVALID_ID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Nominal";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/StrmFlush.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#2 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_streamflush_test_exit_tag;
+    }
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "A HORSE! A HORSE! MY KINGDOM FOR A HORSE!");
+    memset(g_readBuff, '\0', sizeof(g_readBuff));
+
+    if ((OS_StreamOpen(&streamId, g_fDescs[0], 64, 0, 0) != OS_FS_SUCCESS) ||
+        (OS_StreamWrite(streamId, g_writeBuff, strlen(g_writeBuff)) != strlen(g_writeBuff)))
+    {
+        testDesc = "#2 Nominal - Stream-write failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else if ((OS_StreamFlush(streamId) == OS_FS_SUCCESS) &&
+             (OS_pread(g_fDescs[0], g_readBuff, strlen(g_writeBuff), 0) == strlen(g_writeBuff)) &&
+             (strcmp(g_readBuff, g_writeBuff) == 0))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_StreamClose(streamId);
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_streamflush_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_StreamFlush", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_StreamFlushAll(void)
+** Purpose: Writes out the data buffered by all the streams
+** Parameters: None
+** Returns: OS_FS_ERROR if the data of a stream could not be written
+**          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Nominal condition
+**   1) Call OS_creat() to create and open two files, OS_StreamOpen() to open a
+**      stream on each and OS_StreamWrite() to write some text to both
+**   2) Call this routine
+**   3) Expect the returned value to be
+**        (a) OS_FS_SUCCESS __and__
+**        (b) OS_pread() to return the text from both files
+**--------------------------------------------------------------------------------*/
+void UT_os_streamflushall_test()
+{
+    int32 idx=0, i=0;
+    uint32 streamIds[2];
+    int32 setupFailed=0, testFailed=0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_StreamFlushAll() == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_streamflushall_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Nominal";
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "A HORSE! A HORSE! MY KINGDOM FOR A HORSE!");
+
+    for (i = 0; i < 2; i++)
+    {
+        memset(g_fNames[i], '\0', sizeof(g_fNames[i]));
+        UT_os_sprintf(g_fNames[i], "%s/StrmFlAll%d.txt", g_mntName, (int)i);
+
+        g_fDescs[i] = OS_creat(g_fNames[i], OS_READ_WRITE);
+        if ((g_fDescs[i] < 0) ||
+            (OS_StreamOpen(&streamIds[i], g_fDescs[i], 64, 0, 0) != OS_FS_SUCCESS) ||
+            (OS_StreamWrite(streamIds[i], g_writeBuff, strlen(g_writeBuff)) != strlen(g_writeBuff)))
+        {
+            setupFailed = 1;
+        }
+    }
+
+    if (setupFailed)
+    {
+        testDesc = "#1 Nominal - Stream-write failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        if (OS_StreamFlushAll() != OS_FS_SUCCESS)
+        {
+            testFailed = 1;
+        }
+
+        for (i = 0; i < 2; i++)
+        {
+            memset(g_readBuff, '\0', sizeof(g_readBuff));
+            if ((OS_pread(g_fDescs[i], g_readBuff, strlen(g_writeBuff), 0) != strlen(g_writeBuff)) ||
+                (strcmp(g_readBuff, g_writeBuff) != 0))
+            {
+                testFailed = 1;
+            }
+        }
+
+        if (testFailed == 0)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+    /* Reset test environment, closing a file also frees its stream */
+    for (i = 0; i < 2; i++)
+    {
+        OS_close(g_fDescs[i]);
+        OS_remove(g_fNames[i]);
+    }
+
+UT_os_streamflushall_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_StreamFlushAll", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_StreamClose(uint32 stream_id)
+** Purpose: Flushes and frees a buffered stream, leaving its file open
+** Parameters: stream_id - the id of the stream
+** Returns: OS_ERR_INVALID_ID if the stream id passed in is invalid
+**          OS_FS_ERROR if the buffered data could not be written
+**          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Invalid-ID-arg condition
+**   1) Call this routine with a stream id of 99999 as argument
+**   2) Expect the returned value to be
+**        (a) OS_ERR_INVALID_ID
+** -----------------------------------------------------
+** Test #2: Nominal condition
+**   1) Call OS_creat() to create and open a file, OS_StreamOpen() to open a stream
+**      on it and OS_StreamWrite() to write some text
+**   2) Call this routine, then call it again
+**   3) Expect the returned values to be
+**        (a) OS_FS_SUCCESS, then OS_ERR_INVALID_ID __and__
+**        (b) OS_pread() to return the text
+** -----------------------------------------------------
+** Test #3: File-close condition
+**   1) Call OS_StreamOpen() to open a stream on the file opened in #2, and
+**      OS_StreamWrite() to write some text
+**   2) Call OS_close() on the file, then this routine
+**   3) Expect the returned value to be
+**        (a) OS_ERR_INVALID_ID __and__
+**        (b) the text to be in the file once it is opened again
+**--------------------------------------------------------------------------------*/
+void UT_os_streamclose_test()
+{
+    int32 idx=0;
+    uint32 streamId=0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_StreamClose(99999) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_streamclose_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Invalid-ID-arg";
+
+    if (OS_StreamClose(99999) == OS_ERR_INVALID_ID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Nominal";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/StrmClose.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#2 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_streamclose_test_exit_tag;
+    }
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "A HORSE! A HORSE! MY KINGDOM FOR A HORSE!");
+    memset(g_readBuff, '\0', sizeof(g_readBuff));
+
+    if ((OS_StreamOpen(&streamId, g_fDescs[0], 64, 0, 0) != OS_FS_SUCCESS) ||
+        (OS_StreamWrite(streamId, g_writeBuff, 8) != 8))
+    {
+        testDesc = "#2 Nominal - Stream-write failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        OS_close(g_fDescs[0]);
+        OS_remove(g_fNames[0]);
+        goto UT_os_streamclose_test_exit_tag;
+    }
+
+    if ((OS_StreamClose(streamId) == OS_FS_SUCCESS) &&
+        (OS_StreamClose(streamId) == OS_ERR_INVALID_ID) &&
+        (OS_pread(g_fDescs[0], g_readBuff, 8, 0) == 8) &&
+        (strncmp(g_readBuff, g_writeBuff, 8) == 0))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 File-close";
+
+    if ((OS_StreamOpen(&streamId, g_fDescs[0], 64, 0, 0) != OS_FS_SUCCESS) ||
+        (OS_lseek(g_fDescs[0], 0, OS_SEEK_END) != 8) ||
+        (OS_StreamWrite(streamId, g_writeBuff + 8, strlen(g_writeBuff) - 8) != strlen(g_writeBuff) - 8))
+    {
+        testDesc = "#3 File-close - Stream-write failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        OS_close(g_fDescs[0]);
+        OS_remove(g_fNames[0]);
+        goto UT_os_streamclose_test_exit_tag;
+    }
+
+    memset(g_readBuff, '\0', sizeof(g_readBuff));
+    if ((OS_close(g_fDescs[0]) == OS_FS_SUCCESS) &&
+        (OS_StreamClose(streamId) == OS_ERR_INVALID_ID) &&
+        ((g_fDescs[0] = OS_open(g_fNames[0], OS_READ_ONLY, 0644)) >= 0) &&
+        (OS_read(g_fDescs[0], g_readBuff, sizeof(g_readBuff)) == strlen(g_writeBuff)) &&
+        (strcmp(g_readBuff, g_writeBuff) == 0))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_streamclose_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_StreamClose", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_StreamGetInfo(uint32 stream_id, os_stream_prop_t *stream_prop)
+** Purpose: Fills in the state of a buffered stream
+** Parameters: stream_id - the id of the stream
+**             *stream_prop - pointer that will hold the state of the stream
+** Returns: OS_FS_ERR_INVALID_POINTER if the pointer passed in is null
+**          OS_ERR_INVALID_ID if the stream id passed in is invalid
+**          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null pointer as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Invalid-ID-arg condition
+**   1) Call this routine with a stream id of 99999 as argument
+**   2) Expect the returned value to be
+**        (a) OS_ERR_INVALID_ID
+** -----------------------------------------------------
+** Test #3: Nominal condition
+**   1) Call OS_creat() to create and open a file, OS_StreamOpen() to open a stream
+**      on it and OS_StreamWrite() to write 5 bytes
+**   2) Call this routine
+**   3) Expect the returned value to be
+**        (a) OS_FS_SUCCESS __and__
+**        (b) the state to match the arguments given to OS_StreamOpen(), with 5 bytes
+**            buffered and none written
+**--------------------------------------------------------------------------------*/
+void UT_os_streamgetinfo_test()
+{
+    int32 idx=0;
+    uint32 streamId=0;
+    os_stream_prop_t streamProp;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_StreamGetInfo(99999, NULL) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_streamgetinfo_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if (OS_StreamGetInfo(99999, NULL) == OS_FS_ERR_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-ID-arg";
+
+    if (OS_StreamGetInfo(99999, &streamProp) == OS_ERR_INVALID_ID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Nominal";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/StrmInfo.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#3 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_streamgetinfo_test_exit_tag;
+    }
+
+    if ((OS_StreamOpen(&streamId, g_fDescs[0], 64, 32, 1000) != OS_FS_SUCCESS) ||
+        (OS_StreamWrite(streamId, "HORSE", 5) != 5))
+    {
+        testDesc = "#3 Nominal - Stream-write failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else if ((OS_StreamGetInfo(streamId, &streamProp) == OS_FS_SUCCESS) &&
+             (streamProp.filedes == g_fDescs[0]) && (streamProp.buffer_size == 64) &&
+             (streamProp.flush_size == 32) && (streamProp.flush_msec == 1000) &&
+             (streamProp.buffered == 5) && (streamProp.write_calls == 0) &&
+             (streamProp.bytes_written == 0))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_StreamClose(streamId);
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_streamgetinfo_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_StreamGetInfo", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
 /*--------------------------------------------------------------------------------*
 ** Syntax: int32 OS_lseek(int32 filedes, int32 offset, uint32 whence)
 ** Purpose: Moves the read/write pointer of a given file descriptor to the given offset
 ** Parameters: filedes - file descriptor of the given file
-**             offset - number of bytes to offset the read/write pointer from its position
-**                      dictated by whence
-**             whence - tells offset where to begin offsetting
-**                         OS_SEEK_SET - starts at beginning of file
-**                         OS_SEEK_CUR - starts at the current read/write pointer
-**                         OS_SEEK_END - starts at the end of the file
-** Returns: OS_FS_ERR_INVALID_FD is the file descriptor passed in is invalid
-**          OS_FS_ERROR if the OS call failed or the whence value is invalid
-**          The new offset from the beginning of the given file
+**             offset - number of bytes to offset the read/write pointer from its position
+**                      dictated by whence
+**             whence - tells offset where to begin offsetting
+**                         OS_SEEK_SET - starts at beginning of file
+**                         OS_SEEK_CUR - starts at the current read/write pointer
+**                         OS_SEEK_END - starts at the end of the file
+** Returns: OS_FS_ERR_INVALID_FD is the file descriptor passed in is invalid
+**          OS_FS_ERROR if the OS call failed or the whence value is invalid
+**          The new offset from the beginning of the given file
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Invalid-file-desc-arg condition
+**   1) Call this routine 3 times with a file descriptors of 0, -1, and (OS_MAX_NUM_OPEN_FILES+5)
+**      respectively as argument
+**   2) Expect all three returned values to be
+**        (a) OS_FS_ERR_INVALID_FD
+** -----------------------------------------------------
+** Test #2: Invalid-whence-arg condition
+**   1) Call this routine with invalid "whence" value as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #3: OS-call-failure condition
+**   1) Setup the test to fail OS call inside this routine
+**   2) Call this routine
+**   3) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #4: Nominal condition
+**   1) Call OS_creat() to create and open a file
+**   2) Expect the returned value to be
+**        (a) a file descriptor value greater than or equal to 0
+**   3) Call OS_write() to write something to the file opened in #1
+**   4) Expect the returned value to be
+**        (a) the number of bytes that is equal to the number of bytes in the write buffer __and__
+**        (b) the file position is now at the end of the file
+**   5) Call this routine repeatedly with the file descriptor returned in #1, and different
+**      offset and whence value each time
+**   6) Expect the returned value each time to be
+**        (a) the expected file position value given the arguments
+**--------------------------------------------------------------------------------*/
+void UT_os_lseekfile_test()
+{
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+    int32 idx=0, buffLen=0, pos1=0, pos2=0, pos3=0;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_lseek(99999, 0, OS_SEEK_CUR) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_lseekfile_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Invalid-file-desc-arg";
+
+    if (OS_lseek(99999, 0, OS_SEEK_SET) == OS_FS_ERR_INVALID_FD)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-whence-arg";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Seek_InvWhence.txt", g_mntName);
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#2 Invalid-whence-arg - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        if (OS_lseek(g_fDescs[0], 0, 123456) == OS_FS_ERROR)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 OS-call-failure";
+
+    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_UOF)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Nominal";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Seek_Nominal.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#4 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_lseekfile_test_exit_tag;
+    }
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "THE BROWN FOX JUMPS OVER THE LAZY DOG.");
+    buffLen = (int32)strlen(g_writeBuff);
+
+    if (OS_write(g_fDescs[0], g_writeBuff, buffLen) != buffLen)
+    {
+        testDesc = "#4 Nominal - File-write failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_lseekfile_test_exit_tag;
+    }
+
+    pos1 = OS_lseek(g_fDescs[0], 10, OS_SEEK_SET);
+    pos2 = OS_lseek(g_fDescs[0], 7, OS_SEEK_CUR);
+    pos3 = OS_lseek(g_fDescs[0], -16, OS_SEEK_END);
+    if ((pos1 < 0) || (g_writeBuff[pos1] != 'F') ||
+        (pos2 < 0) || (g_writeBuff[pos2] != 'P') ||
+        (pos3 < 0) || (g_writeBuff[pos3] != 'E'))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_lseekfile_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_lseek", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_lseek64(int32 filedes, int64 offset, uint32 whence, uint64 *new_offset)
+** Purpose: Moves the read/write pointer of a given file descriptor to the given offset,
+**          for files larger than 2 GB
+** Parameters: filedes - file descriptor of the given file
+**             offset - number of bytes to offset the read/write pointer from its position
+**                      dictated by whence
+**             whence - OS_SEEK_SET, OS_SEEK_CUR or OS_SEEK_END
+**             *new_offset - pointer that will hold the new offset, may be null
+** Returns: OS_FS_ERR_INVALID_FD is the file descriptor passed in is invalid
+**          OS_FS_ERROR if the OS call failed or the whence value is invalid
+**          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Invalid-file-desc-arg condition
+**   1) Call this routine with an invalid file descriptor as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_FD
+** -----------------------------------------------------
+** Test #2: Invalid-whence-arg condition
+**   1) Call this routine with invalid "whence" value as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #3: Nominal condition
+**   1) Call OS_creat() and OS_write() to create a file with a known content
+**   2) Call this routine repeatedly with different offset and whence values
+**   3) Expect the returned values to be
+**        (a) OS_FS_SUCCESS __and__
+**        (b) the expected file position value given the arguments
+** -----------------------------------------------------
+** Test #4: Large-file condition
+**   1) Call OS_pwrite() to write one byte at 5 GB into the file of #3
+**   2) Call this routine with OS_SEEK_END and a zero offset
+**   3) Expect the returned value to be
+**        (a) OS_FS_SUCCESS __and__
+**        (b) a new offset of 5 GB plus one
+**   4) Call OS_lseek() with OS_SEEK_END and a zero offset
+**   5) Expect the returned value to be
+**        (a) OS_FS_ERROR
+**   6) Call this routine to go to 5 GB, then OS_read() to read one byte
+**   7) Expect the byte read to be the byte written in #1
+**--------------------------------------------------------------------------------*/
+void UT_os_lseek64file_test()
+{
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+    int32 idx=0, buffLen=0;
+    uint64 pos1=0, pos2=0, pos3=0;
+    uint64 bigOffset = (uint64)5 * 1024 * 1024 * 1024;
+    char bigByte = 'Z';
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_lseek64(99999, 0, OS_SEEK_CUR, NULL) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_lseek64file_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Invalid-file-desc-arg";
+
+    if (OS_lseek64(99999, 0, OS_SEEK_SET, &pos1) == OS_FS_ERR_INVALID_FD)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-whence-arg";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Seek64_Nominal.txt", g_mntName);
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#2 Invalid-whence-arg - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_lseek64file_test_exit_tag;
+    }
+
+    if (OS_lseek64(g_fDescs[0], 0, 123456, &pos1) == OS_FS_ERROR)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Nominal";
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "THE BROWN FOX JUMPS OVER THE LAZY DOG.");
+    buffLen = (int32)strlen(g_writeBuff);
+
+    if (OS_write(g_fDescs[0], g_writeBuff, buffLen) != buffLen)
+    {
+        testDesc = "#3 Nominal - File-write failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_lseek64file_test_reset;
+    }
+
+    if ((OS_lseek64(g_fDescs[0], 10, OS_SEEK_SET, &pos1) == OS_FS_SUCCESS) &&
+        (OS_lseek64(g_fDescs[0], 7, OS_SEEK_CUR, &pos2) == OS_FS_SUCCESS) &&
+        (OS_lseek64(g_fDescs[0], -16, OS_SEEK_END, &pos3) == OS_FS_SUCCESS) &&
+        (pos1 == 10) && (pos2 == 17) && (pos3 == (uint64)(buffLen - 16)) &&
+        (g_writeBuff[pos3] == 'E'))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Large-file";
+
+    if (OS_pwrite(g_fDescs[0], &bigByte, 1, bigOffset) != 1)
+    {
+        /* the host file system may not take files this large */
+        testDesc = "#4 Large-file - File-write failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_lseek64file_test_reset;
+    }
+
+    memset(g_readBuff, '\0', sizeof(g_readBuff));
+    if ((OS_lseek64(g_fDescs[0], 0, OS_SEEK_END, &pos1) == OS_FS_SUCCESS) &&
+        (pos1 == bigOffset + 1) &&
+        (OS_lseek(g_fDescs[0], 0, OS_SEEK_END) == OS_FS_ERROR) &&
+        (OS_lseek64(g_fDescs[0], (int64)bigOffset, OS_SEEK_SET, NULL) == OS_FS_SUCCESS) &&
+        (OS_read(g_fDescs[0], g_readBuff, 1) == 1) &&
+        (g_readBuff[0] == bigByte))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+UT_os_lseek64file_test_reset:
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_lseek64file_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_lseek64", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_fstat(int32 filedes, os_fstat_t *filestats)
+** Purpose: Returns file status information of an open file
+** Parameters: filedes - file descriptor of the given file
+**             *filestats - pointer that will hold file status information
+** Returns: OS_FS_ERR_INVALID_POINTER if the pointer passed in is null
+**          OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+**          OS_FS_ERROR if the OS call failed
+**          OS_FS_SUCCESS if succeeded
 **          OS_FS_UNIMPLEMENTED if not implemented
 ** -----------------------------------------------------
 ** Test #0: Not-implemented condition
@@ -1105,129 +4315,192 @@ UT_os_writefile_test_exit_tag:
 **   3) Otherwise, continue
 ** -----------------------------------------------------
 ** Test #1: Invalid-file-desc-arg condition
-**   1) Call this routine 3 times with a file descriptors of 0, -1, and (OS_MAX_NUM_OPEN_FILES+5)
-**      respectively as argument
-**   2) Expect all three returned values to be
-**        (a) OS_FS_ERR_INVALID_FD
-** -----------------------------------------------------
-** Test #2: Invalid-whence-arg condition
-**   1) Call this routine with invalid "whence" value as argument
+**   1) Call this routine with an invalid file descriptor as argument
 **   2) Expect the returned value to be
-**        (a) OS_FS_ERROR
+**        (a) OS_FS_ERR_INVALID_FD
 ** -----------------------------------------------------
-** Test #3: OS-call-failure condition
-**   1) Setup the test to fail OS call inside this routine
-**   2) Call this routine
+** Test #2: Null-pointer-arg condition
+**   1) Call OS_creat() to create and open a file
+**   2) Call this routine with the file descriptor returned in #1 and a null pointer
 **   3) Expect the returned value to be
-**        (a) OS_FS_ERROR
+**        (a) OS_FS_ERR_INVALID_POINTER
 ** -----------------------------------------------------
-** Test #4: Nominal condition
-**   1) Call OS_creat() to create and open a file
-**   2) Expect the returned value to be
-**        (a) a file descriptor value greater than or equal to 0
-**   3) Call OS_write() to write something to the file opened in #1
-**   4) Expect the returned value to be
-**        (a) the number of bytes that is equal to the number of bytes in the write buffer __and__
-**        (b) the file position is now at the end of the file
-**   5) Call this routine repeatedly with the file descriptor returned in #1, and different
-**      offset and whence value each time
-**   6) Expect the returned value each time to be
-**        (a) the expected file position value given the arguments
+** Test #3: Nominal condition
+**   1) Call OS_write() to write something to the file of #2
+**   2) Call this routine with the file descriptor of #2
+**   3) Expect the returned value to be
+**        (a) OS_FS_SUCCESS __and__
+**        (b) the file size to be the number of bytes written in #1
 **--------------------------------------------------------------------------------*/
-void UT_os_lseekfile_test()
+void UT_os_fstatfile_test()
 {
     UT_OsApiInfo_t apiInfo;
     const char* testDesc=NULL;
-    int32 idx=0, buffLen=0, pos1=0, pos2=0, pos3=0;
+    int32 idx=0, buffLen=0;
+    os_fstat_t fstats;
 
     UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
 
     /*-----------------------------------------------------*/
     testDesc = "API not implemented";
 
-    if (OS_lseek(99999, 0, OS_SEEK_CUR) == OS_FS_UNIMPLEMENTED)
+    if (OS_fstat(99999, &fstats) == OS_FS_UNIMPLEMENTED)
     {
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
-        goto UT_os_lseekfile_test_exit_tag;
+        goto UT_os_fstatfile_test_exit_tag;
     }
 
     /*-----------------------------------------------------*/
     testDesc = "#1 Invalid-file-desc-arg";
 
-    if (OS_lseek(99999, 0, OS_SEEK_SET) == OS_FS_ERR_INVALID_FD)
+    if (OS_fstat(99999, &fstats) == OS_FS_ERR_INVALID_FD)
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
     else
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
     /*-----------------------------------------------------*/
-    testDesc = "#2 Invalid-whence-arg";
+    testDesc = "#2 Null-pointer-arg";
 
     memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
-    UT_os_sprintf(g_fNames[0], "%s/Seek_InvWhence.txt", g_mntName);
+    UT_os_sprintf(g_fNames[0], "%s/Fstat_Nominal.txt", g_mntName);
     g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
     if (g_fDescs[0] < 0)
     {
-        testDesc = "#2 Invalid-whence-arg - File-create failed";
+        testDesc = "#2 Null-pointer-arg - File-create failed";
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_fstatfile_test_exit_tag;
     }
+
+    if (OS_fstat(g_fDescs[0], NULL) == OS_FS_ERR_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
     else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Nominal";
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "HOW NOW, BROWN COW?");
+    buffLen = (int32)strlen(g_writeBuff);
+
+    if (OS_write(g_fDescs[0], g_writeBuff, buffLen) != buffLen)
     {
-        if (OS_lseek(g_fDescs[0], 0, 123456) == OS_FS_ERROR)
-            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
-        else
-            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+        testDesc = "#3 Nominal - File-write failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
     }
+    else if ((OS_fstat(g_fDescs[0], &fstats) == OS_FS_SUCCESS) &&
+             (fstats.st_size == buffLen))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
     /* Reset test environment */
     OS_close(g_fDescs[0]);
     OS_remove(g_fNames[0]);
 
+UT_os_fstatfile_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_fstat", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_FDGetSize(int32 filedes, uint64 *size)
+** Purpose: Returns the size in bytes of an open file
+** Parameters: filedes - file descriptor of the given file
+**             *size - pointer that will hold the size of the file
+** Returns: OS_FS_ERR_INVALID_POINTER if the pointer passed in is null
+**          OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+**          OS_FS_ERROR if the OS call failed
+**          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Invalid-file-desc-arg condition
+**   1) Call this routine with an invalid file descriptor as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_FD
+** -----------------------------------------------------
+** Test #2: Null-pointer-arg condition
+**   1) Call OS_creat() to create and open a file
+**   2) Call this routine with the file descriptor returned in #1 and a null pointer
+**   3) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #3: Nominal condition
+**   1) Call this routine on the empty file of #2
+**   2) Call OS_write() to write something to the file, then call this routine again
+**   3) Expect the returned values to be
+**        (a) OS_FS_SUCCESS and a size of zero __and__
+**        (b) OS_FS_SUCCESS and the number of bytes written
+**--------------------------------------------------------------------------------*/
+void UT_os_fdgetsize_test()
+{
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+    int32 idx=0, buffLen=0;
+    uint64 size1=1, size2=0;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
     /*-----------------------------------------------------*/
-    testDesc = "#3 OS-call-failure";
+    testDesc = "API not implemented";
 
-    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_UOF)
+    if (OS_FDGetSize(99999, &size1) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_fdgetsize_test_exit_tag;
+    }
 
     /*-----------------------------------------------------*/
-    testDesc = "#4 Nominal";
+    testDesc = "#1 Invalid-file-desc-arg";
 
-    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
-    UT_os_sprintf(g_fNames[0], "%s/Seek_Nominal.txt", g_mntName);
+    if (OS_FDGetSize(99999, &size1) == OS_FS_ERR_INVALID_FD)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Null-pointer-arg";
 
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Size_Nominal.txt", g_mntName);
     g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
     if (g_fDescs[0] < 0)
     {
-        testDesc = "#4 Nominal - File-create failed";
+        testDesc = "#2 Null-pointer-arg - File-create failed";
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
-        goto UT_os_lseekfile_test_exit_tag;
+        goto UT_os_fdgetsize_test_exit_tag;
     }
 
+    if (OS_FDGetSize(g_fDescs[0], NULL) == OS_FS_ERR_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Nominal";
+
     memset(g_writeBuff, '\0', sizeof(g_writeBuff));
-    strcpy(g_writeBuff, "THE BROWN FOX JUMPS OVER THE LAZY DOG.");
+    strcpy(g_writeBuff, "HOW NOW, BROWN COW?");
     buffLen = (int32)strlen(g_writeBuff);
 
-    if (OS_write(g_fDescs[0], g_writeBuff, buffLen) != buffLen)
-    {
-        testDesc = "#4 Nominal - File-write failed";
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
-        goto UT_os_lseekfile_test_exit_tag;
-    }
-
-    pos1 = OS_lseek(g_fDescs[0], 10, OS_SEEK_SET);
-    pos2 = OS_lseek(g_fDescs[0], 7, OS_SEEK_CUR);
-    pos3 = OS_lseek(g_fDescs[0], -16, OS_SEEK_END);
-    if ((pos1 < 0) || (g_writeBuff[pos1] != 'F') ||
-        (pos2 < 0) || (g_writeBuff[pos2] != 'P') ||
-        (pos3 < 0) || (g_writeBuff[pos3] != 'E'))
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
-    else
+    if ((OS_FDGetSize(g_fDescs[0], &size1) == OS_FS_SUCCESS) && (size1 == 0) &&
+        (OS_write(g_fDescs[0], g_writeBuff, buffLen) == buffLen) &&
+        (OS_FDGetSize(g_fDescs[0], &size2) == OS_FS_SUCCESS) && (size2 == (uint64)buffLen))
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
     /* Reset test environment */
     OS_close(g_fDescs[0]);
     OS_remove(g_fNames[0]);
 
-UT_os_lseekfile_test_exit_tag:
-    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_lseek", idx)
+UT_os_fdgetsize_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_FDGetSize", idx)
     UT_OS_LOG_API_MACRO(apiInfo)
 }
 
@@ -1624,6 +4897,17 @@ UT_os_removefile_test_exit_tag:
 **   5) Call OS_stat() to get file status on the old name used in #3
 **   6) Expect the returned values to be
 **        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #7: Open-file-renamed condition
+**   1) Call OS_creat() to create and open a file
+**   2) Call this routine to rename the file while it is open
+**   3) Call OS_FileOpenCheck() with the old and the new name
+**   4) Expect the returned values to be
+**        (a) OS_FS_ERROR for the old name
+**        (b) OS_FS_SUCCESS for the new name
+**   5) Call OS_CloseFileByName() with the new name
+**   6) Expect the returned value to be
+**        (a) OS_FS_SUCCESS
 **--------------------------------------------------------------------------------*/
 void UT_os_renamefile_test()
 {
@@ -1717,6 +5001,37 @@ void UT_os_renamefile_test()
     OS_close(g_fDescs[0]);
     OS_remove(g_fNames[1]);
 
+    /*-----------------------------------------------------*/
+    testDesc = "#7 Open-file-renamed";
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_WRITE_ONLY);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#7 Open-file-renamed - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_renamefile_test_exit_tag;
+    }
+
+    if (OS_rename(g_fNames[0], g_fNames[1]) != OS_FS_SUCCESS)
+    {
+        testDesc = "#7 Open-file-renamed - File-rename failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        OS_close(g_fDescs[0]);
+        OS_remove(g_fNames[0]);
+        goto UT_os_renamefile_test_exit_tag;
+    }
+
+    if ((OS_FileOpenCheck(g_fNames[0]) == OS_FS_ERROR) &&
+        (OS_FileOpenCheck(g_fNames[1]) == OS_FS_SUCCESS) &&
+        (OS_CloseFileByName(g_fNames[1]) == OS_FS_SUCCESS))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[1]);
+
 UT_os_renamefile_test_exit_tag:
     UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_rename", idx)
     UT_OS_LOG_API_MACRO(apiInfo)
@@ -1772,13 +5087,23 @@ UT_os_renamefile_test_exit_tag:
 **   3) Call OS_creat() to create and open a file
 **   4) Expect the returned value to be
 **        (a) a file descriptor value greater than or equal to 0
-**   5) Call this routine with file name used in #3 as old file and file name used
+**   5) Call OS_write() to write some text to the file and close it
+**   6) Call this routine with file name used in #3 as old file and file name used
 **      in #1 as new file
-**   6) Expect the returned value to be
+**   7) Expect the returned value to be
 **        (a) OS_FS_SUCCESS
-**   7) Call OS_stat() again as in #1
-**   8) Expect the returned value to be
+**   8) Call OS_stat() again as in #1
+**   9) Expect the returned value to be
 **        (a) OS_FS_SUCCESS
+**  10) Call OS_open() and OS_read() on the new file
+**  11) Expect the text read back to be the same as the text written in #5
+** -----------------------------------------------------
+** Test #7: Directory-dest condition
+**   1) Call OS_mkdir() to create a directory and OS_creat() to create a file
+**   2) Call this routine with the file as old file and the directory as new file
+**   3) Expect the returned value to be
+**        (a) OS_FS_SUCCESS __and__
+**        (b) OS_stat() to find a file of the same name in the directory
 **--------------------------------------------------------------------------------*/
 void UT_os_copyfile_test()
 {
@@ -1864,6 +5189,16 @@ void UT_os_copyfile_test()
         goto UT_os_copyfile_test_exit_tag;
     }
 
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "A HORSE! A HORSE! MY KINGDOM FOR A HORSE!");
+    if (OS_write(g_fDescs[0], g_writeBuff, strlen(g_writeBuff)) != strlen(g_writeBuff))
+    {
+        testDesc = "#6 Nominal - File-write failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        OS_close(g_fDescs[0]);
+        goto UT_os_copyfile_test_exit_tag;
+    }
+
     if (OS_close(g_fDescs[0]) != OS_FS_SUCCESS)
     {
         testDesc = "#6 Nominal - File-close failed";
@@ -1877,15 +5212,64 @@ void UT_os_copyfile_test()
         goto UT_os_copyfile_test_exit_tag;
     }
 
-    if (OS_stat(g_fNames[1], &fstats) == OS_FS_SUCCESS)
+    if (OS_stat(g_fNames[1], &fstats) != OS_FS_SUCCESS)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+        goto UT_os_copyfile_test_exit_tag;
+    }
+
+    g_fDescs[1] = OS_open(g_fNames[1], OS_READ_ONLY, 0644);
+    if (g_fDescs[1] < 0)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+        goto UT_os_copyfile_test_exit_tag;
+    }
+
+    memset(g_readBuff, '\0', sizeof(g_readBuff));
+    if ((OS_read(g_fDescs[1], g_readBuff, sizeof(g_readBuff) - 1) == strlen(g_writeBuff)) &&
+        (strcmp(g_readBuff, g_writeBuff) == 0))
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
     else
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
+    OS_close(g_fDescs[1]);
+
     /* Reset test environment */
     OS_remove(g_fNames[0]);
     OS_remove(g_fNames[1]);
 
+    /*-----------------------------------------------------*/
+    testDesc = "#7 Directory-dest";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    memset(g_fNames[1], '\0', sizeof(g_fNames[1]));
+    memset(g_fNames[2], '\0', sizeof(g_fNames[2]));
+    UT_os_sprintf(g_fNames[0], "%s/Cp_Dir_File.txt", g_mntName);
+    UT_os_sprintf(g_fNames[1], "%s/Cp_Dir", g_mntName);
+    UT_os_sprintf(g_fNames[2], "%s/Cp_Dir/Cp_Dir_File.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_WRITE_ONLY);
+    if ((g_fDescs[0] < 0) || (OS_mkdir(g_fNames[1], 0) != OS_FS_SUCCESS))
+    {
+        testDesc = "#7 Directory-dest - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        OS_close(g_fDescs[0]);
+
+        if ((OS_cp(g_fNames[0], g_fNames[1]) == OS_FS_SUCCESS) &&
+            (OS_stat(g_fNames[2], &fstats) == OS_FS_SUCCESS))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+    /* Reset test environment */
+    OS_remove(g_fNames[2]);
+    OS_remove(g_fNames[0]);
+    OS_rmdir(g_fNames[1]);
+
 UT_os_copyfile_test_exit_tag:
     UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_cp", idx)
     UT_OS_LOG_API_MACRO(apiInfo)
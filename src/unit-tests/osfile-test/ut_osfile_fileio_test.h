@@ -41,7 +41,30 @@ void UT_os_closefile_test(void);
 
 void UT_os_readfile_test(void);
 void UT_os_writefile_test(void);
+void UT_os_preadfile_test(void);
+void UT_os_pwritefile_test(void);
+void UT_os_readvfile_test(void);
+void UT_os_writevfile_test(void);
+void UT_os_preadvfile_test(void);
+void UT_os_pwritevfile_test(void);
+void UT_os_filemap_test(void);
+void UT_os_fileunmap_test(void);
+void UT_os_filesync_test(void);
+void UT_os_asyncqueuecreate_test(void);
+void UT_os_asyncqueuedelete_test(void);
+void UT_os_asyncread_test(void);
+void UT_os_asyncwrite_test(void);
+void UT_os_asyncwait_test(void);
+void UT_os_streamopen_test(void);
+void UT_os_streamwrite_test(void);
+void UT_os_streamflush_test(void);
+void UT_os_streamflushall_test(void);
+void UT_os_streamclose_test(void);
+void UT_os_streamgetinfo_test(void);
 void UT_os_lseekfile_test(void);
+void UT_os_lseek64file_test(void);
+void UT_os_fstatfile_test(void);
+void UT_os_fdgetsize_test(void);
 
 void UT_os_chmodfile_test(void);
 void UT_os_statfile_test(void);
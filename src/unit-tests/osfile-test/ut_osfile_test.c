@@ -132,6 +132,8 @@ void OS_Application_Startup(void)
         UT_os_readdir_test();
         UT_os_rewinddir_test();
         UT_os_removedir_test();
+        UT_os_readdirbatch_test();
+        UT_os_dirwalk_test();
 
         /* File I/O APIs */
         UT_os_createfile_test();
@@ -140,7 +142,30 @@ void OS_Application_Startup(void)
 
         UT_os_readfile_test();
         UT_os_writefile_test();
+        UT_os_preadfile_test();
+        UT_os_pwritefile_test();
+        UT_os_readvfile_test();
+        UT_os_writevfile_test();
+        UT_os_preadvfile_test();
+        UT_os_pwritevfile_test();
+        UT_os_filemap_test();
+        UT_os_fileunmap_test();
+        UT_os_filesync_test();
+        UT_os_asyncqueuecreate_test();
+        UT_os_asyncqueuedelete_test();
+        UT_os_asyncread_test();
+        UT_os_asyncwrite_test();
+        UT_os_asyncwait_test();
+        UT_os_streamopen_test();
+        UT_os_streamwrite_test();
+        UT_os_streamflush_test();
+        UT_os_streamflushall_test();
+        UT_os_streamclose_test();
+        UT_os_streamgetinfo_test();
         UT_os_lseekfile_test();
+        UT_os_lseek64file_test();
+        UT_os_fstatfile_test();
+        UT_os_fdgetsize_test();
 
         UT_os_chmodfile_test();
         UT_os_statfile_test();
@@ -991,6 +991,14 @@ UT_os_getfsinfo_test_exit_tag:
 **   7) Expect the returned value to be
 **        (a) OS_FS_SUCCESS __and__
 **        (b) the returned local path to be ?
+** -----------------------------------------------------
+** Test #5: Shared-prefix-mount-point condition
+**   1) Call OS_mkfs and OS_mount to mount a device on a mount point, then another
+**      device on a mount point that is the first one without its last character
+**   2) Call this routine with a file under each mount point
+**   3) Expect the returned values to be
+**        (a) OS_FS_SUCCESS __and__
+**        (b) each local path to start with the physical name of its own device
 ** --------------------------------------------------------------------------------*/
 void UT_os_translatepath_test()
 {
@@ -998,6 +1006,9 @@ void UT_os_translatepath_test()
     UT_OsApiInfo_t apiInfo;
     const char* testDesc=NULL;
     char localPath[UT_OS_LG_TEXT_LEN];
+    char longMntName[UT_OS_XS_TEXT_LEN + 1];
+    char virtPath[UT_OS_LG_TEXT_LEN];
+    char physNames[2][OS_FS_PHYS_NAME_LEN];
 
     UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
 
@@ -1069,6 +1080,55 @@ void UT_os_translatepath_test()
     OS_unmount(g_mntNames[4]);
     OS_rmfs(g_devNames[4]);
 
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Shared-prefix-mount-point";
+
+    /* the longer mount point goes to the device that comes first in the volume table */
+    memset(longMntName, '\0', sizeof(longMntName));
+    UT_os_sprintf(longMntName, "%sx", g_mntNames[5]);
+
+    if ((OS_mkfs(g_fsAddrPtr, g_devNames[4], g_volNames[4], g_blkSize, g_blkCnt) != OS_FS_SUCCESS) ||
+        (OS_mkfs(g_fsAddrPtr, g_devNames[5], g_volNames[5], g_blkSize, g_blkCnt) != OS_FS_SUCCESS) ||
+        (OS_mount(g_devNames[4], longMntName) != OS_FS_SUCCESS) ||
+        (OS_mount(g_devNames[5], g_mntNames[5]) != OS_FS_SUCCESS) ||
+        (OS_FS_GetPhysDriveName(physNames[0], longMntName) != OS_FS_SUCCESS) ||
+        (OS_FS_GetPhysDriveName(physNames[1], g_mntNames[5]) != OS_FS_SUCCESS))
+    {
+        testDesc = "#5 Shared-prefix-mount-point - File-system-mount failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        res = 1;
+
+        UT_os_sprintf(virtPath, "%s/file.txt", g_mntNames[5]);
+        if ((OS_TranslatePath(virtPath, localPath) != OS_FS_SUCCESS) ||
+            (strncmp(localPath, physNames[1], strlen(physNames[1])) != 0) ||
+            (strcmp(localPath + strlen(physNames[1]), "/file.txt") != 0))
+        {
+            res = 0;
+        }
+
+        UT_os_sprintf(virtPath, "%s/file.txt", longMntName);
+        if ((OS_TranslatePath(virtPath, localPath) != OS_FS_SUCCESS) ||
+            (strncmp(localPath, physNames[0], strlen(physNames[0])) != 0) ||
+            (strcmp(localPath + strlen(physNames[0]), "/file.txt") != 0))
+        {
+            res = 0;
+        }
+
+        if (res)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+    /* Reset test environment */
+    OS_unmount(g_mntNames[5]);
+    OS_unmount(longMntName);
+    OS_rmfs(g_devNames[5]);
+    OS_rmfs(g_devNames[4]);
+
 UT_os_translatepath_test_exit_tag:
     UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_TranslatePath (internal)", idx)
     UT_OS_LOG_API_MACRO(apiInfo)
@@ -210,6 +210,17 @@ void UT_timertest_task(void)
    UT_os_timerset_test();
    UT_OS_LOG_MACRO("============================================\n")
 
+   UT_os_timersetns_test();
+   UT_os_timersetslack_test();
+   UT_os_timergetservicestats_test();
+   UT_os_timersetserviceattr_test();
+
+   UT_os_timebasecreate_test();
+   UT_os_timebaseset_test();
+   UT_os_timebasedelete_test();
+   UT_os_timebasegetidbyname_test();
+   UT_os_timeradd_test();
+
    UT_os_teardown("ut_ostimer");
 
    OS_ApplicationShutdown(TRUE);
@@ -13,6 +13,7 @@
 
 #include "ut_os_stubs.h"
 #include "ut_ostimer_timerio_test.h"
+#include "ut_ostimer_timebase_test.h"
 
 /*--------------------------------------------------------------------------------*
 ** Macros
@@ -0,0 +1,653 @@
+/*================================================================================*
+** File:  ut_ostimer_timebase_test.c
+**================================================================================*/
+
+/*--------------------------------------------------------------------------------*
+** Includes
+**--------------------------------------------------------------------------------*/
+
+#include "ut_ostimer_timebase_test.h"
+
+/*--------------------------------------------------------------------------------*
+** Macros
+**--------------------------------------------------------------------------------*/
+
+#define UT_TIMEBASE_TICK_USEC     10000
+#define UT_TIMEBASE_RUN_MSEC        200
+
+/*--------------------------------------------------------------------------------*
+** Data types
+**--------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*
+** External global variables
+**--------------------------------------------------------------------------------*/
+
+extern UT_OsLogInfo_t  g_logInfo;
+
+extern char   g_longTimerName[OS_MAX_API_NAME+5];
+
+/*--------------------------------------------------------------------------------*
+** Global variables
+**--------------------------------------------------------------------------------*/
+
+uint32           g_tbIds[OS_MAX_TIMEBASES+1];
+uint32           g_tbTimerIds[UT_OS_TIMEBASE_TIMERS];
+volatile uint32  g_tbCounts[UT_OS_TIMEBASE_TIMERS];
+volatile int32   g_tbResult = 0;
+
+/*--------------------------------------------------------------------------------*
+** Local function prototypes
+**--------------------------------------------------------------------------------*/
+
+void  UT_os_timebase_counter(uint32 timer_id, void *arg);
+int32 UT_os_timebase_sync(uint32 timebase_id);
+void  UT_os_timebase_reset_counts(void);
+
+/*--------------------------------------------------------------------------------*
+** Local function definitions
+**--------------------------------------------------------------------------------*/
+
+/*
+** Timer callback, arg points at the counter of the timer
+*/
+void UT_os_timebase_counter(uint32 timer_id, void *arg)
+{
+    uint32 idx = (uint32)((volatile uint32 *)arg - g_tbCounts);
+
+    if (idx >= UT_OS_TIMEBASE_TIMERS || g_tbTimerIds[idx] != timer_id)
+    {
+        g_tbResult = -1;
+        return;
+    }
+
+    ++g_tbCounts[idx];
+}
+
+/*
+** External sync function, ticks every UT_TIMEBASE_TICK_USEC
+*/
+int32 UT_os_timebase_sync(uint32 timebase_id)
+{
+    OS_TaskDelay(UT_TIMEBASE_TICK_USEC / 1000);
+    return UT_TIMEBASE_TICK_USEC;
+}
+
+void UT_os_timebase_reset_counts(void)
+{
+    uint32 i;
+
+    for (i = 0; i < UT_OS_TIMEBASE_TIMERS; i++)
+    {
+        g_tbCounts[i] = 0;
+        g_tbTimerIds[i] = 0;
+    }
+    g_tbResult = 0;
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_TimeBaseCreate(uint32 *timer_id, const char *timebase_name,
+**                                 OS_TimerSync_t external_sync)
+** Purpose: Creates a time base, served by its own thread
+** Parameters: *timer_id - a pointer that will hold the time base id
+**             *timebase_name - a pointer that holds the time base name
+**             external_sync - optional function that blocks until the next tick
+** Returns: OS_INVALID_POINTER if any of the pointers passed in is null
+**          OS_ERR_NAME_TOO_LONG if the name passed in is too long
+**          OS_ERR_NO_FREE_IDS if all time bases are in use
+**          OS_ERR_NAME_TAKEN if the name passed in has already been used
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_timebasecreate_test()
+{
+    int32 res=0, idx=0, i=0, j=0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+    char tbName[OS_MAX_API_NAME];
+    uint32 tbId=0;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_TimeBaseCreate(&tbId, "TimeBase", NULL);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_timebasecreate_test_exit_tag;
+    }
+
+    /* Reset test environment */
+    OS_TimeBaseDelete(tbId);
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if ((OS_TimeBaseCreate(NULL, "TimeBase", NULL) == OS_INVALID_POINTER) &&
+        (OS_TimeBaseCreate(&tbId, NULL, NULL) == OS_INVALID_POINTER))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Name-too-long";
+
+    if (OS_TimeBaseCreate(&tbId, g_longTimerName, NULL) == OS_ERR_NAME_TOO_LONG)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 No-free-IDs";
+
+    for (i=0; i <= OS_MAX_TIMEBASES; i++)
+    {
+        memset(tbName, '\0', sizeof(tbName));
+        UT_os_sprintf(tbName, "TimeBase%d", (int)i);
+        res = OS_TimeBaseCreate(&g_tbIds[i], tbName, NULL);
+        if (res != OS_SUCCESS)
+            break;
+    }
+
+    if (i < OS_MAX_TIMEBASES)
+    {
+        testDesc = "#3 No-free-IDs - Time-base-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else if (res == OS_ERR_NO_FREE_IDS)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    for (j=0; j < i; j++)
+        OS_TimeBaseDelete(g_tbIds[j]);
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Duplicate-name";
+
+    if (OS_TimeBaseCreate(&g_tbIds[0], "TimeBase", NULL) != OS_SUCCESS)
+    {
+        testDesc = "#4 Duplicate-name - Time-base-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        if (OS_TimeBaseCreate(&g_tbIds[1], "TimeBase", NULL) == OS_ERR_NAME_TAKEN)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Reset test environment */
+        OS_TimeBaseDelete(g_tbIds[0]);
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Nominal";
+
+    res = OS_TimeBaseCreate(&g_tbIds[0], "TimeBase", NULL);
+    if (res == OS_SUCCESS && OS_TimeBaseDelete(g_tbIds[0]) == OS_SUCCESS)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+UT_os_timebasecreate_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_TimeBaseCreate", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_TimeBaseSet(uint32 timer_id, uint32 start_time, uint32 interval_time)
+** Purpose: Starts, changes or stops the tick of a time base
+** Parameters: timer_id - the time base id
+**             start_time - microseconds until the first tick, zero stops the time base
+**             interval_time - microseconds between the following ticks
+** Returns: OS_ERR_INVALID_ID if the id passed in is not a valid time base
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_timebaseset_test()
+{
+    int32 res=0, idx=0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+    uint32 count=0;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_TimeBaseSet(99999, 0, 0);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_timebaseset_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Invalid-id-arg";
+
+    if (res == OS_ERR_INVALID_ID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Stop";
+
+    UT_os_timebase_reset_counts();
+    if ((OS_TimeBaseCreate(&g_tbIds[0], "TimeBase", NULL) != OS_SUCCESS) ||
+        (OS_TimerAdd(&g_tbTimerIds[0], "TimeBaseTimer", g_tbIds[0],
+                     UT_os_timebase_counter, (void *)&g_tbCounts[0]) != OS_SUCCESS))
+    {
+        testDesc = "#2 Stop - Time-base-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_timebaseset_test_exit_tag;
+    }
+
+    OS_TimerSet(g_tbTimerIds[0], UT_TIMEBASE_TICK_USEC, UT_TIMEBASE_TICK_USEC);
+    OS_TimeBaseSet(g_tbIds[0], UT_TIMEBASE_TICK_USEC, UT_TIMEBASE_TICK_USEC);
+    OS_TaskDelay(5 * UT_TIMEBASE_TICK_USEC / 1000);
+
+    if (OS_TimeBaseSet(g_tbIds[0], 0, 0) != OS_SUCCESS)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    else
+    {
+        OS_TaskDelay(2 * UT_TIMEBASE_TICK_USEC / 1000);
+        count = g_tbCounts[0];
+        OS_TaskDelay(5 * UT_TIMEBASE_TICK_USEC / 1000);
+        if (count > 0 && g_tbCounts[0] == count)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Nominal";
+
+    g_tbCounts[0] = 0;
+    if (OS_TimeBaseSet(g_tbIds[0], UT_TIMEBASE_TICK_USEC, UT_TIMEBASE_TICK_USEC) != OS_SUCCESS)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    else
+    {
+        OS_TaskDelay(UT_TIMEBASE_RUN_MSEC);
+        count = g_tbCounts[0];
+
+        /* one tick every 10 msec, leave room for a loaded host */
+        if (g_tbResult == 0 && count >= UT_TIMEBASE_RUN_MSEC / 20 && count <= UT_TIMEBASE_RUN_MSEC / 10 + 2)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+    /* Reset test environment */
+    OS_TimeBaseDelete(g_tbIds[0]);
+
+UT_os_timebaseset_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_TimeBaseSet", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_TimeBaseDelete(uint32 timer_id)
+** Purpose: Deletes a time base and all the timers added to it
+** Parameters: timer_id - the time base id
+** Returns: OS_ERR_INVALID_ID if the id passed in is not a valid time base
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_timebasedelete_test()
+{
+    int32 res=0, idx=0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+    OS_timer_prop_t timerProp;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_TimeBaseDelete(99999);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_timebasedelete_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Invalid-id-arg";
+
+    if (res == OS_ERR_INVALID_ID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 External-sync";
+
+    if (OS_TimeBaseCreate(&g_tbIds[0], "TimeBaseSync", UT_os_timebase_sync) != OS_SUCCESS)
+    {
+        testDesc = "#2 External-sync - Time-base-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        /* the thread is blocked in the sync function, it must still go away */
+        OS_TaskDelay(5);
+        if (OS_TimeBaseDelete(g_tbIds[0]) == OS_SUCCESS &&
+            OS_TimeBaseDelete(g_tbIds[0]) == OS_ERR_INVALID_ID)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Nominal";
+
+    UT_os_timebase_reset_counts();
+    if ((OS_TimeBaseCreate(&g_tbIds[0], "TimeBase", NULL) != OS_SUCCESS) ||
+        (OS_TimerAdd(&g_tbTimerIds[0], "TimeBaseTimer", g_tbIds[0],
+                     UT_os_timebase_counter, (void *)&g_tbCounts[0]) != OS_SUCCESS))
+    {
+        testDesc = "#3 Nominal - Time-base-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_timebasedelete_test_exit_tag;
+    }
+
+    /* the timers of the time base go with it */
+    if (OS_TimeBaseDelete(g_tbIds[0]) == OS_SUCCESS &&
+        OS_TimerGetInfo(g_tbTimerIds[0], &timerProp) == OS_ERR_INVALID_ID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+UT_os_timebasedelete_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_TimeBaseDelete", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_TimeBaseGetIdByName(uint32 *timer_id, const char *timebase_name)
+** Purpose: Returns the id of a given time base name
+** Parameters: *timer_id - a pointer that will hold the time base id
+**             *timebase_name - a pointer that holds the time base name
+** Returns: OS_INVALID_POINTER if any of the pointers passed in is null
+**          OS_ERR_NAME_TOO_LONG if the name passed in is too long
+**          OS_ERR_NAME_NOT_FOUND if the name passed in is not found
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_timebasegetidbyname_test()
+{
+    int32 res=0, idx=0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+    uint32 tbId=0;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_TimeBaseGetIdByName(&tbId, "TimeBase");
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_timebasegetidbyname_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if ((OS_TimeBaseGetIdByName(NULL, "TimeBase") == OS_INVALID_POINTER) &&
+        (OS_TimeBaseGetIdByName(&tbId, NULL) == OS_INVALID_POINTER))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Name-too-long";
+
+    if (OS_TimeBaseGetIdByName(&tbId, g_longTimerName) == OS_ERR_NAME_TOO_LONG)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Name-not-found";
+
+    if (OS_TimeBaseGetIdByName(&tbId, "NameNotFound") == OS_ERR_NAME_NOT_FOUND)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Nominal";
+
+    if (OS_TimeBaseCreate(&g_tbIds[0], "TimeBase", NULL) != OS_SUCCESS)
+    {
+        testDesc = "#4 Nominal - Time-base-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_timebasegetidbyname_test_exit_tag;
+    }
+
+    res = OS_TimeBaseGetIdByName(&tbId, "TimeBase");
+    if (res == OS_SUCCESS && tbId == g_tbIds[0])
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_TimeBaseDelete(g_tbIds[0]);
+
+UT_os_timebasegetidbyname_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_TimeBaseGetIdByName", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_TimerAdd(uint32 *timer_id, const char *timer_name, uint32 timebase_id,
+**                           OS_ArgCallback_t callback_ptr, void *callback_arg)
+** Purpose: Creates a timer serviced by the thread of a time base
+** Parameters: *timer_id - a pointer that will hold the timer id
+**             *timer_name - a pointer that holds the timer name
+**             timebase_id - the time base that drives the timer
+**             callback_ptr - function called with the timer id and callback_arg
+**             *callback_arg - argument passed to callback_ptr
+** Returns: OS_INVALID_POINTER if any of the pointers passed in is null
+**          OS_ERR_NAME_TOO_LONG if the name passed in is too long
+**          OS_ERR_INVALID_ID if the time base id is not valid
+**          OS_TIMER_ERR_INVALID_ARGS if the callback pointer is null
+**          OS_ERR_NAME_TAKEN if the name passed in has already been used
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_timeradd_test()
+{
+    int32 res=0, idx=0, i=0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+    char timerName[OS_MAX_API_NAME];
+    uint32 timerId=0;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_TimerAdd(&timerId, "TimeBaseTimer", 99999, UT_os_timebase_counter, NULL);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_timeradd_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Invalid-id-arg";
+
+    if (res == OS_ERR_INVALID_ID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    UT_os_timebase_reset_counts();
+    if (OS_TimeBaseCreate(&g_tbIds[0], "TimeBase", NULL) != OS_SUCCESS)
+    {
+        testDesc = "#2 Null-pointer-arg - Time-base-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_timeradd_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Null-pointer-arg";
+
+    if ((OS_TimerAdd(NULL, "TimeBaseTimer", g_tbIds[0], UT_os_timebase_counter, NULL) == OS_INVALID_POINTER) &&
+        (OS_TimerAdd(&timerId, NULL, g_tbIds[0], UT_os_timebase_counter, NULL) == OS_INVALID_POINTER))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Name-too-long";
+
+    if (OS_TimerAdd(&timerId, g_longTimerName, g_tbIds[0], UT_os_timebase_counter, NULL) == OS_ERR_NAME_TOO_LONG)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Null-callback-arg";
+
+    if (OS_TimerAdd(&timerId, "TimeBaseTimer", g_tbIds[0], NULL, NULL) == OS_TIMER_ERR_INVALID_ARGS)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Duplicate-name";
+
+    if (OS_TimerAdd(&g_tbTimerIds[0], "TimeBaseTimer", g_tbIds[0],
+                    UT_os_timebase_counter, (void *)&g_tbCounts[0]) != OS_SUCCESS)
+    {
+        testDesc = "#5 Duplicate-name - Timer-add failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        if (OS_TimerAdd(&timerId, "TimeBaseTimer", g_tbIds[0], UT_os_timebase_counter, NULL) == OS_ERR_NAME_TAKEN)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Reset test environment */
+        OS_TimerDelete(g_tbTimerIds[0]);
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#6 More-than-OS_MAX_TIMERS";
+
+    UT_os_timebase_reset_counts();
+    for (i=0; i < UT_OS_TIMEBASE_TIMERS; i++)
+    {
+        memset(timerName, '\0', sizeof(timerName));
+        UT_os_sprintf(timerName, "TimeBaseTimer%d", (int)i);
+        res = OS_TimerAdd(&g_tbTimerIds[i], timerName, g_tbIds[0],
+                          UT_os_timebase_counter, (void *)&g_tbCounts[i]);
+        if (res != OS_SUCCESS)
+            break;
+
+        /* periods of one to four ticks */
+        OS_TimerSet(g_tbTimerIds[i], UT_TIMEBASE_TICK_USEC, UT_TIMEBASE_TICK_USEC * (1 + (i % 4)));
+    }
+
+    if (i < UT_OS_TIMEBASE_TIMERS)
+    {
+        testDesc = "#6 More-than-OS_MAX_TIMERS - Timer-add failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+    else
+    {
+        OS_TimeBaseSet(g_tbIds[0], UT_TIMEBASE_TICK_USEC, UT_TIMEBASE_TICK_USEC);
+        OS_TaskDelay(UT_TIMEBASE_RUN_MSEC);
+        OS_TimeBaseSet(g_tbIds[0], 0, 0);
+
+        res = g_tbResult;
+        for (i=0; i < UT_OS_TIMEBASE_TIMERS; i++)
+        {
+            /* a timer never runs ahead of its period */
+            if (g_tbCounts[i] == 0 || g_tbCounts[i] > (UT_TIMEBASE_RUN_MSEC / 10) / (1 + (i % 4)) + 2)
+                res = -1;
+        }
+
+        if (res == 0)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+    /* Reset test environment */
+    OS_TimeBaseDelete(g_tbIds[0]);
+
+    /*-----------------------------------------------------*/
+    testDesc = "#7 External-sync";
+
+    UT_os_timebase_reset_counts();
+    if ((OS_TimeBaseCreate(&g_tbIds[0], "TimeBaseSync", UT_os_timebase_sync) != OS_SUCCESS) ||
+        (OS_TimerAdd(&g_tbTimerIds[0], "TimeBaseTimer", g_tbIds[0],
+                     UT_os_timebase_counter, (void *)&g_tbCounts[0]) != OS_SUCCESS))
+    {
+        testDesc = "#7 External-sync - Time-base-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        OS_TimerSet(g_tbTimerIds[0], 2 * UT_TIMEBASE_TICK_USEC, 2 * UT_TIMEBASE_TICK_USEC);
+        OS_TaskDelay(UT_TIMEBASE_RUN_MSEC);
+
+        if (g_tbResult == 0 && g_tbCounts[0] > 0)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+    /* Reset test environment */
+    OS_TimeBaseDelete(g_tbIds[0]);
+
+    /*-----------------------------------------------------*/
+    testDesc = "#8 Nominal";
+
+    UT_os_timebase_reset_counts();
+    if (OS_TimeBaseCreate(&g_tbIds[0], "TimeBase", NULL) != OS_SUCCESS)
+    {
+        testDesc = "#8 Nominal - Time-base-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_timeradd_test_exit_tag;
+    }
+
+    res = OS_TimerAdd(&g_tbTimerIds[0], "TimeBaseTimer", g_tbIds[0],
+                      UT_os_timebase_counter, (void *)&g_tbCounts[0]);
+    if (res == OS_SUCCESS)
+    {
+        /* one shot timer */
+        OS_TimerSet(g_tbTimerIds[0], 3 * UT_TIMEBASE_TICK_USEC, 0);
+        OS_TimeBaseSet(g_tbIds[0], UT_TIMEBASE_TICK_USEC, UT_TIMEBASE_TICK_USEC);
+        OS_TaskDelay(10 * UT_TIMEBASE_TICK_USEC / 1000);
+    }
+
+    if (res == OS_SUCCESS && g_tbResult == 0 && g_tbCounts[0] == 1 &&
+        OS_TimerGetIdByName(&timerId, "TimeBaseTimer") == OS_SUCCESS && timerId == g_tbTimerIds[0] &&
+        OS_TimerDelete(g_tbTimerIds[0]) == OS_SUCCESS)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_TimeBaseDelete(g_tbIds[0]);
+
+UT_os_timeradd_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_TimerAdd", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*================================================================================*
+** End of File: ut_ostimer_timebase_test.c
+**================================================================================*/
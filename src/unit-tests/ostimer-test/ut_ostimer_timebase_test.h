@@ -0,0 +1,47 @@
+/*================================================================================*
+** File:  ut_ostimer_timebase_test.h
+**================================================================================*/
+
+#ifndef _UT_OSTIMER_TIMEBASE_TEST_H_
+#define _UT_OSTIMER_TIMEBASE_TEST_H_
+
+/*--------------------------------------------------------------------------------*
+** Includes
+**--------------------------------------------------------------------------------*/
+
+#include "ut_os_stubs.h"
+
+/*--------------------------------------------------------------------------------*
+** Macros
+**--------------------------------------------------------------------------------*/
+
+#define UT_OS_TIMEBASE_TIMERS  64     /* well beyond OS_MAX_TIMERS */
+/*--------------------------------------------------------------------------------*
+** Data types
+**--------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*
+** External global variables
+**--------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*
+** Global variables
+**--------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*
+** Function prototypes
+**--------------------------------------------------------------------------------*/
+
+void UT_os_timebasecreate_test(void);
+void UT_os_timebaseset_test(void);
+void UT_os_timebasedelete_test(void);
+void UT_os_timebasegetidbyname_test(void);
+void UT_os_timeradd_test(void);
+
+/*--------------------------------------------------------------------------------*/
+
+#endif  /* _UT_OSTIMER_TIMEBASE_TEST_H_ */
+
+/*================================================================================*
+** End of File: ut_ostimer_timebase_test.h
+**================================================================================*/
@@ -46,10 +46,18 @@ extern void UT_os_timercallback(uint32 timerId);
 uint32  g_clkAccuracy = 0;
 uint32  g_timerIds[UT_OS_TIMER_LIST_LEN];
 
+uint32           g_serviceMutexId = 0;
+volatile uint32  g_serviceCount = 0;
+
+volatile uint32  g_setNsCount = 0;
+
 /*--------------------------------------------------------------------------------*
 ** Local function prototypes
 **--------------------------------------------------------------------------------*/
 
+void UT_os_timerservicecallback(uint32 timerId);
+void UT_os_timersetnscallback(uint32 timerId);
+
 /*--------------------------------------------------------------------------------*
 ** Local function definitions
 **--------------------------------------------------------------------------------*/
@@ -653,6 +661,329 @@ UT_os_timerset_test_exit_tag:
     UT_OS_LOG_API_MACRO(apiInfo)
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_TimerSetNs(uint32 timer_id, uint64 start_time_ns, uint64 interval_time_ns)
+** Purpose: Programs a given timer with a start time and an interval time of nanoseconds
+** Parameters: timer_id - id of the timer to be programmed
+**             start_time_ns - start time in nanoseconds of when to first call the
+**                             timer's callback function
+**             interval_time_ns - interval in nanoseconds of what the periodic timer
+**                                will be programmed for
+** Returns: OS_ERR_INVALID_ID if the timer id passed in is not a valid timer id
+**          OS_TIMER_ERR_INVALID_ARGS if a time is too long for the host timer
+**          OS_TIMER_ERR_INTERNAL if the OS call failed
+**          OS_SUCCESS if succeeded
+**          OS_ERR_NOT_IMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_ERR_NOT_IMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Invalid-id condition
+**   1) Make sure there's no timer created previously
+**   2) Call this routine with some value for timer id as argument
+**   3) Expect the returned value to be
+**        (a) OS_ERR_INVALID_ID
+** -----------------------------------------------------
+** Test #2: Long-interval condition
+**   1) Call OS_TimerCreate
+**   2) Call this routine with start and interval times of two hours, which do
+**      not fit in the uint32 microseconds of OS_TimerSet
+**   3) Expect the returned value to be
+**        (a) OS_SUCCESS __and__
+**        (b) OS_TimerGetInfo to return the nanosecond times that were set
+**      A port limited to microsecond host timers returns OS_TIMER_ERR_INVALID_ARGS
+** -----------------------------------------------------
+** Test #3: Overflow-start condition
+**   1) Call OS_TimerCreate
+**   2) Call this routine with the largest start time
+**   3) Expect the returned value to be
+**        (a) OS_TIMER_ERR_INVALID_ARGS, or OS_SUCCESS if the host timer holds it
+**            __and__
+**        (b) the callback not to have run
+** -----------------------------------------------------
+** Test #4: Nominal condition
+**   1) Call OS_TimerCreate
+**   2) Call this routine with a start time of 1 msec and an interval time of 2.5 msec
+**   3) Let it run for 100 msec
+**   4) Expect the returned value to be
+**        (a) OS_SUCCESS __and__
+**        (b) the callback to have run __and__
+**        (c) OS_TimerGetInfo to return a non-zero clock resolution in nanoseconds
+**--------------------------------------------------------------------------------*/
+void UT_os_timersetnscallback(uint32 timerId)
+{
+    ++g_setNsCount;
+}
+
+void UT_os_timersetns_test()
+{
+    int32 res=0, idx=0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+    OS_timer_prop_t timerProps;
+    uint64 longTime = (uint64)2 * 3600 * 1000000000;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_TimerSetNs(99999, 0, 0);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_timersetns_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Invalid-id-arg";
+
+    res = OS_TimerSetNs(99999, 1000000, 0);
+    if (res == OS_ERR_INVALID_ID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Long-interval";
+
+    res = OS_TimerCreate(&g_timerIds[2], g_timerNames[2], &g_clkAccuracy, &UT_os_timersetnscallback);
+    if (res != OS_SUCCESS)
+    {
+        testDesc = "#2 Long-interval - Timer-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        res = OS_TimerSetNs(g_timerIds[2], longTime, longTime);
+        memset(&timerProps, 0x00, sizeof(timerProps));
+        if (res == OS_TIMER_ERR_INVALID_ARGS)
+        {
+            testDesc = "#2 Long-interval - Not supported by the host timers";
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        }
+        else if ((res == OS_SUCCESS) &&
+                 (OS_TimerGetInfo(g_timerIds[2], &timerProps) == OS_SUCCESS) &&
+                 (timerProps.start_time_ns == longTime) &&
+                 (timerProps.interval_time_ns == longTime))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Reset test environment */
+        OS_TimerDelete(g_timerIds[2]);
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Overflow-start";
+
+    res = OS_TimerCreate(&g_timerIds[2], g_timerNames[2], &g_clkAccuracy, &UT_os_timersetnscallback);
+    if (res != OS_SUCCESS)
+    {
+        testDesc = "#3 Overflow-start - Timer-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        g_setNsCount = 0;
+        res = OS_TimerSetNs(g_timerIds[2], (uint64)-1, 0);
+        OS_TaskDelay(50);
+        if ((res == OS_TIMER_ERR_INVALID_ARGS || res == OS_SUCCESS) && (g_setNsCount == 0))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Reset test environment */
+        OS_TimerDelete(g_timerIds[2]);
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Nominal";
+
+    res = OS_TimerCreate(&g_timerIds[3], g_timerNames[3], &g_clkAccuracy, &UT_os_timersetnscallback);
+    if (res != OS_SUCCESS)
+    {
+        testDesc = "#4 Nominal - Timer-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_timersetns_test_exit_tag;
+    }
+
+    g_setNsCount = 0;
+    res = OS_TimerSetNs(g_timerIds[3], 1000000, 2500000);
+    OS_TaskDelay(100);
+    OS_TimerSetNs(g_timerIds[3], 0, 0);
+
+    memset(&timerProps, 0x00, sizeof(timerProps));
+    if ((res == OS_SUCCESS) && (g_setNsCount > 0) &&
+        (OS_TimerGetInfo(g_timerIds[3], &timerProps) == OS_SUCCESS) &&
+        (timerProps.accuracy_ns > 0))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_TimerDelete(g_timerIds[3]);
+
+UT_os_timersetns_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_TimerSetNs", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_TimerSetSlack(uint32 timer_id, uint32 slack_usec)
+** Purpose: Lets a timer expire up to slack_usec late, together with other timers
+** Parameters: timer_id - id of the timer
+**             slack_usec - how late the timer may expire, in microseconds
+** Returns: OS_ERR_INVALID_ID if the timer id passed in is not a valid timer id
+**          OS_TIMER_ERR_INTERNAL if the OS call failed
+**          OS_SUCCESS if succeeded
+**          OS_ERR_NOT_IMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_ERR_NOT_IMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Invalid-id condition
+**   1) Make sure there's no timer created previously
+**   2) Call this routine with some value for timer id as argument
+**   3) Expect the returned value to be
+**        (a) OS_ERR_INVALID_ID
+** -----------------------------------------------------
+** Test #2: Nominal condition
+**   1) Create a timer without slack expiring every 10 msec, and a timer with
+**      8 msec of slack expiring every 10 msec, 3 msec after the first one
+**   2) Let them run for 200 msec
+**   3) Expect the returned value to be
+**        (a) OS_SUCCESS __and__
+**        (b) both timers to have expired __and__
+**        (c) the timer service thread to have woken up less often than the
+**            timers expired
+**      Timers that use signals return OS_ERR_NOT_IMPLEMENTED
+** -----------------------------------------------------
+** Test #3: Expired-one-shot condition
+**   1) Create a timer expiring once after 5 msec, and let it expire
+**   2) Call this routine with 1 msec of slack for the timer
+**   3) Wait 50 msec
+**   4) Expect the returned value to be
+**        (a) OS_SUCCESS __and__
+**        (b) the callback to have run only once
+**--------------------------------------------------------------------------------*/
+void UT_os_timersetslack_test()
+{
+    int32 res=0, idx=0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+    OS_timer_service_stats_t before, after;
+    uint32 expirations=0, wakeups=0;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_TimerSetSlack(99999, 0);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_timersetslack_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Invalid-id-arg";
+
+    res = OS_TimerSetSlack(99999, 1000);
+    if (res == OS_ERR_INVALID_ID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Nominal";
+
+    if ((OS_TimerCreate(&g_timerIds[1], g_timerNames[1], &g_clkAccuracy, &UT_os_timersetnscallback) != OS_SUCCESS) ||
+        (OS_TimerCreate(&g_timerIds[2], g_timerNames[2], &g_clkAccuracy, &UT_os_timerservicecallback) != OS_SUCCESS) ||
+        (OS_MutSemCreate(&g_serviceMutexId, "SlackMutex", 0) != OS_SUCCESS))
+    {
+        testDesc = "#2 Nominal - Timer-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_timersetslack_test_exit_tag;
+    }
+
+    g_setNsCount = 0;
+    g_serviceCount = 0;
+    memset(&before, 0x00, sizeof(before));
+    memset(&after, 0x00, sizeof(after));
+    OS_TimerGetServiceStats(&before);
+
+    res = OS_TimerSetSlack(g_timerIds[2], 8000);
+    OS_TimerSet(g_timerIds[1], 10000, 10000);
+    OS_TimerSet(g_timerIds[2], 13000, 10000);
+    OS_TaskDelay(200);
+    OS_TimerSet(g_timerIds[1], 0, 0);
+    OS_TimerSet(g_timerIds[2], 0, 0);
+    OS_TaskDelay(20);
+
+    if (OS_TimerGetServiceStats(&after) == OS_SUCCESS)
+    {
+        expirations = after.expirations - before.expirations;
+        wakeups = after.wakeups - before.wakeups;
+    }
+
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        testDesc = "#2 Nominal - Not supported by the host timers";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+    }
+    else if ((res == OS_SUCCESS) && (g_setNsCount > 0) && (g_serviceCount > 0) &&
+        (wakeups > 0) && (wakeups < expirations))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_TimerDelete(g_timerIds[1]);
+    OS_TimerDelete(g_timerIds[2]);
+    OS_MutSemDelete(g_serviceMutexId);
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Expired-one-shot";
+
+    if (OS_TimerCreate(&g_timerIds[1], g_timerNames[1], &g_clkAccuracy, &UT_os_timersetnscallback) != OS_SUCCESS)
+    {
+        testDesc = "#3 Expired-one-shot - Timer-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_timersetslack_test_exit_tag;
+    }
+
+    g_setNsCount = 0;
+    OS_TimerSet(g_timerIds[1], 5000, 0);
+    OS_TaskDelay(50);
+    expirations = g_setNsCount;
+
+    res = OS_TimerSetSlack(g_timerIds[1], 1000);
+    OS_TaskDelay(50);
+
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        testDesc = "#3 Expired-one-shot - Not supported by the host timers";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+    }
+    else if ((res == OS_SUCCESS) && (expirations == 1) && (g_setNsCount == 1))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_TimerDelete(g_timerIds[1]);
+
+UT_os_timersetslack_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_TimerSetSlack", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
 /*--------------------------------------------------------------------------------*
 ** Syntax: int32 OS_TimerGetIdByName(uint32 *timer_id, const char *timer_name)
 ** Purpose: Returns the timer id of a given timer name
@@ -882,6 +1213,192 @@ UT_os_timergetinfo_test_exit_tag:
     UT_OS_LOG_API_MACRO(apiInfo)
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_TimerGetServiceStats(OS_timer_service_stats_t *stats)
+** Purpose: Returns the statistics of the thread that calls the timer callbacks
+** Parameters: *stats - a pointer to an OS_timer_service_stats_t structure that will
+**                      hold the statistics
+** Returns: OS_INVALID_POINTER if the pointer passed in is null
+**          OS_SUCCESS if succeeded
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_ERR_NOT_IMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-argument condition
+**   1) Call this routine with a null pointer as argument
+**   2) Expect the returned value to be
+**        (a) OS_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Nominal condition
+**   1) Create and start a timer whose callback takes an OSAL mutex
+**   2) Let it expire a few times, then call this routine
+**   3) Expect the returned value to be
+**        (a) OS_SUCCESS __and__
+**        (b) the callback ran __and__
+**        (c) the expirations went up by at least the number of callbacks
+**--------------------------------------------------------------------------------*/
+void UT_os_timerservicecallback(uint32 timerId)
+{
+    /* callbacks run in thread context, so they may block on a mutex */
+    if (OS_MutSemTake(g_serviceMutexId) == OS_SUCCESS)
+    {
+        ++g_serviceCount;
+        OS_MutSemGive(g_serviceMutexId);
+    }
+}
+
+void UT_os_timergetservicestats_test()
+{
+    int32 res=0, idx=0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+    OS_timer_service_stats_t before, after;
+    uint32 timerId=0;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_TimerGetServiceStats(&before);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_timergetservicestats_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if (OS_TimerGetServiceStats(NULL) == OS_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Nominal";
+
+    if ((OS_MutSemCreate(&g_serviceMutexId, "ServiceMutex", 0) != OS_SUCCESS) ||
+        (OS_TimerCreate(&timerId, "ServiceTimer", &g_clkAccuracy, &UT_os_timerservicecallback) != OS_SUCCESS))
+    {
+        testDesc = "#2 Nominal - Timer-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_timergetservicestats_test_exit_tag;
+    }
+
+    g_serviceCount = 0;
+    OS_TimerGetServiceStats(&before);
+    OS_TimerSet(timerId, 10000, 10000);
+    OS_TaskDelay(100);
+    OS_TimerSet(timerId, 0, 0);
+    OS_TaskDelay(20);
+
+    res = OS_TimerGetServiceStats(&after);
+    if (res == OS_SUCCESS && g_serviceCount > 0 &&
+        (after.expirations - before.expirations) >= g_serviceCount &&
+        after.latency_max >= after.latency_avg)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_TimerDelete(timerId);
+    OS_MutSemDelete(g_serviceMutexId);
+
+UT_os_timergetservicestats_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_TimerGetServiceStats", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_TimerSetServiceAttr(uint32 priority, uint32 affinity_mask)
+** Purpose: Sets the priority and the CPU mask of the thread that calls the timer
+**          callbacks
+** Parameters: priority - the OSAL priority of the thread
+**             affinity_mask - the CPUs the thread may run on, 0 = any CPU
+** Returns: OS_ERR_INVALID_PRIORITY if the priority is bad
+**          OS_SUCCESS if succeeded
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_ERR_NOT_IMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Invalid-priority-arg condition
+**   1) Call this routine with a priority above 255
+**   2) Expect the returned value to be
+**        (a) OS_ERR_INVALID_PRIORITY
+** -----------------------------------------------------
+** Test #2: Nominal condition
+**   1) Call this routine to keep the service thread on CPU 0
+**   2) Create and start a timer and let it expire a few times
+**   3) Expect the returned value to be
+**        (a) OS_SUCCESS __and__
+**        (b) the callback ran
+**--------------------------------------------------------------------------------*/
+void UT_os_timersetserviceattr_test()
+{
+    int32 res=0, idx=0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+    uint32 timerId=0;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_TimerSetServiceAttr(1, 0);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_timersetserviceattr_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Invalid-priority-arg";
+
+    if (OS_TimerSetServiceAttr(256, 0) == OS_ERR_INVALID_PRIORITY)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Nominal";
+
+    res = OS_TimerSetServiceAttr(1, 0x1);
+
+    if ((OS_MutSemCreate(&g_serviceMutexId, "ServiceMutex", 0) != OS_SUCCESS) ||
+        (OS_TimerCreate(&timerId, "ServiceTimer", &g_clkAccuracy, &UT_os_timerservicecallback) != OS_SUCCESS))
+    {
+        testDesc = "#2 Nominal - Timer-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_timersetserviceattr_test_exit_tag;
+    }
+
+    g_serviceCount = 0;
+    OS_TimerSet(timerId, 10000, 10000);
+    OS_TaskDelay(100);
+    OS_TimerSet(timerId, 0, 0);
+    OS_TaskDelay(20);
+
+    if (res == OS_SUCCESS && g_serviceCount > 0)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_TimerDelete(timerId);
+    OS_MutSemDelete(g_serviceMutexId);
+    OS_TimerSetServiceAttr(1, 0);
+
+UT_os_timersetserviceattr_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_TimerSetServiceAttr", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
 /*================================================================================*
 ** End of File: ut_ostimer_timerio_test.c
 **================================================================================*/
@@ -39,8 +39,12 @@ void UT_os_timerinit_test(void);
 void UT_os_timercreate_test(void);
 void UT_os_timerdelete_test(void);
 void UT_os_timerset_test(void);
+void UT_os_timersetns_test(void);
+void UT_os_timersetslack_test(void);
 void UT_os_timergetidbyname_test(void);
 void UT_os_timergetinfo_test(void);
+void UT_os_timergetservicestats_test(void);
+void UT_os_timersetserviceattr_test(void);
 
 /*--------------------------------------------------------------------------------*/
 
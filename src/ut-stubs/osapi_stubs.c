@@ -754,6 +754,685 @@ int32 OS_TaskCreate(uint32 *task_id, const char *task_name,
     return status;
 }
 
+/*****************************************************************************/
+/**
+** \brief OS_TaskCreateEx stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_TaskCreateEx.  The user can adjust the response by setting the value
+**        of UT_OS_Fail prior to this function being called.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_TaskCreateEx(uint32 *task_id, const char *task_name,
+                      osal_task_entry_arg function_pointer,
+                      void *entry_arg,
+                      uint32 stack_size, uint32 priority,
+                      uint32 flags, const OS_task_attr_t *attr)
+{
+    int32 status = OS_SUCCESS;
+
+    status = UT_DEFAULT_IMPL(OS_TaskCreateEx);
+
+    if (status == OS_SUCCESS)
+    {
+        *task_id = UT_AllocStubObjId(UT_OBJTYPE_TASK);
+    }
+    else
+    {
+        *task_id = 0xDEADBEEFU;
+    }
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief OS_WorkQueueCreate stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_WorkQueueCreate.  The user can adjust the response by setting the value
+**        of UT_OS_Fail prior to this function being called.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_WorkQueueCreate(uint32 *queue_id, const char *queue_name,
+                         uint32 num_workers, uint32 priority,
+                         uint32 affinity_mask)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_WorkQueueCreate);
+
+    if (status == OS_SUCCESS)
+    {
+        *queue_id = 0;
+    }
+    else
+    {
+        *queue_id = 0xDEADBEEFU;
+    }
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief OS_WorkQueueDelete stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_WorkQueueDelete.  The user can adjust the response by setting the value
+**        of UT_OS_Fail prior to this function being called.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_WorkQueueDelete(uint32 queue_id)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_WorkQueueDelete);
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief OS_WorkSubmit stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_WorkSubmit.  The user can adjust the response by setting the value
+**        of UT_OS_Fail prior to this function being called.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_WorkSubmit(uint32 queue_id, OS_WorkFunc_t function_pointer,
+                    void *arg, uint32 *work_id)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_WorkSubmit);
+
+    if (status == OS_SUCCESS)
+    {
+        /*
+         * There is no real queue behind the stub, so run the
+         * work item synchronously to preserve its side effects.
+         */
+        if (function_pointer != NULL)
+        {
+            function_pointer(arg);
+        }
+        *work_id = 0;
+    }
+    else
+    {
+        *work_id = 0xDEADBEEFU;
+    }
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief OS_WorkSubmitGroup stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_WorkSubmitGroup.  The user can adjust the response by setting the value
+**        of UT_OS_Fail prior to this function being called.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_WorkSubmitGroup(uint32 queue_id, uint32 group,
+                         OS_WorkFunc_t function_pointer, void *arg)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_WorkSubmitGroup);
+
+    if (status == OS_SUCCESS && function_pointer != NULL)
+    {
+        function_pointer(arg);
+    }
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief OS_WorkWait stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_WorkWait.  The user can adjust the response by setting the value
+**        of UT_OS_Fail prior to this function being called.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_WorkWait(uint32 queue_id, uint32 work_id)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_WorkWait);
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief OS_WorkGroupWait stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_WorkGroupWait.  The user can adjust the response by setting the value
+**        of UT_OS_Fail prior to this function being called.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_WorkGroupWait(uint32 queue_id, uint32 group)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_WorkGroupWait);
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief OS_FiberSchedCreate stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_FiberSchedCreate.  The user can adjust the response by setting the value
+**        of UT_OS_Fail prior to this function being called.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_FiberSchedCreate(uint32 *sched_id, const char *sched_name,
+                          uint32 num_workers, uint32 priority,
+                          uint32 affinity_mask)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_FiberSchedCreate);
+
+    if (status == OS_SUCCESS)
+    {
+        *sched_id = 0;
+    }
+    else
+    {
+        *sched_id = 0xDEADBEEFU;
+    }
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief OS_FiberSchedDelete stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_FiberSchedDelete.  The user can adjust the response by setting the value
+**        of UT_OS_Fail prior to this function being called.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_FiberSchedDelete(uint32 sched_id)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_FiberSchedDelete);
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief OS_FiberSchedGetInfo stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_FiberSchedGetInfo.  The user can adjust the response by setting the value
+**        of UT_OS_Fail prior to this function being called.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_FiberSchedGetInfo(uint32 sched_id, OS_fiber_sched_prop_t *sched_prop)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_FiberSchedGetInfo);
+
+    if (status == OS_SUCCESS)
+    {
+        memset(sched_prop, 0, sizeof(*sched_prop));
+    }
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief OS_FiberCreate stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_FiberCreate.  The user can adjust the response by setting the value
+**        of UT_OS_Fail prior to this function being called.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_FiberCreate(uint32 *fiber_id, uint32 sched_id, OS_FiberFunc_t function,
+                     void *arg, uint32 stack_size)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_FiberCreate);
+
+    if (status == OS_SUCCESS)
+    {
+        *fiber_id = 0;
+    }
+    else
+    {
+        *fiber_id = 0xDEADBEEFU;
+    }
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief OS_FiberExit stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_FiberExit.  The user can adjust the response by setting the value
+**        of UT_OS_Fail prior to this function being called.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void OS_FiberExit(void)
+{
+    /* Although this has no retcode, invoke the hooks provided in the default impl */
+    UT_DEFAULT_IMPL_RC(OS_FiberExit, 1);
+}
+
+/*****************************************************************************/
+/**
+** \brief OS_FiberYield stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_FiberYield.  The user can adjust the response by setting the value
+**        of UT_OS_Fail prior to this function being called.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_FiberYield(void)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_FiberYield);
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief OS_FiberDelay stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_FiberDelay.  The user can adjust the response by setting the value
+**        of UT_OS_Fail prior to this function being called.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_FiberDelay(uint32 millisecond)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_FiberDelay);
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief OS_FiberGetId stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_FiberGetId.  The user can adjust the response by setting the value
+**        of UT_OS_Fail prior to this function being called.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_FiberGetId(uint32 *fiber_id)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_FiberGetId);
+
+    if (status == OS_SUCCESS)
+    {
+        *fiber_id = 0;
+    }
+    else
+    {
+        *fiber_id = 0xDEADBEEFU;
+    }
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief OS_FiberSemCreate stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_FiberSemCreate.  The user can adjust the response by setting the value
+**        of UT_OS_Fail prior to this function being called.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_FiberSemCreate(uint32 *sem_id, uint32 sem_initial_value)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_FiberSemCreate);
+
+    if (status == OS_SUCCESS)
+    {
+        *sem_id = 0;
+    }
+    else
+    {
+        *sem_id = 0xDEADBEEFU;
+    }
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief OS_FiberSemDelete stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_FiberSemDelete.  The user can adjust the response by setting the value
+**        of UT_OS_Fail prior to this function being called.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_FiberSemDelete(uint32 sem_id)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_FiberSemDelete);
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief OS_FiberSemGive stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_FiberSemGive.  The user can adjust the response by setting the value
+**        of UT_OS_Fail prior to this function being called.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_FiberSemGive(uint32 sem_id)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_FiberSemGive);
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief OS_FiberSemTake stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_FiberSemTake.  The user can adjust the response by setting the value
+**        of UT_OS_Fail prior to this function being called.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_FiberSemTake(uint32 sem_id)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_FiberSemTake);
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief OS_FiberQueueCreate stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_FiberQueueCreate.  The user can adjust the response by setting the value
+**        of UT_OS_Fail prior to this function being called.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_FiberQueueCreate(uint32 *queue_id, uint32 queue_depth, uint32 data_size)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_FiberQueueCreate);
+
+    if (status == OS_SUCCESS)
+    {
+        *queue_id = 0;
+    }
+    else
+    {
+        *queue_id = 0xDEADBEEFU;
+    }
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief OS_FiberQueueDelete stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_FiberQueueDelete.  The user can adjust the response by setting the value
+**        of UT_OS_Fail prior to this function being called.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_FiberQueueDelete(uint32 queue_id)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_FiberQueueDelete);
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief OS_FiberQueuePut stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_FiberQueuePut.  The user can adjust the response by setting the value
+**        of UT_OS_Fail prior to this function being called.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_FiberQueuePut(uint32 queue_id, const void *data, uint32 size)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_FiberQueuePut);
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief OS_FiberQueueGet stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_FiberQueueGet.  The user can adjust the response by setting the value
+**        of UT_OS_Fail prior to this function being called.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_FiberQueueGet(uint32 queue_id, void *data, uint32 size, uint32 *size_copied,
+                       int32 timeout)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_FiberQueueGet);
+
+    if (status == OS_SUCCESS)
+    {
+        *size_copied = 0;
+    }
+
+    return status;
+}
+
 /*****************************************************************************/
 /**
 ** \brief OS_TaskGetId stub function
@@ -808,12 +1487,123 @@ int32 OS_TaskGetInfo(uint32 task_id, OS_task_prop_t *task_prop)
     task_prop->OStask_id = task_id & 0xFFFF;
     task_prop->stack_size = 100;
     task_prop->priority = 150;
+    task_prop->policy = OS_SCHED_DEFAULT;
+    task_prop->os_priority = 150;
     strncpy(task_prop->name, "UnitTest", OS_MAX_API_NAME - 1);
     task_prop->name[OS_MAX_API_NAME - 1] = '\0';
 
     return status;
 }
 
+/*****************************************************************************/
+/**
+** \brief OS_TaskGetStats stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_TaskGetStats.  It clears the statistics structure, sets the name
+**        and task ID, and returns the configured status.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_TaskGetStats(uint32 task_id, OS_task_stats_t *task_stats)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_TaskGetStats);
+
+    memset(task_stats, 0, sizeof(*task_stats));
+    task_stats->task_id = task_id;
+    task_stats->current_cpu = -1;
+    strncpy(task_stats->name, "UnitTest", OS_MAX_API_NAME - 1);
+    task_stats->name[OS_MAX_API_NAME - 1] = '\0';
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief OS_TaskGetStatsAll stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_TaskGetStatsAll.  It reports an empty snapshot and returns the
+**        configured status.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_TaskGetStatsAll(OS_task_stats_t *task_stats, uint32 max_count, uint32 *count)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_TaskGetStatsAll);
+
+    *count = 0;
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief OS_TaskStatsMonitorStart stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_TaskStatsMonitorStart.  The user can adjust the response by setting the value
+**        of UT_OS_Fail prior to this function being called.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_TaskStatsMonitorStart(uint32 period_msec, uint32 priority,
+                               OS_TaskStatsCallback_t callback)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_TaskStatsMonitorStart);
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief OS_TaskStatsMonitorStop stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_TaskStatsMonitorStop.  The user can adjust the response by setting the value
+**        of UT_OS_Fail prior to this function being called.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_TaskStatsMonitorStop(void)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_TaskStatsMonitorStop);
+
+    return status;
+}
+
 /*****************************************************************************/
 /**
 ** \brief OS_read stub function
@@ -1034,6 +1824,56 @@ int32 OS_TaskDelay(uint32 millisecond)
     return status;
 }
 
+/*****************************************************************************/
+/**
+** \brief OS_TaskPeriodicInit stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_TaskPeriodicInit.  The user can adjust the response by setting the value
+**        of UT_OS_Fail prior to this function being called.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_TaskPeriodicInit(uint32 period_usec)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_TaskPeriodicInit);
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief OS_TaskWaitNextPeriod stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_TaskWaitNextPeriod.  The user can adjust the response by setting the value
+**        of UT_OS_Fail prior to this function being called.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_TaskWaitNextPeriod(void)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_TaskWaitNextPeriod);
+
+    return status;
+}
+
 /*****************************************************************************/
 /**
 ** \brief OS_BinSemGive stub function
@@ -1403,6 +2243,47 @@ int32 OS_TimerSet(uint32 timer_id, uint32 start_time, uint32 interval_time)
     return status;
 }
 
+int32 OS_TimerSetNs(uint32 timer_id, uint64 start_time_ns, uint64 interval_time_ns)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_TimerSetNs);
+
+    return status;
+}
+
+int32 OS_TimerSetSlack(uint32 timer_id, uint32 slack_usec)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_TimerSetSlack);
+
+    return status;
+}
+
+int32 OS_TimerGetServiceStats (OS_timer_service_stats_t *stats)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_TimerGetServiceStats);
+
+    if (status == OS_SUCCESS)
+    {
+        memset(stats, 0, sizeof(*stats));
+    }
+
+    return status;
+}
+
+int32 OS_TimerSetServiceAttr (uint32 priority, uint32 affinity_mask)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_TimerSetServiceAttr);
+
+    return status;
+}
+
 /*****************************************************************************/
 /**
 ** \brief OS_TaskDelete stub function
@@ -1693,6 +2574,31 @@ int32 OS_HeapGetInfo(OS_heap_prop_t *heap_prop)
     return status;
 }
 
+/*****************************************************************************/
+/**
+** \brief OS_DeterministicModeEnable stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_DeterministicModeEnable.  The user can adjust the response by setting
+**        the value of UT_OS_Fail prior to this function being called.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_DeterministicModeEnable(uint32 heap_reserve_size)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_DeterministicModeEnable);
+
+    return status;
+}
+
 /*****************************************************************************/
 /**
 ** \brief OS_TimerGetInfo stub function
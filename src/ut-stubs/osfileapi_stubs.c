@@ -105,6 +105,392 @@ int32 OS_lseek(int32 filedes, int32 offset, uint32 whence)
     return status;
 }
 
+int32 OS_lseek64(int32 filedes, int64 offset, uint32 whence, uint64 *new_offset)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_lseek64);
+
+    if (status == OS_SUCCESS && new_offset != NULL)
+    {
+        *new_offset = (uint64)offset;
+    }
+
+    return status;
+}
+
+int32 OS_fstat(int32 filedes, os_fstat_t *filestats)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_fstat);
+
+    if (status == OS_SUCCESS &&
+        UT_Stub_CopyToLocal(UT_KEY(OS_fstat), (uint8 *)filestats, sizeof(*filestats)) < sizeof(*filestats))
+    {
+        memset(filestats, 0, sizeof(*filestats));
+    }
+
+    return status;
+}
+
+int32 OS_FDGetSize(int32 filedes, uint64 *size)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_FDGetSize);
+
+    if (status == OS_SUCCESS &&
+        UT_Stub_CopyToLocal(UT_KEY(OS_FDGetSize), (uint8 *)size, sizeof(*size)) < sizeof(*size))
+    {
+        *size = 0;
+    }
+
+    return status;
+}
+
+int32 OS_pread(int32 filedes, void *buffer, uint32 nbytes, uint64 offset)
+{
+    int32 status;
+    uint32 CopySize;
+
+    status = UT_DEFAULT_IMPL_RC(OS_pread, 0x7FFFFFFF);
+
+    if (status == 0x7FFFFFFF)
+    {
+        CopySize = UT_Stub_CopyToLocal(UT_KEY(OS_pread), (uint8 *)buffer, nbytes);
+        if (CopySize > 0)
+        {
+            status = CopySize;
+        }
+        else
+        {
+            memset(buffer, 0, nbytes);
+            status = nbytes;
+        }
+    }
+    else if (status > 0)
+    {
+        memset(buffer, 0, status);
+    }
+
+    return status;
+}
+
+int32 OS_pwrite(int32 filedes, void *buffer, uint32 nbytes, uint64 offset)
+{
+    int32 status;
+    uint32 CopySize;
+
+    status = UT_DEFAULT_IMPL_RC(OS_pwrite, 0x7FFFFFFF);
+
+    if (status == 0x7FFFFFFF)
+    {
+        CopySize = UT_Stub_CopyFromLocal(UT_KEY(OS_pwrite), (const uint8 *)buffer, nbytes);
+        if (CopySize > 0)
+        {
+            status = CopySize;
+        }
+        else
+        {
+            status = nbytes;
+        }
+    }
+
+    return status;
+}
+
+int32 OS_readv(int32 filedes, const os_iovec_t *iov, uint32 iovcnt)
+{
+    int32 status;
+    uint32 i;
+
+    status = UT_DEFAULT_IMPL_RC(OS_readv, 0x7FFFFFFF);
+
+    /* by default pretend every segment was transferred in full */
+    if (status == 0x7FFFFFFF)
+    {
+        status = 0;
+        for (i = 0; i < iovcnt; ++i)
+        {
+            status += iov[i].length;
+        }
+    }
+
+    return status;
+}
+
+int32 OS_writev(int32 filedes, const os_iovec_t *iov, uint32 iovcnt)
+{
+    int32 status;
+    uint32 i;
+
+    status = UT_DEFAULT_IMPL_RC(OS_writev, 0x7FFFFFFF);
+
+    /* by default pretend every segment was transferred in full */
+    if (status == 0x7FFFFFFF)
+    {
+        status = 0;
+        for (i = 0; i < iovcnt; ++i)
+        {
+            status += iov[i].length;
+        }
+    }
+
+    return status;
+}
+
+int32 OS_preadv(int32 filedes, const os_iovec_t *iov, uint32 iovcnt, uint64 offset)
+{
+    int32 status;
+    uint32 i;
+
+    status = UT_DEFAULT_IMPL_RC(OS_preadv, 0x7FFFFFFF);
+
+    /* by default pretend every segment was transferred in full */
+    if (status == 0x7FFFFFFF)
+    {
+        status = 0;
+        for (i = 0; i < iovcnt; ++i)
+        {
+            status += iov[i].length;
+        }
+    }
+
+    return status;
+}
+
+int32 OS_pwritev(int32 filedes, const os_iovec_t *iov, uint32 iovcnt, uint64 offset)
+{
+    int32 status;
+    uint32 i;
+
+    status = UT_DEFAULT_IMPL_RC(OS_pwritev, 0x7FFFFFFF);
+
+    /* by default pretend every segment was transferred in full */
+    if (status == 0x7FFFFFFF)
+    {
+        status = 0;
+        for (i = 0; i < iovcnt; ++i)
+        {
+            status += iov[i].length;
+        }
+    }
+
+    return status;
+}
+
+int32 OS_FileMap(int32 filedes, uint64 offset, uint32 length, uint32 access, void **addr)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_FileMap);
+
+    if (status == OS_SUCCESS &&
+        UT_Stub_CopyToLocal(UT_KEY(OS_FileMap), (uint8 *)addr, sizeof(*addr)) < sizeof(*addr))
+    {
+        *addr = NULL;
+    }
+
+    return status;
+}
+
+int32 OS_FileUnmap(void *addr)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_FileUnmap);
+
+    return status;
+}
+
+int32 OS_FileSync(void *addr)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_FileSync);
+
+    return status;
+}
+
+int32 OS_AsyncQueueCreate(uint32 *queue_id, uint32 depth, uint32 flags)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_AsyncQueueCreate);
+
+    if (status == OS_SUCCESS)
+    {
+        *queue_id = 0;
+    }
+    else
+    {
+        *queue_id = 0xDEADBEEFU;
+    }
+
+    return status;
+}
+
+int32 OS_AsyncQueueDelete(uint32 queue_id)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_AsyncQueueDelete);
+
+    return status;
+}
+
+int32 OS_AsyncRead(uint32 queue_id, int32 filedes, void *buffer, uint32 nbytes,
+                   uint64 offset, void *user_arg)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_AsyncRead);
+
+    return status;
+}
+
+int32 OS_AsyncWrite(uint32 queue_id, int32 filedes, void *buffer, uint32 nbytes,
+                    uint64 offset, void *user_arg)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_AsyncWrite);
+
+    return status;
+}
+
+int32 OS_AsyncWait(uint32 queue_id, os_async_completion_t *completions, uint32 max_count,
+                   int32 msecs)
+{
+    int32 status;
+    uint32 CopySize;
+
+    status = UT_DEFAULT_IMPL(OS_AsyncWait);
+
+    /* the test code may register completions to return, otherwise there are none */
+    if (status == OS_SUCCESS)
+    {
+        CopySize = UT_Stub_CopyToLocal(UT_KEY(OS_AsyncWait), (uint8 *)completions,
+                                       max_count * sizeof(*completions));
+        status = CopySize / sizeof(*completions);
+        if (status == 0)
+        {
+            status = OS_ERROR_TIMEOUT;
+        }
+    }
+
+    return status;
+}
+
+int32 OS_StreamOpen(uint32 *stream_id, int32 filedes, uint32 buffer_size,
+                    uint32 flush_size, uint32 flush_msec)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_StreamOpen);
+
+    if (status == OS_SUCCESS)
+    {
+        *stream_id = 0;
+    }
+    else
+    {
+        *stream_id = 0xDEADBEEFU;
+    }
+
+    return status;
+}
+
+int32 OS_StreamWrite(uint32 stream_id, const void *buffer, uint32 nbytes)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL_RC(OS_StreamWrite, 0x7FFFFFFF);
+
+    /* by default pretend all the data was taken */
+    if (status == 0x7FFFFFFF)
+    {
+        status = nbytes;
+    }
+
+    return status;
+}
+
+int32 OS_StreamFlush(uint32 stream_id)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_StreamFlush);
+
+    return status;
+}
+
+int32 OS_StreamFlushAll(void)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_StreamFlushAll);
+
+    return status;
+}
+
+int32 OS_StreamClose(uint32 stream_id)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_StreamClose);
+
+    return status;
+}
+
+int32 OS_StreamGetInfo(uint32 stream_id, os_stream_prop_t *stream_prop)
+{
+    int32 status;
+    uint32 CopySize;
+
+    status = UT_DEFAULT_IMPL(OS_StreamGetInfo);
+
+    /* the test code may register the state to return, otherwise it is all zero */
+    if (status == OS_SUCCESS)
+    {
+        CopySize = UT_Stub_CopyToLocal(UT_KEY(OS_StreamGetInfo), (uint8 *)stream_prop,
+                                       sizeof(*stream_prop));
+        if (CopySize < sizeof(*stream_prop))
+        {
+            memset(stream_prop, 0, sizeof(*stream_prop));
+        }
+    }
+
+    return status;
+}
+
+int32 OS_DirReadBatch(os_dirp_t directory, os_dirent_stat_t *entries, uint32 max_entries)
+{
+    int32 status;
+    uint32 CopySize;
+
+    status = UT_DEFAULT_IMPL(OS_DirReadBatch);
+
+    if (status == OS_SUCCESS)
+    {
+        CopySize = UT_Stub_CopyToLocal(UT_KEY(OS_DirReadBatch), (uint8 *)entries,
+                                       max_entries * sizeof(*entries));
+        status = CopySize / sizeof(*entries);
+    }
+
+    return status;
+}
+
+int32 OS_DirWalk(const char *path, OS_DirWalkCallback_t callback, void *callback_arg, uint32 flags)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_DirWalk);
+
+    return status;
+}
+
 int32 OS_remove (const char *path)
 {
     int32 Status;